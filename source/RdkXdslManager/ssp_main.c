@@ -56,6 +56,7 @@
 #include "ssp_global.h"
 #include "stdlib.h"
 #include "ccsp_dm_api.h"
+#include "xdsl_hal_perf.h"
 
 #define DEBUG_INI_NAME "/etc/debug.ini"
 
@@ -212,7 +213,7 @@ void sig_handler(int sig)
     	CcspTraceInfo(("SIGUSR1 received!\n"));
     }
     else if ( sig == SIGUSR2 ) {
-    	CcspTraceInfo(("SIGUSR2 received!\n"));
+    	XdslHalPerfRequestDump();
     }
     else if ( sig == SIGCHLD ) {
     	signal(SIGCHLD, sig_handler); /* reset it to this function */
@@ -305,6 +306,7 @@ int main(int argc, char* argv[])
 #ifdef INCLUDE_BREAKPAD
     breakpad_ExceptionHandler();
     signal(SIGALRM, sig_handler);
+    signal(SIGUSR2, sig_handler);
 #else
     signal(SIGTERM, sig_handler);
     signal(SIGINT, sig_handler);
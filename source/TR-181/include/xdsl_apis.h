@@ -22,6 +22,10 @@
 
 #include "cosa_apis.h"
 #include "xdsl_manager.h"
+#include "xdsl_hal_perf.h"
+#include "xdsl_bringup.h"
+#include "xdsl_pm_history.h"
+#include "xdsl_tca.h"
 
 /* * Telemetry Markers */
 #define XDSL_MARKER_LINE_CFG_CHNG           "RDKB_XDSL_LINE_CFG_CHANGED"
@@ -32,6 +36,11 @@
 
 #define XDSL_STANDARD_USED_STR_MAX          64
 
+/* Line parameters set and waiting for Line_Commit */
+#define XDSL_LINE_CFG_ENABLE                0x01
+#define XDSL_LINE_CFG_DATA_GATHERING        0x02
+#define XDSL_LINE_CFG_UPSTREAM              0x04
+
 
 
 /* Collection */
@@ -148,37 +157,55 @@ _DML_XDSL_LINE_STATS
     DML_XDSL_LINE_STATS_TIME         stLastShowTime;
     DML_XDSL_LINE_STATS_CURRENTDAY   stCurrentDay;
     DML_XDSL_LINE_STATS_QUARTERHOUR  stQuarterHour;
+    UINT                            X_RDK_LifetimeSuccessfulRetrains;
 }
 DML_XDSL_LINE_STATS, *PDML_XDSL_LINE_STATS;
 
+/* X_RDK_PMHistory, completed intervals of a line taken when the table is read */
+typedef  struct
+_DML_XDSL_X_RDK_PM_HISTORY
+{
+    ULONG                   ulTotalNoofQuarterHours;
+    ULONG                   ulQuarterHourDepth;     /* history depth the quarter hours were taken at */
+    DML_XDSL_PM_INTERVAL    stQuarterHour[XDSL_PM_HISTORY_QUARTER_HOURS];
+    ULONG                   ulTotalNoofDays;
+    ULONG                   ulDayDepth;
+    DML_XDSL_PM_INTERVAL    stDay[XDSL_PM_HISTORY_DAYS];
+}
+DML_XDSL_X_RDK_PM_HISTORY, *PDML_XDSL_X_RDK_PM_HISTORY;
+
 typedef  struct
 _DML_XDSL_LINE
-{	
-    BOOL                              Enable;
-    BOOL                              EnableDataGathering;
-    ULONG                             ulInstanceNumber;
-    CHAR                              LowerLayers[128];
-    CHAR                              Alias[64];
-    CHAR                              Name[64];
-    UINT                              LastChange;
-    CHAR                              StandardsSupported[512];
-    CHAR                              XTSE[17];
-    CHAR                              AllowedProfiles[256];
-    CHAR                              StandardUsed[XDSL_STANDARD_USED_STR_MAX];
-    CHAR                              XTSUsed[17];
-    CHAR                              FirmwareVersion[64];
+{
+    /*
+     * Hot: refreshed on every poll and read by most consumers, kept together
+     * at the head of the structure so a poll touches the first cache lines only
+     */
     DML_XDSL_IF_STATUS                Status;
     DML_XDSL_LINK_STATUS              LinkStatus;
-    BOOL                              Upstream;
-    CHAR                              CurrentProfile[64];
+    DML_XDSL_LINE_WAN_STATUS          WanStatus;
     XDSL_LINE_POWER_MGMT_ENUM         PowerManagementState;
+    ULONG                             ulInstanceNumber;
+    UINT                              LastChange;
     UINT                              UpstreamMaxBitRate;
     UINT                              DownstreamMaxBitRate;
+    INT                               UpstreamAttenuation;
+    INT                               DownstreamAttenuation;
+    INT                               UpstreamNoiseMargin;
+    INT                               DownstreamNoiseMargin;
+    INT                               UpstreamPower;
+    INT                               DownstreamPower;
+    BOOL                              Enable;
+    BOOL                              EnableDataGathering;
+    BOOL                              Upstream;
+    ULONG                             ulPendingCfg;     /* XDSL_LINE_CFG_* differing from the applied value */
+
+    /* Per-showtime scalars, rewritten on link up only */
+    XDSL_LINE_ENCODING_ENUM           LineEncoding;
     UINT                              SuccessFailureCause;
-    DML_XDSL_LINE_WAN_STATUS          WanStatus;
+    INT                               LineNumber;
+    UINT                              UPBOKLE;
     UINT                              UPBOKLER;
-    CHAR                              UPBOKLEPb[256];
-    CHAR                              UPBOKLERPb[256];
     INT                               RXTHRSHds;
     UINT                              ACTRAMODEds;
     UINT                              ACTRAMODEus;
@@ -188,44 +215,113 @@ _DML_XDSL_LINE
     UINT                              SNRMROCus;
     UINT                              LastStateTransmittedDownstream;
     UINT                              LastStateTransmittedUpstream;
-    UINT                              UPBOKLE;
-    CHAR                              MREFPSDds[145];
-    CHAR                              MREFPSDus[145];
     UINT                              LIMITMASK;
     UINT                              US0MASK;
-    INT                               UpstreamAttenuation;
-    INT                               UpstreamNoiseMargin;
-    INT                               UpstreamPower;
-    XDSL_LINE_ENCODING_ENUM           LineEncoding;
     INT                               TRELLISds;
     INT                               TRELLISus;
     UINT                              ACTSNRMODEds;
     UINT                              ACTSNRMODEus;
-    CHAR                              VirtualNoisePSDds[97];
-    CHAR                              VirtualNoisePSDus[49];
     UINT                              ACTUALCE;
-    INT                               LineNumber;
-    CHAR                              SNRMpbus[24];
-    CHAR                              SNRMpbds[24];
     ULONG                             INMIATOds;
     ULONG                             INMIATSds;
     ULONG                             INMCCds;
     INT                               INMINPEQMODEds;
-    INT                               DownstreamAttenuation;
-    INT                               DownstreamNoiseMargin;
-    INT                               DownstreamPower;
-    CHAR                              XTURVendor[9];
-    CHAR                              XTURCountry[5];
     UINT                              XTURANSIStd;
     UINT                              XTURANSIRev;
-    CHAR                              XTUCVendor[9];
-    CHAR                              XTUCCountry[5];
     UINT                              XTUCANSIStd;
     UINT                              XTUCANSIRev;
+
+    /* Counters, refreshed on every poll */
     DML_XDSL_LINE_STATS                stLineStats;
+
+    /* Short strings, live or per showtime */
+    CHAR                              SNRMpbus[24];
+    CHAR                              SNRMpbds[24];
+    CHAR                              StandardUsed[XDSL_STANDARD_USED_STR_MAX];
+    CHAR                              CurrentProfile[64];
+    CHAR                              XTSUsed[17];
+    CHAR                              XTUCVendor[9];
+    CHAR                              XTUCCountry[5];
+
+    /* Cold: static or rarely read strings, filled at init or on link up */
+    CHAR                              XTSE[17];
+    CHAR                              XTURVendor[9];
+    CHAR                              XTURCountry[5];
+    CHAR                              FirmwareVersion[64];
+    CHAR                              Alias[64];
+    CHAR                              Name[64];
+    CHAR                              LowerLayers[128];
+    CHAR                              AllowedProfiles[256];
+    CHAR                              UPBOKLEPb[256];
+    CHAR                              UPBOKLERPb[256];
+    CHAR                              MREFPSDds[145];
+    CHAR                              MREFPSDus[145];
+    CHAR                              VirtualNoisePSDds[97];
+    CHAR                              VirtualNoisePSDus[49];
+    CHAR                              StandardsSupported[512];
+
+    /* Allocated on the first read of X_RDK_PMHistory */
+    PDML_XDSL_X_RDK_PM_HISTORY        pstPmHistory;
 }
 DML_XDSL_LINE, *PDML_XDSL_LINE;              
 
+/*
+ * Live line state and the negotiated mode, for readers that only look at
+ * showtime, rates and margins. Filled by xdsl_hal_dslGetLineLive() without
+ * staging a whole DML_XDSL_LINE.
+ */
+typedef  struct
+_DML_XDSL_LINE_LIVE
+{
+    DML_XDSL_IF_STATUS                Status;
+    DML_XDSL_LINK_STATUS              LinkStatus;
+    XDSL_LINE_POWER_MGMT_ENUM         PowerManagementState;
+    UINT                              LastChange;
+    UINT                              UpstreamMaxBitRate;
+    UINT                              DownstreamMaxBitRate;
+    INT                               UpstreamAttenuation;
+    INT                               DownstreamAttenuation;
+    INT                               UpstreamNoiseMargin;
+    INT                               DownstreamNoiseMargin;
+    INT                               UpstreamPower;
+    INT                               DownstreamPower;
+    CHAR                              StandardUsed[XDSL_STANDARD_USED_STR_MAX];
+    CHAR                              CurrentProfile[64];
+}
+DML_XDSL_LINE_LIVE, *PDML_XDSL_LINE_LIVE;
+
+/* Family of StandardUsed, resolved when the standard is read after training */
+typedef enum
+_DML_XDSL_STANDARD_FAMILY
+{
+    XDSL_STANDARD_FAMILY_UNKNOWN = 0,
+    XDSL_STANDARD_FAMILY_ADSL,
+    XDSL_STANDARD_FAMILY_VDSL,
+    XDSL_STANDARD_FAMILY_GFAST
+} DML_XDSL_STANDARD_FAMILY;
+
+typedef enum
+_DML_XDSL_STANDARD_ANNEX
+{
+    XDSL_STANDARD_ANNEX_NONE = 0,
+    XDSL_STANDARD_ANNEX_A,
+    XDSL_STANDARD_ANNEX_B,
+    XDSL_STANDARD_ANNEX_C,
+    XDSL_STANDARD_ANNEX_I,
+    XDSL_STANDARD_ANNEX_J,
+    XDSL_STANDARD_ANNEX_L,
+    XDSL_STANDARD_ANNEX_M
+} DML_XDSL_STANDARD_ANNEX;
+
+/* Router region as reported by the platform HAL, unknown where the platform has none */
+typedef enum
+_DML_XDSL_ROUTER_REGION
+{
+    XDSL_ROUTER_REGION_UNKNOWN = 0,
+    XDSL_ROUTER_REGION_GB,
+    XDSL_ROUTER_REGION_OTHER
+} DML_XDSL_ROUTER_REGION;
+
 typedef  struct
 _DML_XDSL_LINE_GLOBALINFO
 {
@@ -233,9 +329,13 @@ _DML_XDSL_LINE_GLOBALINFO
     CHAR                              Name[64];
     CHAR                              LowerLayers[128];
     CHAR                              StandardUsed[XDSL_STANDARD_USED_STR_MAX];
+    DML_XDSL_STANDARD_FAMILY           StandardFamily;
+    DML_XDSL_STANDARD_ANNEX            StandardAnnex;
+    DML_XDSL_ROUTER_REGION             RouterRegion;
     DML_XDSL_LINE_WAN_STATUS           WanStatus;
     DML_XDSL_LINK_STATUS               LinkStatus;
     pthread_t                          iface_thread_id;
+    UINT                               PendingInfoTiers;
 }
 DML_XDSL_LINE_GLOBALINFO, *PDML_XDSL_LINE_GLOBALINFO;
 
@@ -320,33 +420,58 @@ DML_XDSL_CHANNEL_STATS, *PDML_XDSL_CHANNEL_STATS;
 typedef  struct
 _DML_XDSL_CHANNEL
 {
-    BOOL                              Enable;
+    /* Hot: rates and framing, read together on every poll */
+    DML_XDSL_IF_STATUS                 Status;
     ULONG                             ulInstanceNumber;
     INT                               LineIndex;
     UINT                              LastChange;
-    CHAR                              LowerLayers[1024];
-    CHAR                              Alias[64];
-    CHAR                              Name[64];
-    DML_XDSL_IF_STATUS                 Status;
-    CHAR                              LinkEncapsulationSupported[256];
-    CHAR                              LinkEncapsulationUsed[32];
+    UINT                              UpstreamCurrRate;
+    UINT                              DownstreamCurrRate;
+    UINT                              ACTNDR;
+    INT                               ACTINP;
+    UINT                              ACTINPREIN;
+    UINT                              ActualInterleavingDelay;
     UINT                              LPATH;
     UINT                              INTLVDEPTH;
     INT                               INTLVBLOCK;
-    UINT                              ActualInterleavingDelay;
-    INT                               ACTINP;
-    BOOL                              INPREPORT;
     INT                               NFEC;
     INT                               RFEC;
     INT                               LSYMB;
-    UINT                              UpstreamCurrRate;
-    UINT                              DownstreamCurrRate;
-    UINT                              ACTNDR;
-    UINT                              ACTINPREIN;
+    BOOL                              Enable;
+    BOOL                              INPREPORT;
+
+    /* Counters, refreshed on every poll */
     DML_XDSL_CHANNEL_STATS             stChannelStats;
+
+    /* Cold: static strings, filled at init or on link up */
+    CHAR                              LinkEncapsulationUsed[32];
+    CHAR                              Alias[64];
+    CHAR                              Name[64];
+    CHAR                              LinkEncapsulationSupported[256];
+    CHAR                              LowerLayers[1024];
 }
 DML_XDSL_CHANNEL, *PDML_XDSL_CHANNEL;
 
+/*
+ * Channel table snapshot, one per line. The channel configuration only changes
+ * when the line retrains, so it is re-read from the HAL when the line retrain
+ * counter or the showtime start moves. Counters are refreshed at most once per
+ * XDSL_CHANNEL_SNAPSHOT_TIMEOUT_MS.
+ */
+#define XDSL_CHANNEL_SNAPSHOT_TIMEOUT_MS        1000
+#define XDSL_CHANNEL_SHOWTIME_JITTER_SEC        2
+
+typedef  struct
+_DML_XDSL_CHANNEL_SNAPSHOT
+{
+    BOOL                              bValid;
+    ULONG                             ulVersion;
+    UINT                              LinkRetrain;
+    ULONG                             ShowtimeEpoch;
+    ULONG                             ulTimestamp;
+}
+DML_XDSL_CHANNEL_SNAPSHOT, *PDML_XDSL_CHANNEL_SNAPSHOT;
+
 /* * Diagnostics */
 
 typedef enum
@@ -487,6 +612,111 @@ _DML_XDSL_X_RDK_NLNM
 }
 DML_XDSL_X_RDK_NLNM, *PDML_XDSL_X_RDK_NLNM;
 
+/* X_RDK_Perf */
+
+typedef  struct
+_DML_XDSL_X_RDK_PERF
+{
+    BOOL                Enable;
+    BOOL                ByteCounting;
+    ULONG               ulTotalNoofHalCalls;
+    DML_XDSL_HAL_PERF   stHalCall[XDSL_HAL_PERF_MAX];
+}
+DML_XDSL_X_RDK_PERF, *PDML_XDSL_X_RDK_PERF;
+
+/* X_RDK_BringUp */
+
+typedef  struct
+_DML_XDSL_X_RDK_BRINGUP
+{
+    ULONG                   ulTotalNoofPhases;
+    DML_XDSL_BRINGUP_PHASE  stPhase[XDSL_BRINGUP_PHASE_MAX];
+    ULONG                   ulTotalNoofTraces;
+    DML_XDSL_BRINGUP_TRACE  stTrace[XDSL_BRINGUP_TRACE_MAX];
+}
+DML_XDSL_X_RDK_BRINGUP, *PDML_XDSL_X_RDK_BRINGUP;
+
+/* X_RDK_FlapDamping */
+
+typedef  struct
+_DML_XDSL_X_RDK_FLAP_DAMPING
+{
+    BOOL                Enable;
+    ULONG               HalfLife;
+    ULONG               SuppressThreshold;
+    ULONG               ReuseThreshold;
+    ULONG               MaxSuppressTime;
+    ULONG               Flaps;
+    ULONG               SuppressedEvents;
+    ULONG               Suppressions;
+    ULONG               Penalty;
+    ULONG               SuppressedLines;
+    BOOL                bConfigChanged;
+}
+DML_XDSL_X_RDK_FLAP_DAMPING, *PDML_XDSL_X_RDK_FLAP_DAMPING;
+
+/* X_RDK_TrainingHint */
+
+typedef  struct
+_DML_XDSL_X_RDK_TRAINING_HINT
+{
+    BOOL                Enable;
+    ULONG               FallbackTimeout;
+    BOOL                Active;
+    CHAR                StandardUsed[XDSL_STANDARD_USED_STR_MAX];
+    CHAR                CurrentProfile[16];
+    ULONG               UpstreamRate;
+    ULONG               DownstreamRate;
+    ULONG               Fallbacks;
+    BOOL                bConfigChanged;
+}
+DML_XDSL_X_RDK_TRAINING_HINT, *PDML_XDSL_X_RDK_TRAINING_HINT;
+
+/* X_RDK_Shaper */
+
+typedef  struct
+_DML_XDSL_X_RDK_SHAPER
+{
+    BOOL                Enable;
+    ULONG               Percent;
+    ULONG               PacketSize;
+    ULONG               ATMOverhead;
+    ULONG               PTMOverhead;
+    ULONG               CheckInterval;
+    ULONG               EgressShaper;
+    ULONG               IngressShaper;
+    CHAR                Encapsulation[8];
+    ULONG               UpstreamSyncRate;
+    ULONG               DownstreamSyncRate;
+    ULONG               EgressRate;
+    ULONG               IngressRate;
+    ULONG               Updates;
+    BOOL                bConfigChanged;
+}
+DML_XDSL_X_RDK_SHAPER, *PDML_XDSL_X_RDK_SHAPER;
+
+/* X_RDK_TCA */
+
+typedef  struct
+_DML_XDSL_TCA_PROFILE
+{
+    BOOL                Enable;
+    CHAR                Counter[XDSL_TCA_NAME_LENGTH];
+    CHAR                Interval[XDSL_TCA_NAME_LENGTH];
+    INT                 Threshold;
+    ULONG               Hysteresis;
+    BOOL                Raised;
+    BOOL                bConfigChanged;
+}
+DML_XDSL_TCA_PROFILE, *PDML_XDSL_TCA_PROFILE;
+
+typedef  struct
+_DML_XDSL_X_RDK_TCA
+{
+    DML_XDSL_TCA_PROFILE    stProfile[XDSL_TCA_MAX_PROFILES];
+}
+DML_XDSL_X_RDK_TCA, *PDML_XDSL_X_RDK_TCA;
+
 /*
     Standard function declaration 
 */
@@ -513,12 +743,10 @@ INT DmlXdslGetTotalNoofLines( VOID );
 
 ANSC_STATUS DmlXdslGetLineCfg( INT LineIndex, PDML_XDSL_LINE pstLineInfo );
 
-ANSC_STATUS DmlXdslLineSetEnable( INT LineIndex, BOOL Enable );
-
-ANSC_STATUS DmlXdslLineSetDataGatheringEnable( INT LineIndex, BOOL Enable );
-
 ANSC_STATUS DmlXdslLineSetUpstream( INT LineIndex, BOOL Upstream );
 
+ANSC_STATUS DmlXdslLineApplyConfig( INT LineIndex, PDML_XDSL_LINE pstLineInfo, ULONG ulChanged );
+
 ANSC_STATUS DmlXdslLineGetWanStatus( INT LineIndex, DML_XDSL_LINE_WAN_STATUS *wan_state );
 
 ANSC_STATUS DmlXdslLineSetWanStatus( INT LineIndex, DML_XDSL_LINE_WAN_STATUS wan_state );
@@ -527,9 +755,11 @@ ANSC_STATUS DmlXdslLineGetLinkStatus( INT LineIndex, DML_XDSL_LINK_STATUS *LinkS
 
 ANSC_STATUS DmlXdslLineGetIndexFromIfName( char *ifname, INT *LineIndex );
 
-ANSC_STATUS DmlXdslDeleteXTMLink( char *ifname );
+ANSC_STATUS DmlXdslDeleteXTMLink( char *ifname, ULONG *pulTicket );
 
-ANSC_STATUS DmlXdslCreateXTMLink( char *ifname );
+ANSC_STATUS DmlXdslCreateXTMLink( char *ifname, ULONG *pulTicket );
+
+BOOL DmlXdslIsXTMJobDone( char *ifname, ULONG ulTicket, ANSC_STATUS *pStatus );
 
 ANSC_STATUS DmlXdslLine_GetStandardUsedByGivenIfName(char* ifname, char* StandardUsed);
 
@@ -547,10 +777,20 @@ ANSC_STATUS DmlXdslSetWanLinkStatusForWanManager( char *ifname, char *WanStatus
 
 ANSC_STATUS DmlXdslSetPhyStatusForWanManager( char *ifname, char *PhyStatus );
 
+ANSC_STATUS DmlXdslWarmRestartSave( char *ifname, INT iSmState );
+
+ANSC_STATUS DmlXdslWarmRestartResume( char *ifname, INT iSmState );
+
+VOID DmlXdslWarmRestartClear( char *ifname );
+
 INT DmlXdslGetTotalNoofChannels( INT LineIndex );
 
 ANSC_STATUS DmlXdslGetChannelCfg( INT LineIndex, INT ChannelIndex, PDML_XDSL_CHANNEL pstChannelInfo );
 
+BOOL DmlXdslChannelIsSnapshotStale( ANSC_HANDLE hContext );
+
+ANSC_STATUS DmlXdslChannelRefreshSnapshot( ANSC_HANDLE hContext );
+
 ANSC_STATUS DmlXdslChannelSetEnable( INT LineIndex, INT ChannelIndex, BOOL Enable );
 
 ANSC_STATUS DmlGetXdslStandardUsed( char *standard_used);
@@ -574,4 +814,100 @@ DmlXdslXRdkNlmInit
     );
 
 ANSC_STATUS DmlXdslGetXRDKNlm( PDML_XDSL_X_RDK_NLNM pstXRdkNlm );
+
+ANSC_STATUS
+DmlXdslPerfInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+ANSC_STATUS DmlXdslGetHalPerf( INT HalCallIndex, PDML_XDSL_HAL_PERF pstHalPerf );
+
+ANSC_STATUS DmlXdslSetHalPerfEnable( BOOL Enable );
+
+ANSC_STATUS DmlXdslSetHalPerfByteCounting( BOOL Enable );
+
+ANSC_STATUS DmlXdslResetHalPerf( VOID );
+
+ANSC_STATUS
+DmlXdslBringUpInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+ANSC_STATUS DmlXdslGetBringUpPhase( INT PhaseIndex, PDML_XDSL_BRINGUP_PHASE pstPhase );
+
+ANSC_STATUS DmlXdslGetBringUpTraces( PDML_XDSL_X_RDK_BRINGUP pstBringUp );
+
+ANSC_STATUS DmlXdslResetBringUp( VOID );
+
+ANSC_STATUS
+DmlXdslFlapDampingInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+ANSC_STATUS DmlXdslGetFlapDampingConfig( PDML_XDSL_X_RDK_FLAP_DAMPING pstFlapDamping );
+
+ANSC_STATUS DmlXdslSetFlapDampingConfig( PDML_XDSL_X_RDK_FLAP_DAMPING pstFlapDamping );
+
+ANSC_STATUS DmlXdslGetFlapDampingStats( PDML_XDSL_X_RDK_FLAP_DAMPING pstFlapDamping );
+
+ANSC_STATUS DmlXdslResetFlapDampingStats( VOID );
+
+ANSC_STATUS
+DmlXdslTrainHintInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+VOID DmlXdslTrainHintTraining( char *ifname );
+
+BOOL DmlXdslTrainHintTrained( char *ifname );
+
+VOID DmlXdslTrainHintLineDown( char *ifname );
+
+ANSC_STATUS DmlXdslGetTrainingHintConfig( PDML_XDSL_X_RDK_TRAINING_HINT pstTrainingHint );
+
+ANSC_STATUS DmlXdslSetTrainingHintConfig( PDML_XDSL_X_RDK_TRAINING_HINT pstTrainingHint );
+
+ANSC_STATUS DmlXdslGetTrainingHintStatus( PDML_XDSL_X_RDK_TRAINING_HINT pstTrainingHint );
+
+ANSC_STATUS DmlXdslForgetTrainingHint( VOID );
+
+ANSC_STATUS
+DmlXdslShaperInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+VOID DmlXdslShaperLinkUp( char *ifname );
+
+VOID DmlXdslShaperLinkDown( char *ifname );
+
+ANSC_STATUS DmlXdslGetShaperConfig( PDML_XDSL_X_RDK_SHAPER pstShaper );
+
+ANSC_STATUS DmlXdslSetShaperConfig( PDML_XDSL_X_RDK_SHAPER pstShaper );
+
+ANSC_STATUS DmlXdslGetShaperRates( PDML_XDSL_X_RDK_SHAPER pstShaper );
+
+ANSC_STATUS
+DmlXdslPmHistoryInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+ANSC_STATUS DmlXdslGetPmHistory( INT LineIndex, PDML_XDSL_X_RDK_PM_HISTORY pstPmHistory );
+
+BOOL DmlXdslIsPmHistoryStale( INT LineIndex, XDSL_PM_INTERVAL interval, PDML_XDSL_X_RDK_PM_HISTORY pstPmHistory );
+
+ANSC_STATUS
+DmlXdslTcaInit
+    (
+        PANSC_HANDLE                phContext
+    );
+
+ANSC_STATUS DmlXdslGetTcaProfile( INT ProfileIndex, PDML_XDSL_TCA_PROFILE pstProfile );
+
+ANSC_STATUS DmlXdslSetTcaProfile( INT ProfileIndex, PDML_XDSL_TCA_PROFILE pstProfile );
 #endif /* _XDSL_APIS_H */
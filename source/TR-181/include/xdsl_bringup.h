@@ -0,0 +1,89 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_BRINGUP_H
+#define  _XDSL_BRINGUP_H
+
+#include <stddef.h>
+#include "cosa_apis.h"
+
+/*
+ * Phase duration histogram buckets are log2 of the duration in milliseconds:
+ * bucket 0 counts phases shorter than 2ms, bucket n phases in [2^n, 2^(n+1))ms
+ * and the last bucket everything from 2^(XDSL_BRINGUP_BUCKETS-1)ms upwards.
+ */
+#define XDSL_BRINGUP_BUCKETS                20
+
+/* Number of most recent bring-up attempts kept */
+#define XDSL_BRINGUP_TRACE_MAX              8
+
+/* Phases of a link bring-up */
+typedef enum
+_XDSL_BRINGUP_PHASE
+{
+    XDSL_BRINGUP_PHASE_TRAINING = 0,    /* training seen -> line up */
+    XDSL_BRINGUP_PHASE_XTM_CONFIG,      /* line up -> WAN status up */
+    XDSL_BRINGUP_PHASE_WAN_NOTIFY,      /* WAN Manager link status update */
+    XDSL_BRINGUP_PHASE_TOTAL,           /* start of the attempt -> WAN link up */
+    XDSL_BRINGUP_PHASE_TRAINING_HINTED, /* training offered the last good configuration */
+    XDSL_BRINGUP_PHASE_TRAINING_FULL,   /* training offered the full policy */
+    XDSL_BRINGUP_PHASE_MAX
+} XDSL_BRINGUP_PHASE;
+
+/* Snapshot of the duration counters of one phase */
+typedef  struct
+_DML_XDSL_BRINGUP_PHASE
+{
+    CHAR                Name[32];
+    ULONG               Count;
+    ULONGLONG           TotalTime;
+    ULONG               MaxTime;
+    ULONG               Histogram[XDSL_BRINGUP_BUCKETS];
+}
+DML_XDSL_BRINGUP_PHASE, *PDML_XDSL_BRINGUP_PHASE;
+
+/* One bring-up attempt, durations in milliseconds */
+typedef  struct
+_DML_XDSL_BRINGUP_TRACE
+{
+    CHAR                Interface[64];
+    ULONG               StartTime;          /* seconds since boot */
+    ULONG               TrainTime;
+    ULONG               XtmConfigTime;
+    ULONG               WanNotifyTime;
+    ULONG               TotalTime;
+    CHAR                Result[32];         /* "Up" or the state the attempt was abandoned in */
+}
+DML_XDSL_BRINGUP_TRACE, *PDML_XDSL_BRINGUP_TRACE;
+
+ULONGLONG XdslBringUpGetTimeMs( VOID );
+
+VOID XdslBringUpRecordPhase( XDSL_BRINGUP_PHASE phase, ULONG ulTimeMs );
+
+VOID XdslBringUpRecordTrace( PDML_XDSL_BRINGUP_TRACE pstTrace );
+
+ANSC_STATUS XdslBringUpGetPhaseStats( XDSL_BRINGUP_PHASE phase, PDML_XDSL_BRINGUP_PHASE pstPhase );
+
+ULONG XdslBringUpGetTraces( PDML_XDSL_BRINGUP_TRACE pstTraces, ULONG ulMax );
+
+INT XdslBringUpFormatHistogram( const ULONG *pHistogram, char *pBuffer, size_t bufferLen );
+
+VOID XdslBringUpReset( VOID );
+
+#endif /* _XDSL_BRINGUP_H */
@@ -0,0 +1,55 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_BUS_TXN_H
+#define  _XDSL_BUS_TXN_H
+
+#include "cosa_apis.h"
+#include "ssp_global.h"
+
+/* Maximum number of parameters written by one transaction */
+#define XDSL_BUS_TXN_MAX_PARAMS             8
+
+#define XDSL_BUS_TXN_PARAM_LENGTH           256
+
+/*
+ * Writes to one component gathered into a single setParameterValues with
+ * commit. Either every parameter is applied or none is.
+ */
+typedef  struct
+_XDSL_BUS_TXN
+{
+    const char          *pComponent;
+    const char          *pBus;
+    INT                 iCount;
+    BOOL                bOverflow;
+    CHAR                Name[XDSL_BUS_TXN_MAX_PARAMS][XDSL_BUS_TXN_PARAM_LENGTH];
+    CHAR                Value[XDSL_BUS_TXN_MAX_PARAMS][XDSL_BUS_TXN_PARAM_LENGTH];
+    enum dataType_e     Type[XDSL_BUS_TXN_MAX_PARAMS];
+}
+XDSL_BUS_TXN, *PXDSL_BUS_TXN;
+
+VOID XdslBusTxnBegin( PXDSL_BUS_TXN pstTxn, const char *pComponent, const char *pBus );
+
+ANSC_STATUS XdslBusTxnAddParam( PXDSL_BUS_TXN pstTxn, enum dataType_e type, const char *pValue, const char *pNameFormat, ... )
+    __attribute__ ((format (printf, 4, 5)));
+
+ANSC_STATUS XdslBusTxnCommit( PXDSL_BUS_TXN pstTxn );
+
+#endif /* _XDSL_BUS_TXN_H */
@@ -0,0 +1,74 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_EVENT_RING_H
+#define  _XDSL_EVENT_RING_H
+
+#include "xdsl_apis.h"
+
+/* Number of slots in the event ring, must be a power of two */
+#define XDSL_EVENT_RING_SIZE                64
+
+typedef enum
+_XDSL_EVENT_TYPE
+{
+    XDSL_EVENT_TYPE_WAN       = 1,
+} XDSL_EVENT_TYPE;
+
+/* One queued event. ulSequence is assigned by the ring on push. */
+typedef  struct
+_XDSL_EVENT
+{
+    XDSL_EVENT_TYPE                   EventType;
+    UINT                              ulSequence;
+    CHAR                              Name[64];
+    CHAR                              LowerLayers[128];
+    DML_XDSL_LINK_STATUS              LinkStatus;
+}
+XDSL_EVENT, *PXDSL_EVENT;
+
+typedef  struct
+_XDSL_EVENT_RING_STATS
+{
+    ULONG               Pushed;
+    ULONG               Dropped;
+    ULONG               Coalesced;
+    ULONG               Wakeups;
+}
+XDSL_EVENT_RING_STATS, *PXDSL_EVENT_RING_STATS;
+
+ANSC_STATUS XdslEventRingInit( VOID );
+
+ANSC_STATUS XdslEventRingPush( PXDSL_EVENT pstEvent );
+
+BOOL XdslEventRingPop( PXDSL_EVENT pstEvent );
+
+INT XdslEventRingGetFd( VOID );
+
+ANSC_STATUS XdslEventRingWait( VOID );
+
+BOOL XdslEventRingTakeOverflow( VOID );
+
+BOOL XdslEventRingHasPending( VOID );
+
+VOID XdslEventRingRecordCoalesced( ULONG ulCount );
+
+VOID XdslEventRingGetStats( PXDSL_EVENT_RING_STATS pstStats );
+
+#endif /* _XDSL_EVENT_RING_H */
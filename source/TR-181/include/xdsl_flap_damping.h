@@ -0,0 +1,96 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_FLAP_DAMPING_H
+#define  _XDSL_FLAP_DAMPING_H
+
+#include "xdsl_apis.h"
+
+/* Number of interfaces tracked by the damping engine */
+#define XDSL_FLAP_DAMPING_MAX_IFACES                4
+
+/* Penalty added each time a line drops out of showtime */
+#define XDSL_FLAP_DAMPING_PENALTY                   1000
+
+/* Defaults, overridden by PSM */
+#define XDSL_FLAP_DAMPING_DEFAULT_ENABLE            TRUE
+#define XDSL_FLAP_DAMPING_DEFAULT_HALF_LIFE         300     /* seconds */
+#define XDSL_FLAP_DAMPING_DEFAULT_SUPPRESS          3000
+#define XDSL_FLAP_DAMPING_DEFAULT_REUSE             1000
+#define XDSL_FLAP_DAMPING_DEFAULT_MAX_SUPPRESS_TIME 1800    /* seconds */
+
+/*
+ * Penalty-decay damping as used for BGP route flaps. Every flap adds
+ * XDSL_FLAP_DAMPING_PENALTY, the penalty halves every HalfLife seconds.
+ * Once it reaches SuppressThreshold the line is suppressed: the down is
+ * still delivered, later status changes are withheld until the penalty has
+ * decayed below ReuseThreshold or MaxSuppressTime has passed.
+ */
+typedef  struct
+_XDSL_FLAP_DAMPING_CONFIG
+{
+    BOOL                Enable;
+    ULONG               HalfLife;
+    ULONG               SuppressThreshold;
+    ULONG               ReuseThreshold;
+    ULONG               MaxSuppressTime;
+}
+XDSL_FLAP_DAMPING_CONFIG, *PXDSL_FLAP_DAMPING_CONFIG;
+
+typedef  struct
+_XDSL_FLAP_DAMPING_STATS
+{
+    ULONG               Flaps;              /* showtime drops seen from the HAL */
+    ULONG               SuppressedEvents;   /* status changes withheld */
+    ULONG               Suppressions;       /* times a line became suppressed */
+    ULONG               Penalty;            /* current penalty, highest of all lines */
+    ULONG               SuppressedLines;    /* lines suppressed right now */
+}
+XDSL_FLAP_DAMPING_STATS, *PXDSL_FLAP_DAMPING_STATS;
+
+/* Status to deliver for a line whose suppression just ended */
+typedef  struct
+_XDSL_FLAP_DAMPING_RELEASE
+{
+    CHAR                    Name[64];
+    DML_XDSL_LINK_STATUS    LinkStatus;
+}
+XDSL_FLAP_DAMPING_RELEASE, *PXDSL_FLAP_DAMPING_RELEASE;
+
+ANSC_STATUS XdslFlapDampingInit( PXDSL_FLAP_DAMPING_CONFIG pstConfig );
+
+ANSC_STATUS XdslFlapDampingSetConfig( PXDSL_FLAP_DAMPING_CONFIG pstConfig );
+
+VOID XdslFlapDampingGetConfig( PXDSL_FLAP_DAMPING_CONFIG pstConfig );
+
+/*
+ * Feeds a link status from the HAL. Returns FALSE when the change has to be
+ * withheld. pulNextCheckMs is set to the delay before XdslFlapDampingRelease()
+ * should run next, 0 when no line is suppressed.
+ */
+BOOL XdslFlapDampingApply( const char *ifname, DML_XDSL_LINK_STATUS enLinkStatus, ULONG *pulNextCheckMs );
+
+/* Ends suppression where due, returns the number of statuses to deliver */
+INT XdslFlapDampingRelease( PXDSL_FLAP_DAMPING_RELEASE pstReleased, INT iMax, ULONG *pulNextCheckMs );
+
+VOID XdslFlapDampingGetStats( PXDSL_FLAP_DAMPING_STATS pstStats );
+
+VOID XdslFlapDampingResetStats( VOID );
+
+#endif /* _XDSL_FLAP_DAMPING_H */
@@ -0,0 +1,109 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_HAL_PERF_H
+#define  _XDSL_HAL_PERF_H
+
+#include <stddef.h>
+#include "cosa_apis.h"
+
+/*
+ * Latency histogram buckets are log2 of the call duration in microseconds:
+ * bucket 0 counts calls shorter than 2us, bucket n calls in [2^n, 2^(n+1))us
+ * and the last bucket everything from 2^(XDSL_HAL_PERF_BUCKETS-1)us upwards.
+ */
+#define XDSL_HAL_PERF_BUCKETS               24
+
+#define XDSL_HAL_PERF_DUMP_FILE             "/tmp/xdsl_hal_perf.txt"
+
+/* HAL entry points that are instrumented */
+typedef enum
+_XDSL_HAL_PERF_ID
+{
+    XDSL_HAL_PERF_DSL_GET_LINE_ENABLE = 0,
+    XDSL_HAL_PERF_DSL_GET_STANDARD_USED,
+    XDSL_HAL_PERF_DSL_SET_LINE_ENABLE,
+    XDSL_HAL_PERF_DSL_SET_DATA_GATHERING,
+    XDSL_HAL_PERF_DSL_GET_LINE_INFO,
+    XDSL_HAL_PERF_DSL_GET_LINE_STATS,
+    XDSL_HAL_PERF_DSL_GET_CHANNEL_INFO,
+    XDSL_HAL_PERF_DSL_GET_CHANNEL_STATS,
+    XDSL_HAL_PERF_DSL_GET_NLM,
+    XDSL_HAL_PERF_DSL_CONFIGURE_DRIVER,
+    XDSL_HAL_PERF_XTM_SET_LINK_INFO,
+    XDSL_HAL_PERF_XTM_GET_LINK_INFO,
+    XDSL_HAL_PERF_XTM_GET_LINK_STATS,
+    XDSL_HAL_PERF_ATM_SET_LINK_INFO,
+    XDSL_HAL_PERF_ATM_LOOPBACK_DIAGNOSTICS,
+    XDSL_HAL_PERF_ATM_GET_LINK_STATS,
+    XDSL_HAL_PERF_DSL_SET_LINE_PARAMS,
+    XDSL_HAL_PERF_MAX
+} XDSL_HAL_PERF_ID;
+
+typedef enum
+_XDSL_HAL_PERF_RESULT
+{
+    XDSL_HAL_PERF_RESULT_OK = 0,
+    XDSL_HAL_PERF_RESULT_ERROR,
+    XDSL_HAL_PERF_RESULT_TIMEOUT
+} XDSL_HAL_PERF_RESULT;
+
+/* Snapshot of the counters of one entry point */
+typedef  struct
+_DML_XDSL_HAL_PERF
+{
+    CHAR                Name[64];
+    ULONG               Calls;
+    ULONG               Errors;
+    ULONG               Timeouts;
+    ULONGLONG           BytesSent;
+    ULONGLONG           BytesReceived;
+    ULONGLONG           TotalLatency;
+    ULONG               MaxLatency;
+    ULONG               Histogram[XDSL_HAL_PERF_BUCKETS];
+    ULONG               CacheHits;
+    ULONG               CacheMisses;
+}
+DML_XDSL_HAL_PERF, *PDML_XDSL_HAL_PERF;
+
+BOOL XdslHalPerfIsEnabled( VOID );
+
+VOID XdslHalPerfSetEnable( BOOL bEnable );
+
+BOOL XdslHalPerfIsByteCountingEnabled( VOID );
+
+VOID XdslHalPerfSetByteCounting( BOOL bEnable );
+
+VOID XdslHalPerfRecord( XDSL_HAL_PERF_ID id, ULONG ulLatencyUsec, XDSL_HAL_PERF_RESULT result, size_t bytesSent, size_t bytesReceived );
+
+VOID XdslHalPerfRecordCache( XDSL_HAL_PERF_ID id, BOOL bHit );
+
+ANSC_STATUS XdslHalPerfGetStats( XDSL_HAL_PERF_ID id, PDML_XDSL_HAL_PERF pstPerf );
+
+VOID XdslHalPerfReset( VOID );
+
+VOID XdslHalPerfDump( VOID );
+
+/* Starts the thread that writes the dumps requested by XdslHalPerfRequestDump() */
+ANSC_STATUS XdslHalPerfDumpInit( VOID );
+
+/* Async-signal-safe, the dump is written later by the dump thread */
+VOID XdslHalPerfRequestDump( VOID );
+
+#endif /* _XDSL_HAL_PERF_H */
@@ -0,0 +1,55 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_INSTANCE_CACHE_H
+#define  _XDSL_INSTANCE_CACHE_H
+
+#include "cosa_apis.h"
+
+/* Maximum number of rows indexed per table */
+#define XDSL_INSTANCE_CACHE_MAX_ENTRIES     16
+
+/* Tables of other agents that are looked up by name or lower layer */
+typedef enum
+_XDSL_INSTANCE_TABLE
+{
+    XDSL_INSTANCE_TABLE_WAN   = 0,  /* Device.X_RDK_WanManager.CPEInterface.{i}.Name */
+    XDSL_INSTANCE_TABLE_PTM,        /* Device.PTM.Link.{i}.LowerLayers */
+    XDSL_INSTANCE_TABLE_ATM,        /* Device.ATM.Link.{i}.LowerLayers */
+    XDSL_INSTANCE_TABLE_VLAN,       /* Device.X_RDK_Ethernet.Link.{i}.LowerLayers */
+    XDSL_INSTANCE_TABLE_MAX
+} XDSL_INSTANCE_TABLE;
+
+typedef  struct
+_XDSL_INSTANCE_CACHE_STATS
+{
+    ULONG               Hits;
+    ULONG               Misses;
+    ULONG               Refreshes;
+    ULONG               Invalidations;
+}
+XDSL_INSTANCE_CACHE_STATS, *PXDSL_INSTANCE_CACHE_STATS;
+
+ANSC_STATUS XdslInstanceCacheLookup( XDSL_INSTANCE_TABLE enTable, char *pKey, INT *piInstanceNumber );
+
+VOID XdslInstanceCacheInvalidate( XDSL_INSTANCE_TABLE enTable );
+
+VOID XdslInstanceCacheGetStats( PXDSL_INSTANCE_CACHE_STATS pstStats );
+
+#endif /* _XDSL_INSTANCE_CACHE_H */
@@ -0,0 +1,58 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_LINE_POLICY_H
+#define  _XDSL_LINE_POLICY_H
+
+#include <stddef.h>
+#include "cosa_apis.h"
+
+/* Region key of the policy used when nothing more specific matches */
+#define XDSL_LINE_POLICY_REGION_DEFAULT     "default"
+
+/* XTSE/XTSUsed are 8 octets written as 16 hex digits */
+#define XDSL_LINE_POLICY_XTSE_LEN           17
+
+/*
+ * Line configuration pushed to the driver at start up. An empty field leaves
+ * the corresponding driver setting untouched.
+ */
+typedef  struct
+_XDSL_LINE_POLICY
+{
+    CHAR                Region[16];
+    CHAR                AllowedProfiles[64];    /* comma separated VDSL2 profiles, e.g. "8b,12a,17a,35b" */
+    CHAR                Standards[512];         /* comma separated TR-181 standard names, mapped to XTSE */
+}
+XDSL_LINE_POLICY, *PXDSL_LINE_POLICY;
+
+/* Built-in policy of pRegion, the default policy if the region has none */
+VOID XdslLinePolicyGetDefault( const char *pRegion, PXDSL_LINE_POLICY pstPolicy );
+
+/*
+ * XTSE bitmap of a comma and/or space separated list of standards, a single
+ * standard gives its XTSUsed value. Unknown standards contribute no bits,
+ * fails without touching pXtse when none of them is known.
+ */
+ANSC_STATUS XdslLinePolicyStandardsToXtse( const char *pStandards, char *pXtse, size_t xtseLen );
+
+/* TRUE when both lists hold the same profiles, in any order */
+BOOL XdslLinePolicyProfilesEqual( const char *pProfilesA, const char *pProfilesB );
+
+#endif /* _XDSL_LINE_POLICY_H */
@@ -62,6 +62,7 @@ _XDSL_SM_PRIVATE_INFO
 {
     char        Name[64];
     char        LowerLayers[128];
+    unsigned long ulXtmJobTicket;
 }
 XDSL_SM_PRIVATE_INFO, *PXDSL_SM_PRIVATE_INFO;
 
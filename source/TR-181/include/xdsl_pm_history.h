@@ -0,0 +1,104 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_PM_HISTORY_H
+#define  _XDSL_PM_HISTORY_H
+
+#include "cosa_apis.h"
+
+/* Completed intervals kept per line, a week of quarter hours and a month of days */
+#define XDSL_PM_HISTORY_QUARTER_HOURS       ( 96 * 7 )
+#define XDSL_PM_HISTORY_DAYS                30
+
+#define XDSL_PM_HISTORY_QUARTER_HOUR_SECS   900
+#define XDSL_PM_HISTORY_DAY_SECS            86400
+
+/*
+ * An interval whose last sample was taken more than this before it ended
+ * misses counts and is flagged suspect, G.997.1 invalid data flag.
+ */
+#define XDSL_PM_HISTORY_SUSPECT_SECS        60
+
+typedef enum
+_XDSL_PM_INTERVAL
+{
+    XDSL_PM_INTERVAL_QUARTER_HOUR = 0,
+    XDSL_PM_INTERVAL_DAY,
+    XDSL_PM_INTERVAL_MAX
+} XDSL_PM_INTERVAL;
+
+/* Performance counters of one interval, CRC/FEC/HEC of the first channel */
+typedef  struct
+_DML_XDSL_PM_COUNTERS
+{
+    UINT                ErroredSecs;
+    UINT                SeverelyErroredSecs;
+    UINT                XTURCRCErrors;
+    UINT                XTUCCRCErrors;
+    UINT                XTURFECErrors;
+    UINT                XTUCFECErrors;
+    UINT                XTURHECErrors;
+    UINT                XTUCHECErrors;
+    UINT                LinkRetrain;
+    UINT                InitErrors;
+}
+DML_XDSL_PM_COUNTERS, *PDML_XDSL_PM_COUNTERS;
+
+/* Driver counters of the running quarter hour and day, read in one go */
+typedef  struct
+_XDSL_PM_SAMPLE
+{
+    ULONG               Uptime;             /* seconds, monotonic */
+    ULONG               Time;               /* seconds since the epoch */
+    ULONG               QuarterHourStart;   /* seconds into the running quarter hour */
+    ULONG               CurrentDayStart;    /* seconds into the running day */
+    DML_XDSL_PM_COUNTERS stQuarterHour;     /* InitErrors is not read, the driver only counts it per day */
+    DML_XDSL_PM_COUNTERS stCurrentDay;
+}
+XDSL_PM_SAMPLE, *PXDSL_PM_SAMPLE;
+
+/* One completed interval */
+typedef  struct
+_DML_XDSL_PM_INTERVAL
+{
+    ULONG               IntervalEnd;        /* seconds since the epoch */
+    ULONG               Elapsed;            /* seconds of the interval covered by the counters */
+    BOOL                Suspect;
+    DML_XDSL_PM_COUNTERS stCounters;
+}
+DML_XDSL_PM_INTERVAL, *PDML_XDSL_PM_INTERVAL;
+
+/* The completed intervals are kept by the PM store, XdslPmStoreInit() comes first */
+ANSC_STATUS XdslPmHistoryInit( INT iLines );
+
+/*
+ * Feeds a sample of line LineIndex. When the driver started a new quarter
+ * hour or day since the previous sample, the interval that ended is stored
+ * with the counters of that previous sample. Whole intervals that went by
+ * without a sample are stored as empty suspect intervals.
+ */
+VOID XdslPmHistoryUpdate( INT LineIndex, const XDSL_PM_SAMPLE *pstSample );
+
+/* Copies up to ulMax completed intervals, most recent first, returns the number copied */
+ULONG XdslPmHistoryExport( INT LineIndex, XDSL_PM_INTERVAL interval, PDML_XDSL_PM_INTERVAL pstIntervals, ULONG ulMax );
+
+/* Changes whenever an interval is stored, also once the history is full */
+ULONG XdslPmHistoryGetDepth( INT LineIndex, XDSL_PM_INTERVAL interval );
+
+#endif /* _XDSL_PM_HISTORY_H */
@@ -0,0 +1,80 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_PM_STORE_H
+#define  _XDSL_PM_STORE_H
+
+#include "xdsl_pm_history.h"
+
+/*
+ * Memory mapped on flash so the history survives restarts and reboots. Lines
+ * are sized in the file up front, the layout does not depend on the HAL.
+ */
+#ifndef XDSL_PM_STORE_FILE
+#define XDSL_PM_STORE_FILE                  "/nvram/xdsl_pm_store"
+#endif
+#define XDSL_PM_STORE_MAX_LINES             2
+
+#define XDSL_PM_STORE_MAGIC                 0x58504D53      /* "XPMS" */
+#define XDSL_PM_STORE_VERSION               1
+
+/* Counters are committed at most this often, each commit rewrites one flash page */
+#define XDSL_PM_STORE_FLUSH_INTERVAL_MS     ( 5 * 60 * 1000 )
+
+/* Counters of a line kept across restarts */
+typedef enum
+_XDSL_PM_STORE_COUNTER
+{
+    XDSL_PM_STORE_COUNTER_LIFETIME_RETRAINS = 0,   /* successful retrains since the store was created */
+    XDSL_PM_STORE_COUNTER_DAY_RETRAINS,            /* successful retrains of the driver's current day */
+    XDSL_PM_STORE_COUNTER_DAY_START,               /* CurrentDayStart when the day count last changed */
+    XDSL_PM_STORE_COUNTER_MAX
+} XDSL_PM_STORE_COUNTER;
+
+/*
+ * Maps XDSL_PM_STORE_FILE and restores the completed intervals and counters
+ * it holds. A missing, foreign or corrupt file is reinitialised, when it can
+ * not be mapped the store is kept in memory only.
+ */
+ANSC_STATUS XdslPmStoreInit( VOID );
+
+/*
+ * Appends a completed interval to the ring of line LineIndex. A bin is
+ * written once with its sequence number and checksum, a bin torn by a crash
+ * fails the check and is skipped when the history is read back. The ring
+ * position is committed like a changed counter.
+ */
+VOID XdslPmStoreAppend( INT LineIndex, XDSL_PM_INTERVAL interval, const DML_XDSL_PM_INTERVAL *pstInterval );
+
+/* Copies up to ulMax completed intervals, most recent first, returns the number copied */
+ULONG XdslPmStoreExport( INT LineIndex, XDSL_PM_INTERVAL interval, PDML_XDSL_PM_INTERVAL pstIntervals, ULONG ulMax );
+
+/* Intervals ever appended to the ring, keeps growing once the ring is full */
+ULONG XdslPmStoreGetDepth( INT LineIndex, XDSL_PM_INTERVAL interval );
+
+/* FALSE when the counter was never stored */
+BOOL XdslPmStoreGetCounter( INT LineIndex, XDSL_PM_STORE_COUNTER counter, INT *piValue );
+
+/* Committed within XDSL_PM_STORE_FLUSH_INTERVAL_MS, straight away until the event loop runs */
+VOID XdslPmStoreSetCounter( INT LineIndex, XDSL_PM_STORE_COUNTER counter, INT iValue );
+
+/* Commits changed counters and schedules the write back of the mapped pages */
+ANSC_STATUS XdslPmStoreFlush( VOID );
+
+#endif /* _XDSL_PM_STORE_H */
@@ -0,0 +1,53 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_PSM_CACHE_H
+#define  _XDSL_PSM_CACHE_H
+
+#include <stddef.h>
+#include "cosa_apis.h"
+
+/* Records mirrored, must be a power of two */
+#define XDSL_PSM_CACHE_SLOTS                128
+
+#define XDSL_PSM_CACHE_NAME_LENGTH          128
+#define XDSL_PSM_CACHE_VALUE_LENGTH         256
+
+/* Writes made within this window of the first one go out in one batch */
+#define XDSL_PSM_CACHE_FLUSH_DELAY_MS       200
+
+/*
+ * PSM access of the xdslmanager records through an in-memory mirror. A
+ * record is read from PSM once and then served from the mirror, writes only
+ * update the mirror and mark the record dirty, a write of the value already
+ * held costs nothing. Dirty records are written with one setParameterValues
+ * per batch when XdslPsmCacheFlush() is called, e.g. from a DML commit, or
+ * XDSL_PSM_CACHE_FLUSH_DELAY_MS after the first unflushed write. Until the
+ * event loop runs, and for records that do not fit the mirror, writes go
+ * straight to PSM.
+ *
+ * Both return the CCSP status of the PSM access.
+ */
+INT XdslPsmCacheGet( const char *pName, char *pValue, size_t valueLen );
+
+INT XdslPsmCacheSet( const char *pName, const char *pValue );
+
+ANSC_STATUS XdslPsmCacheFlush( VOID );
+
+#endif /* _XDSL_PSM_CACHE_H */
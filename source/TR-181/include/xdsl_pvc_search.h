@@ -0,0 +1,56 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_PVC_SEARCH_H
+#define  _XDSL_PVC_SEARCH_H
+
+#include <stddef.h>
+#include "cosa_apis.h"
+
+/* Candidates probed per showtime, the preferred PVC included */
+#define XDSL_PVC_SEARCH_MAX_CANDIDATES      16
+
+/* "PVC: 255/65535" */
+#define XDSL_PVC_STR_LEN                    32
+
+typedef  struct
+_XDSL_PVC
+{
+    UINT                Vpi;
+    UINT                Vci;
+}
+XDSL_PVC, *PXDSL_PVC;
+
+/*
+ * Parses "VPI/VCI" as used by VCSearchList or "PVC: VPI/VCI" as used by
+ * DestinationAddress. Fails for VPIs above 255 and the reserved VCIs below 32.
+ */
+BOOL XdslPvcParse( const char *pString, PXDSL_PVC pstPvc );
+
+/* DestinationAddress form of pstPvc */
+VOID XdslPvcFormat( const XDSL_PVC *pstPvc, char *pString, size_t stringLen );
+
+/*
+ * Probe order: pPreferred (may be NULL or empty) followed by the comma
+ * separated pSearchList, duplicates and invalid entries dropped. Returns the
+ * number of candidates written to pstCandidates.
+ */
+INT XdslPvcSearchBuildCandidates( const char *pPreferred, const char *pSearchList, PXDSL_PVC pstCandidates, INT iMaxCandidates );
+
+#endif /* _XDSL_PVC_SEARCH_H */
@@ -0,0 +1,60 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_REACTOR_H
+#define  _XDSL_REACTOR_H
+
+#include "cosa_apis.h"
+
+/* Maximum number of file descriptors and timers watched by the reactor */
+#define XDSL_REACTOR_MAX_SOURCES            16
+
+/* Worker threads running the blocking jobs (bus calls, HAL requests) */
+#define XDSL_REACTOR_WORKERS                2
+
+/* Pending jobs, must be a power of two */
+#define XDSL_REACTOR_WORK_QUEUE_SIZE        32
+
+/* Stack size of the reactor and worker threads */
+#define XDSL_REACTOR_STACK_SIZE             ( 128 * 1024 )
+
+/*
+ * Fd and timer handlers run on the reactor thread with the source table
+ * locked. They must not block and must not add or remove sources, anything
+ * slow has to be handed over to a worker with XdslReactorSubmit().
+ */
+typedef VOID (*XDSL_REACTOR_FD_HANDLER)( INT iFd, UINT uEvents, PVOID pContext );
+typedef VOID (*XDSL_REACTOR_TIMER_HANDLER)( PVOID pContext );
+typedef VOID (*XDSL_REACTOR_WORK_HANDLER)( PVOID pContext );
+
+ANSC_STATUS XdslReactorInit( VOID );
+
+ANSC_STATUS XdslReactorAddFd( INT iFd, XDSL_REACTOR_FD_HANDLER pHandler, PVOID pContext );
+
+ANSC_STATUS XdslReactorRemoveFd( INT iFd );
+
+INT XdslReactorAddTimer( XDSL_REACTOR_TIMER_HANDLER pHandler, PVOID pContext );
+
+ANSC_STATUS XdslReactorSetTimer( INT iTimerId, ULONG ulFirstMs, ULONG ulIntervalMs );
+
+ANSC_STATUS XdslReactorRemoveTimer( INT iTimerId );
+
+ANSC_STATUS XdslReactorSubmit( XDSL_REACTOR_WORK_HANDLER pHandler, PVOID pContext );
+
+#endif /* _XDSL_REACTOR_H */
@@ -0,0 +1,95 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_SHAPER_H
+#define  _XDSL_SHAPER_H
+
+#include "cosa_apis.h"
+
+#define XDSL_SHAPER_DEFAULT_ENABLE          TRUE
+#define XDSL_SHAPER_DEFAULT_PERCENT         95      /* of the payload rate the line can carry */
+#define XDSL_SHAPER_DEFAULT_PACKET_SIZE     1500    /* IP packet size the overhead is accounted for */
+#define XDSL_SHAPER_DEFAULT_ATM_OVERHEAD    32      /* RFC 2684 bridged LLC/SNAP + Ethernet + PPPoE */
+#define XDSL_SHAPER_DEFAULT_PTM_OVERHEAD    30      /* Ethernet with FCS + VLAN + PPPoE */
+#define XDSL_SHAPER_DEFAULT_CHECK_INTERVAL  30      /* seconds between sync rate checks in showtime */
+
+/* Smaller moves of the recommendation, e.g. SRA steps, are not republished */
+#define XDSL_SHAPER_CHANGE_PERCENT          2
+
+typedef enum
+_XDSL_SHAPER_ENCAP
+{
+    XDSL_SHAPER_ENCAP_NONE = 0,
+    XDSL_SHAPER_ENCAP_ATM,
+    XDSL_SHAPER_ENCAP_PTM
+} XDSL_SHAPER_ENCAP;
+
+typedef  struct
+_XDSL_SHAPER_CONFIG
+{
+    BOOL                Enable;
+    ULONG               Percent;
+    ULONG               PacketSize;
+    ULONG               AtmOverhead;        /* bytes per packet in front of AAL5 */
+    ULONG               PtmOverhead;        /* bytes per packet in front of PTM-TC */
+    ULONG               CheckInterval;
+    ULONG               EgressShaper;       /* Device.QoS.Shaper instance pushed the egress rate, 0 for none */
+    ULONG               IngressShaper;      /* Device.QoS.Shaper instance pushed the ingress rate, 0 for none */
+}
+XDSL_SHAPER_CONFIG, *PXDSL_SHAPER_CONFIG;
+
+/* Recommendation last published, rates in kbps */
+typedef  struct
+_XDSL_SHAPER_RATES
+{
+    XDSL_SHAPER_ENCAP   Encapsulation;
+    ULONG               UpstreamSyncRate;
+    ULONG               DownstreamSyncRate;
+    ULONG               EgressRate;
+    ULONG               IngressRate;
+    ULONG               Updates;
+}
+XDSL_SHAPER_RATES, *PXDSL_SHAPER_RATES;
+
+/* Fails and keeps the defaults if pstConfig is out of range */
+ANSC_STATUS XdslShaperInit( const XDSL_SHAPER_CONFIG *pstConfig );
+
+VOID XdslShaperGetConfig( PXDSL_SHAPER_CONFIG pstConfig );
+
+ANSC_STATUS XdslShaperSetConfig( const XDSL_SHAPER_CONFIG *pstConfig );
+
+BOOL XdslShaperIsConfigValid( const XDSL_SHAPER_CONFIG *pstConfig );
+
+/* Payload rate in kbps a shaper may send at for a line synchronised at ulSyncRate kbps */
+ULONG XdslShaperComputeRate( ULONG ulSyncRate, XDSL_SHAPER_ENCAP enEncap, const XDSL_SHAPER_CONFIG *pstConfig );
+
+/*
+ * Recomputes the recommendation for the given sync rates. Returns TRUE and
+ * the new rates when they have to be published, i.e. on the first update
+ * after XdslShaperReset(), an encapsulation or configuration change or a
+ * move of at least XDSL_SHAPER_CHANGE_PERCENT.
+ */
+BOOL XdslShaperUpdate( XDSL_SHAPER_ENCAP enEncap, ULONG ulUpstreamSyncRate, ULONG ulDownstreamSyncRate, PXDSL_SHAPER_RATES pstRates );
+
+/* Line left showtime, the next update is published unconditionally */
+VOID XdslShaperReset( VOID );
+
+VOID XdslShaperGetRates( PXDSL_SHAPER_RATES pstRates );
+
+#endif /* _XDSL_SHAPER_H */
@@ -0,0 +1,135 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_TCA_H
+#define  _XDSL_TCA_H
+
+#include "xdsl_pm_history.h"
+
+#define XDSL_TCA_MAX_PROFILES               8
+
+#define XDSL_TCA_NAME_LENGTH                32
+
+/* Crossings one evaluation can report, a profile changes state at most once per evaluation */
+#define XDSL_TCA_MAX_EVENTS                 XDSL_TCA_MAX_PROFILES
+
+/*
+ * Values a profile can watch. Error counters raise when they reach the
+ * threshold, noise margins (0.1 dB) and attainable rates (kbps) when they
+ * drop to it.
+ */
+typedef enum
+_XDSL_TCA_COUNTER
+{
+    XDSL_TCA_COUNTER_ERRORED_SECS = 0,
+    XDSL_TCA_COUNTER_SEVERELY_ERRORED_SECS,
+    XDSL_TCA_COUNTER_XTUR_CRC_ERRORS,
+    XDSL_TCA_COUNTER_XTUC_CRC_ERRORS,
+    XDSL_TCA_COUNTER_XTUR_FEC_ERRORS,
+    XDSL_TCA_COUNTER_XTUC_FEC_ERRORS,
+    XDSL_TCA_COUNTER_XTUR_HEC_ERRORS,
+    XDSL_TCA_COUNTER_XTUC_HEC_ERRORS,
+    XDSL_TCA_COUNTER_LINK_RETRAIN,
+    XDSL_TCA_COUNTER_DOWNSTREAM_NOISE_MARGIN,
+    XDSL_TCA_COUNTER_UPSTREAM_NOISE_MARGIN,
+    XDSL_TCA_COUNTER_DOWNSTREAM_MAX_BIT_RATE,
+    XDSL_TCA_COUNTER_UPSTREAM_MAX_BIT_RATE,
+    XDSL_TCA_COUNTER_MAX
+} XDSL_TCA_COUNTER;
+
+/* Running interval of the error counters, line values are compared as read */
+typedef enum
+_XDSL_TCA_INTERVAL
+{
+    XDSL_TCA_INTERVAL_QUARTER_HOUR = 0,
+    XDSL_TCA_INTERVAL_CURRENT_DAY,
+    XDSL_TCA_INTERVAL_MAX
+} XDSL_TCA_INTERVAL;
+
+typedef  struct
+_XDSL_TCA_PROFILE
+{
+    BOOL                Enable;
+    XDSL_TCA_COUNTER    Counter;
+    XDSL_TCA_INTERVAL   Interval;
+    INT                 Threshold;
+    ULONG               Hysteresis;     /* how far back over the threshold the value has to go to clear */
+}
+XDSL_TCA_PROFILE, *PXDSL_TCA_PROFILE;
+
+/* Values of one stats refresh of a line */
+typedef  struct
+_XDSL_TCA_SAMPLE
+{
+    DML_XDSL_PM_COUNTERS    stQuarterHour;
+    DML_XDSL_PM_COUNTERS    stCurrentDay;
+    BOOL                    bLineValid;     /* the line values below were read, the line is up */
+    BOOL                    bLineDown;      /* the line was read out of showtime, raised line values clear */
+    INT                     DownstreamNoiseMargin;
+    INT                     UpstreamNoiseMargin;
+    ULONG                   DownstreamMaxBitRate;
+    ULONG                   UpstreamMaxBitRate;
+}
+XDSL_TCA_SAMPLE, *PXDSL_TCA_SAMPLE;
+
+/* A profile that was raised or cleared on a line */
+typedef  struct
+_XDSL_TCA_EVENT
+{
+    INT                 LineIndex;
+    INT                 ProfileIndex;
+    XDSL_TCA_COUNTER    Counter;
+    XDSL_TCA_INTERVAL   Interval;
+    BOOL                bRaised;
+    LONG                lValue;
+    INT                 Threshold;
+}
+XDSL_TCA_EVENT, *PXDSL_TCA_EVENT;
+
+ANSC_STATUS XdslTcaInit( INT iLines );
+
+/* Validates and applies a profile, a raised crossing it had is cleared by the next evaluation */
+ANSC_STATUS XdslTcaSetProfile( INT ProfileIndex, const XDSL_TCA_PROFILE *pstProfile );
+
+ANSC_STATUS XdslTcaGetProfile( INT ProfileIndex, PXDSL_TCA_PROFILE pstProfile );
+
+/* TRUE while the profile is raised on any line */
+BOOL XdslTcaIsRaised( INT ProfileIndex );
+
+/* TRUE when an enabled profile watches a line value, it is read only then */
+BOOL XdslTcaNeedsLineValues( VOID );
+
+/*
+ * Compares the sample with the enabled profiles and returns the number of
+ * crossings written to pstEvents, only profiles whose state changed since
+ * the previous sample of the line are reported. A profile cleared because
+ * it was changed is compared again from the next sample.
+ */
+INT XdslTcaEvaluate( INT LineIndex, const XDSL_TCA_SAMPLE *pstSample, PXDSL_TCA_EVENT pstEvents, INT iMaxEvents );
+
+/* TR-181 style names of counters and intervals, NULL or -1 when unknown */
+const char *XdslTcaCounterName( XDSL_TCA_COUNTER counter );
+
+INT XdslTcaCounterFromName( const char *pName );
+
+const char *XdslTcaIntervalName( XDSL_TCA_INTERVAL interval );
+
+INT XdslTcaIntervalFromName( const char *pName );
+
+#endif /* _XDSL_TCA_H */
@@ -0,0 +1,80 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_TRAIN_HINT_H
+#define  _XDSL_TRAIN_HINT_H
+
+#include "xdsl_apis.h"
+
+#define XDSL_TRAIN_HINT_DEFAULT_ENABLE              TRUE
+#define XDSL_TRAIN_HINT_DEFAULT_FALLBACK_TIMEOUT    90      /* seconds of training on the hint before the full set is offered */
+
+/* Configuration the line last reached showtime with */
+typedef  struct
+_XDSL_TRAIN_HINT
+{
+    CHAR                StandardUsed[XDSL_STANDARD_USED_STR_MAX];
+    CHAR                CurrentProfile[16];     /* VDSL2 profile, empty for ADSL */
+    ULONG               UpstreamRate;           /* kbps */
+    ULONG               DownstreamRate;         /* kbps */
+}
+XDSL_TRAIN_HINT, *PXDSL_TRAIN_HINT;
+
+typedef  struct
+_XDSL_TRAIN_HINT_STATS
+{
+    BOOL                Offered;                /* driver is restricted to the hint */
+    BOOL                FallenBack;             /* hint timed out, full set offered until the line trains */
+    ULONG               Fallbacks;
+}
+XDSL_TRAIN_HINT_STATS, *PXDSL_TRAIN_HINT_STATS;
+
+VOID XdslTrainHintInit( BOOL bEnable, ULONG ulFallbackTimeout, const XDSL_TRAIN_HINT *pstLastGood );
+
+VOID XdslTrainHintGetConfig( BOOL *pbEnable, ULONG *pulFallbackTimeout );
+
+VOID XdslTrainHintSetConfig( BOOL bEnable, ULONG ulFallbackTimeout );
+
+/* FALSE when no configuration was learnt yet */
+BOOL XdslTrainHintGetLastGood( PXDSL_TRAIN_HINT pstHint );
+
+/* Returns TRUE when the standard or profile changed and the record has to be persisted */
+BOOL XdslTrainHintSetLastGood( const XDSL_TRAIN_HINT *pstHint );
+
+VOID XdslTrainHintForget( VOID );
+
+/* TRUE when the next training should be offered the last good configuration */
+BOOL XdslTrainHintShouldOffer( VOID );
+
+VOID XdslTrainHintSetOffered( BOOL bOffered );
+
+/* Line started training, TRUE when the fallback timer has to be armed */
+BOOL XdslTrainHintTrainingStarted( VOID );
+
+/* Line reached showtime, returns whether it trained on the hint */
+BOOL XdslTrainHintTrained( VOID );
+
+/* Hint did not train within the fallback timeout, FALSE when the line trained meanwhile */
+BOOL XdslTrainHintFallback( VOID );
+
+VOID XdslTrainHintGetStats( PXDSL_TRAIN_HINT_STATS pstStats );
+
+VOID XdslTrainHintResetStats( VOID );
+
+#endif /* _XDSL_TRAIN_HINT_H */
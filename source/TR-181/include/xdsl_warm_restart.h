@@ -0,0 +1,59 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+#ifndef  _XDSL_WARM_RESTART_H
+#define  _XDSL_WARM_RESTART_H
+
+#include "xdsl_apis.h"
+#include "xdsl_instance_cache.h"
+
+/*
+ * One file per interface. /tmp survives a process restart but not a reboot,
+ * which retrains the line anyway, so a stale snapshot never outlives its link.
+ */
+#define XDSL_WARM_RESTART_FILE_FORMAT       "/tmp/.xdsl_runtime_%s"
+
+#define XDSL_WARM_RESTART_MAGIC             0x5844534C      /* "XDSL" */
+#define XDSL_WARM_RESTART_VERSION           1
+
+/* Runtime state of a line that reached WAN link up */
+typedef  struct
+_XDSL_WARM_RESTART_SNAPSHOT
+{
+    ULONG                   Magic;
+    ULONG                   Version;
+    CHAR                    Name[64];
+    CHAR                    LowerLayers[128];
+    CHAR                    StandardUsed[XDSL_STANDARD_USED_STR_MAX];
+    INT                     SmState;
+    XDSL_INSTANCE_TABLE     XtmTable;       /* XDSL_INSTANCE_TABLE_PTM or XDSL_INSTANCE_TABLE_ATM */
+    INT                     XtmInstance;
+    INT                     WanInstance;
+    ULONG                   Checksum;       /* over all fields above */
+}
+XDSL_WARM_RESTART_SNAPSHOT, *PXDSL_WARM_RESTART_SNAPSHOT;
+
+ANSC_STATUS XdslWarmRestartSave( PXDSL_WARM_RESTART_SNAPSHOT pstSnapshot );
+
+/* Fails when there is no snapshot for ifname or it is truncated, corrupt or of another version */
+ANSC_STATUS XdslWarmRestartLoad( const char *ifname, PXDSL_WARM_RESTART_SNAPSHOT pstSnapshot );
+
+VOID XdslWarmRestartClear( const char *ifname );
+
+#endif /* _XDSL_WARM_RESTART_H */
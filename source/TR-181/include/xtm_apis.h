@@ -87,6 +87,8 @@ _DML_PTM
     CHAR                 LowerLayers[1024];
     CHAR                 MACAddress[64];
     DML_PTM_STATS   Statistics;
+    BOOLEAN              StatsValid;
+    ULONG                StatsTimestamp;
 }
 DML_PTM,  *PDML_PTM;
 
@@ -209,8 +211,17 @@ _DML_ATM
     CHAR                 VCSearchList[256];
     DML_ATM_QOS          Qos;
     DML_ATM_STATS        Statistics;
+    BOOLEAN              StatsValid;
+    ULONG                StatsTimestamp;
 }
 DML_ATM,  *PDML_ATM;
+/*
+ * Stats read from the HAL are reused for this many milliseconds, so that a
+ * walk over all counters of a Link.{i}.Stats object costs a single
+ * xtm_hal_getLinkStats / atm_hal_getLinkStats call instead of one per counter.
+ */
+#define XTM_STATS_CACHE_TIMEOUT_MS             1000
+
 #define DML_PTM_INIT(pPtm)                     \
 {                                              \
     (pPtm)->Enable            = FALSE;         \
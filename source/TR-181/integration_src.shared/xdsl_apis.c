@@ -69,33 +69,37 @@
 
 //Standard library
 #include <stdlib.h>
+#include <stddef.h>
 #include <errno.h>
-#include <mqueue.h>
+#include <time.h>
 #include <sysevent/sysevent.h>
 
 //Specific includes
 #include "xdsl_apis.h"
 #include "xdsl_hal.h"
 #include "xdsl_internal.h"
+#include "xdsl_dml.h"
 #include "xdsl_report.h"
+#include "xdsl_event_ring.h"
+#include "xdsl_reactor.h"
+#include "xdsl_instance_cache.h"
+#include "xdsl_bus_txn.h"
+#include "xdsl_flap_damping.h"
+#include "xdsl_warm_restart.h"
+#include "xdsl_line_policy.h"
+#include "xdsl_train_hint.h"
+#include "xdsl_shaper.h"
+#include "xdsl_pvc_search.h"
+#include "xdsl_psm_cache.h"
+#include "xdsl_pm_store.h"
+#include "xdsl_tca.h"
 
 
-#define XDSL_EVENT_QUEUE_NAME  "/DSL_event_queue"
-#define MAX_QUEUE_MSG_SIZE         ( 2048 )
-#define MAX_QUEUE_LENGTH           ( 100 )
-#define EVENT_MSG_MAX_SIZE         ( 1024 )
-
-#define CHECK(x) \
-    do { \
-        if (!(x)) { \
-            CcspTraceError(("%s:%d: ", __FUNCTION__, __LINE__)); \
-            perror(#x); \
-            return; \
-        } \
-    } while (0) \
-
 #define DATAMODEL_PARAM_LENGTH 256
 
+#define XDSL_XTM_JOB_QUEUE_SIZE    ( 8 )
+#define XDSL_XTM_JOB_MAX_IFACES    ( 4 )
+
 //PTM Manager
 #define XTM_DBUS_PATH                     "/com/cisco/spvtg/ccsp/xdslmanager"
 #define XTM_COMPONENT_NAME                "eRT.com.cisco.spvtg.ccsp.xdslmanager"
@@ -111,6 +115,8 @@
 #define ATM_LINK_LOWERLAYER_PARAM_NAME    "Device.ATM.Link.%d.LowerLayers"
 #define ATM_LINK_ENABLE_PARAM_NAME        "Device.ATM.Link.%d.Enable"
 #define ATM_LINK_ALIAS_PARAM_NAME         "Device.ATM.Link.%d.Alias"
+#define ATM_LINK_DESTINATION_PARAM_NAME   "Device.ATM.Link.%d.DestinationAddress"
+#define ATM_LINK_PATH_NAME                "Device.ATM.Link.%d"
 
 //WAN Agent
 #define WAN_DBUS_PATH                     "/com/cisco/spvtg/ccsp/wanmanager"
@@ -128,6 +134,72 @@
 #define XDSL_LINE_ENABLE "Device.DSL.Line.%d.Enable"
 #define XDSL_LINE_DATA_GATHERING_ENABLE "Device.DSL.Line.%d.EnableDataGathering"
 
+//Longest an Upstream set waits for the previous state machine thread to exit
+#define XDSL_LINE_UPSTREAM_HANDOVER_TIMEOUT_SEC    15
+
+//Retry of a damping release job the work queue could not take
+#define XDSL_FLAP_DAMPING_RESUBMIT_MS              1000
+
+//Period of the PM interval sampling, well below XDSL_PM_HISTORY_SUSPECT_SECS
+#define XDSL_PM_HISTORY_SAMPLE_INTERVAL_MS    ( 20 * 1000 )
+
+//Threshold crossing alerts, evaluated on every PM sample
+#define PSM_TCA_ENABLE                       "dmsb.xdslmanager.tca.%d.enable"
+#define PSM_TCA_COUNTER                      "dmsb.xdslmanager.tca.%d.counter"
+#define PSM_TCA_INTERVAL                     "dmsb.xdslmanager.tca.%d.interval"
+#define PSM_TCA_THRESHOLD                    "dmsb.xdslmanager.tca.%d.threshold"
+#define PSM_TCA_HYSTERESIS                   "dmsb.xdslmanager.tca.%d.hysteresis"
+#define SYSEVENT_TCA                         "dsl_tca_%d_%d"
+
+//Link flap damping
+#define PSM_FLAP_DAMPING_ENABLE              "dmsb.xdslmanager.flapdamping.enable"
+#define PSM_FLAP_DAMPING_HALF_LIFE           "dmsb.xdslmanager.flapdamping.halflife"
+#define PSM_FLAP_DAMPING_SUPPRESS            "dmsb.xdslmanager.flapdamping.suppressthreshold"
+#define PSM_FLAP_DAMPING_REUSE               "dmsb.xdslmanager.flapdamping.reusethreshold"
+#define PSM_FLAP_DAMPING_MAX_SUPPRESS_TIME   "dmsb.xdslmanager.flapdamping.maxsuppresstime"
+
+//Line profile and standard policy, an unset record keeps the region default
+#define PSM_LINE_POLICY_REGION               "dmsb.xdslmanager.linepolicy.region"
+#define PSM_LINE_POLICY_ALLOWED_PROFILES     "dmsb.xdslmanager.linepolicy.allowedprofiles"
+#define PSM_LINE_POLICY_STANDARDS            "dmsb.xdslmanager.linepolicy.standards"
+
+//Last good training configuration, the driver line configuration is only written for line 1
+#define XDSL_TRAIN_HINT_LINE_INSTANCE        1
+#define XDSL_LINE_STANDARDS_SUPPORTED        "G.992.1_Annex_A, G.992.1_Annex_B, G.992.1_Annex_C, T1.413, G.992.2, G.992.3_Annex_A, G.992.3_Annex_B, G.992.3_Annex_C, G.993.1, G.993.1_Annex_A, G.993.2_Annex_B, G.993.2_Annex_C"
+#define PSM_TRAIN_HINT_ENABLE                "dmsb.xdslmanager.traininghint.enable"
+#define PSM_TRAIN_HINT_FALLBACK_TIMEOUT      "dmsb.xdslmanager.traininghint.fallbacktimeout"
+#define PSM_LINE_LAST_GOOD_STANDARD          "dmsb.xdslmanager.line.%d.lastgood.standardused"
+#define PSM_LINE_LAST_GOOD_PROFILE           "dmsb.xdslmanager.line.%d.lastgood.currentprofile"
+#define PSM_LINE_LAST_GOOD_UPSTREAM_RATE     "dmsb.xdslmanager.line.%d.lastgood.upstreamrate"
+#define PSM_LINE_LAST_GOOD_DOWNSTREAM_RATE   "dmsb.xdslmanager.line.%d.lastgood.downstreamrate"
+
+//WAN shaper rate recommendation
+#define PSM_SHAPER_ENABLE                    "dmsb.xdslmanager.shaper.enable"
+#define PSM_SHAPER_PERCENT                   "dmsb.xdslmanager.shaper.percent"
+#define PSM_SHAPER_PACKET_SIZE               "dmsb.xdslmanager.shaper.packetsize"
+#define PSM_SHAPER_ATM_OVERHEAD              "dmsb.xdslmanager.shaper.atmoverhead"
+#define PSM_SHAPER_PTM_OVERHEAD              "dmsb.xdslmanager.shaper.ptmoverhead"
+#define PSM_SHAPER_CHECK_INTERVAL            "dmsb.xdslmanager.shaper.checkinterval"
+#define PSM_SHAPER_EGRESS_SHAPER             "dmsb.xdslmanager.shaper.egressshaper"
+#define PSM_SHAPER_INGRESS_SHAPER            "dmsb.xdslmanager.shaper.ingressshaper"
+#define SYSEVENT_SHAPER_EGRESS_RATE          "dsl_shaper_egress_rate"
+#define SYSEVENT_SHAPER_INGRESS_RATE         "dsl_shaper_ingress_rate"
+
+//ATM PVC auto-detection, the records are owned by Device.ATM.Link
+#define PSM_ATM_AUTOCONFIG                   "dmsb.xdslmanager.atm.autoconfig"
+#define PSM_ATM_PVC                          "dmsb.xdslmanager.atm.pvc"
+#define PSM_ATM_VCSEARCHLIST                 "dmsb.xdslmanager.atm.vcsearchlist"
+#define XDSL_PVC_PROBE_REPETITIONS           1
+#define XDSL_PVC_PROBE_TIMEOUT_MS            1000
+#define XDSL_PVC_PROBE_GAP_MS                10
+#define XDSL_PVC_SEARCH_MAX_MS               8000
+#define XDSL_PVC_SEARCH_RESUBMIT_MS          1000
+
+//QoS Manager
+#define QOS_DBUS_PATH                     "/com/cisco/spvtg/ccsp/qos"
+#define QOS_COMPONENT_NAME                "eRT.com.cisco.spvtg.ccsp.qos"
+#define QOS_SHAPER_RATE_PARAM_NAME        "Device.QoS.Shaper.%lu.ShapingRate"
+
 /* *********************************************************************** */
 //Global Declaration
 
@@ -139,51 +211,173 @@ extern char * XdslReportStatusDfltReportingPeriod;
 extern char * XdslReportStatusReportingPeriod;
 
 typedef enum
-_XDSL_MSGQ_MSG_TYPE
+_XDSL_XTM_JOB_TYPE
 {
-    MSG_TYPE_WAN       = 1,
+    XDSL_XTM_JOB_CREATE       = 1,
+    XDSL_XTM_JOB_DELETE
+} XDSL_XTM_JOB_TYPE;
 
-} XDSL_MSGQ_MSG_TYPE;
-
-typedef struct _XDSLEventQData
+typedef struct _XDSL_XTM_JOB
 {
-    char                       Msg[EVENT_MSG_MAX_SIZE]; //Msg structure for the specific event
-    XDSL_MSGQ_MSG_TYPE     MsgType; // WAN = 1
-}DSLEventQData;
+    XDSL_XTM_JOB_TYPE                    JobType;
+    DML_XDSL_STANDARD_FAMILY             StandardFamily; //link type resolved when the job was queued
+    CHAR                                 Name[64];
+    ULONG                                ulTicket;
+}XDSL_XTM_JOB;
 
-typedef struct _XDSLMSGQWanData
+typedef struct _XDSL_XTM_JOB_IFACE
 {
     CHAR                                 Name[64];
-    CHAR                                 LowerLayers[128];
-    DML_XDSL_LINK_STATUS             LinkStatus;
-}XDSLMSGQWanData;
+    ULONG                                ulDoneTicket;
+    ANSC_STATUS                          DoneStatus;
+}XDSL_XTM_JOB_IFACE;
+
+typedef struct _XDSL_PVC_SEARCH_STATE
+{
+    XDSL_XTM_JOB                         stJob;
+    INT                                  iATMInstance;
+    XDSL_PVC                             astCandidates[XDSL_PVC_SEARCH_MAX_CANDIDATES];
+    INT                                  iCount;
+    INT                                  iNext;
+    BOOL                                 bPreferredValid;
+    ULONG                                ulDeadlineMs;
+}XDSL_PVC_SEARCH_STATE;
 
 PDML_XDSL_LINE_GLOBALINFO     gpstLineGInfo     = NULL;
 //mutex for flobal variable
 static pthread_mutex_t        gmXdslGInfo_mutex = PTHREAD_MUTEX_INITIALIZER;
+//signalled with gmXdslGInfo_mutex held when a state machine thread clears its id
+static pthread_cond_t         gcXdslIfaceThreadExit = PTHREAD_COND_INITIALIZER;
+
+//XTM provisioning job queue, drained by one job at a time on the event loop workers
+static XDSL_XTM_JOB           gastXtmJobQueue[XDSL_XTM_JOB_QUEUE_SIZE];
+static XDSL_XTM_JOB_IFACE     gastXtmJobIfaces[XDSL_XTM_JOB_MAX_IFACES];
+static UINT                   guXtmJobHead      = 0;
+static UINT                   guXtmJobTail      = 0;
+static ULONG                  gulXtmJobTicket   = 0;
+static UINT                   guXtmJobScheduled = 0;
+static pthread_mutex_t        gmXtmJob_mutex    = PTHREAD_MUTEX_INITIALIZER;
+
+//PVC search of the ATM create job the XTM drain is parked on, one probe per timer step
+static XDSL_PVC_SEARCH_STATE  gstPvcSearch;
+static INT                    giPvcSearchTimerId = -1;
+
+//set while an event drain job is queued or running
+static UINT                   guXdslEventDrainScheduled = 0;
+
+//fires when a flap-suppressed line is due for release
+static INT                    giFlapDampingTimerId      = -1;
+//damping decision and delivery of a link status, held across both
+static pthread_mutex_t        gmXdslLinkDeliver_mutex   = PTHREAD_MUTEX_INITIALIZER;
+
+//fires when the line did not train on the last good configuration in time
+static INT                    giTrainHintTimerId        = -1;
+
+//rechecks the sync rates of the line in showtime, -1 line index while no line is up
+static INT                    giShaperTimerId           = -1;
+static INT                    giShaperLineIndex         = -1;
+
+//platform region, kept once a lookup succeeded, it does not change at runtime
+static DML_XDSL_ROUTER_REGION genXdslRouterRegion      = XDSL_ROUTER_REGION_UNKNOWN;
+
+//samples the running PM intervals of every line
+static INT                    giPmHistoryTimerId        = -1;
+static INT                    giPmHistoryLines          = 0;
+
+//Where a PM counter is read in the line or channel statistics, -1 when the driver has none
+typedef struct _XDSL_PM_SAMPLE_SOURCE
+{
+    size_t                               CounterOffset;
+    BOOL                                 bChannel;
+    LONG                                 QuarterHourOffset;
+    LONG                                 CurrentDayOffset;
+}XDSL_PM_SAMPLE_SOURCE;
+
+#define XDSL_PM_LINE_COUNTER( member, quarterhour, currentday ) \
+    { offsetof(DML_XDSL_PM_COUNTERS, member), FALSE, \
+      offsetof(DML_XDSL_LINE_STATS, stQuarterHour.quarterhour), offsetof(DML_XDSL_LINE_STATS, stCurrentDay.currentday) }
+
+#define XDSL_PM_LINE_DAY_COUNTER( member, currentday ) \
+    { offsetof(DML_XDSL_PM_COUNTERS, member), FALSE, -1, offsetof(DML_XDSL_LINE_STATS, stCurrentDay.currentday) }
+
+#define XDSL_PM_CHANNEL_COUNTER( member ) \
+    { offsetof(DML_XDSL_PM_COUNTERS, member), TRUE, \
+      offsetof(DML_XDSL_CHANNEL_STATS, stQuarterHour.member), offsetof(DML_XDSL_CHANNEL_STATS, stCurrentDay.member) }
 
-//mutex for signal conditional
-static pthread_mutex_t        mCondMutex = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t         mCreationCond = PTHREAD_COND_INITIALIZER;
-static pthread_cond_t         mDeletionCond = PTHREAD_COND_INITIALIZER;
+static const XDSL_PM_SAMPLE_SOURCE g_PmSampleSources[] =
+{
+    XDSL_PM_LINE_COUNTER( ErroredSecs,         ErroredSecs,         ErroredSecs ),
+    XDSL_PM_LINE_COUNTER( SeverelyErroredSecs, SeverelyErroredSecs, SeverelyErroredSecs ),
+    XDSL_PM_LINE_COUNTER( LinkRetrain,         X_RDK_LinkRetrain,   X_RDK_LinkRetrain ),
+    XDSL_PM_LINE_DAY_COUNTER( InitErrors,      X_RDK_InitErrors ),
+    XDSL_PM_CHANNEL_COUNTER( XTURCRCErrors ),
+    XDSL_PM_CHANNEL_COUNTER( XTUCCRCErrors ),
+    XDSL_PM_CHANNEL_COUNTER( XTURFECErrors ),
+    XDSL_PM_CHANNEL_COUNTER( XTUCFECErrors ),
+    XDSL_PM_CHANNEL_COUNTER( XTURHECErrors ),
+    XDSL_PM_CHANNEL_COUNTER( XTUCHECErrors )
+};
 
 static ANSC_STATUS DmlXdslGetLineStaticInfo( INT LineIndex, PDML_XDSL_LINE pstLineInfo );
 static ANSC_STATUS DmlXdslLinePrepareGlobalInfo( ANSC_HANDLE   hContext );
+static ANSC_STATUS DmlXdslLineApplyPolicy( BOOL bOfferHint );
+static void DmlXdslLineParseStandardUsed( const char *StandardUsed, DML_XDSL_STANDARD_FAMILY *penFamily, DML_XDSL_STANDARD_ANNEX *penAnnex );
+static DML_XDSL_ROUTER_REGION DmlXdslGetRouterRegion( VOID );
+static UINT DmlXdslLineTakePendingInfoTiers( INT LineIndex );
+static void DmlXdslLineAddPendingInfoTiers( INT LineIndex, UINT uTiers );
 static ANSC_STATUS DmlXdslGetParamValues( char *pComponent, char *pBus, char *pParamName, char *pReturnVal );
 static ANSC_STATUS DmlXdslSetParamValues( char *pComponent, char *pBus, char *pParamName, char *pParamVal, enum dataType_e type, BOOLEAN bCommit );
-static ANSC_STATUS DmlXdslGetParamNames( char *pComponent, char *pBus, char *pParamName, char a2cReturnVal[][256], int *pReturnSize );
-static ANSC_STATUS DmlXdslLineSendLinkStatusToEventQueue( XDSLMSGQWanData *MSGQWanData );
-static void DmlXdslTriggerEventHandlerThread( void );
-static void *DmlXdslEventHandlerThread( void *arg );
+static ANSC_STATUS DmlXdslLineSendLinkStatusToEventQueue( PXDSL_EVENT pstEvent );
+static ANSC_STATUS DmlXdslEventHandlerInit( void );
+static void DmlXdslEventRingReadable( INT iFd, UINT uEvents, PVOID pContext );
+static void DmlXdslScheduleEventDrain( void );
+static void DmlXdslEventDrainJob( PVOID pContext );
+static INT DmlXdslCoalesceEvents( PXDSL_EVENT pstEvents, INT iCount );
+static INT DmlXdslEventPhyClass( DML_XDSL_LINK_STATUS enLinkStatus );
+static void DmlXdslResyncEventsFromGlobalInfo( void );
+static void DmlXdslProcessWanEvent( PXDSL_EVENT pstEvent );
 static ANSC_STATUS DmlXdslGetChannelStaticInfo( INT LineIndex, INT ChannelIndex, PDML_XDSL_CHANNEL pstChannelInfo );
+static ANSC_STATUS DmlXdslGetChannelStats( INT LineIndex, INT ChannelIndex, PDML_XDSL_CHANNEL pstChannelInfo );
+static ULONG DmlXdslGetMonotonicMs( VOID );
 static void DmlXdslStatusStrToEnum(char *status, DML_XDSL_IF_STATUS *ifStatus);
 void DmlXdslLineLinkStatusCallback( char *ifname, DslLinkStatus_t dsl_link_state );
+static void DmlXdslLineDeliverLinkStatus( char *ifname, DML_XDSL_LINK_STATUS enLinkStatus );
+static BOOL DmlXdslLineGateLinkStatus( char *ifname, DML_XDSL_LINK_STATUS enLinkStatus );
+static void DmlXdslFlapDampingArmTimer( ULONG ulNextCheckMs );
+static void DmlXdslFlapDampingTimer( PVOID pContext );
+static void DmlXdslFlapDampingReleaseJob( PVOID pContext );
+static BOOL DmlXdslTrainHintIsLine( char *ifname );
+static void DmlXdslTrainHintTimer( PVOID pContext );
+static void DmlXdslTrainHintFallbackJob( PVOID pContext );
+static void DmlXdslTrainHintOfferJob( PVOID pContext );
+static void DmlXdslTrainHintLearnJob( PVOID pContext );
+static void DmlXdslTrainHintForgetJob( PVOID pContext );
+static BOOL DmlXdslTrainHintLineInShowtime( VOID );
+static void DmlXdslTrainHintStore( const XDSL_TRAIN_HINT *pstHint );
+static void DmlXdslShaperTimer( PVOID pContext );
+static void DmlXdslShaperUpdateJob( PVOID pContext );
+static void DmlXdslShaperPublish( const XDSL_SHAPER_RATES *pstRates );
+static void DmlXdslPmHistoryTimer( PVOID pContext );
+static void DmlXdslPmHistorySampleJob( PVOID pContext );
+static void DmlXdslTcaEvaluate( INT LineIndex, const XDSL_PM_SAMPLE *pstSample );
 static ANSC_STATUS DmlCreatePTMLink( char *ifname );
 static ANSC_STATUS DmlDeletePTMLink( char *ifname );
 static ANSC_STATUS DmlCreateATMLink( char *ifname );
+static ANSC_STATUS DmlXdslAtmLinkConfigure( PDML_XDSL_LINE_GLOBALINFO pstGlobalInfo, INT iATMInstance, const char *pPvc );
+static BOOL DmlXdslAtmPvcSearchPrepare( char *ifname, INT iATMInstance );
+static void DmlXdslAtmPvcSearchArmTimer( ULONG ulMs );
+static void DmlXdslAtmPvcSearchTimer( PVOID pContext );
+static void DmlXdslAtmPvcSearchStep( PVOID pContext );
+static void DmlXdslAtmPvcSearchFinish( const char *pPvc );
 static ANSC_STATUS DmlDeleteATMLink( char *ifname );
-static void *XTM_DMLUpdationHandlerThread(void *arg);
-static void *XTM_DMLDeletionHandlerThread(void *arg);
+static ANSC_STATUS DmlXdslQueueXTMJob( XDSL_XTM_JOB_TYPE JobType, char *ifname, ULONG *pulTicket );
+static void DmlXdslXTMJobDrain( PVOID pContext );
+static void DmlXdslXTMJobComplete( const XDSL_XTM_JOB *pstJob, ANSC_STATUS retStatus );
+static BOOL DmlXdslXTMJobIsQueued( char *ifname );
+static ANSC_STATUS DmlXdslRunXTMCreateJob( XDSL_XTM_JOB *pstJob );
+static ANSC_STATUS DmlXdslRunXTMDeleteJob( XDSL_XTM_JOB *pstJob );
+static ANSC_STATUS DmlXdslWarmRestartCollect( char *ifname, PXDSL_WARM_RESTART_SNAPSHOT pstSnapshot );
+static ANSC_STATUS DmlXdslWarmRestartValidate( char *ifname, PXDSL_WARM_RESTART_SNAPSHOT pstSaved, INT iSmState, INT *piLineIndex );
 
 int sysevent_fd = -1;
 token_t sysevent_token;
@@ -216,6 +410,9 @@ DmlXdslInit
 {
     PDATAMODEL_XDSL      pMyObject    = (PDATAMODEL_XDSL)phContext;
 
+    //PM history and counters of the previous run, the HAL restores its counters from it
+    XdslPmStoreInit();
+
     //dsl HAL init
     if ( RETURN_OK != xdsl_hal_init())
     {
@@ -238,8 +435,36 @@ DmlXdslInit
     //DSL Diagnostics init
     DmlXdslDiagnosticsInit( pMyObject );
 
-    //Trigger Event Handler thread
-    DmlXdslTriggerEventHandlerThread();
+    //Event handler runs on the shared event loop
+    if ( ANSC_STATUS_SUCCESS != XdslReactorInit() )
+    {
+        CcspTraceError(("%s Failed to start event loop\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    DmlXdslEventHandlerInit();
+
+    //Without the timer the ATM link comes up on the configured PVC, no search
+    giPvcSearchTimerId = XdslReactorAddTimer( DmlXdslAtmPvcSearchTimer, NULL );
+    if( 0 > giPvcSearchTimerId )
+    {
+        CcspTraceError(("%s Failed to create PVC search timer\n", __FUNCTION__));
+    }
+
+    //Damping has to be configured before the first link status arrives
+    DmlXdslFlapDampingInit( pMyObject );
+
+    //Profiles and standards before the line trains, the last good configuration first
+    DmlXdslTrainHintInit( pMyObject );
+
+    //WAN shaper rate follows the sync rate once the WAN link is up
+    DmlXdslShaperInit( pMyObject );
+
+    //Alert profiles are evaluated on the PM samples, load them before the first one
+    DmlXdslTcaInit( pMyObject );
+
+    //Completed 15 minute and 1 day intervals, the driver only keeps the running ones
+    DmlXdslPmHistoryInit( pMyObject );
 
     //Register linkstatus callback
     xdsl_hal_registerDslLinkStatusCallback(DmlXdslLineLinkStatusCallback);
@@ -250,6 +475,12 @@ DmlXdslInit
     //DSL  XRDKNLM Init
     DmlXdslXRdkNlmInit( pMyObject );
 
+    //DSL HAL performance counters init
+    DmlXdslPerfInit( pMyObject );
+
+    //DSL link bring-up statistics init
+    DmlXdslBringUpInit( pMyObject );
+
     return ANSC_STATUS_SUCCESS;
 }
 
@@ -296,6 +527,16 @@ DmlXdslLineInit
     //Prepare Global Information
     DmlXdslLinePrepareGlobalInfo( pMyObject );
 
+    //Static line attributes only change through DmlXdslLineApplyPolicy(), read them once here
+    for( iLoopCount = 0; iLoopCount < iTotalLines; iLoopCount++ )
+    {
+        if ( RETURN_OK != xdsl_hal_dslGetLineInfoTiers( iLoopCount, &pXDSLLineTmp[iLoopCount], XDSL_LINE_INFO_TIER_STATIC ) )
+        {
+            CcspTraceError(("%s Failed to get static info of line %d, retrying on next poll\n", __FUNCTION__, iLoopCount));
+            DmlXdslLineAddPendingInfoTiers( iLoopCount, XDSL_LINE_INFO_TIER_STATIC );
+        }
+    }
+
     return ANSC_STATUS_SUCCESS;
 }
 
@@ -332,10 +573,70 @@ static ANSC_STATUS DmlXdslLinePrepareGlobalInfo( ANSC_HANDLE   hContext )
         gpstLineGInfo[iLoopCount].LinkStatus        = XDSL_LINK_STATUS_Disabled;
         snprintf( gpstLineGInfo[iLoopCount].LowerLayers, sizeof(gpstLineGInfo[iLoopCount].LowerLayers), "%s", pXDSLLineTmp->LowerLayers );
         gpstLineGInfo[iLoopCount].iface_thread_id   = 0;
+        gpstLineGInfo[iLoopCount].PendingInfoTiers  = XDSL_LINE_INFO_TIER_SHOWTIME;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+/* DmlXdslLineApplyPolicy() */
+static ANSC_STATUS DmlXdslLineApplyPolicy( BOOL bOfferHint )
+{
+    XDSL_LINE_POLICY   stPolicy;
+    XDSL_TRAIN_HINT    stHint;
+    CHAR               acRegion[sizeof(stPolicy.Region)]  = { 0 };
+    CHAR               acXtse[XDSL_LINE_POLICY_XTSE_LEN]  = { 0 };
+    INT                iChanged                           = 0;
+
+    //Operator may pin a region, otherwise the default policy applies
+    if( CCSP_SUCCESS != GetNVRamStringConfiguration( PSM_LINE_POLICY_REGION, acRegion, sizeof(acRegion) ) || '\0' == acRegion[0] )
+    {
+        snprintf( acRegion, sizeof(acRegion), "%s", XDSL_LINE_POLICY_REGION_DEFAULT );
+    }
+
+    XdslLinePolicyGetDefault( acRegion, &stPolicy );
+
+    //Operator overrides of the region policy
+    GetNVRamStringConfiguration( PSM_LINE_POLICY_ALLOWED_PROFILES, stPolicy.AllowedProfiles, sizeof(stPolicy.AllowedProfiles) );
+    GetNVRamStringConfiguration( PSM_LINE_POLICY_STANDARDS, stPolicy.Standards, sizeof(stPolicy.Standards) );
+
+    //Only the standard and profile the line last trained with, a standard without XTSE bits can not be offered alone
+    if( bOfferHint && XdslTrainHintGetLastGood( &stHint ) &&
+        ( ANSC_STATUS_SUCCESS == XdslLinePolicyStandardsToXtse( stHint.StandardUsed, acXtse, sizeof(acXtse) ) ) )
+    {
+        if( '\0' != stHint.CurrentProfile[0] )
+        {
+            snprintf( stPolicy.AllowedProfiles, sizeof(stPolicy.AllowedProfiles), "%s", stHint.CurrentProfile );
+        }
+    }
+    else
+    {
+        bOfferHint = FALSE;
+        acXtse[0]  = '\0';
+
+        //An earlier hint may have narrowed XTSE, without policy standards the full set is everything the modem supports
+        XdslLinePolicyStandardsToXtse( ( '\0' != stPolicy.Standards[0] ) ? stPolicy.Standards : XDSL_LINE_STANDARDS_SUPPORTED,
+                                       acXtse, sizeof(acXtse) );
+    }
+
+    if( RETURN_OK != xdsl_hal_dslConfigureLine( stPolicy.AllowedProfiles, acXtse, &iChanged ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslTrainHintSetOffered( bOfferHint );
+
+    //AllowedProfiles and XTSE are static tier attributes, re-read them on the next poll
+    if( 0 != iChanged )
+    {
+        DmlXdslLineAddPendingInfoTiers( XDSL_TRAIN_HINT_LINE_INSTANCE - 1, XDSL_LINE_INFO_TIER_STATIC );
     }
 
+    CcspTraceInfo(("%s - %s:Region:%s AllowedProfiles:%s XTSE:%s hint:%d changed:%d\n", __FUNCTION__, XDSL_MARKER_LINE_CFG_CHNG,
+                   acRegion, stPolicy.AllowedProfiles, ( '\0' != acXtse[0] ) ? acXtse : "driver", bOfferHint, iChanged));
+
     return ANSC_STATUS_SUCCESS;
 }
+
 /* DmlXdslGetTotalNoofLines() */
 INT DmlXdslGetTotalNoofLines( VOID )
 {
@@ -358,16 +659,48 @@ static ANSC_STATUS DmlXdslGetLineStaticInfo( INT LineIndex, PDML_XDSL_LINE pstLi
     snprintf( pstLineInfo->Alias, sizeof(pstLineInfo->Alias), "dsl%d", LineIndex );
 
     //As of now hardcoded
-    snprintf( pstLineInfo->StandardsSupported, sizeof(pstLineInfo->StandardsSupported), "%s", "G.992.1_Annex_A, G.992.1_Annex_B, G.992.1_Annex_C, T1.413, G.992.2, G.992.3_Annex_A, G.992.3_Annex_B, G.992.3_Annex_C, G.993.1, G.993.1_Annex_A, G.993.2_Annex_B, G.993.2_Annex_C" );
+    snprintf( pstLineInfo->StandardsSupported, sizeof(pstLineInfo->StandardsSupported), "%s", XDSL_LINE_STANDARDS_SUPPORTED );
 
     return ANSC_STATUS_SUCCESS;
 }
 
+/* DmlXdslLineTakePendingInfoTiers() */
+static UINT DmlXdslLineTakePendingInfoTiers( INT LineIndex )
+{
+    UINT uTiers = 0;
+
+    if( ( NULL == gpstLineGInfo ) || ( LineIndex < 0 ) || ( LineIndex >= DmlXdslGetTotalNoofLines() ) )
+    {
+        return XDSL_LINE_INFO_TIER_ALL;
+    }
+
+    pthread_mutex_lock(&gmXdslGInfo_mutex);
+    uTiers = gpstLineGInfo[LineIndex].PendingInfoTiers;
+    gpstLineGInfo[LineIndex].PendingInfoTiers = 0;
+    pthread_mutex_unlock(&gmXdslGInfo_mutex);
+
+    return uTiers;
+}
+
+/* DmlXdslLineAddPendingInfoTiers() */
+static void DmlXdslLineAddPendingInfoTiers( INT LineIndex, UINT uTiers )
+{
+    if( ( NULL == gpstLineGInfo ) || ( LineIndex < 0 ) || ( LineIndex >= DmlXdslGetTotalNoofLines() ) )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmXdslGInfo_mutex);
+    gpstLineGInfo[LineIndex].PendingInfoTiers |= uTiers;
+    pthread_mutex_unlock(&gmXdslGInfo_mutex);
+}
+
 /* DmlXdslGetLineCfg() */
 ANSC_STATUS DmlXdslGetLineCfg( INT LineIndex, PDML_XDSL_LINE pstLineInfo )
 {
     char            tmpBuf[128]    = { 0 };
     hal_param_t     req_param;
+    UINT            uTiers         = 0;
 
     if( NULL == pstLineInfo )
     {
@@ -385,10 +718,12 @@ ANSC_STATUS DmlXdslGetLineCfg( INT LineIndex, PDML_XDSL_LINE pstLineInfo )
 
     pstLineInfo->Enable = atoi(req_param.value);
 
-    //Get line full information
-    if ( RETURN_OK != xdsl_hal_dslGetLineInfo( LineIndex, pstLineInfo ) )
+    //Live attributes on every poll, static and per-showtime ones only when pending
+    uTiers = DmlXdslLineTakePendingInfoTiers( LineIndex );
+    if ( RETURN_OK != xdsl_hal_dslGetLineInfoTiers( LineIndex, pstLineInfo, uTiers | XDSL_LINE_INFO_TIER_LIVE ) )
     {
          CcspTraceError(("%s Failed to get line info value\n", __FUNCTION__));
+         DmlXdslLineAddPendingInfoTiers( LineIndex, uTiers );
          return ANSC_STATUS_FAILURE;
     }
 
@@ -405,10 +740,11 @@ ANSC_STATUS DmlXdslGetLineCfg( INT LineIndex, PDML_XDSL_LINE pstLineInfo )
     return ANSC_STATUS_SUCCESS;
 }
 
-/* DmlXdslLineSetEnable() */
-ANSC_STATUS DmlXdslLineSetEnable( INT LineIndex, BOOL Enable )
+/* DmlXdslLineSetHalParams() */
+static ANSC_STATUS DmlXdslLineSetHalParams( INT LineIndex, ULONG ulParams, BOOL Enable, BOOL EnableDataGathering )
 {
-    hal_param_t req_param;
+    hal_param_t req_param[2];
+    int count = 0;
 
     //Validate index
     if ( LineIndex < 0 )
@@ -417,29 +753,44 @@ ANSC_STATUS DmlXdslLineSetEnable( INT LineIndex, BOOL Enable )
         return ANSC_STATUS_FAILURE;
     }
 
-    memset(&req_param, 0, sizeof(req_param));
-    snprintf(req_param.name, sizeof(req_param), XDSL_LINE_ENABLE, LineIndex);
-    snprintf(req_param.value, sizeof(req_param.value), "%d", Enable);
-    req_param.type = PARAM_BOOLEAN;
+    memset(req_param, 0, sizeof(req_param));
+    if ( ulParams & XDSL_LINE_CFG_ENABLE )
+    {
+        snprintf(req_param[count].name, sizeof(req_param[count].name), XDSL_LINE_ENABLE, LineIndex);
+        snprintf(req_param[count].value, sizeof(req_param[count].value), "%d", Enable);
+        req_param[count].type = PARAM_BOOLEAN;
+        count++;
+    }
 
-    //Set enable/disable
-    if ( RETURN_OK != xdsl_hal_dslSetLineEnable( &req_param ) )
+    if ( ulParams & XDSL_LINE_CFG_DATA_GATHERING )
     {
-        CcspTraceError(("%s Failed to set line index[%d] Flag[%d]\n", __FUNCTION__,LineIndex,Enable));
-        return ANSC_STATUS_FAILURE;
+        snprintf(req_param[count].name, sizeof(req_param[count].name), XDSL_LINE_DATA_GATHERING_ENABLE, LineIndex);
+        snprintf(req_param[count].value, sizeof(req_param[count].value), "%d", EnableDataGathering);
+        req_param[count].type = PARAM_BOOLEAN;
+        count++;
     }
 
-    CcspTraceInfo(("%s - %s:LineIndex:%d Enable:%d\n",__FUNCTION__,XDSL_MARKER_LINE_CFG_CHNG,LineIndex,Enable));
+    if ( count == 0 )
+    {
+        return ANSC_STATUS_SUCCESS;
+    }
 
-    return ANSC_STATUS_SUCCESS;
-}
+    //All parameters in one request
+    if ( RETURN_OK != xdsl_hal_dslSetLineParams( req_param, count ) )
+    {
+        CcspTraceError(("%s Failed to set line index[%d] Enable[%d] EnableDataGathering[%d]\n", __FUNCTION__,LineIndex,Enable,EnableDataGathering));
+        return ANSC_STATUS_FAILURE;
+    }
 
-/* DmlXdslLineSetDataGatheringEnable() */
-ANSC_STATUS DmlXdslLineSetDataGatheringEnable( INT LineIndex, BOOL Enable )
-{
-    //TBD
+    if ( ulParams & XDSL_LINE_CFG_ENABLE )
+    {
+        CcspTraceInfo(("%s - %s:LineIndex:%d Enable:%d\n",__FUNCTION__,XDSL_MARKER_LINE_CFG_CHNG,LineIndex,Enable));
+    }
 
-    CcspTraceInfo(("%s - %s:LineIndex:%d Enable:%d\n",__FUNCTION__,XDSL_MARKER_LINE_CFG_CHNG,LineIndex,Enable));
+    if ( ulParams & XDSL_LINE_CFG_DATA_GATHERING )
+    {
+        CcspTraceInfo(("%s - %s:LineIndex:%d EnableDataGathering:%d\n",__FUNCTION__,XDSL_MARKER_LINE_CFG_CHNG,LineIndex,EnableDataGathering));
+    }
 
     return ANSC_STATUS_SUCCESS;
 }
@@ -448,8 +799,9 @@ ANSC_STATUS DmlXdslLineSetDataGatheringEnable( INT LineIndex, BOOL Enable )
 ANSC_STATUS DmlXdslLineSetUpstream( INT LineIndex, BOOL Upstream )
 {
     pthread_t iface_thread_id = 0;
-    unsigned int check_try = 0;    
-    
+    struct timespec deadline;
+    int ret = 0;
+
     CcspTraceInfo(("%s - %d: Received Upstream %d event\n",__FUNCTION__,__LINE__,  Upstream));
 
     //Validate index
@@ -463,25 +815,26 @@ ANSC_STATUS DmlXdslLineSetUpstream( INT LineIndex, BOOL Upstream )
     pthread_mutex_lock(&gmXdslGInfo_mutex);
     gpstLineGInfo[LineIndex].Upstream = Upstream;
     iface_thread_id = gpstLineGInfo[LineIndex].iface_thread_id;
-    pthread_mutex_unlock(&gmXdslGInfo_mutex);
-
 
     if(TRUE == Upstream)
     {
-        //Check if we already have a thread running
-        while((iface_thread_id > 0) && (check_try < 15))
+        //Wait for the old thread to terminate, it signals when it clears its id
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += XDSL_LINE_UPSTREAM_HANDOVER_TIMEOUT_SEC;
+        while(iface_thread_id > 0)
         {
-            //wait some seconds to the old thread terminate
-            sleep(1);
-
-            //re-check the thread id
-            pthread_mutex_lock(&gmXdslGInfo_mutex);
+            ret = pthread_cond_timedwait(&gcXdslIfaceThreadExit, &gmXdslGInfo_mutex, &deadline);
             iface_thread_id = gpstLineGInfo[LineIndex].iface_thread_id;
-            pthread_mutex_unlock(&gmXdslGInfo_mutex);
-
-            check_try++;
+            if(ETIMEDOUT == ret)
+            {
+                break;
+            }
         }
+    }
+    pthread_mutex_unlock(&gmXdslGInfo_mutex);
 
+    if(TRUE == Upstream)
+    {
         //Needs to start thread based on instance - TBD. As of now I started
         //Thread only starts if there are no other thread running for the interface
         if((TRUE == Upstream) && (iface_thread_id == 0))
@@ -624,6 +977,34 @@ ANSC_STATUS DmlXdslLine_GetIfaceTidByGivenIfName(char* ifname, pthread_t* thread
     return ( ANSC_STATUS_SUCCESS );
 }
 
+/* DmlXdslLineApplyConfig() */
+ANSC_STATUS DmlXdslLineApplyConfig( INT LineIndex, PDML_XDSL_LINE pstLineInfo, ULONG ulChanged )
+{
+    ANSC_STATUS returnStatus = ANSC_STATUS_SUCCESS;
+
+    if( NULL == pstLineInfo )
+    {
+        CcspTraceError(("%s Invalid Memory\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Enable and EnableDataGathering go to the HAL in one set
+    if( ulChanged & ( XDSL_LINE_CFG_ENABLE | XDSL_LINE_CFG_DATA_GATHERING ) )
+    {
+        returnStatus = DmlXdslLineSetHalParams( LineIndex, ulChanged, pstLineInfo->Enable, pstLineInfo->EnableDataGathering );
+    }
+
+    if( ulChanged & XDSL_LINE_CFG_UPSTREAM )
+    {
+        if( ANSC_STATUS_SUCCESS != DmlXdslLineSetUpstream( LineIndex, pstLineInfo->Upstream ) )
+        {
+            returnStatus = ANSC_STATUS_FAILURE;
+        }
+    }
+
+    return returnStatus;
+}
+
 /* DmlXdslLine_UpdateIfaceTidByGivenIfName() */
 ANSC_STATUS DmlXdslLine_UpdateIfaceTidByGivenIfName(char* ifname, pthread_t new_thread_id)
 {
@@ -648,6 +1029,11 @@ ANSC_STATUS DmlXdslLine_UpdateIfaceTidByGivenIfName(char* ifname, pthread_t new_
     //Get the data
     pthread_mutex_lock(&gmXdslGInfo_mutex);
     gpstLineGInfo[LineIndex].iface_thread_id = new_thread_id;
+    if (0 == new_thread_id)
+    {
+        //Wake up an Upstream set waiting to start the next thread
+        pthread_cond_broadcast(&gcXdslIfaceThreadExit);
+    }
     pthread_mutex_unlock(&gmXdslGInfo_mutex);
 
     return ( ANSC_STATUS_SUCCESS );
@@ -682,11 +1068,79 @@ ANSC_STATUS DmlXdslLine_GetStandardUsedByGivenIfName(char* ifname, char* Standar
     return ( ANSC_STATUS_SUCCESS );
 }
 
+/* DmlXdslLineParseStandardUsed() */
+static void DmlXdslLineParseStandardUsed( const char *StandardUsed, DML_XDSL_STANDARD_FAMILY *penFamily, DML_XDSL_STANDARD_ANNEX *penAnnex )
+{
+    const char *pAnnex = NULL;
+
+    if(strstr(StandardUsed,"G.992.1") || strstr(StandardUsed,"T1.413")  ||
+       strstr(StandardUsed,"G.992.2") || strstr(StandardUsed,"G.992.3") ||
+       strstr(StandardUsed,"G.992.5")) /* ADSL */
+    {
+        *penFamily = XDSL_STANDARD_FAMILY_ADSL;
+    }
+    else if(strstr(StandardUsed,"G.993.2")) /* VDSL */
+    {
+        *penFamily = XDSL_STANDARD_FAMILY_VDSL;
+    }
+    else if(strstr(StandardUsed,"G.9701")) /* GFAST */
+    {
+        *penFamily = XDSL_STANDARD_FAMILY_GFAST;
+    }
+    else
+    {
+        *penFamily = XDSL_STANDARD_FAMILY_UNKNOWN;
+    }
+
+    *penAnnex = XDSL_STANDARD_ANNEX_NONE;
+    pAnnex    = strstr(StandardUsed, "_Annex_");
+    if( NULL == pAnnex )
+    {
+        return;
+    }
+
+    switch( pAnnex[strlen("_Annex_")] )
+    {
+        case 'A': *penAnnex = XDSL_STANDARD_ANNEX_A; break;
+        case 'B': *penAnnex = XDSL_STANDARD_ANNEX_B; break;
+        case 'C': *penAnnex = XDSL_STANDARD_ANNEX_C; break;
+        case 'I': *penAnnex = XDSL_STANDARD_ANNEX_I; break;
+        case 'J': *penAnnex = XDSL_STANDARD_ANNEX_J; break;
+        case 'L': *penAnnex = XDSL_STANDARD_ANNEX_L; break;
+        case 'M': *penAnnex = XDSL_STANDARD_ANNEX_M; break;
+        default: break;
+    }
+}
+
+/* DmlXdslGetRouterRegion() */
+static DML_XDSL_ROUTER_REGION DmlXdslGetRouterRegion( VOID )
+{
+#ifdef _HUB4_PRODUCT_REQ_
+    char region[16] = {'\0'};
+
+    if ( XDSL_ROUTER_REGION_UNKNOWN != __atomic_load_n( &genXdslRouterRegion, __ATOMIC_RELAXED ) )
+    {
+        return __atomic_load_n( &genXdslRouterRegion, __ATOMIC_RELAXED );
+    }
+
+    //A failed lookup is not kept, the next call asks the platform again
+    if ( 0 == platform_hal_GetRouterRegion(region) )
+    {
+        __atomic_store_n( &genXdslRouterRegion, ( 0 == strncmp(region, "GB", strlen("GB")) ) ? XDSL_ROUTER_REGION_GB : XDSL_ROUTER_REGION_OTHER, __ATOMIC_RELAXED );
+    }
+#endif
+
+    return __atomic_load_n( &genXdslRouterRegion, __ATOMIC_RELAXED );
+}
+
 /* DmlXdslLine_UpdateStandardUsedByGivenIfName() */
 ANSC_STATUS DmlXdslLine_UpdateStandardUsedByGivenIfName(char* ifname, char* StandardUsed)
 {
-    ANSC_STATUS   retStatus;
-    INT           LineIndex = -1;
+    ANSC_STATUS               retStatus;
+    INT                       LineIndex = -1;
+    DML_XDSL_STANDARD_FAMILY  enFamily;
+    DML_XDSL_STANDARD_ANNEX   enAnnex;
+    DML_XDSL_ROUTER_REGION    enRegion;
 
     //Validate index
     if ( ( NULL == ifname ) || ( NULL == StandardUsed ) )
@@ -702,11 +1156,20 @@ ANSC_STATUS DmlXdslLine_UpdateStandardUsedByGivenIfName(char* ifname, char* Stan
         return ANSC_STATUS_FAILURE;
     }
 
+    //Resolved once per showtime, the state machine tick only compares the cached values
+    DmlXdslLineParseStandardUsed( StandardUsed, &enFamily, &enAnnex );
+    enRegion = DmlXdslGetRouterRegion( );
+
     //Get the data
     pthread_mutex_lock(&gmXdslGInfo_mutex);
     strncpy(gpstLineGInfo[LineIndex].StandardUsed, StandardUsed, sizeof(gpstLineGInfo[LineIndex].StandardUsed));
+    gpstLineGInfo[LineIndex].StandardFamily = enFamily;
+    gpstLineGInfo[LineIndex].StandardAnnex  = enAnnex;
+    gpstLineGInfo[LineIndex].RouterRegion   = enRegion;
     pthread_mutex_unlock(&gmXdslGInfo_mutex);
 
+    CcspTraceInfo(("%s - IfName:%s StandardUsed:%s Family:%d Annex:%d Region:%d\n", __FUNCTION__, ifname, StandardUsed, enFamily, enAnnex, enRegion));
+
     return ( ANSC_STATUS_SUCCESS );
 }
 
@@ -736,6 +1199,20 @@ ANSC_STATUS DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( char *ifname, PDML_XDS
     memcpy( pGlobalInfo, &gpstLineGInfo[LineIndex], sizeof(DML_XDSL_LINE_GLOBALINFO));
     pthread_mutex_unlock(&gmXdslGInfo_mutex);
 
+#ifdef _HUB4_PRODUCT_REQ_
+    //The region lookup failed when StandardUsed was resolved, retry until it succeeds
+    if( ( '\0' != pGlobalInfo->StandardUsed[0] ) && ( XDSL_ROUTER_REGION_UNKNOWN == pGlobalInfo->RouterRegion ) )
+    {
+        pGlobalInfo->RouterRegion = DmlXdslGetRouterRegion( );
+        if( XDSL_ROUTER_REGION_UNKNOWN != pGlobalInfo->RouterRegion )
+        {
+            pthread_mutex_lock(&gmXdslGInfo_mutex);
+            gpstLineGInfo[LineIndex].RouterRegion = pGlobalInfo->RouterRegion;
+            pthread_mutex_unlock(&gmXdslGInfo_mutex);
+        }
+    }
+#endif
+
     return ( ANSC_STATUS_SUCCESS );
 }
 
@@ -770,6 +1247,13 @@ ANSC_STATUS DmlXdslLineUpdateLinkStatusAndGetGlobalInfoForGivenIfName( char *ifn
         {
             //Update link status
             gpstLineGInfo[iLoopCount].LinkStatus = enLinkStatus;
+
+            //A new showtime renegotiated the per-showtime line attributes
+            if( XDSL_LINK_STATUS_Up == enLinkStatus )
+            {
+                gpstLineGInfo[iLoopCount].PendingInfoTiers |= XDSL_LINE_INFO_TIER_SHOWTIME;
+            }
+
             memcpy( pGlobalInfo, &gpstLineGInfo[iLoopCount], sizeof(DML_XDSL_LINE_GLOBALINFO));
             retStatus = ANSC_STATUS_SUCCESS;
             break;
@@ -784,6 +1268,11 @@ ANSC_STATUS DmlXdslLineUpdateLinkStatusAndGetGlobalInfoForGivenIfName( char *ifn
                 //Update link status
                 gpstLineGInfo[iLoopCount].LinkStatus = enLinkStatus;
 
+                if( XDSL_LINK_STATUS_Up == enLinkStatus )
+                {
+                    gpstLineGInfo[iLoopCount].PendingInfoTiers |= XDSL_LINE_INFO_TIER_SHOWTIME;
+                }
+
                 memcpy( pGlobalInfo, &gpstLineGInfo[iLoopCount], sizeof(DML_XDSL_LINE_GLOBALINFO));
                 retStatus = ANSC_STATUS_SUCCESS;
                 CcspTraceInfo(("%s %d Updated received ifname %s into index %d\n", __FUNCTION__, __LINE__, ifname, iLoopCount));
@@ -798,29 +1287,22 @@ ANSC_STATUS DmlXdslLineUpdateLinkStatusAndGetGlobalInfoForGivenIfName( char *ifn
 }
 
 /* *DmlXdslLineSendLinkStatusToEventQueue() */
-static ANSC_STATUS DmlXdslLineSendLinkStatusToEventQueue( XDSLMSGQWanData *MSGQWanData )
+static ANSC_STATUS DmlXdslLineSendLinkStatusToEventQueue( PXDSL_EVENT pstEvent )
 {
-    DSLEventQData    EventMsg = { 0 };
-    mqd_t                mq;
-    char                 buffer[ MAX_QUEUE_MSG_SIZE ];
-
     //Validate buffer
-    if( NULL == MSGQWanData )
+    if( NULL == pstEvent )
     {
-        CcspTraceError(("%s %d Invalid Buffer\n", __FUNCTION__, __LINE__));\
+        CcspTraceError(("%s %d Invalid Buffer\n", __FUNCTION__, __LINE__));
         return ANSC_STATUS_FAILURE;
     }
 
-    //message queue send
-    mq = mq_open(XDSL_EVENT_QUEUE_NAME, O_WRONLY);
-    CHECK((mqd_t)-1 != mq);
-    memset(buffer, 0, MAX_QUEUE_MSG_SIZE);
-    EventMsg.MsgType = MSG_TYPE_WAN;
+    pstEvent->EventType = XDSL_EVENT_TYPE_WAN;
 
-    memcpy(EventMsg.Msg,MSGQWanData,sizeof(XDSLMSGQWanData));
-    memcpy(buffer,&EventMsg,sizeof(EventMsg));
-    CHECK(0 <= mq_send(mq, buffer, MAX_QUEUE_MSG_SIZE, 0));
-    CHECK((mqd_t)-1 != mq_close(mq));
+    if( ANSC_STATUS_SUCCESS != XdslEventRingPush( pstEvent ) )
+    {
+        CcspTraceError(("%s %d - Event ring full, %s will be resynced from global info\n", __FUNCTION__, __LINE__, pstEvent->Name));
+        return ANSC_STATUS_FAILURE;
+    }
 
     CcspTraceInfo(("%s %d - Successfully sent WAN message to event queue\n", __FUNCTION__, __LINE__));
 
@@ -868,7 +1350,6 @@ static void DmlXdslStatusStrToEnum(char *status, DML_XDSL_IF_STATUS *ifStatus)
 void DmlXdslLineLinkStatusCallback( char *ifname, DslLinkStatus_t dsl_link_state )
 {
     DML_XDSL_LINK_STATUS tmpLinkStatus;
-    INT                      LineIndex     = -1;
     BOOL                     IsValidStatus = TRUE;
 
     CcspTraceInfo(("%s - %s:IfName:%s Linkstate:%d\n",__FUNCTION__, XDSL_MARKER_LINE_LINK_CB, ifname, dsl_link_state ));
@@ -922,191 +1403,333 @@ void DmlXdslLineLinkStatusCallback( char *ifname, DslLinkStatus_t dsl_link_state
     //Update link status in global info if valid status and ignore if invalid
     if( TRUE == IsValidStatus )
     {
-       ANSC_STATUS    retStatus;
-       DML_XDSL_LINE_GLOBALINFO  stGlobalInfo = { 0 };
+       DmlXdslLineGateLinkStatus( ifname, tmpLinkStatus );
+    }
+}
 
-       //Check and get copy of the data
-       retStatus = DmlXdslLineUpdateLinkStatusAndGetGlobalInfoForGivenIfName( ifname, tmpLinkStatus, &stGlobalInfo );
+/* DmlXdslLineGateLinkStatus() */
+static BOOL DmlXdslLineGateLinkStatus( char *ifname, DML_XDSL_LINK_STATUS enLinkStatus )
+{
+    ULONG    ulNextCheckMs = 0;
+    BOOL     bDeliver;
 
-       //Validate return status
-       if ( ANSC_STATUS_SUCCESS == retStatus )
-       {
-           XDSLMSGQWanData MSGQWanData = { 0 };
+    //Decision and delivery in one step, a release running alongside can not publish an older status after this one
+    pthread_mutex_lock(&gmXdslLinkDeliver_mutex);
 
-           //Prepare MSGQData buffer
-           snprintf( MSGQWanData.Name, sizeof( MSGQWanData.Name ), "%s", stGlobalInfo.Name );
-           snprintf( MSGQWanData.LowerLayers, sizeof( MSGQWanData.LowerLayers ), "%s", stGlobalInfo.LowerLayers );
-           MSGQWanData.LinkStatus = stGlobalInfo.LinkStatus;
+    //Every link status source goes through damping, retrain oscillation is held back from WAN manager and the state machine
+    bDeliver = XdslFlapDampingApply( ifname, enLinkStatus, &ulNextCheckMs );
+    DmlXdslFlapDampingArmTimer( ulNextCheckMs );
 
-           //Send message to Queue.
-           DmlXdslLineSendLinkStatusToEventQueue( &MSGQWanData );
-       }
+    if( TRUE == bDeliver )
+    {
+        DmlXdslLineDeliverLinkStatus( ifname, enLinkStatus );
     }
+
+    pthread_mutex_unlock(&gmXdslLinkDeliver_mutex);
+
+    return bDeliver;
 }
 
-/* DmlXdslTriggerEventHandlerThread() */
-void DmlXdslTriggerEventHandlerThread( void )
+/* *DmlXdslLineDeliverLinkStatus() */
+static void DmlXdslLineDeliverLinkStatus( char *ifname, DML_XDSL_LINK_STATUS enLinkStatus )
 {
-    pthread_t EvtThreadId;
-    int iErrorCode = 0;
+    ANSC_STATUS    retStatus;
+    DML_XDSL_LINE_GLOBALINFO  stGlobalInfo = { 0 };
 
-    //DSL event handler thread
-    iErrorCode = pthread_create( &EvtThreadId, NULL, &DmlXdslEventHandlerThread, NULL );
+    //Check and get copy of the data
+    retStatus = DmlXdslLineUpdateLinkStatusAndGetGlobalInfoForGivenIfName( ifname, enLinkStatus, &stGlobalInfo );
 
-    if( 0 != iErrorCode )
+    //Validate return status
+    if ( ANSC_STATUS_SUCCESS == retStatus )
     {
-        CcspTraceInfo(("%s %d - Failed to start Event Handler Thread EC:%d\n", __FUNCTION__, __LINE__, iErrorCode ));
+        XDSL_EVENT stEvent = { 0 };
+
+        //Prepare event
+        snprintf( stEvent.Name, sizeof( stEvent.Name ), "%s", stGlobalInfo.Name );
+        snprintf( stEvent.LowerLayers, sizeof( stEvent.LowerLayers ), "%s", stGlobalInfo.LowerLayers );
+        stEvent.LinkStatus = stGlobalInfo.LinkStatus;
+
+        //Send message to Queue.
+        DmlXdslLineSendLinkStatusToEventQueue( &stEvent );
     }
-    else
+}
+
+/* DmlXdslFlapDampingArmTimer() */
+static void DmlXdslFlapDampingArmTimer( ULONG ulNextCheckMs )
+{
+    //0 disarms the timer when no line is suppressed
+    if( 0 <= giFlapDampingTimerId )
     {
-        CcspTraceInfo(("%s %d - Event Handler Thread Started Successfully\n", __FUNCTION__, __LINE__ ));
+        XdslReactorSetTimer( giFlapDampingTimerId, ulNextCheckMs, 0 );
     }
 }
 
-/* *DmlXdslEventHandlerThread() */
-static void *DmlXdslEventHandlerThread( void *arg )
+/* DmlXdslFlapDampingTimer() */
+static void DmlXdslFlapDampingTimer( PVOID pContext )
 {
-  mqd_t     mq;
-  struct    mq_attr attr;
-  char      buffer[MAX_QUEUE_MSG_SIZE + 1];
-
-  /* initialize the queue attributes */
-  attr.mq_flags   = 0;
-  attr.mq_maxmsg  = MAX_QUEUE_LENGTH;
-  attr.mq_msgsize = MAX_QUEUE_MSG_SIZE;
-  attr.mq_curmsgs = 0;
-
-  /* create the message queue */
-  mq = mq_open(XDSL_EVENT_QUEUE_NAME, O_CREAT | O_RDONLY, 0644, &attr);
-
-  CHECK((mqd_t)-1 != mq);
+    //Delivering the released status takes the global info lock, keep it off the reactor thread
+    if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DmlXdslFlapDampingReleaseJob, NULL ) )
+    {
+        //Nothing else re-arms the one-shot timer, a lost release would keep the line suppressed
+        DmlXdslFlapDampingArmTimer( XDSL_FLAP_DAMPING_RESUBMIT_MS );
+    }
+}
 
-  do
-  {
-    ssize_t              bytes_read;
-    DSLEventQData    EventMsg = { 0 };
+/* *DmlXdslFlapDampingReleaseJob() */
+static void DmlXdslFlapDampingReleaseJob( PVOID pContext )
+{
+    XDSL_FLAP_DAMPING_RELEASE astReleased[XDSL_FLAP_DAMPING_MAX_IFACES];
+    ULONG                     ulNextCheckMs = 0;
+    INT                       iCount;
+    INT                       iLoopCount;
 
-    /* receive the message */
-    bytes_read = mq_receive(mq, buffer, MAX_QUEUE_MSG_SIZE, NULL);
+    //Same serialization as DmlXdslLineGateLinkStatus(), a status released here is still the latest when it is delivered
+    pthread_mutex_lock(&gmXdslLinkDeliver_mutex);
 
-    CHECK(bytes_read >= 0);
+    iCount = XdslFlapDampingRelease( astReleased, XDSL_FLAP_DAMPING_MAX_IFACES, &ulNextCheckMs );
+    DmlXdslFlapDampingArmTimer( ulNextCheckMs );
 
-    buffer[bytes_read] = '\0';
+    for( iLoopCount = 0; iLoopCount < iCount; iLoopCount++ )
+    {
+        DmlXdslLineDeliverLinkStatus( astReleased[iLoopCount].Name, astReleased[iLoopCount].LinkStatus );
+    }
 
-    memcpy(&EventMsg, buffer, sizeof(EventMsg));
+    pthread_mutex_unlock(&gmXdslLinkDeliver_mutex);
+}
 
-    //WAN Event
-    if( MSG_TYPE_WAN == EventMsg.MsgType )
+/* DmlXdslEventHandlerInit() */
+static ANSC_STATUS DmlXdslEventHandlerInit( void )
+{
+    //Event ring must exist before the link status callback is registered
+    if( ANSC_STATUS_SUCCESS != XdslEventRingInit( ) )
     {
-       XDSLMSGQWanData MSGQWanData        = { 0 };
-       char               acTmpPhyStatus[32] = { 0 };
-       BOOL               IsValidStatus      = TRUE;
-#ifdef _HUB4_PRODUCT_REQ_
-       char               ledStatus[32]      = { 0 };
-#endif
+        CcspTraceError(("%s %d - Failed to init event ring\n", __FUNCTION__, __LINE__ ));
+        return ANSC_STATUS_FAILURE;
+    }
 
-       memcpy(&MSGQWanData, EventMsg.Msg, sizeof(XDSLMSGQWanData));
+    if( ANSC_STATUS_SUCCESS != XdslReactorAddFd( XdslEventRingGetFd( ), DmlXdslEventRingReadable, NULL ) )
+    {
+        CcspTraceError(("%s %d - Failed to watch event ring\n", __FUNCTION__, __LINE__ ));
+        return ANSC_STATUS_FAILURE;
+    }
 
-       CcspTraceInfo(("%s - MSGQ Name:%s LowerLayers:%s LinkStatus:%d\n", __FUNCTION__, MSGQWanData.Name, MSGQWanData.LowerLayers, MSGQWanData.LinkStatus));
+    CcspTraceInfo(("%s %d - Event Handler registered Successfully\n", __FUNCTION__, __LINE__ ));
 
-       switch( MSGQWanData.LinkStatus )
-       {
-           case XDSL_LINK_STATUS_Up:
-           {
-               snprintf( acTmpPhyStatus, sizeof( acTmpPhyStatus ), "%s", "Up" );
-           }
-           break; /* * XDSL_LINK_STATUS_Up */
-
-           case XDSL_LINK_STATUS_Initializing:
-           case XDSL_LINK_STATUS_EstablishingLink:
-           {
-#ifdef _HUB4_PRODUCT_REQ_
-               sysevent_get(sysevent_fd, sysevent_token, SYSEVENT_WAN_LED_STATE, ledStatus, sizeof(ledStatus));
-               if(strncmp(ledStatus, SOLID_GREEN, sizeof(ledStatus)) != 0)
-               {
-                   sysevent_set(sysevent_fd, sysevent_token, SYSEVENT_WAN_LED_STATE, FLASHING_AMBER, 0);
-                   snprintf( acTmpPhyStatus, sizeof( acTmpPhyStatus ), "%s", "Initializing" );
-               }
-#endif
-           }
-           break; /* * XDSL_LINK_STATUS_Initializing XDSL_LINK_STATUS_EstablishingLink */
-
-           case XDSL_LINK_STATUS_NoSignal:
-           case XDSL_LINK_STATUS_Disabled:
-           case XDSL_LINK_STATUS_Error:
-           {
-               snprintf( acTmpPhyStatus, sizeof( acTmpPhyStatus ), "%s", "Down" );
-           }
-           break; /* * XDSL_LINK_STATUS_NoSignal XDSL_LINK_STATUS_Disabled XDSL_LINK_STATUS_Error */
-
-           default:
-           {
-               IsValidStatus = FALSE;
-           }
-           break; /* * default */
-       }
+    return ANSC_STATUS_SUCCESS;
+}
 
-       //Check whether valid status or not
-       if( TRUE == IsValidStatus )
-       {
-          DmlXdslSetPhyStatusForWanManager( MSGQWanData.Name, acTmpPhyStatus );
-       }
+/* DmlXdslEventRingReadable() */
+static void DmlXdslEventRingReadable( INT iFd, UINT uEvents, PVOID pContext )
+{
+    if( ANSC_STATUS_SUCCESS == XdslEventRingWait( ) )
+    {
+        DmlXdslScheduleEventDrain( );
     }
+}
 
-  }while(1);
-
-  //exit from thread
-  pthread_exit(NULL);
+/* DmlXdslScheduleEventDrain() */
+static void DmlXdslScheduleEventDrain( void )
+{
+    //At most one drain job in flight keeps the events in order across workers
+    if( 0 != __atomic_exchange_n( &guXdslEventDrainScheduled, 1, __ATOMIC_SEQ_CST ) )
+    {
+        return;
+    }
 
+    if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DmlXdslEventDrainJob, NULL ) )
+    {
+        __atomic_store_n( &guXdslEventDrainScheduled, 0, __ATOMIC_SEQ_CST );
+    }
 }
 
-/* *DmlXdslGetParamNames() */
-static ANSC_STATUS DmlXdslGetParamNames( char *pComponent, char *pBus, char *pParamName, char a2cReturnVal[][256], int *pReturnSize )
+/* *DmlXdslEventDrainJob() */
+static void DmlXdslEventDrainJob( PVOID pContext )
 {
-    CCSP_MESSAGE_BUS_INFO  *bus_info         = (CCSP_MESSAGE_BUS_INFO *)bus_handle;
-    parameterInfoStruct_t  **retInfo;
-    char                    *ParamName[ 1 ];
-    int                    ret               = 0,
-                           nval;
+    XDSL_EVENT astEvents[XDSL_EVENT_RING_SIZE];
 
-    ret = CcspBaseIf_getParameterNames(
-                                    bus_handle,
-                                    pComponent,
-                                    pBus,
-                                    pParamName,
-                                    1,
-                                    &nval,
-                                    &retInfo);
-
-    //Copy the value
-    if( CCSP_SUCCESS == ret )
+    do
     {
-        int iLoopCount;
+        INT iCount;
+        INT iLoopCount;
 
-        *pReturnSize = nval;
-
-        for( iLoopCount = 0; iLoopCount < nval; iLoopCount++ )
+        //Drain everything queued so far, a full batch means more may be waiting
+        do
         {
-           if( NULL != retInfo[iLoopCount]->parameterName )
-           {
-              snprintf( a2cReturnVal[iLoopCount], strlen( retInfo[iLoopCount]->parameterName ) + 1, "%s", retInfo[iLoopCount]->parameterName );
-           }
-        }
+            iCount = 0;
+            while( ( iCount < XDSL_EVENT_RING_SIZE ) && XdslEventRingPop( &astEvents[iCount] ) )
+            {
+                iCount++;
+            }
 
-        if( retInfo )
-        {
-          free_parameterInfoStruct_t(bus_handle, nval, retInfo);
-        }
+            DmlXdslCoalesceEvents( astEvents, iCount );
 
-        return ANSC_STATUS_SUCCESS;
-    }
+            for( iLoopCount = 0; iLoopCount < iCount; iLoopCount++ )
+            {
+                //Superseded events have been cleared by the coalescing pass
+                if( XDSL_EVENT_TYPE_WAN == astEvents[iLoopCount].EventType )
+                {
+                    DmlXdslProcessWanEvent( &astEvents[iLoopCount] );
+                }
+            }
+        } while( XDSL_EVENT_RING_SIZE == iCount );
+
+        //Events were dropped while the ring was full, republish the current state
+        if( TRUE == XdslEventRingTakeOverflow( ) )
+        {
+            DmlXdslResyncEventsFromGlobalInfo( );
+        }
+
+        __atomic_store_n( &guXdslEventDrainScheduled, 0, __ATOMIC_SEQ_CST );
 
-    if( retInfo )
+        //A push that raced with the flag reset found the job still scheduled
+    } while( XdslEventRingHasPending( ) && ( 0 == __atomic_exchange_n( &guXdslEventDrainScheduled, 1, __ATOMIC_SEQ_CST ) ) );
+}
+
+/* *DmlXdslEventPhyClass() */
+static INT DmlXdslEventPhyClass( DML_XDSL_LINK_STATUS enLinkStatus )
+{
+    //Same grouping as DmlXdslProcessWanEvent(), 0 for the non terminal statuses
+    switch( enLinkStatus )
     {
-      free_parameterInfoStruct_t(bus_handle, nval, retInfo);
+        case XDSL_LINK_STATUS_Up:
+            return 1;
+
+        case XDSL_LINK_STATUS_NoSignal:
+        case XDSL_LINK_STATUS_Disabled:
+        case XDSL_LINK_STATUS_Error:
+            return 2;
+
+        default:
+            return 0;
     }
+}
 
-    return ANSC_STATUS_FAILURE;
+/* *DmlXdslCoalesceEvents() */
+static INT DmlXdslCoalesceEvents( PXDSL_EVENT pstEvents, INT iCount )
+{
+    INT iCoalesced = 0;
+    INT iLoopCount;
+    INT iNext;
+
+    /*
+     * Only the latest link status of an interface matters to WAN manager, so
+     * an up/down/up burst drained in one batch is delivered as the final up.
+     * An event is only superseded by the next one of its interface when that
+     * one is an up/down or maps to the same phy status. Initializing after a
+     * down must not hide the down from WAN manager.
+     */
+    for( iLoopCount = 0; iLoopCount < iCount; iLoopCount++ )
+    {
+        for( iNext = iLoopCount + 1; iNext < iCount; iNext++ )
+        {
+            if( ( pstEvents[iNext].EventType == pstEvents[iLoopCount].EventType ) &&
+                ( 0 == strcmp( pstEvents[iNext].Name, pstEvents[iLoopCount].Name ) ) )
+            {
+                if( ( 0 == DmlXdslEventPhyClass( pstEvents[iNext].LinkStatus ) ) &&
+                    ( 0 != DmlXdslEventPhyClass( pstEvents[iLoopCount].LinkStatus ) ) )
+                {
+                    break;
+                }
+
+                CcspTraceInfo(("%s - Seq:%u LinkStatus:%d for %s superseded by Seq:%u\n", __FUNCTION__, pstEvents[iLoopCount].ulSequence, pstEvents[iLoopCount].LinkStatus, pstEvents[iLoopCount].Name, pstEvents[iNext].ulSequence));
+                pstEvents[iLoopCount].EventType = 0;
+                iCoalesced++;
+                break;
+            }
+        }
+    }
+
+    if( 0 < iCoalesced )
+    {
+        XdslEventRingRecordCoalesced( iCoalesced );
+    }
+
+    return iCoalesced;
+}
+
+/* *DmlXdslResyncEventsFromGlobalInfo() */
+static void DmlXdslResyncEventsFromGlobalInfo( void )
+{
+    XDSL_EVENT_RING_STATS stStats = { 0 };
+    INT                   iTotalLines = DmlXdslGetTotalNoofLines();
+    INT                   iLoopCount;
+
+    XdslEventRingGetStats( &stStats );
+    CcspTraceWarning(("%s - Event ring overflowed, Pushed:%lu Dropped:%lu Coalesced:%lu\n", __FUNCTION__, stStats.Pushed, stStats.Dropped, stStats.Coalesced));
+
+    if( NULL == gpstLineGInfo )
+    {
+        return;
+    }
+
+    for( iLoopCount = 0; iLoopCount < iTotalLines; iLoopCount++ )
+    {
+        XDSL_EVENT stEvent = { 0 };
+
+        pthread_mutex_lock(&gmXdslGInfo_mutex);
+        stEvent.EventType  = XDSL_EVENT_TYPE_WAN;
+        stEvent.LinkStatus = gpstLineGInfo[iLoopCount].LinkStatus;
+        snprintf( stEvent.Name, sizeof( stEvent.Name ), "%s", gpstLineGInfo[iLoopCount].Name );
+        snprintf( stEvent.LowerLayers, sizeof( stEvent.LowerLayers ), "%s", gpstLineGInfo[iLoopCount].LowerLayers );
+        pthread_mutex_unlock(&gmXdslGInfo_mutex);
+
+        DmlXdslProcessWanEvent( &stEvent );
+    }
+}
+
+/* *DmlXdslProcessWanEvent() */
+static void DmlXdslProcessWanEvent( PXDSL_EVENT pstEvent )
+{
+    char               acTmpPhyStatus[32] = { 0 };
+    BOOL               IsValidStatus      = TRUE;
+#ifdef _HUB4_PRODUCT_REQ_
+    char               ledStatus[32]      = { 0 };
+#endif
+
+    CcspTraceInfo(("%s - Event Seq:%u Name:%s LowerLayers:%s LinkStatus:%d\n", __FUNCTION__, pstEvent->ulSequence, pstEvent->Name, pstEvent->LowerLayers, pstEvent->LinkStatus));
+
+    switch( pstEvent->LinkStatus )
+    {
+        case XDSL_LINK_STATUS_Up:
+        {
+            snprintf( acTmpPhyStatus, sizeof( acTmpPhyStatus ), "%s", "Up" );
+        }
+        break; /* * XDSL_LINK_STATUS_Up */
+
+        case XDSL_LINK_STATUS_Initializing:
+        case XDSL_LINK_STATUS_EstablishingLink:
+        {
+#ifdef _HUB4_PRODUCT_REQ_
+            sysevent_get(sysevent_fd, sysevent_token, SYSEVENT_WAN_LED_STATE, ledStatus, sizeof(ledStatus));
+            if(strncmp(ledStatus, SOLID_GREEN, sizeof(ledStatus)) != 0)
+            {
+                sysevent_set(sysevent_fd, sysevent_token, SYSEVENT_WAN_LED_STATE, FLASHING_AMBER, 0);
+                snprintf( acTmpPhyStatus, sizeof( acTmpPhyStatus ), "%s", "Initializing" );
+            }
+#endif
+        }
+        break; /* * XDSL_LINK_STATUS_Initializing XDSL_LINK_STATUS_EstablishingLink */
+
+        case XDSL_LINK_STATUS_NoSignal:
+        case XDSL_LINK_STATUS_Disabled:
+        case XDSL_LINK_STATUS_Error:
+        {
+            snprintf( acTmpPhyStatus, sizeof( acTmpPhyStatus ), "%s", "Down" );
+        }
+        break; /* * XDSL_LINK_STATUS_NoSignal XDSL_LINK_STATUS_Disabled XDSL_LINK_STATUS_Error */
+
+        default:
+        {
+            IsValidStatus = FALSE;
+        }
+        break; /* * default */
+    }
+
+    //Check whether valid status or not
+    if( TRUE == IsValidStatus )
+    {
+        DmlXdslSetPhyStatusForWanManager( pstEvent->Name, acTmpPhyStatus );
+    }
 }
 
 /* *DmlXdslGetParamValues() */
@@ -1194,6 +1817,8 @@ static ANSC_STATUS DmlXdslSetParamValues( char *pComponent, char *pBus, char *pP
 /* * DmlXdslGetLowerLayersInstanceInOtherAgent() */
 static ANSC_STATUS DmlXdslGetLowerLayersInstanceInOtherAgent( XDSL_NOTIFY_ENUM enNotifyAgent, char *pLowerLayers, INT *piInstanceNumber )
 {
+    XDSL_INSTANCE_TABLE enTable;
+
     //Validate buffer
     if( ( NULL == pLowerLayers ) || ( NULL == piInstanceNumber ) )
     {
@@ -1208,291 +1833,312 @@ static ANSC_STATUS DmlXdslGetLowerLayersInstanceInOtherAgent( XDSL_NOTIFY_ENUM e
     {
         case NOTIFY_TO_WAN_AGENT:
         {
-            char acTmpReturnValue[ 256 ]    = { 0 };
-            INT  iLoopCount,
-                 iTotalNoofEntries;
-
-            if ( ANSC_STATUS_FAILURE == DmlXdslGetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, WAN_NOE_PARAM_NAME, acTmpReturnValue ) )
-            {
-                CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                return ANSC_STATUS_FAILURE;
-            }
-
-            //Total count
-            iTotalNoofEntries = atoi( acTmpReturnValue );
-            CcspTraceInfo(("%s %d - TotalNoofEntries:%d\n", __FUNCTION__, __LINE__, iTotalNoofEntries));
-
-            if( 0 >= iTotalNoofEntries )
-            {
-               return ANSC_STATUS_SUCCESS;
-            }
-
-            //Traverse from loop
-            for ( iLoopCount = 0; iLoopCount < iTotalNoofEntries; iLoopCount++ )
-            {
-                char acTmpQueryParam[256] = { 0 };
-
-                //Query
-                snprintf( acTmpQueryParam, sizeof(acTmpQueryParam ), WAN_IF_NAME_PARAM_NAME, iLoopCount + 1 );
-
-                memset( acTmpReturnValue, 0, sizeof( acTmpReturnValue ) );
-                if ( ANSC_STATUS_FAILURE == DmlXdslGetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, acTmpQueryParam, acTmpReturnValue ) )
-                {
-                    CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                    continue;
-                }
-
-                //Compare name
-                if( 0 == strcmp( acTmpReturnValue, pLowerLayers ) )
-                {
-                    *piInstanceNumber   = iLoopCount + 1;
-                    break;
-                }
-            }
+            enTable = XDSL_INSTANCE_TABLE_WAN;
         }
         break; /* * NOTIFY_TO_WAN_AGENT */
 
         case NOTIFY_TO_PTM_AGENT:
         {
-            char acTmpReturnValue[ 256 ]    = { 0 },
-                 a2cTmpTableParams[16][256] = { 0 };
-            INT  iLoopCount,
-                 iTotalNoofEntries;
+            enTable = XDSL_INSTANCE_TABLE_PTM;
+        }
+        break; /* * NOTIFY_TO_PTM_AGENT */
 
-            if ( ANSC_STATUS_FAILURE == DmlXdslGetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, PTM_NOE_PARAM_NAME, acTmpReturnValue ) )
-            {
-                CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                return ANSC_STATUS_FAILURE;
-            }
+        case NOTIFY_TO_ATM_AGENT:
+        {
+            enTable = XDSL_INSTANCE_TABLE_ATM;
+        }
+        break; /* * NOTIFY_TO_ATM_AGENT */
 
-            //Total count
-            iTotalNoofEntries = atoi( acTmpReturnValue );
-            CcspTraceInfo(("%s %d - TotalNoofEntries:%d\n", __FUNCTION__, __LINE__, iTotalNoofEntries));
+        default:
+        {
+            CcspTraceError(("%s Invalid Case\n", __FUNCTION__));
+            return ANSC_STATUS_SUCCESS;
+        }
+    }
 
-            if( 0 >= iTotalNoofEntries )
-            {
-               return ANSC_STATUS_SUCCESS;
-            }
+    //Cached index, refreshed with one bulk get when the row is not known
+    return XdslInstanceCacheLookup( enTable, pLowerLayers, piInstanceNumber );
+}
 
-            //Get table names
-            iTotalNoofEntries = 0;
-            if ( ANSC_STATUS_FAILURE == DmlXdslGetParamNames( XTM_COMPONENT_NAME, XTM_DBUS_PATH, PTM_LINK_TABLE_NAME, a2cTmpTableParams , &iTotalNoofEntries ))
-            {
-                CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                return ANSC_STATUS_FAILURE;
-            }
+/* * DmlXdslQueueXTMJob() */
+static ANSC_STATUS DmlXdslQueueXTMJob( XDSL_XTM_JOB_TYPE JobType, char *ifname, ULONG *pulTicket )
+{
+    DML_XDSL_LINE_GLOBALINFO stGlobalInfo = { 0 };
+    XDSL_XTM_JOB_IFACE *pstIface = NULL;
+    XDSL_XTM_JOB       *pstJob   = NULL;
+    ULONG               ulTicket = 0;
+    UINT                uPos;
+    INT                 iLoopCount;
 
-            //Traverse from loop
-            for ( iLoopCount = 0; iLoopCount < iTotalNoofEntries; iLoopCount++ )
-            {
-                char acTmpQueryParam[256] = { 0 };
+    if( NULL == ifname )
+    {
+        CcspTraceError(("%s Invalid Argument\n",__FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
 
-                //Query
-                snprintf( acTmpQueryParam, sizeof(acTmpQueryParam ), "%sLowerLayers", a2cTmpTableParams[ iLoopCount ] );
+    //ATM or PTM is decided by the standard the line trained in when the request came in
+    if( ANSC_STATUS_SUCCESS != DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( ifname, &stGlobalInfo ) )
+    {
+        CcspTraceError(("%s Failed to get the standard family of %s\n",__FUNCTION__, ifname));
+        return ANSC_STATUS_FAILURE;
+    }
 
-                memset( acTmpReturnValue, 0, sizeof( acTmpReturnValue ) );
-                if ( ANSC_STATUS_FAILURE == DmlXdslGetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acTmpQueryParam, acTmpReturnValue ) )
-                {
-                    CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                    continue;
-                }
+    pthread_mutex_lock(&gmXtmJob_mutex);
 
-                //Compare lowerlayers
-                if( 0 == strcmp( acTmpReturnValue, pLowerLayers ) )
-                {
-                    char  tmpTableParam[ 256 ] = { 0 };
-                    const char *last_two;
+    //Completion is tracked per interface
+    for( iLoopCount = 0; iLoopCount < XDSL_XTM_JOB_MAX_IFACES; iLoopCount++ )
+    {
+        if( 0 == strcmp( gastXtmJobIfaces[iLoopCount].Name, ifname ) )
+        {
+            pstIface = &gastXtmJobIfaces[iLoopCount];
+            break;
+        }
 
-                    //Copy table param
-                    snprintf( tmpTableParam, sizeof(tmpTableParam), "%s", a2cTmpTableParams[ iLoopCount ] );
+        if( ( NULL == pstIface ) && ( '\0' == gastXtmJobIfaces[iLoopCount].Name[0] ) )
+        {
+            pstIface = &gastXtmJobIfaces[iLoopCount];
+        }
+    }
 
-                    //Get last two chareters from return value and cut the instance
-                    last_two = &tmpTableParam[strlen(tmpTableParam) - 2];
+    if( NULL == pstIface )
+    {
+        pthread_mutex_unlock(&gmXtmJob_mutex);
+        CcspTraceError(("%s No job slot left for %s\n",__FUNCTION__, ifname));
+        return ANSC_STATUS_FAILURE;
+    }
+    snprintf( pstIface->Name, sizeof( pstIface->Name ), "%s", ifname );
 
-                    *piInstanceNumber   = atoi(last_two);
-                    break;
-                }
-            }
+    //A job still waiting for the same interface only has to end in the latest state
+    for( uPos = guXtmJobTail; uPos != guXtmJobHead; uPos++ )
+    {
+        if( 0 == strcmp( gastXtmJobQueue[uPos % XDSL_XTM_JOB_QUEUE_SIZE].Name, ifname ) )
+        {
+            pstJob = &gastXtmJobQueue[uPos % XDSL_XTM_JOB_QUEUE_SIZE];
+            break;
         }
-        break; /* * NOTIFY_TO_PTM_AGENT */
+    }
 
-        case NOTIFY_TO_ATM_AGENT:
+    if( NULL != pstJob )
+    {
+        if( pstJob->JobType != JobType )
         {
-            char acTmpReturnValue[ 256 ]    = { 0 },
-                 a2cTmpTableParams[16][256] = { 0 };
-            INT  iLoopCount,
-                 iTotalNoofEntries;
-
-            if ( ANSC_STATUS_FAILURE == DmlXdslGetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, ATM_NOE_PARAM_NAME, acTmpReturnValue ) )
-            {
-                CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                return ANSC_STATUS_FAILURE;
-            }
-
-            //Total count
-            iTotalNoofEntries = atoi( acTmpReturnValue );
-            CcspTraceInfo(("%s %d - TotalNoofEntries:%d\n", __FUNCTION__, __LINE__, iTotalNoofEntries));
+            CcspTraceInfo(("%s Pending job %lu for %s superseded\n",__FUNCTION__, pstJob->ulTicket, ifname));
+            pstJob->JobType  = JobType;
+            pstJob->ulTicket = ++gulXtmJobTicket;
+        }
+        pstJob->StandardFamily = stGlobalInfo.StandardFamily;
+        ulTicket = pstJob->ulTicket;
+    }
+    else
+    {
+        if( XDSL_XTM_JOB_QUEUE_SIZE == ( guXtmJobHead - guXtmJobTail ) )
+        {
+            pthread_mutex_unlock(&gmXtmJob_mutex);
+            CcspTraceError(("%s Job queue full, dropping job for %s\n",__FUNCTION__, ifname));
+            return ANSC_STATUS_FAILURE;
+        }
 
-            if( 0 >= iTotalNoofEntries )
-            {
-               return ANSC_STATUS_SUCCESS;
-            }
+        pstJob = &gastXtmJobQueue[guXtmJobHead % XDSL_XTM_JOB_QUEUE_SIZE];
+        pstJob->JobType  = JobType;
+        pstJob->StandardFamily = stGlobalInfo.StandardFamily;
+        pstJob->ulTicket = ++gulXtmJobTicket;
+        snprintf( pstJob->Name, sizeof( pstJob->Name ), "%s", ifname );
+        ulTicket = pstJob->ulTicket;
+        guXtmJobHead++;
+    }
 
-            //Get table names
-            iTotalNoofEntries = 0;
-            if ( ANSC_STATUS_FAILURE == DmlXdslGetParamNames( XTM_COMPONENT_NAME, XTM_DBUS_PATH, ATM_LINK_TABLE_NAME, a2cTmpTableParams , &iTotalNoofEntries ))
-            {
-                CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                return ANSC_STATUS_FAILURE;
-            }
+    pthread_mutex_unlock(&gmXtmJob_mutex);
 
-            //Traverse from loop
-            for ( iLoopCount = 0; iLoopCount < iTotalNoofEntries; iLoopCount++ )
-            {
-                char acTmpQueryParam[256] = { 0 };
+    if( NULL != pulTicket )
+    {
+        *pulTicket = ulTicket;
+    }
 
-                //Query
-                snprintf( acTmpQueryParam, sizeof(acTmpQueryParam ), "%sLowerLayers", a2cTmpTableParams[ iLoopCount ] );
+    //At most one drain job in flight keeps the jobs of an interface in order
+    if( 0 == __atomic_exchange_n( &guXtmJobScheduled, 1, __ATOMIC_SEQ_CST ) )
+    {
+        if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DmlXdslXTMJobDrain, NULL ) )
+        {
+            __atomic_store_n( &guXtmJobScheduled, 0, __ATOMIC_SEQ_CST );
+            CcspTraceError(("%s Failed to schedule job %lu for %s\n",__FUNCTION__, ulTicket, ifname));
+            return ANSC_STATUS_FAILURE;
+        }
+    }
 
-                memset( acTmpReturnValue, 0, sizeof( acTmpReturnValue ) );
-                if ( ANSC_STATUS_FAILURE == DmlXdslGetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acTmpQueryParam, acTmpReturnValue ) )
-                {
-                    CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                    continue;
-                }
+    return ANSC_STATUS_SUCCESS;
+}
 
-                //Compare lowerlayers
-                if( 0 == strcmp( acTmpReturnValue, pLowerLayers ) )
-                {
-                    char  tmpTableParam[ 256 ] = { 0 };
-                    const char *last_two;
+/* * DmlXdslXTMJobDrain() */
+static void DmlXdslXTMJobDrain( PVOID pContext )
+{
+    while( 1 )
+    {
+        XDSL_XTM_JOB  stJob;
+        ANSC_STATUS   retStatus;
 
-                    //Copy table param
-                    snprintf( tmpTableParam, sizeof(tmpTableParam), "%s", a2cTmpTableParams[ iLoopCount ] );
+        pthread_mutex_lock(&gmXtmJob_mutex);
+        if( guXtmJobTail == guXtmJobHead )
+        {
+            //Cleared under the lock, so a job queued after this point schedules a new drain
+            __atomic_store_n( &guXtmJobScheduled, 0, __ATOMIC_SEQ_CST );
+            pthread_mutex_unlock(&gmXtmJob_mutex);
+            break;
+        }
+        stJob = gastXtmJobQueue[guXtmJobTail % XDSL_XTM_JOB_QUEUE_SIZE];
+        guXtmJobTail++;
+        pthread_mutex_unlock(&gmXtmJob_mutex);
 
-                    //Get last two chareters from return value and cut the instance
-                    last_two = &tmpTableParam[strlen(tmpTableParam) - 2];
+        CcspTraceInfo(("%s Running job %lu type %d for %s\n",__FUNCTION__, stJob.ulTicket, stJob.JobType, stJob.Name));
 
-                    *piInstanceNumber   = atoi(last_two);
-                    break;
-                }
+        if( XDSL_XTM_JOB_CREATE == stJob.JobType )
+        {
+            retStatus = DmlXdslRunXTMCreateJob( &stJob );
+            if( ANSC_STATUS_PENDING == retStatus )
+            {
+                /*
+                 * The PVC search completes the job and continues the drain from
+                 * its last step. guXtmJobScheduled stays set, so jobs queued in
+                 * the meantime still run after this one.
+                 */
+                gstPvcSearch.stJob = stJob;
+                DmlXdslAtmPvcSearchArmTimer( XDSL_PVC_PROBE_GAP_MS );
+                return;
             }
         }
-        break; /* * NOTIFY_TO_ATM_AGENT */
-
-        default:
+        else
         {
-            CcspTraceError(("%s Invalid Case\n", __FUNCTION__));
+            retStatus = DmlXdslRunXTMDeleteJob( &stJob );
         }
-        break; /* * default */
-    }
 
-    return ANSC_STATUS_SUCCESS;
+        DmlXdslXTMJobComplete( &stJob, retStatus );
+    }
 }
 
-/* * DmlXdslCreateXTMLink() */
-ANSC_STATUS DmlXdslCreateXTMLink( char *ifname )
+/* * DmlXdslXTMJobComplete() */
+static void DmlXdslXTMJobComplete( const XDSL_XTM_JOB *pstJob, ANSC_STATUS retStatus )
 {
-    pthread_t  XtmObjCreationThread;
-    int        iErrorCode   = 0;
-    struct timespec _ts;
-    struct timespec _now;
-    int n;
-
-    memset(&_ts, 0, sizeof(struct timespec));
-    memset(&_now, 0, sizeof(struct timespec));
-    clock_gettime(CLOCK_REALTIME, &_now);
-    _ts.tv_sec = _now.tv_sec + 15;
+    INT iLoopCount;
 
-    iErrorCode = pthread_create(&XtmObjCreationThread, NULL, XTM_DMLUpdationHandlerThread, (void *)ifname);
-    if (iErrorCode != 0)
+    pthread_mutex_lock(&gmXtmJob_mutex);
+    for( iLoopCount = 0; iLoopCount < XDSL_XTM_JOB_MAX_IFACES; iLoopCount++ )
     {
-       CcspTraceError(("%s %d - Failed to start the handler thread\n",__FUNCTION__, __LINE__));
-       return ANSC_STATUS_FAILURE;
+        if( 0 == strcmp( gastXtmJobIfaces[iLoopCount].Name, pstJob->Name ) )
+        {
+            gastXtmJobIfaces[iLoopCount].ulDoneTicket = pstJob->ulTicket;
+            gastXtmJobIfaces[iLoopCount].DoneStatus   = retStatus;
+            break;
+        }
     }
+    pthread_mutex_unlock(&gmXtmJob_mutex);
+}
 
-    pthread_mutex_lock(&mCondMutex);
-    n = pthread_cond_timedwait(&mCreationCond, &mCondMutex, &_ts);
-    pthread_mutex_unlock(&mCondMutex);
+/* * DmlXdslXTMJobIsQueued() */
+static BOOL DmlXdslXTMJobIsQueued( char *ifname )
+{
+    BOOL bQueued = FALSE;
+    UINT uIndex;
 
-    if(n == ETIMEDOUT)
+    pthread_mutex_lock(&gmXtmJob_mutex);
+    for( uIndex = guXtmJobTail; uIndex != guXtmJobHead; uIndex++ )
     {
-        CcspTraceInfo(("%s : pthread_cond_timedwait TIMED OUT!!!\n",__FUNCTION__));
+        if( 0 == strcmp( gastXtmJobQueue[uIndex % XDSL_XTM_JOB_QUEUE_SIZE].Name, ifname ) )
+        {
+            bQueued = TRUE;
+            break;
+        }
     }
-    else if (n == 0)
+    pthread_mutex_unlock(&gmXtmJob_mutex);
+
+    return bQueued;
+}
+
+/* * DmlXdslIsXTMJobDone() */
+BOOL DmlXdslIsXTMJobDone( char *ifname, ULONG ulTicket, ANSC_STATUS *pStatus )
+{
+    BOOL bDone = TRUE;
+    INT  iLoopCount;
+
+    if( ( NULL == ifname ) || ( 0 == ulTicket ) )
     {
-        CcspTraceInfo(("%s : pthread_cond_timedwait SIGNALLED OK!!!\n",__FUNCTION__));
+        return TRUE;
     }
-    else
+
+    pthread_mutex_lock(&gmXtmJob_mutex);
+    for( iLoopCount = 0; iLoopCount < XDSL_XTM_JOB_MAX_IFACES; iLoopCount++ )
     {
-        CcspTraceInfo(("%s : pthread_cond_timedwait ERROR!!!\n",__FUNCTION__));
+        if( 0 == strcmp( gastXtmJobIfaces[iLoopCount].Name, ifname ) )
+        {
+            //Jobs of one interface complete in ticket order
+            bDone = ( gastXtmJobIfaces[iLoopCount].ulDoneTicket >= ulTicket ) ? TRUE : FALSE;
+            if( ( TRUE == bDone ) && ( NULL != pStatus ) )
+            {
+                *pStatus = gastXtmJobIfaces[iLoopCount].DoneStatus;
+            }
+            break;
+        }
     }
+    pthread_mutex_unlock(&gmXtmJob_mutex);
 
-    CcspTraceInfo(("%s %d - Successfully started PTM creation thread\n",__FUNCTION__, __LINE__));
-    return ANSC_STATUS_SUCCESS;
+    return bDone;
 }
 
-/* * XTM_DMLUpdationHandlerThread() */
-static void *XTM_DMLUpdationHandlerThread( void *arg )
+/* * DmlXdslCreateXTMLink() */
+ANSC_STATUS DmlXdslCreateXTMLink( char *ifname, ULONG *pulTicket )
 {
-    char StandardUsed[XDSL_STANDARD_USED_STR_MAX] = {'\0'};
-    char* ifname = (char*)arg;
-
-    if ( NULL == ifname)
+    if ( ANSC_STATUS_SUCCESS != DmlXdslQueueXTMJob( XDSL_XTM_JOB_CREATE, ifname, pulTicket ) )
     {
-        CcspTraceError(("%s Invalid Argument\n",__FUNCTION__));
-        pthread_exit(NULL);
+       CcspTraceError(("%s %d - Failed to queue the creation job\n",__FUNCTION__, __LINE__));
+       return ANSC_STATUS_FAILURE;
     }
 
-    //detach thread from caller stack
-    pthread_detach(pthread_self());
+    CcspTraceInfo(("%s %d - Successfully queued XTM creation job\n",__FUNCTION__, __LINE__));
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* * DmlXdslRunXTMCreateJob() */
+static ANSC_STATUS DmlXdslRunXTMCreateJob( XDSL_XTM_JOB *pstJob )
+{
+    char *ifname = pstJob->Name;
+    ANSC_STATUS retStatus = ANSC_STATUS_FAILURE;
 
-    if (ANSC_STATUS_SUCCESS == DmlXdslLine_GetStandardUsedByGivenIfName(ifname, StandardUsed))
+    if(XDSL_STANDARD_FAMILY_ADSL == pstJob->StandardFamily) /* ADSL */
     {
-        if(strstr(StandardUsed,"G.992.1") || strstr(StandardUsed,"T1.413")  ||
-           strstr(StandardUsed,"G.992.2") || strstr(StandardUsed,"G.992.3") ||
-           strstr(StandardUsed,"G.992.5")) /* ADSL */
+        retStatus = DmlCreateATMLink(ifname);
+        if (ANSC_STATUS_SUCCESS == retStatus)
         {
-            if (ANSC_STATUS_SUCCESS == DmlCreateATMLink(ifname))
-            {
-                CcspTraceInfo(("%s Successfully created ATMLink\n",__FUNCTION__));
-            }
-            else
-            {
-                CcspTraceInfo(("%s - Failed to create ATMLink\n",__FUNCTION__));
-            }
+            CcspTraceInfo(("%s Successfully created ATMLink\n",__FUNCTION__));
         }
-        else if(strstr(StandardUsed,"G.993.2")) /* VDSL */
+        else if (ANSC_STATUS_PENDING == retStatus)
         {
-            if (ANSC_STATUS_SUCCESS == DmlCreatePTMLink(ifname))
-            {
-                CcspTraceInfo(("%s Successfully created PTMLink\n",__FUNCTION__));
-            }
-            else
-            {
-                CcspTraceInfo(("%s - Failed to create PTMLink\n",__FUNCTION__));
-            }
+            CcspTraceInfo(("%s Created ATMLink, searching the PVC\n",__FUNCTION__));
+        }
+        else
+        {
+            CcspTraceInfo(("%s - Failed to create ATMLink\n",__FUNCTION__));
         }
-        else if(strstr(StandardUsed,"G.9701")) /* GFAST */
+    }
+    else if(XDSL_STANDARD_FAMILY_VDSL == pstJob->StandardFamily) /* VDSL */
+    {
+        retStatus = DmlCreatePTMLink(ifname);
+        if (ANSC_STATUS_SUCCESS == retStatus)
         {
-            CcspTraceInfo(("%s : %s standards is not supported\n", __FUNCTION__, StandardUsed));
+            CcspTraceInfo(("%s Successfully created PTMLink\n",__FUNCTION__));
         }
         else
         {
-            CcspTraceError(("%s : %s have no match with StandardsSupported\n", __FUNCTION__, StandardUsed));
+            CcspTraceInfo(("%s - Failed to create PTMLink\n",__FUNCTION__));
         }
     }
+    else if(XDSL_STANDARD_FAMILY_GFAST == pstJob->StandardFamily) /* GFAST */
+    {
+        CcspTraceInfo(("%s : G.fast is not supported for %s\n", __FUNCTION__, ifname));
+    }
     else
     {
-        CcspTraceError(("%s : DmlGetXdslStandardUsed() failed \n", __FUNCTION__ ));
+        CcspTraceError(("%s : Unknown standard family %d for %s\n", __FUNCTION__, pstJob->StandardFamily, ifname));
     }
 
-    pthread_mutex_lock(&mCondMutex);
-    pthread_cond_signal(&mCreationCond);
-    pthread_mutex_unlock(&mCondMutex);
-
-    //Exit thread.
-    pthread_exit(NULL);
+    return retStatus;
 }
 
 ANSC_STATUS DmlGetXdslStandardUsed( char *StandardUsed )
@@ -1516,8 +2162,7 @@ ANSC_STATUS DmlGetXdslStandardUsed( char *StandardUsed )
 ANSC_STATUS DmlCreatePTMLink( char *ifname )
 {
     DML_XDSL_LINE_GLOBALINFO   stGlobalInfo   = { 0 };
-    char                       acSetParamName[256] = { 0 };
-    char                       acSetParamValue[256] = { 0 };
+    XDSL_BUS_TXN               stTxn;
     INT                        iPTMInstance   = -1;
 
     //Validate buffer
@@ -1554,26 +2199,24 @@ ANSC_STATUS DmlCreatePTMLink( char *ifname )
             return ANSC_STATUS_FAILURE;
        }
 
+       XdslInstanceCacheInvalidate( XDSL_INSTANCE_TABLE_PTM );
+
        //Assign new instance
        iPTMInstance = iNewTableInstance;
     }
 
     CcspTraceInfo(("%s %d PTM Instance:%d\n",__FUNCTION__, __LINE__,iPTMInstance));
 
-    //Set Lower Layer
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, PTM_LINK_LOWERLAYER_PARAM_NAME, iPTMInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", stGlobalInfo.LowerLayers );
-    DmlXdslSetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, FALSE );
-
-    //Set Alias
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, PTM_LINK_ALIAS_PARAM_NAME, iPTMInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", stGlobalInfo.Name );
-    DmlXdslSetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, FALSE );
-
-    //Set PTM Enable
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, PTM_LINK_ENABLE_PARAM_NAME, iPTMInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", "true" );
-    DmlXdslSetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_boolean, TRUE );
+    //Lower Layer, Alias and Enable are applied together with one commit
+    XdslBusTxnBegin( &stTxn, XTM_COMPONENT_NAME, XTM_DBUS_PATH );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, stGlobalInfo.LowerLayers, PTM_LINK_LOWERLAYER_PARAM_NAME, iPTMInstance );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, stGlobalInfo.Name, PTM_LINK_ALIAS_PARAM_NAME, iPTMInstance );
+    XdslBusTxnAddParam( &stTxn, ccsp_boolean, "true", PTM_LINK_ENABLE_PARAM_NAME, iPTMInstance );
+    if ( ANSC_STATUS_SUCCESS != XdslBusTxnCommit( &stTxn ) )
+    {
+        CcspTraceError(("%s %d Failed to configure PTM Instance:%d\n", __FUNCTION__, __LINE__, iPTMInstance));
+        return ANSC_STATUS_FAILURE;
+    }
 
     CcspTraceInfo(("%s %d Successfully notified Up event to PTM Agent for %s interface\n", __FUNCTION__,__LINE__,ifname));
 
@@ -1584,8 +2227,6 @@ ANSC_STATUS DmlCreatePTMLink( char *ifname )
 ANSC_STATUS DmlCreateATMLink( char *ifname )
 {
     DML_XDSL_LINE_GLOBALINFO   stGlobalInfo   = { 0 };
-    char                       acSetParamName[DATAMODEL_PARAM_LENGTH];
-    char                       acSetParamValue[DATAMODEL_PARAM_LENGTH];
     INT                        iATMInstance   = -1;
 
     //Validate buffer
@@ -1622,136 +2263,239 @@ ANSC_STATUS DmlCreateATMLink( char *ifname )
             return ANSC_STATUS_FAILURE;
        }
 
+       XdslInstanceCacheInvalidate( XDSL_INSTANCE_TABLE_ATM );
+
        //Assign new instance
        iATMInstance = iNewTableInstance;
     }
 
     CcspTraceInfo(("%s %d ATM Instance:%d\n",__FUNCTION__, __LINE__, iATMInstance));
 
-    //Set Lower Layer
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, ATM_LINK_LOWERLAYER_PARAM_NAME, iATMInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", stGlobalInfo.LowerLayers );
-    DmlXdslSetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, FALSE );
+    //With AutoConfig the link is configured once the PVC search ends
+    if( DmlXdslAtmPvcSearchPrepare( ifname, iATMInstance ) )
+    {
+        return ANSC_STATUS_PENDING;
+    }
+
+    return DmlXdslAtmLinkConfigure( &stGlobalInfo, iATMInstance, NULL );
+}
 
-    //Set Alias
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, ATM_LINK_ALIAS_PARAM_NAME, iATMInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", stGlobalInfo.Name );
-    DmlXdslSetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, FALSE );
+/* DmlXdslAtmLinkConfigure() - pPvc is written as DestinationAddress when not NULL */
+static ANSC_STATUS DmlXdslAtmLinkConfigure( PDML_XDSL_LINE_GLOBALINFO pstGlobalInfo, INT iATMInstance, const char *pPvc )
+{
+    XDSL_BUS_TXN stTxn;
 
-    //Set ATM Enable
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, ATM_LINK_ENABLE_PARAM_NAME, iATMInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", "true" );
-    DmlXdslSetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_boolean, TRUE );
+    //Lower Layer, Alias and Enable are applied together with one commit
+    XdslBusTxnBegin( &stTxn, XTM_COMPONENT_NAME, XTM_DBUS_PATH );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, pstGlobalInfo->LowerLayers, ATM_LINK_LOWERLAYER_PARAM_NAME, iATMInstance );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, pstGlobalInfo->Name, ATM_LINK_ALIAS_PARAM_NAME, iATMInstance );
+    if( NULL != pPvc )
+    {
+        //Persisted by the ATM link, the next showtime probes it first
+        XdslBusTxnAddParam( &stTxn, ccsp_string, (char *)pPvc, ATM_LINK_DESTINATION_PARAM_NAME, iATMInstance );
+    }
+    XdslBusTxnAddParam( &stTxn, ccsp_boolean, "true", ATM_LINK_ENABLE_PARAM_NAME, iATMInstance );
+    if ( ANSC_STATUS_SUCCESS != XdslBusTxnCommit( &stTxn ) )
+    {
+        CcspTraceError(("%s %d Failed to configure ATM Instance:%d\n", __FUNCTION__, __LINE__, iATMInstance));
+        return ANSC_STATUS_FAILURE;
+    }
 
-    CcspTraceInfo(("%s %d Successfully notified Up event to ATM Agent for %s interface\n", __FUNCTION__,__LINE__,ifname));
+    CcspTraceInfo(("%s %d Successfully notified Up event to ATM Agent for %s interface\n", __FUNCTION__,__LINE__,pstGlobalInfo->Name));
 
     return ANSC_STATUS_SUCCESS;
 }
 
+/* DmlXdslAtmPvcSearchPrepare() - TRUE when a PVC search was set up for the XTM drain to start */
+static BOOL DmlXdslAtmPvcSearchPrepare( char *ifname, INT iATMInstance )
+{
+    XDSL_PVC        stPreferred;
+    CHAR            acPreferred[XDSL_PVC_STR_LEN] = { 0 };
+    CHAR            acSearchList[256] = { 0 };
+    ULONG           ulAutoConfig    = 0;
 
-/* * DmlXdslDeleteXTMLink() */
-ANSC_STATUS DmlXdslDeleteXTMLink( char *ifname )
+    if( ( CCSP_SUCCESS != GetNVRamULONGConfiguration( PSM_ATM_AUTOCONFIG, &ulAutoConfig ) ) || ( 0 == ulAutoConfig ) )
+    {
+        return FALSE;
+    }
+
+    if( 0 > giPvcSearchTimerId )
+    {
+        CcspTraceWarning(("%s No PVC search timer, keeping the configured DestinationAddress\n", __FUNCTION__));
+        return FALSE;
+    }
+
+    GetNVRamStringConfiguration( PSM_ATM_PVC, acPreferred, sizeof(acPreferred) );
+    GetNVRamStringConfiguration( PSM_ATM_VCSEARCHLIST, acSearchList, sizeof(acSearchList) );
+
+    //Only the parked drain and the search steps touch the state, they never overlap
+    memset( &gstPvcSearch, 0, sizeof(gstPvcSearch) );
+
+    //PVC that answered last first, then the search list in order
+    gstPvcSearch.iCount = XdslPvcSearchBuildCandidates( acPreferred, acSearchList, gstPvcSearch.astCandidates, XDSL_PVC_SEARCH_MAX_CANDIDATES );
+    if( 0 == gstPvcSearch.iCount )
+    {
+        CcspTraceWarning(("%s No PVC to probe, keeping the configured DestinationAddress\n", __FUNCTION__));
+        return FALSE;
+    }
+
+    gstPvcSearch.iATMInstance    = iATMInstance;
+    gstPvcSearch.bPreferredValid = XdslPvcParse( acPreferred, &stPreferred );
+    gstPvcSearch.ulDeadlineMs    = DmlXdslGetMonotonicMs() + XDSL_PVC_SEARCH_MAX_MS;
+
+    return TRUE;
+}
+
+/* DmlXdslAtmPvcSearchArmTimer() */
+static void DmlXdslAtmPvcSearchArmTimer( ULONG ulMs )
 {
-    pthread_t                 XtmObjDeletionThread;
-    int                       iErrorCode   = 0;
-    struct timespec _ts;
-    struct timespec _now;
-    int n;
+    XdslReactorSetTimer( giPvcSearchTimerId, ulMs, 0 );
+}
+
+/* DmlXdslAtmPvcSearchTimer() */
+static void DmlXdslAtmPvcSearchTimer( PVOID pContext )
+{
+    //A probe waits for the loopback timeout, keep it off the reactor thread
+    if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DmlXdslAtmPvcSearchStep, NULL ) )
+    {
+        //The XTM drain is parked on the search, a lost step would stall every XTM job
+        DmlXdslAtmPvcSearchArmTimer( XDSL_PVC_SEARCH_RESUBMIT_MS );
+    }
+}
 
-    memset(&_ts, 0, sizeof(struct timespec));
-    memset(&_now, 0, sizeof(struct timespec));
-    clock_gettime(CLOCK_REALTIME, &_now);
-    _ts.tv_sec = _now.tv_sec + 15;
+/* DmlXdslAtmPvcSearchStep() - probes one candidate, the next one is probed from a later step */
+static void DmlXdslAtmPvcSearchStep( PVOID pContext )
+{
+    XDSL_PVC_SEARCH_STATE *pstSearch = &gstPvcSearch;
+    PDML_ATM_DIAG          pstDiag   = NULL;
+    CHAR                   acCandidate[XDSL_PVC_STR_LEN] = { 0 };
+    BOOL                   bFound    = FALSE;
 
-    iErrorCode = pthread_create( &XtmObjDeletionThread, NULL, XTM_DMLDeletionHandlerThread, (void *)ifname );
-    if ( iErrorCode != 0 )
+    //A job queued for the interface means the line moved on, the result would be stale
+    if( ( 0 <= (LONG)( DmlXdslGetMonotonicMs() - pstSearch->ulDeadlineMs ) ) || DmlXdslXTMJobIsQueued( pstSearch->stJob.Name ) )
     {
-       CcspTraceError(("%s %d - Failed to start deletion handler thread\n",__FUNCTION__, __LINE__));
-       return ANSC_STATUS_FAILURE;
+        CcspTraceWarning(("%s ATM Instance:%d search stopped after %d of %d PVCs, keeping the configured DestinationAddress\n",
+                          __FUNCTION__, pstSearch->iATMInstance, pstSearch->iNext, pstSearch->iCount));
+        DmlXdslAtmPvcSearchFinish( NULL );
+        return;
     }
 
-    pthread_mutex_lock(&mCondMutex);
-    n = pthread_cond_timedwait(&mDeletionCond, &mCondMutex, &_ts);
-    pthread_mutex_unlock(&mCondMutex);
+    XdslPvcFormat( &pstSearch->astCandidates[pstSearch->iNext], acCandidate, sizeof(acCandidate) );
+    pstSearch->iNext++;
 
-    if(n == ETIMEDOUT)
+    //The HAL has a single F5Loopback diagnostics object, probes cannot overlap
+    pstDiag = (PDML_ATM_DIAG) AnscAllocateMemory( sizeof(DML_ATM_DIAG) );
+    if( NULL != pstDiag )
     {
-        CcspTraceInfo(("%s : pthread_cond_timedwait TIMED OUT!!!\n",__FUNCTION__));
+        memset( pstDiag, 0, sizeof(DML_ATM_DIAG) );
+        snprintf( pstDiag->Interface, sizeof(pstDiag->Interface), ATM_LINK_PATH_NAME, pstSearch->iATMInstance );
+        pstDiag->DiagnosticsState    = DIAG_STATE_REQUESTED;
+        pstDiag->NumberOfRepetitions = XDSL_PVC_PROBE_REPETITIONS;
+        pstDiag->Timeout             = XDSL_PVC_PROBE_TIMEOUT_MS;
+
+        if( ( ANSC_STATUS_SUCCESS == atm_hal_startAtmLoopbackDiagnosticsOnPvc( pstDiag, acCandidate ) ) &&
+            ( DIAG_STATE_COMPLETE == pstDiag->DiagnosticsState ) && ( 0 < pstDiag->SuccessCount ) )
+        {
+            bFound = TRUE;
+        }
+
+        AnscFreeMemory( pstDiag );
     }
-    else if (n == 0)
+
+    CcspTraceInfo(("%s ATM Instance:%d %s %s\n", __FUNCTION__, pstSearch->iATMInstance, acCandidate, ( bFound ) ? "answered" : "no answer"));
+
+    if( bFound )
     {
-        CcspTraceInfo(("%s : pthread_cond_timedwait SIGNALLED OK!!!\n",__FUNCTION__));
+        //Only a PVC other than the configured one has to be written to the link
+        DmlXdslAtmPvcSearchFinish( ( ( 1 == pstSearch->iNext ) && pstSearch->bPreferredValid ) ? NULL : acCandidate );
+        return;
     }
-    else
+
+    if( pstSearch->iNext >= pstSearch->iCount )
     {
-        CcspTraceInfo(("%s : pthread_cond_timedwait ERROR!!!\n",__FUNCTION__));
+        CcspTraceWarning(("%s No PVC answered the F5 loopback, keeping the configured DestinationAddress\n", __FUNCTION__));
+        DmlXdslAtmPvcSearchFinish( NULL );
+        return;
     }
 
-    return ANSC_STATUS_SUCCESS;
+    //The worker is free for other jobs until the next probe
+    DmlXdslAtmPvcSearchArmTimer( XDSL_PVC_PROBE_GAP_MS );
 }
 
+/* DmlXdslAtmPvcSearchFinish() - configures the link, completes the parked job and continues the drain */
+static void DmlXdslAtmPvcSearchFinish( const char *pPvc )
+{
+    DML_XDSL_LINE_GLOBALINFO stGlobalInfo = { 0 };
+    ANSC_STATUS              retStatus    = ANSC_STATUS_FAILURE;
 
+    if( ANSC_STATUS_SUCCESS == DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( gstPvcSearch.stJob.Name, &stGlobalInfo ) )
+    {
+        retStatus = DmlXdslAtmLinkConfigure( &stGlobalInfo, gstPvcSearch.iATMInstance, pPvc );
+    }
 
-static void *XTM_DMLDeletionHandlerThread( void *arg )
-{
-    char StandardUsed[XDSL_STANDARD_USED_STR_MAX] = {'\0'};
-    char* ifname = (char*)arg;
+    if( ANSC_STATUS_SUCCESS != retStatus )
+    {
+        CcspTraceInfo(("%s - Failed to create ATMLink\n",__FUNCTION__));
+    }
+
+    DmlXdslXTMJobComplete( &gstPvcSearch.stJob, retStatus );
+
+    //Already on a worker and still owning guXtmJobScheduled, run the jobs queued behind the search
+    DmlXdslXTMJobDrain( NULL );
+}
 
-    if ( NULL == ifname )
+/* * DmlXdslDeleteXTMLink() */
+ANSC_STATUS DmlXdslDeleteXTMLink( char *ifname, ULONG *pulTicket )
+{
+    if ( ANSC_STATUS_SUCCESS != DmlXdslQueueXTMJob( XDSL_XTM_JOB_DELETE, ifname, pulTicket ) )
     {
-        CcspTraceError(("%s Invalid Argument\n",__FUNCTION__));
-        pthread_exit(NULL);
+       CcspTraceError(("%s %d - Failed to queue the deletion job\n",__FUNCTION__, __LINE__));
+       return ANSC_STATUS_FAILURE;
     }
 
-    //detach thread from caller stack
-    pthread_detach(pthread_self());
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* * DmlXdslRunXTMDeleteJob() */
+static ANSC_STATUS DmlXdslRunXTMDeleteJob( XDSL_XTM_JOB *pstJob )
+{
+    char *ifname = pstJob->Name;
+    ANSC_STATUS retStatus = ANSC_STATUS_FAILURE;
 
-    if (ANSC_STATUS_SUCCESS == DmlXdslLine_GetStandardUsedByGivenIfName(ifname, StandardUsed))
+    if(XDSL_STANDARD_FAMILY_ADSL == pstJob->StandardFamily) /* ADSL */
     {
-        if(strstr(StandardUsed,"G.992.1") || strstr(StandardUsed,"T1.413") || strstr(StandardUsed,"G.992.2") ||
-           strstr(StandardUsed,"G.992.3") || strstr(StandardUsed,"G.992.5")) /* ADSL */
+        retStatus = DmlDeleteATMLink(ifname);
+        if (ANSC_STATUS_SUCCESS != retStatus)
         {
-            if (ANSC_STATUS_SUCCESS != DmlDeleteATMLink(ifname))
-            {
-                CcspTraceError(("%s:Failed to delete ATM table\n ",__FUNCTION__));
-            }
-            else
-            {
-                CcspTraceInfo(("%s:Successfully deleted ATM table\n",__FUNCTION__));
-            }
+            CcspTraceError(("%s:Failed to delete ATM table\n ",__FUNCTION__));
         }
-        else if(strstr(StandardUsed,"G.993.2")) /* VDSL */
+        else
         {
-            if (ANSC_STATUS_SUCCESS != DmlDeletePTMLink(ifname))
-            {
-                CcspTraceError(("%s:Failed to delete PTM table\n ",__FUNCTION__));
-            }
-            else
-            {
-                CcspTraceInfo(("%s:Successfully deleted PTM table\n",__FUNCTION__));
-            }
+            CcspTraceInfo(("%s:Successfully deleted ATM table\n",__FUNCTION__));
         }
-        else if(strstr(StandardUsed,"G.9701")) /* GFAST */
+    }
+    else if(XDSL_STANDARD_FAMILY_VDSL == pstJob->StandardFamily) /* VDSL */
+    {
+        retStatus = DmlDeletePTMLink(ifname);
+        if (ANSC_STATUS_SUCCESS != retStatus)
         {
-            CcspTraceInfo(("%s : %s standards is not supported\n", __FUNCTION__, StandardUsed));
+            CcspTraceError(("%s:Failed to delete PTM table\n ",__FUNCTION__));
         }
         else
         {
-            CcspTraceError(("%s : %s have no match with StandardsSupported\n", __FUNCTION__, StandardUsed));
+            CcspTraceInfo(("%s:Successfully deleted PTM table\n",__FUNCTION__));
         }
     }
+    else if(XDSL_STANDARD_FAMILY_GFAST == pstJob->StandardFamily) /* GFAST */
+    {
+        CcspTraceInfo(("%s : G.fast is not supported for %s\n", __FUNCTION__, ifname));
+    }
     else
     {
-        CcspTraceError(("%s : DmlGetXdslStandardUsed() failed \n", __FUNCTION__ ));
+        CcspTraceError(("%s : Unknown standard family %d for %s\n", __FUNCTION__, pstJob->StandardFamily, ifname));
     }
 
-
-    pthread_mutex_lock(&mCondMutex);
-    pthread_cond_signal(&mDeletionCond);
-    pthread_mutex_unlock(&mCondMutex);
-
-    //Exit thread.
-    pthread_exit(NULL);
+    return retStatus;
 }
 
 /* * DmlDeletePTMLink() */
@@ -1807,6 +2551,8 @@ ANSC_STATUS DmlDeletePTMLink( char *ifname )
          return ANSC_STATUS_FAILURE;
     }
 
+    XdslInstanceCacheInvalidate( XDSL_INSTANCE_TABLE_PTM );
+
     CcspTraceInfo(("%s %d Successfully notified Down event to PTM Agent for %s interface\n", __FUNCTION__,__LINE__,ifname));
 
     return ANSC_STATUS_SUCCESS;
@@ -1865,6 +2611,8 @@ ANSC_STATUS DmlDeleteATMLink( char *ifname )
          return ANSC_STATUS_FAILURE;
     }
 
+    XdslInstanceCacheInvalidate( XDSL_INSTANCE_TABLE_ATM );
+
     CcspTraceInfo(("%s %d Successfully notified Down event to ATM Agent for %s interface\n", __FUNCTION__,__LINE__,ifname));
 
     return ANSC_STATUS_SUCCESS;
@@ -1875,10 +2623,8 @@ ANSC_STATUS DmlDeleteATMLink( char *ifname )
 ANSC_STATUS DmlXdslSetWanLinkStatusForWanManager( char *ifname, char *WanStatus )
 {
     DML_XDSL_LINE_GLOBALINFO   stGlobalInfo   = { 0 };
-    char                       acSetParamName[256] = {'\0'};
-    char                       acSetParamValue[256] = {'\0'};
-
-    INT                            iWANInstance   = -1;
+    XDSL_BUS_TXN               stTxn;
+    INT                        iWANInstance   = -1;
 
     //Validate buffer
     if( ( NULL == ifname ) || ( NULL == WanStatus ) )
@@ -1902,15 +2648,15 @@ ANSC_STATUS DmlXdslSetWanLinkStatusForWanManager( char *ifname, char *WanStatus
 
     CcspTraceInfo(("%s %d WAN Instance:%d\n",__FUNCTION__, __LINE__,iWANInstance));
 
-    //Set WAN Interface Name
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, WAN_WAN_INTERFACE_PARAM_NAME, iWANInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", WAN_INTERFACE_NAME );
-    DmlXdslSetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, TRUE );
-
-    //Set WAN Link Status
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, WAN_LINK_STATUS_PARAM_NAME, iWANInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", WanStatus );
-    DmlXdslSetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, TRUE );
+    //WAN Interface Name and WAN Link Status are applied together with one commit
+    XdslBusTxnBegin( &stTxn, WAN_COMPONENT_NAME, WAN_DBUS_PATH );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, WAN_INTERFACE_NAME, WAN_WAN_INTERFACE_PARAM_NAME, iWANInstance );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, WanStatus, WAN_LINK_STATUS_PARAM_NAME, iWANInstance );
+    if ( ANSC_STATUS_SUCCESS != XdslBusTxnCommit( &stTxn ) )
+    {
+        CcspTraceError(("%s %d Failed to set WAN link status for %s\n", __FUNCTION__, __LINE__, ifname));
+        return ANSC_STATUS_FAILURE;
+    }
 
     CcspTraceInfo(("%s %d Successfully notified %s event to WAN Agent for %s interface\n", __FUNCTION__, __LINE__, WanStatus, ifname));
 
@@ -1921,8 +2667,7 @@ ANSC_STATUS DmlXdslSetWanLinkStatusForWanManager( char *ifname, char *WanStatus
 ANSC_STATUS DmlXdslSetPhyStatusForWanManager( char *ifname, char *PhyStatus )
 {
     DML_XDSL_LINE_GLOBALINFO   stGlobalInfo   = { 0 };
-    char                       acSetParamName[256] = { 0 };
-    char                       acSetParamValue[256] = { 0 };
+    XDSL_BUS_TXN               stTxn;
     INT                        iWANInstance   = -1;
 
     //Validate buffer
@@ -1947,21 +2692,206 @@ ANSC_STATUS DmlXdslSetPhyStatusForWanManager( char *ifname, char *PhyStatus )
 
     CcspTraceInfo(("%s %d WAN Instance:%d\n",__FUNCTION__, __LINE__,iWANInstance));
 
-    //Set PHY path
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, WAN_PHY_PATH_PARAM_NAME, iWANInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", stGlobalInfo.LowerLayers );
-    DmlXdslSetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, FALSE );
-
-    //Set PHY Status
-    snprintf( acSetParamName, DATAMODEL_PARAM_LENGTH, WAN_PHY_STATUS_PARAM_NAME, iWANInstance );
-    snprintf( acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", PhyStatus );
-    DmlXdslSetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string, TRUE );
+    //PHY path and PHY Status are applied together with one commit
+    XdslBusTxnBegin( &stTxn, WAN_COMPONENT_NAME, WAN_DBUS_PATH );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, stGlobalInfo.LowerLayers, WAN_PHY_PATH_PARAM_NAME, iWANInstance );
+    XdslBusTxnAddParam( &stTxn, ccsp_string, PhyStatus, WAN_PHY_STATUS_PARAM_NAME, iWANInstance );
+    if ( ANSC_STATUS_SUCCESS != XdslBusTxnCommit( &stTxn ) )
+    {
+        CcspTraceError(("%s %d Failed to set PHY status for %s\n", __FUNCTION__, __LINE__, ifname));
+        return ANSC_STATUS_FAILURE;
+    }
 
     CcspTraceInfo(("%s %d Successfully notified %s event to WAN Agent for %s interface\n", __FUNCTION__, __LINE__, PhyStatus, ifname));
 
     return ANSC_STATUS_SUCCESS;
 }
 
+/* * DmlXdslWarmRestartCollect() */
+static ANSC_STATUS DmlXdslWarmRestartCollect( char *ifname, PXDSL_WARM_RESTART_SNAPSHOT pstSnapshot )
+{
+    DML_XDSL_LINE_GLOBALINFO   stGlobalInfo   = { 0 };
+    XDSL_NOTIFY_ENUM           enXtmAgent;
+
+    //Get global copy of the data from interface name
+    if ( ANSC_STATUS_SUCCESS != DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( ifname, &stGlobalInfo ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    snprintf( pstSnapshot->Name, sizeof( pstSnapshot->Name ), "%s", stGlobalInfo.Name );
+    snprintf( pstSnapshot->LowerLayers, sizeof( pstSnapshot->LowerLayers ), "%s", stGlobalInfo.LowerLayers );
+    snprintf( pstSnapshot->StandardUsed, sizeof( pstSnapshot->StandardUsed ), "%s", stGlobalInfo.StandardUsed );
+
+    //Same standard to link type mapping as the XTM creation job
+    if( XDSL_STANDARD_FAMILY_ADSL == stGlobalInfo.StandardFamily ) /* ADSL */
+    {
+        pstSnapshot->XtmTable = XDSL_INSTANCE_TABLE_ATM;
+        enXtmAgent            = NOTIFY_TO_ATM_AGENT;
+    }
+    else if( XDSL_STANDARD_FAMILY_VDSL == stGlobalInfo.StandardFamily ) /* VDSL */
+    {
+        pstSnapshot->XtmTable = XDSL_INSTANCE_TABLE_PTM;
+        enXtmAgent            = NOTIFY_TO_PTM_AGENT;
+    }
+    else
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    DmlXdslGetLowerLayersInstanceInOtherAgent( enXtmAgent, stGlobalInfo.LowerLayers, &pstSnapshot->XtmInstance );
+    DmlXdslGetLowerLayersInstanceInOtherAgent( NOTIFY_TO_WAN_AGENT, stGlobalInfo.Name, &pstSnapshot->WanInstance );
+
+    if( ( -1 == pstSnapshot->XtmInstance ) || ( -1 == pstSnapshot->WanInstance ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* * DmlXdslWarmRestartSave() */
+ANSC_STATUS DmlXdslWarmRestartSave( char *ifname, INT iSmState )
+{
+    XDSL_WARM_RESTART_SNAPSHOT stSnapshot;
+
+    //Validate buffer
+    if( NULL == ifname )
+    {
+        CcspTraceError(("%s Invalid Memory\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Zero padding as well, it is covered by the checksum
+    memset( &stSnapshot, 0, sizeof( stSnapshot ) );
+
+    if( ANSC_STATUS_SUCCESS != DmlXdslWarmRestartCollect( ifname, &stSnapshot ) )
+    {
+        CcspTraceWarning(("%s %d - No XTM or WAN instance for %s, warm restart not possible\n", __FUNCTION__, __LINE__, ifname));
+        XdslWarmRestartClear( ifname );
+        return ANSC_STATUS_FAILURE;
+    }
+
+    stSnapshot.SmState = iSmState;
+
+    return XdslWarmRestartSave( &stSnapshot );
+}
+
+/* * DmlXdslWarmRestartValidate() */
+static ANSC_STATUS DmlXdslWarmRestartValidate( char *ifname, PXDSL_WARM_RESTART_SNAPSHOT pstSaved, INT iSmState, INT *piLineIndex )
+{
+    XDSL_WARM_RESTART_SNAPSHOT stLive;
+    DML_XDSL_LINE_LIVE         stLineLive;
+    char                       acParamName[DATAMODEL_PARAM_LENGTH]  = { 0 };
+    char                       acParamValue[DATAMODEL_PARAM_LENGTH] = { 0 };
+
+    if( pstSaved->SmState != iSmState )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    if( ANSC_STATUS_SUCCESS != DmlXdslLineGetIndexFromIfName( ifname, piLineIndex ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Ask the driver directly, its first link status event may not have arrived yet
+    if( ( RETURN_OK != xdsl_hal_dslGetLineLive( *piLineIndex, &stLineLive ) ) ||
+        ( XDSL_LINK_STATUS_Up != stLineLive.LinkStatus ) )
+    {
+        CcspTraceInfo(("%s %d - %s is not in showtime\n", __FUNCTION__, __LINE__, ifname));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Line retrained with another standard or the other agents were reprovisioned
+    memset( &stLive, 0, sizeof( stLive ) );
+    if( ( ANSC_STATUS_SUCCESS != DmlXdslWarmRestartCollect( ifname, &stLive ) ) ||
+        ( 0 != strcmp( stLive.StandardUsed, pstSaved->StandardUsed ) ) ||
+        ( 0 != strcmp( stLive.LowerLayers, pstSaved->LowerLayers ) ) ||
+        ( stLive.XtmTable != pstSaved->XtmTable ) ||
+        ( stLive.XtmInstance != pstSaved->XtmInstance ) ||
+        ( stLive.WanInstance != pstSaved->WanInstance ) )
+    {
+        CcspTraceInfo(("%s %d - Runtime state of %s changed since the snapshot\n", __FUNCTION__, __LINE__, ifname));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //XTM link must still be enabled
+    snprintf( acParamName, DATAMODEL_PARAM_LENGTH, ( XDSL_INSTANCE_TABLE_ATM == stLive.XtmTable ) ? ATM_LINK_ENABLE_PARAM_NAME : PTM_LINK_ENABLE_PARAM_NAME, stLive.XtmInstance );
+    if( ( ANSC_STATUS_SUCCESS != DmlXdslGetParamValues( XTM_COMPONENT_NAME, XTM_DBUS_PATH, acParamName, acParamValue ) ) ||
+        ( 0 != strcmp( acParamValue, "true" ) ) )
+    {
+        CcspTraceInfo(("%s %d - XTM Instance:%d is not enabled\n", __FUNCTION__, __LINE__, stLive.XtmInstance));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //WAN Manager must still consider the link up
+    memset( acParamValue, 0, sizeof( acParamValue ) );
+    snprintf( acParamName, DATAMODEL_PARAM_LENGTH, WAN_LINK_STATUS_PARAM_NAME, stLive.WanInstance );
+    if( ( ANSC_STATUS_SUCCESS != DmlXdslGetParamValues( WAN_COMPONENT_NAME, WAN_DBUS_PATH, acParamName, acParamValue ) ) ||
+        ( 0 != strcmp( acParamValue, "Up" ) ) )
+    {
+        CcspTraceInfo(("%s %d - WAN Instance:%d link is not up\n", __FUNCTION__, __LINE__, stLive.WanInstance));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* * DmlXdslWarmRestartResume() */
+ANSC_STATUS DmlXdslWarmRestartResume( char *ifname, INT iSmState )
+{
+    XDSL_WARM_RESTART_SNAPSHOT stSaved;
+    DML_XDSL_LINE_GLOBALINFO   stGlobalInfo   = { 0 };
+    INT                        iLineIndex     = -1;
+
+    //Validate buffer
+    if( NULL == ifname )
+    {
+        CcspTraceError(("%s Invalid Memory\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //No snapshot, cold start
+    if( ANSC_STATUS_SUCCESS != XdslWarmRestartLoad( ifname, &stSaved ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //A snapshot is only trusted once, anything stale falls back to a full bring-up
+    if( ANSC_STATUS_SUCCESS != DmlXdslWarmRestartValidate( ifname, &stSaved, iSmState, &iLineIndex ) )
+    {
+        XdslWarmRestartClear( ifname );
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Same path and damping gate as a driver event so the WAN PHY status and LED follow
+    DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( ifname, &stGlobalInfo );
+    if( XDSL_LINK_STATUS_Up != stGlobalInfo.LinkStatus )
+    {
+        if( TRUE != DmlXdslLineGateLinkStatus( ifname, XDSL_LINK_STATUS_Up ) )
+        {
+            //Held down, the release delivers the up and the line comes up the regular way
+            CcspTraceInfo(("%s %d - %s is damped, not resuming\n", __FUNCTION__, __LINE__, ifname));
+            XdslWarmRestartClear( ifname );
+            return ANSC_STATUS_FAILURE;
+        }
+    }
+
+    DmlXdslLineSetWanStatus( iLineIndex, XDSL_LINE_WAN_UP );
+
+    CcspTraceInfo(("%s %d - Resumed %s %s XTM Instance:%d WAN Instance:%d\n", __FUNCTION__, __LINE__, ifname,
+                   stSaved.StandardUsed, stSaved.XtmInstance, stSaved.WanInstance));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* * DmlXdslWarmRestartClear() */
+VOID DmlXdslWarmRestartClear( char *ifname )
+{
+    XdslWarmRestartClear( ifname );
+}
+
 /*DmlXdslChannelInit */
 ANSC_STATUS
 DmlXdslChannelInit
@@ -2014,6 +2944,16 @@ DmlXdslChannelInit
     //Assign the memory address to oringinal structure
     pMyObject->pDSLChannel = pDSLChannelTmp;
 
+    //Allocate one channel snapshot per line, filled by the first Channel_Synchronize
+    pMyObject->pDSLChannelSnapshot = (PDML_XDSL_CHANNEL_SNAPSHOT) AnscAllocateMemory( sizeof(DML_XDSL_CHANNEL_SNAPSHOT) * pMyObject->ulTotalNoofDSLLines );
+
+    if( NULL == pMyObject->pDSLChannelSnapshot )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    memset( pMyObject->pDSLChannelSnapshot, 0, ( sizeof(DML_XDSL_CHANNEL_SNAPSHOT) * pMyObject->ulTotalNoofDSLLines ) );
+
     return ANSC_STATUS_SUCCESS;
 }
 
@@ -2057,6 +2997,13 @@ ANSC_STATUS DmlXdslGetChannelCfg( INT LineIndex, INT ChannelIndex, PDML_XDSL_CHA
          return ANSC_STATUS_FAILURE;
     }
 
+    //Get channel statistics
+    return DmlXdslGetChannelStats( LineIndex, ChannelIndex, pstChannelInfo );
+}
+
+/* DmlXdslGetChannelStats() */
+static ANSC_STATUS DmlXdslGetChannelStats( INT LineIndex, INT ChannelIndex, PDML_XDSL_CHANNEL pstChannelInfo )
+{
     //Initialize statistics
     memset( &pstChannelInfo->stChannelStats, 0, sizeof(DML_XDSL_CHANNEL_STATS ));
 
@@ -2069,48 +3016,175 @@ ANSC_STATUS DmlXdslGetChannelCfg( INT LineIndex, INT ChannelIndex, PDML_XDSL_CHA
     return ANSC_STATUS_SUCCESS;
 }
 
-/* DmlXdslChannelSetEnable() */
-ANSC_STATUS DmlXdslChannelSetEnable( INT LineIndex, INT ChannelIndex, BOOL Enable )
+/* DmlXdslGetMonotonicMs() */
+static ULONG DmlXdslGetMonotonicMs( VOID )
 {
-    //Validate index
-    if ( ( ChannelIndex < 0 ) || ( LineIndex < 0 ) )
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+
+    return (ULONG)( (ULONG)ts.tv_sec * 1000 + (ULONG)( ts.tv_nsec / 1000000 ) );
+}
+
+/* DmlXdslChannelIsSnapshotStale() */
+BOOL DmlXdslChannelIsSnapshotStale( ANSC_HANDLE hContext )
+{
+    PDATAMODEL_XDSL               pMyObject  = (PDATAMODEL_XDSL)hContext;
+    PDML_XDSL_CHANNEL_SNAPSHOT    pSnapshot  = NULL;
+    ULONG                         ulNow      = DmlXdslGetMonotonicMs();
+    INT                           iLoopCount = 0;
+
+    if( ( NULL == pMyObject ) || ( NULL == pMyObject->pDSLChannelSnapshot ) )
     {
-        CcspTraceError(("%s Invalid index[%d,%d]\n", __FUNCTION__,ChannelIndex,LineIndex));
-        return ANSC_STATUS_FAILURE;
+        return FALSE;
     }
 
-    //Set enable/disable
-    //TBD
+    for( iLoopCount = 0; iLoopCount < pMyObject->ulTotalNoofDSLLines; iLoopCount++ )
+    {
+        pSnapshot = pMyObject->pDSLChannelSnapshot + iLoopCount;
 
-    CcspTraceInfo(("%s - %s:LineIndex:%d ChannelIndex:%d Enable:%d\n",__FUNCTION__,XDSL_MARKER_CHAN_CFG_CHNG,LineIndex,ChannelIndex,Enable));
+        if( ( FALSE == pSnapshot->bValid ) ||
+            ( (ULONG)( ulNow - pSnapshot->ulTimestamp ) >= XDSL_CHANNEL_SNAPSHOT_TIMEOUT_MS ) )
+        {
+            return TRUE;
+        }
+    }
 
-    return ANSC_STATUS_SUCCESS;
+    return FALSE;
 }
 
-/*DmlXdslDiagnosticsInit */
-ANSC_STATUS
-DmlXdslDiagnosticsInit
-    (
-        PANSC_HANDLE                phContext
-    )
+/* DmlXdslChannelRefreshSnapshot() */
+ANSC_STATUS DmlXdslChannelRefreshSnapshot( ANSC_HANDLE hContext )
 {
-    PDATAMODEL_XDSL               pMyObject       = (PDATAMODEL_XDSL)phContext;
-    PDML_XDSL_DIAGNOSTICS_FULL    pDSLDiagTmp     = NULL;
-
-    pDSLDiagTmp = (PDML_XDSL_DIAGNOSTICS_FULL) AnscAllocateMemory( sizeof(DML_XDSL_DIAGNOSTICS_FULL) );
-
-    //Return failure if allocation failiure
-    if( NULL == pDSLDiagTmp )
+    PDATAMODEL_XDSL               pMyObject     = (PDATAMODEL_XDSL)hContext;
+    PDML_XDSL_CHANNEL_SNAPSHOT    pSnapshot     = NULL;
+    PDML_XDSL_CHANNEL             pDSLChannel   = NULL;
+    DML_XDSL_LINE_STATS           stLineStats;
+    ULONG                         ulNow         = DmlXdslGetMonotonicMs();
+    ULONG                         ulEpoch       = 0;
+    ULONG                         ulEpochDiff   = 0;
+    BOOL                          bResync       = FALSE;
+    ANSC_STATUS                   returnStatus  = ANSC_STATUS_SUCCESS;
+    INT                           iLineIndex    = 0,
+                                  iChannelIndex = 0,
+                                  iLoopCount    = 0;
+
+    if( ( NULL == pMyObject ) || ( NULL == pMyObject->pDSLChannelSnapshot ) )
     {
+        CcspTraceError(("%s Invalid Memory\n", __FUNCTION__));
         return ANSC_STATUS_FAILURE;
     }
 
-    //Memset all memory
-    memset( pDSLDiagTmp, 0, sizeof(DML_XDSL_DIAGNOSTICS_FULL) );
+    for( iLineIndex = 0; iLineIndex < pMyObject->ulTotalNoofDSLLines; iLineIndex++ )
+    {
+        pSnapshot = pMyObject->pDSLChannelSnapshot + iLineIndex;
 
-    //Initialize
-    pDSLDiagTmp->stDiagADSLLineTest.DiagnosticsState  = XDSL_DIAG_STATE_None;
-    pDSLDiagTmp->stDiagSELTUER.DiagnosticsState       = XDSL_DIAG_STATE_None;
+        if( ( TRUE == pSnapshot->bValid ) &&
+            ( (ULONG)( ulNow - pSnapshot->ulTimestamp ) < XDSL_CHANNEL_SNAPSHOT_TIMEOUT_MS ) )
+        {
+            continue;
+        }
+
+        //Retry after the next timeout on failure instead of on every access
+        pSnapshot->ulTimestamp = ulNow;
+
+        //Probe the line, a retrain or a new showtime invalidates the channel configuration
+        memset( &stLineStats, 0, sizeof(stLineStats) );
+        if ( RETURN_OK != xdsl_hal_dslGetLineStats( iLineIndex, &stLineStats ) )
+        {
+            CcspTraceError(("%s Failed to get line stats for line %d\n", __FUNCTION__, iLineIndex));
+            returnStatus = ANSC_STATUS_FAILURE;
+            continue;
+        }
+
+        //ShowtimeStart counts seconds since showtime began, convert it to a fixed point in time
+        ulEpoch     = ( stLineStats.ShowtimeStart > 0 ) ? ( ( ulNow / 1000 ) - stLineStats.ShowtimeStart ) : 0;
+        ulEpochDiff = ( ulEpoch > pSnapshot->ShowtimeEpoch ) ? ( ulEpoch - pSnapshot->ShowtimeEpoch ) : ( pSnapshot->ShowtimeEpoch - ulEpoch );
+
+        //The retrain counter is a CurrentDay one, it drops at the day rollover without any retrain
+        bResync = ( FALSE == pSnapshot->bValid ) ||
+                  ( pSnapshot->LinkRetrain < stLineStats.stCurrentDay.X_RDK_LinkRetrain ) ||
+                  ( ulEpochDiff > XDSL_CHANNEL_SHOWTIME_JITTER_SEC );
+
+        //Healthy line across the day boundary, only rebase the counter
+        pSnapshot->LinkRetrain = stLineStats.stCurrentDay.X_RDK_LinkRetrain;
+
+        pSnapshot->bValid = TRUE;
+        iChannelIndex     = 0;
+
+        for( iLoopCount = 0; iLoopCount < pMyObject->ulTotalNoofDSLChannels; iLoopCount++ )
+        {
+            pDSLChannel = pMyObject->pDSLChannel + iLoopCount;
+
+            if( pDSLChannel->LineIndex != iLineIndex )
+            {
+                continue;
+            }
+
+            if ( ANSC_STATUS_SUCCESS != ( bResync ? DmlXdslGetChannelCfg( iLineIndex, iChannelIndex, pDSLChannel ) :
+                                                    DmlXdslGetChannelStats( iLineIndex, iChannelIndex, pDSLChannel ) ) )
+            {
+                pSnapshot->bValid = FALSE;
+                returnStatus      = ANSC_STATUS_FAILURE;
+            }
+
+            iChannelIndex++;
+        }
+
+        if( bResync )
+        {
+            pSnapshot->ShowtimeEpoch = ulEpoch;
+            pSnapshot->ulVersion++;
+
+            CcspTraceInfo(("%s - Line %d channel snapshot resynced, version %lu\n", __FUNCTION__, iLineIndex, pSnapshot->ulVersion));
+        }
+    }
+
+    return returnStatus;
+}
+
+/* DmlXdslChannelSetEnable() */
+ANSC_STATUS DmlXdslChannelSetEnable( INT LineIndex, INT ChannelIndex, BOOL Enable )
+{
+    //Validate index
+    if ( ( ChannelIndex < 0 ) || ( LineIndex < 0 ) )
+    {
+        CcspTraceError(("%s Invalid index[%d,%d]\n", __FUNCTION__,ChannelIndex,LineIndex));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Set enable/disable
+    //TBD
+
+    CcspTraceInfo(("%s - %s:LineIndex:%d ChannelIndex:%d Enable:%d\n",__FUNCTION__,XDSL_MARKER_CHAN_CFG_CHNG,LineIndex,ChannelIndex,Enable));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/*DmlXdslDiagnosticsInit */
+ANSC_STATUS
+DmlXdslDiagnosticsInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL               pMyObject       = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_DIAGNOSTICS_FULL    pDSLDiagTmp     = NULL;
+
+    pDSLDiagTmp = (PDML_XDSL_DIAGNOSTICS_FULL) AnscAllocateMemory( sizeof(DML_XDSL_DIAGNOSTICS_FULL) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLDiagTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLDiagTmp, 0, sizeof(DML_XDSL_DIAGNOSTICS_FULL) );
+
+    //Initialize
+    pDSLDiagTmp->stDiagADSLLineTest.DiagnosticsState  = XDSL_DIAG_STATE_None;
+    pDSLDiagTmp->stDiagSELTUER.DiagnosticsState       = XDSL_DIAG_STATE_None;
     pDSLDiagTmp->stDiagSELTQLN.DiagnosticsState       = XDSL_DIAG_STATE_None;
     pDSLDiagTmp->stDiagSELTP.DiagnosticsState         = XDSL_DIAG_STATE_None;
 
@@ -2217,3 +3291,1324 @@ ANSC_STATUS DmlXdslGetXRDKNlm( PDML_XDSL_X_RDK_NLNM  pstXRdkNlm )
 
     return ANSC_STATUS_SUCCESS;
 }
+
+/*DmlXdslPerfInit */
+ANSC_STATUS
+DmlXdslPerfInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL               pMyObject       = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_X_RDK_PERF          pDSLPerfTmp     = NULL;
+    INT                           iLoopCount      = 0;
+
+    pDSLPerfTmp = (PDML_XDSL_X_RDK_PERF) AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_PERF) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLPerfTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLPerfTmp, 0, sizeof(DML_XDSL_X_RDK_PERF) );
+
+    pDSLPerfTmp->Enable              = XdslHalPerfIsEnabled();
+    pDSLPerfTmp->ByteCounting        = XdslHalPerfIsByteCountingEnabled();
+    pDSLPerfTmp->ulTotalNoofHalCalls = XDSL_HAL_PERF_MAX;
+
+    for( iLoopCount = 0; iLoopCount < XDSL_HAL_PERF_MAX; iLoopCount++ )
+    {
+        XdslHalPerfGetStats( iLoopCount, &pDSLPerfTmp->stHalCall[iLoopCount] );
+    }
+
+    //Assign the memory address to oringinal structure
+    pMyObject->pDSLPerf = pDSLPerfTmp;
+
+    //SIGUSR2 only requests a statistics dump, the dump thread writes it
+    XdslHalPerfDumpInit();
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetHalPerf() */
+ANSC_STATUS DmlXdslGetHalPerf( INT HalCallIndex, PDML_XDSL_HAL_PERF pstHalPerf )
+{
+    if( ( NULL == pstHalPerf ) || ( HalCallIndex < 0 ) || ( HalCallIndex >= XDSL_HAL_PERF_MAX ) )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return XdslHalPerfGetStats( HalCallIndex, pstHalPerf );
+}
+
+/* DmlXdslSetHalPerfEnable() */
+ANSC_STATUS DmlXdslSetHalPerfEnable( BOOL Enable )
+{
+    XdslHalPerfSetEnable( Enable );
+    CcspTraceInfo(("%s HAL call instrumentation %s\n", __FUNCTION__, Enable ? "enabled" : "disabled"));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslSetHalPerfByteCounting() */
+ANSC_STATUS DmlXdslSetHalPerfByteCounting( BOOL Enable )
+{
+    XdslHalPerfSetByteCounting( Enable );
+    CcspTraceInfo(("%s HAL call byte counting %s\n", __FUNCTION__, Enable ? "enabled" : "disabled"));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslResetHalPerf() */
+ANSC_STATUS DmlXdslResetHalPerf( VOID )
+{
+    XdslHalPerfReset();
+    CcspTraceInfo(("%s HAL call counters cleared\n", __FUNCTION__));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/*DmlXdslBringUpInit */
+ANSC_STATUS
+DmlXdslBringUpInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL               pMyObject       = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_X_RDK_BRINGUP       pDSLBringUpTmp  = NULL;
+    INT                           iLoopCount      = 0;
+
+    pDSLBringUpTmp = (PDML_XDSL_X_RDK_BRINGUP) AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_BRINGUP) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLBringUpTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLBringUpTmp, 0, sizeof(DML_XDSL_X_RDK_BRINGUP) );
+
+    pDSLBringUpTmp->ulTotalNoofPhases = XDSL_BRINGUP_PHASE_MAX;
+
+    for( iLoopCount = 0; iLoopCount < XDSL_BRINGUP_PHASE_MAX; iLoopCount++ )
+    {
+        XdslBringUpGetPhaseStats( iLoopCount, &pDSLBringUpTmp->stPhase[iLoopCount] );
+    }
+
+    //Assign the memory address to oringinal structure
+    pMyObject->pDSLBringUp = pDSLBringUpTmp;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetBringUpPhase() */
+ANSC_STATUS DmlXdslGetBringUpPhase( INT PhaseIndex, PDML_XDSL_BRINGUP_PHASE pstPhase )
+{
+    if( ( NULL == pstPhase ) || ( PhaseIndex < 0 ) || ( PhaseIndex >= XDSL_BRINGUP_PHASE_MAX ) )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return XdslBringUpGetPhaseStats( PhaseIndex, pstPhase );
+}
+
+/* DmlXdslGetBringUpTraces() */
+ANSC_STATUS DmlXdslGetBringUpTraces( PDML_XDSL_X_RDK_BRINGUP pstBringUp )
+{
+    if( NULL == pstBringUp )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pstBringUp->ulTotalNoofTraces = XdslBringUpGetTraces( pstBringUp->stTrace, XDSL_BRINGUP_TRACE_MAX );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslResetBringUp() */
+ANSC_STATUS DmlXdslResetBringUp( VOID )
+{
+    XdslBringUpReset();
+    CcspTraceInfo(("%s Link bring-up statistics cleared\n", __FUNCTION__));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/*DmlXdslFlapDampingInit */
+ANSC_STATUS
+DmlXdslFlapDampingInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL               pMyObject          = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_X_RDK_FLAP_DAMPING  pDSLFlapDampingTmp = NULL;
+    XDSL_FLAP_DAMPING_CONFIG      stConfig           = { 0 };
+    ULONG                         psmValue           = 0;
+
+    pDSLFlapDampingTmp = (PDML_XDSL_X_RDK_FLAP_DAMPING) AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_FLAP_DAMPING) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLFlapDampingTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLFlapDampingTmp, 0, sizeof(DML_XDSL_X_RDK_FLAP_DAMPING) );
+
+    //Defaults unless overridden in PSM
+    stConfig.Enable            = XDSL_FLAP_DAMPING_DEFAULT_ENABLE;
+    stConfig.HalfLife          = XDSL_FLAP_DAMPING_DEFAULT_HALF_LIFE;
+    stConfig.SuppressThreshold = XDSL_FLAP_DAMPING_DEFAULT_SUPPRESS;
+    stConfig.ReuseThreshold    = XDSL_FLAP_DAMPING_DEFAULT_REUSE;
+    stConfig.MaxSuppressTime   = XDSL_FLAP_DAMPING_DEFAULT_MAX_SUPPRESS_TIME;
+
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_FLAP_DAMPING_ENABLE, &psmValue ) )
+    {
+        stConfig.Enable = ( psmValue ) ? TRUE : FALSE;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_FLAP_DAMPING_HALF_LIFE, &psmValue ) )
+    {
+        stConfig.HalfLife = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_FLAP_DAMPING_SUPPRESS, &psmValue ) )
+    {
+        stConfig.SuppressThreshold = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_FLAP_DAMPING_REUSE, &psmValue ) )
+    {
+        stConfig.ReuseThreshold = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_FLAP_DAMPING_MAX_SUPPRESS_TIME, &psmValue ) )
+    {
+        stConfig.MaxSuppressTime = psmValue;
+    }
+
+    //Keep the defaults if the stored set is inconsistent
+    if( ANSC_STATUS_SUCCESS != XdslFlapDampingInit( &stConfig ) )
+    {
+        CcspTraceWarning(("%s Invalid damping configuration in PSM, using defaults\n", __FUNCTION__));
+    }
+
+    giFlapDampingTimerId = XdslReactorAddTimer( DmlXdslFlapDampingTimer, NULL );
+    if( 0 > giFlapDampingTimerId )
+    {
+        CcspTraceError(("%s Failed to create damping timer\n", __FUNCTION__));
+    }
+
+    DmlXdslGetFlapDampingConfig( pDSLFlapDampingTmp );
+
+    //Assign the memory address to oringinal structure
+    pMyObject->pDSLFlapDamping = pDSLFlapDampingTmp;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetFlapDampingConfig() */
+ANSC_STATUS DmlXdslGetFlapDampingConfig( PDML_XDSL_X_RDK_FLAP_DAMPING pstFlapDamping )
+{
+    XDSL_FLAP_DAMPING_CONFIG stConfig = { 0 };
+
+    if( NULL == pstFlapDamping )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslFlapDampingGetConfig( &stConfig );
+
+    pstFlapDamping->Enable            = stConfig.Enable;
+    pstFlapDamping->HalfLife          = stConfig.HalfLife;
+    pstFlapDamping->SuppressThreshold = stConfig.SuppressThreshold;
+    pstFlapDamping->ReuseThreshold    = stConfig.ReuseThreshold;
+    pstFlapDamping->MaxSuppressTime   = stConfig.MaxSuppressTime;
+    pstFlapDamping->bConfigChanged    = FALSE;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslSetFlapDampingConfig() */
+ANSC_STATUS DmlXdslSetFlapDampingConfig( PDML_XDSL_X_RDK_FLAP_DAMPING pstFlapDamping )
+{
+    XDSL_FLAP_DAMPING_CONFIG stConfig = { 0 };
+
+    if( NULL == pstFlapDamping )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    stConfig.Enable            = pstFlapDamping->Enable;
+    stConfig.HalfLife          = pstFlapDamping->HalfLife;
+    stConfig.SuppressThreshold = pstFlapDamping->SuppressThreshold;
+    stConfig.ReuseThreshold    = pstFlapDamping->ReuseThreshold;
+    stConfig.MaxSuppressTime   = pstFlapDamping->MaxSuppressTime;
+
+    if( ANSC_STATUS_SUCCESS != XdslFlapDampingSetConfig( &stConfig ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    SetNVRamULONGConfiguration( PSM_FLAP_DAMPING_ENABLE, stConfig.Enable );
+    SetNVRamULONGConfiguration( PSM_FLAP_DAMPING_HALF_LIFE, stConfig.HalfLife );
+    SetNVRamULONGConfiguration( PSM_FLAP_DAMPING_SUPPRESS, stConfig.SuppressThreshold );
+    SetNVRamULONGConfiguration( PSM_FLAP_DAMPING_REUSE, stConfig.ReuseThreshold );
+    SetNVRamULONGConfiguration( PSM_FLAP_DAMPING_MAX_SUPPRESS_TIME, stConfig.MaxSuppressTime );
+    XdslPsmCacheFlush();
+
+    //Disabling or a lower reuse threshold can release a line right away
+    if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DmlXdslFlapDampingReleaseJob, NULL ) )
+    {
+        DmlXdslFlapDampingArmTimer( XDSL_FLAP_DAMPING_RESUBMIT_MS );
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetFlapDampingStats() */
+ANSC_STATUS DmlXdslGetFlapDampingStats( PDML_XDSL_X_RDK_FLAP_DAMPING pstFlapDamping )
+{
+    XDSL_FLAP_DAMPING_STATS stStats = { 0 };
+
+    if( NULL == pstFlapDamping )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslFlapDampingGetStats( &stStats );
+
+    pstFlapDamping->Flaps            = stStats.Flaps;
+    pstFlapDamping->SuppressedEvents = stStats.SuppressedEvents;
+    pstFlapDamping->Suppressions     = stStats.Suppressions;
+    pstFlapDamping->Penalty          = stStats.Penalty;
+    pstFlapDamping->SuppressedLines  = stStats.SuppressedLines;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslResetFlapDampingStats() */
+ANSC_STATUS DmlXdslResetFlapDampingStats( VOID )
+{
+    XdslFlapDampingResetStats();
+    CcspTraceInfo(("%s Link flap damping counters cleared\n", __FUNCTION__));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/*DmlXdslTrainHintInit */
+ANSC_STATUS
+DmlXdslTrainHintInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL                pMyObject           = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_X_RDK_TRAINING_HINT  pDSLTrainingHintTmp = NULL;
+    XDSL_TRAIN_HINT                stHint              = { 0 };
+    BOOL                           bEnable             = XDSL_TRAIN_HINT_DEFAULT_ENABLE;
+    ULONG                          ulFallbackTimeout   = XDSL_TRAIN_HINT_DEFAULT_FALLBACK_TIMEOUT;
+    ULONG                          psmValue            = 0;
+    CHAR                           acPsmName[64]       = { 0 };
+
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_TRAIN_HINT_ENABLE, &psmValue ) )
+    {
+        bEnable = ( psmValue ) ? TRUE : FALSE;
+    }
+    if( ( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_TRAIN_HINT_FALLBACK_TIMEOUT, &psmValue ) ) && ( 0 != psmValue ) )
+    {
+        ulFallbackTimeout = psmValue;
+    }
+
+    //Configuration the line last reached showtime with, empty on a first boot
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_STANDARD, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    GetNVRamStringConfiguration( acPsmName, stHint.StandardUsed, sizeof(stHint.StandardUsed) );
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_PROFILE, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    GetNVRamStringConfiguration( acPsmName, stHint.CurrentProfile, sizeof(stHint.CurrentProfile) );
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_UPSTREAM_RATE, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    GetNVRamULONGConfiguration( acPsmName, &stHint.UpstreamRate );
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_DOWNSTREAM_RATE, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    GetNVRamULONGConfiguration( acPsmName, &stHint.DownstreamRate );
+
+    XdslTrainHintInit( bEnable, ulFallbackTimeout, &stHint );
+
+    giTrainHintTimerId = XdslReactorAddTimer( DmlXdslTrainHintTimer, NULL );
+    if( 0 > giTrainHintTimerId )
+    {
+        CcspTraceError(("%s Failed to create training hint timer\n", __FUNCTION__));
+    }
+
+    //Reconfiguring a line left in showtime would retrain it, the next line drop applies the configuration
+    if( DmlXdslTrainHintLineInShowtime( ) )
+    {
+        CcspTraceInfo(("%s Line is in showtime, driver configuration left as is\n", __FUNCTION__));
+    }
+    else if( ANSC_STATUS_SUCCESS != DmlXdslLineApplyPolicy( XdslTrainHintShouldOffer() ) )
+    {
+        CcspTraceError(("%s Failed to configure xDSL driver\n", __FUNCTION__));
+    }
+
+    pDSLTrainingHintTmp = (PDML_XDSL_X_RDK_TRAINING_HINT) AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_TRAINING_HINT) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLTrainingHintTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLTrainingHintTmp, 0, sizeof(DML_XDSL_X_RDK_TRAINING_HINT) );
+
+    DmlXdslGetTrainingHintConfig( pDSLTrainingHintTmp );
+
+    //Assign the memory address to oringinal structure
+    pMyObject->pDSLTrainingHint = pDSLTrainingHintTmp;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslTrainHintIsLine() */
+static BOOL DmlXdslTrainHintIsLine( char *ifname )
+{
+    INT iLineIndex = -1;
+
+    if( ( NULL == ifname ) || ( ANSC_STATUS_SUCCESS != DmlXdslLineGetIndexFromIfName( ifname, &iLineIndex ) ) )
+    {
+        return FALSE;
+    }
+
+    return ( ( XDSL_TRAIN_HINT_LINE_INSTANCE - 1 ) == iLineIndex ) ? TRUE : FALSE;
+}
+
+/* DmlXdslTrainHintTraining() */
+VOID DmlXdslTrainHintTraining( char *ifname )
+{
+    ULONG ulFallbackTimeout = 0;
+
+    if( !DmlXdslTrainHintIsLine( ifname ) )
+    {
+        return;
+    }
+
+    //Deadline runs from the first training on the hint, not from the moment it was offered
+    if( XdslTrainHintTrainingStarted( ) && ( 0 <= giTrainHintTimerId ) )
+    {
+        XdslTrainHintGetConfig( NULL, &ulFallbackTimeout );
+        XdslReactorSetTimer( giTrainHintTimerId, ulFallbackTimeout * 1000, 0 );
+    }
+}
+
+/* DmlXdslTrainHintTrained() */
+BOOL DmlXdslTrainHintTrained( char *ifname )
+{
+    BOOL bHinted;
+
+    if( !DmlXdslTrainHintIsLine( ifname ) )
+    {
+        return FALSE;
+    }
+
+    bHinted = XdslTrainHintTrained( );
+
+    if( 0 <= giTrainHintTimerId )
+    {
+        XdslReactorSetTimer( giTrainHintTimerId, 0, 0 );
+    }
+
+    //Negotiated mode and rates are read on a worker, bring-up does not wait for them
+    XdslReactorSubmit( DmlXdslTrainHintLearnJob, NULL );
+
+    return bHinted;
+}
+
+/* DmlXdslTrainHintLineDown() */
+VOID DmlXdslTrainHintLineDown( char *ifname )
+{
+    if( !DmlXdslTrainHintIsLine( ifname ) )
+    {
+        return;
+    }
+
+    //Next training gets the hint again unless it timed out since the line last trained
+    XdslReactorSubmit( DmlXdslTrainHintOfferJob, NULL );
+}
+
+/* DmlXdslTrainHintLineInShowtime() */
+static BOOL DmlXdslTrainHintLineInShowtime( VOID )
+{
+    DML_XDSL_LINE_LIVE stLineLive;
+
+    return ( ( RETURN_OK == xdsl_hal_dslGetLineLive( XDSL_TRAIN_HINT_LINE_INSTANCE - 1, &stLineLive ) ) &&
+             ( XDSL_LINK_STATUS_Up == stLineLive.LinkStatus ) ) ? TRUE : FALSE;
+}
+
+/* DmlXdslTrainHintTimer() */
+static void DmlXdslTrainHintTimer( PVOID pContext )
+{
+    //Timer callbacks must not block, the driver is reconfigured on a worker
+    XdslReactorSubmit( DmlXdslTrainHintFallbackJob, NULL );
+}
+
+/* DmlXdslTrainHintFallbackJob() */
+static void DmlXdslTrainHintFallbackJob( PVOID pContext )
+{
+    if( !XdslTrainHintFallback( ) )
+    {
+        return;
+    }
+
+    CcspTraceWarning(("%s Line did not train on the last good configuration, offering the full set\n", __FUNCTION__));
+
+    if( ANSC_STATUS_SUCCESS != DmlXdslLineApplyPolicy( FALSE ) )
+    {
+        CcspTraceError(("%s Failed to configure xDSL driver\n", __FUNCTION__));
+    }
+}
+
+/* DmlXdslTrainHintOfferJob() */
+static void DmlXdslTrainHintOfferJob( PVOID pContext )
+{
+    if( ANSC_STATUS_SUCCESS != DmlXdslLineApplyPolicy( XdslTrainHintShouldOffer() ) )
+    {
+        CcspTraceError(("%s Failed to configure xDSL driver\n", __FUNCTION__));
+    }
+}
+
+/* DmlXdslTrainHintForgetJob() */
+static void DmlXdslTrainHintForgetJob( PVOID pContext )
+{
+    //A line in showtime keeps its configuration, the next line drop offers the full set
+    if( DmlXdslTrainHintLineInShowtime( ) )
+    {
+        return;
+    }
+
+    if( ANSC_STATUS_SUCCESS != DmlXdslLineApplyPolicy( FALSE ) )
+    {
+        CcspTraceError(("%s Failed to configure xDSL driver\n", __FUNCTION__));
+    }
+}
+
+/* DmlXdslTrainHintLearnJob() */
+static void DmlXdslTrainHintLearnJob( PVOID pContext )
+{
+    XDSL_TRAIN_HINT    stHint          = { 0 };
+    DML_XDSL_LINE_LIVE stLineLive;
+    PDML_XDSL_CHANNEL  pstChannelInfo  = NULL;
+    INT                iHalStatus;
+
+    iHalStatus = xdsl_hal_dslGetLineLive( XDSL_TRAIN_HINT_LINE_INSTANCE - 1, &stLineLive );
+    if( RETURN_OK == iHalStatus )
+    {
+        snprintf( stHint.StandardUsed, sizeof(stHint.StandardUsed), "%s", stLineLive.StandardUsed );
+        snprintf( stHint.CurrentProfile, sizeof(stHint.CurrentProfile), "%.*s", (int)( sizeof(stHint.CurrentProfile) - 1 ), stLineLive.CurrentProfile );
+    }
+
+    if( ( RETURN_OK != iHalStatus ) || ( '\0' == stHint.StandardUsed[0] ) )
+    {
+        CcspTraceWarning(("%s Failed to get the negotiated standard\n", __FUNCTION__));
+        return;
+    }
+
+    //Rates are informational, a failed read keeps the mode
+    pstChannelInfo = (PDML_XDSL_CHANNEL) AnscAllocateMemory( sizeof(DML_XDSL_CHANNEL) );
+    if( NULL != pstChannelInfo )
+    {
+        memset( pstChannelInfo, 0, sizeof(DML_XDSL_CHANNEL) );
+        if( RETURN_OK == xdsl_hal_dslGetChannelInfo( XDSL_TRAIN_HINT_LINE_INSTANCE - 1, 0, pstChannelInfo ) )
+        {
+            stHint.UpstreamRate   = pstChannelInfo->UpstreamCurrRate;
+            stHint.DownstreamRate = pstChannelInfo->DownstreamCurrRate;
+        }
+        AnscFreeMemory( pstChannelInfo );
+    }
+
+    //Every resync lands here, PSM is only written when the mode changed, the rates go along with it
+    if( XdslTrainHintSetLastGood( &stHint ) )
+    {
+        CcspTraceInfo(("%s Last good configuration StandardUsed:%s CurrentProfile:%s\n", __FUNCTION__,
+                       stHint.StandardUsed, stHint.CurrentProfile));
+        DmlXdslTrainHintStore( &stHint );
+    }
+}
+
+/* DmlXdslTrainHintStore() */
+static void DmlXdslTrainHintStore( const XDSL_TRAIN_HINT *pstHint )
+{
+    CHAR acPsmName[64] = { 0 };
+
+    //Setters skip records that already hold the value
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_STANDARD, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    SetNVRamStringConfiguration( acPsmName, (char *)pstHint->StandardUsed );
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_PROFILE, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    SetNVRamStringConfiguration( acPsmName, (char *)pstHint->CurrentProfile );
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_UPSTREAM_RATE, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    SetNVRamULONGConfiguration( acPsmName, pstHint->UpstreamRate );
+    snprintf( acPsmName, sizeof(acPsmName), PSM_LINE_LAST_GOOD_DOWNSTREAM_RATE, XDSL_TRAIN_HINT_LINE_INSTANCE );
+    SetNVRamULONGConfiguration( acPsmName, pstHint->DownstreamRate );
+}
+
+/* DmlXdslGetTrainingHintConfig() */
+ANSC_STATUS DmlXdslGetTrainingHintConfig( PDML_XDSL_X_RDK_TRAINING_HINT pstTrainingHint )
+{
+    if( NULL == pstTrainingHint )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslTrainHintGetConfig( &pstTrainingHint->Enable, &pstTrainingHint->FallbackTimeout );
+    pstTrainingHint->bConfigChanged = FALSE;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslSetTrainingHintConfig() */
+ANSC_STATUS DmlXdslSetTrainingHintConfig( PDML_XDSL_X_RDK_TRAINING_HINT pstTrainingHint )
+{
+    if( ( NULL == pstTrainingHint ) || ( 0 == pstTrainingHint->FallbackTimeout ) )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Takes effect when the line next drops, a line in showtime is not retrained
+    XdslTrainHintSetConfig( pstTrainingHint->Enable, pstTrainingHint->FallbackTimeout );
+
+    SetNVRamULONGConfiguration( PSM_TRAIN_HINT_ENABLE, pstTrainingHint->Enable );
+    SetNVRamULONGConfiguration( PSM_TRAIN_HINT_FALLBACK_TIMEOUT, pstTrainingHint->FallbackTimeout );
+    XdslPsmCacheFlush();
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetTrainingHintStatus() */
+ANSC_STATUS DmlXdslGetTrainingHintStatus( PDML_XDSL_X_RDK_TRAINING_HINT pstTrainingHint )
+{
+    XDSL_TRAIN_HINT        stHint  = { 0 };
+    XDSL_TRAIN_HINT_STATS  stStats = { 0 };
+
+    if( NULL == pstTrainingHint )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslTrainHintGetLastGood( &stHint );
+    XdslTrainHintGetStats( &stStats );
+
+    snprintf( pstTrainingHint->StandardUsed, sizeof(pstTrainingHint->StandardUsed), "%s", stHint.StandardUsed );
+    snprintf( pstTrainingHint->CurrentProfile, sizeof(pstTrainingHint->CurrentProfile), "%s", stHint.CurrentProfile );
+    pstTrainingHint->UpstreamRate   = stHint.UpstreamRate;
+    pstTrainingHint->DownstreamRate = stHint.DownstreamRate;
+    pstTrainingHint->Active         = stStats.Offered;
+    pstTrainingHint->Fallbacks      = stStats.Fallbacks;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslForgetTrainingHint() */
+ANSC_STATUS DmlXdslForgetTrainingHint( VOID )
+{
+    XDSL_TRAIN_HINT stHint = { 0 };
+
+    XdslTrainHintForget( );
+    XdslTrainHintResetStats( );
+    DmlXdslTrainHintStore( &stHint );
+
+    CcspTraceInfo(("%s Last good training configuration cleared\n", __FUNCTION__));
+
+    //Undo a narrowed XTSE now rather than on the next line drop
+    XdslReactorSubmit( DmlXdslTrainHintForgetJob, NULL );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslShaperInit() */
+ANSC_STATUS
+DmlXdslShaperInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL                pMyObject     = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_X_RDK_SHAPER         pDSLShaperTmp = NULL;
+    XDSL_SHAPER_CONFIG             stConfig      = { 0 };
+    ULONG                          psmValue      = 0;
+
+    XdslShaperGetConfig( &stConfig );
+
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_ENABLE, &psmValue ) )
+    {
+        stConfig.Enable = ( psmValue ) ? TRUE : FALSE;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_PERCENT, &psmValue ) )
+    {
+        stConfig.Percent = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_PACKET_SIZE, &psmValue ) )
+    {
+        stConfig.PacketSize = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_ATM_OVERHEAD, &psmValue ) )
+    {
+        stConfig.AtmOverhead = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_PTM_OVERHEAD, &psmValue ) )
+    {
+        stConfig.PtmOverhead = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_CHECK_INTERVAL, &psmValue ) )
+    {
+        stConfig.CheckInterval = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_EGRESS_SHAPER, &psmValue ) )
+    {
+        stConfig.EgressShaper = psmValue;
+    }
+    if( CCSP_SUCCESS == GetNVRamULONGConfiguration( PSM_SHAPER_INGRESS_SHAPER, &psmValue ) )
+    {
+        stConfig.IngressShaper = psmValue;
+    }
+
+    if( ANSC_STATUS_SUCCESS != XdslShaperInit( &stConfig ) )
+    {
+        CcspTraceWarning(("%s Invalid shaper configuration in PSM, using defaults\n", __FUNCTION__));
+    }
+
+    giShaperTimerId = XdslReactorAddTimer( DmlXdslShaperTimer, NULL );
+    if( 0 > giShaperTimerId )
+    {
+        CcspTraceError(("%s Failed to create shaper timer\n", __FUNCTION__));
+    }
+
+    pDSLShaperTmp = (PDML_XDSL_X_RDK_SHAPER) AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_SHAPER) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLShaperTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLShaperTmp, 0, sizeof(DML_XDSL_X_RDK_SHAPER) );
+
+    DmlXdslGetShaperConfig( pDSLShaperTmp );
+
+    //Assign the memory address to oringinal structure
+    pMyObject->pDSLShaper = pDSLShaperTmp;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslShaperLinkUp() */
+VOID DmlXdslShaperLinkUp( char *ifname )
+{
+    XDSL_SHAPER_CONFIG stConfig   = { 0 };
+    INT                iLineIndex = -1;
+
+    if( ( NULL == ifname ) || ( ANSC_STATUS_SUCCESS != DmlXdslLineGetIndexFromIfName( ifname, &iLineIndex ) ) )
+    {
+        return;
+    }
+
+    giShaperLineIndex = iLineIndex;
+
+    //First recommendation right away, SRA and other rate changes are picked up by the periodic check
+    XdslReactorSubmit( DmlXdslShaperUpdateJob, NULL );
+
+    if( 0 <= giShaperTimerId )
+    {
+        XdslShaperGetConfig( &stConfig );
+        XdslReactorSetTimer( giShaperTimerId, stConfig.CheckInterval * 1000, stConfig.CheckInterval * 1000 );
+    }
+}
+
+/* DmlXdslShaperLinkDown() */
+VOID DmlXdslShaperLinkDown( char *ifname )
+{
+    INT iLineIndex = -1;
+
+    if( ( NULL == ifname ) || ( ANSC_STATUS_SUCCESS != DmlXdslLineGetIndexFromIfName( ifname, &iLineIndex ) ) ||
+        ( iLineIndex != giShaperLineIndex ) )
+    {
+        return;
+    }
+
+    giShaperLineIndex = -1;
+
+    if( 0 <= giShaperTimerId )
+    {
+        XdslReactorSetTimer( giShaperTimerId, 0, 0 );
+    }
+
+    //Next showtime publishes whatever it trains at
+    XdslShaperReset( );
+}
+
+/* DmlXdslShaperTimer() */
+static void DmlXdslShaperTimer( PVOID pContext )
+{
+    //Timer callbacks must not block, the HAL is read on a worker
+    XdslReactorSubmit( DmlXdslShaperUpdateJob, NULL );
+}
+
+/* DmlXdslShaperUpdateJob() */
+static void DmlXdslShaperUpdateJob( PVOID pContext )
+{
+    PDML_XDSL_CHANNEL          pstChannelInfo = NULL;
+    DML_XDSL_STANDARD_FAMILY   enFamily;
+    XDSL_SHAPER_ENCAP          enEncap;
+    XDSL_SHAPER_RATES          stRates        = { 0 };
+    ULONG                      ulUpstream     = 0;
+    ULONG                      ulDownstream   = 0;
+    INT                        iLineIndex     = giShaperLineIndex;
+    INT                        iHalStatus;
+
+    if( 0 > iLineIndex )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmXdslGInfo_mutex);
+    enFamily = gpstLineGInfo[iLineIndex].StandardFamily;
+    pthread_mutex_unlock(&gmXdslGInfo_mutex);
+
+    //ADSL is carried over ATM, VDSL2 and G.fast over PTM
+    if( XDSL_STANDARD_FAMILY_ADSL == enFamily )
+    {
+        enEncap = XDSL_SHAPER_ENCAP_ATM;
+    }
+    else if( ( XDSL_STANDARD_FAMILY_VDSL == enFamily ) || ( XDSL_STANDARD_FAMILY_GFAST == enFamily ) )
+    {
+        enEncap = XDSL_SHAPER_ENCAP_PTM;
+    }
+    else
+    {
+        return;
+    }
+
+    pstChannelInfo = (PDML_XDSL_CHANNEL) AnscAllocateMemory( sizeof(DML_XDSL_CHANNEL) );
+    if( NULL == pstChannelInfo )
+    {
+        return;
+    }
+
+    memset( pstChannelInfo, 0, sizeof(DML_XDSL_CHANNEL) );
+    iHalStatus = xdsl_hal_dslGetChannelInfo( iLineIndex, 0, pstChannelInfo );
+    ulUpstream   = pstChannelInfo->UpstreamCurrRate;
+    ulDownstream = pstChannelInfo->DownstreamCurrRate;
+    AnscFreeMemory( pstChannelInfo );
+
+    if( RETURN_OK != iHalStatus )
+    {
+        CcspTraceWarning(("%s Failed to get the channel rates of line %d\n", __FUNCTION__, iLineIndex + 1));
+        return;
+    }
+
+    if( XdslShaperUpdate( enEncap, ulUpstream, ulDownstream, &stRates ) )
+    {
+        DmlXdslShaperPublish( &stRates );
+    }
+}
+
+/* DmlXdslShaperPublish() */
+static void DmlXdslShaperPublish( const XDSL_SHAPER_RATES *pstRates )
+{
+    XDSL_SHAPER_CONFIG stConfig  = { 0 };
+    XDSL_BUS_TXN       stTxn;
+    CHAR               acRate[32] = { 0 };
+
+    CcspTraceInfo(("%s Sync rate %lu/%lu kbps, shaper rate %lu/%lu kbps\n", __FUNCTION__,
+                   pstRates->UpstreamSyncRate, pstRates->DownstreamSyncRate, pstRates->EgressRate, pstRates->IngressRate));
+
+    //Rates in kbps for whichever shaper listens
+    snprintf( acRate, sizeof(acRate), "%lu", pstRates->EgressRate );
+    sysevent_set( sysevent_fd, sysevent_token, SYSEVENT_SHAPER_EGRESS_RATE, acRate, 0 );
+    snprintf( acRate, sizeof(acRate), "%lu", pstRates->IngressRate );
+    sysevent_set( sysevent_fd, sysevent_token, SYSEVENT_SHAPER_INGRESS_RATE, acRate, 0 );
+
+    XdslShaperGetConfig( &stConfig );
+    if( ( 0 == stConfig.EgressShaper ) && ( 0 == stConfig.IngressShaper ) )
+    {
+        return;
+    }
+
+    //TR-181 ShapingRate is in bits per second, both shapers are applied with one commit
+    XdslBusTxnBegin( &stTxn, QOS_COMPONENT_NAME, QOS_DBUS_PATH );
+    if( 0 != stConfig.EgressShaper )
+    {
+        snprintf( acRate, sizeof(acRate), "%llu", (unsigned long long)pstRates->EgressRate * 1000 );
+        XdslBusTxnAddParam( &stTxn, ccsp_int, acRate, QOS_SHAPER_RATE_PARAM_NAME, stConfig.EgressShaper );
+    }
+    if( 0 != stConfig.IngressShaper )
+    {
+        snprintf( acRate, sizeof(acRate), "%llu", (unsigned long long)pstRates->IngressRate * 1000 );
+        XdslBusTxnAddParam( &stTxn, ccsp_int, acRate, QOS_SHAPER_RATE_PARAM_NAME, stConfig.IngressShaper );
+    }
+    if( ANSC_STATUS_SUCCESS != XdslBusTxnCommit( &stTxn ) )
+    {
+        CcspTraceError(("%s Failed to set QoS shaping rate\n", __FUNCTION__));
+    }
+}
+
+/* DmlXdslGetShaperConfig() */
+ANSC_STATUS DmlXdslGetShaperConfig( PDML_XDSL_X_RDK_SHAPER pstShaper )
+{
+    XDSL_SHAPER_CONFIG stConfig = { 0 };
+
+    if( NULL == pstShaper )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslShaperGetConfig( &stConfig );
+
+    pstShaper->Enable         = stConfig.Enable;
+    pstShaper->Percent        = stConfig.Percent;
+    pstShaper->PacketSize     = stConfig.PacketSize;
+    pstShaper->ATMOverhead    = stConfig.AtmOverhead;
+    pstShaper->PTMOverhead    = stConfig.PtmOverhead;
+    pstShaper->CheckInterval  = stConfig.CheckInterval;
+    pstShaper->EgressShaper   = stConfig.EgressShaper;
+    pstShaper->IngressShaper  = stConfig.IngressShaper;
+    pstShaper->bConfigChanged = FALSE;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslSetShaperConfig() */
+ANSC_STATUS DmlXdslSetShaperConfig( PDML_XDSL_X_RDK_SHAPER pstShaper )
+{
+    XDSL_SHAPER_CONFIG stConfig = { 0 };
+
+    if( NULL == pstShaper )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    stConfig.Enable        = pstShaper->Enable;
+    stConfig.Percent       = pstShaper->Percent;
+    stConfig.PacketSize    = pstShaper->PacketSize;
+    stConfig.AtmOverhead   = pstShaper->ATMOverhead;
+    stConfig.PtmOverhead   = pstShaper->PTMOverhead;
+    stConfig.CheckInterval = pstShaper->CheckInterval;
+    stConfig.EgressShaper  = pstShaper->EgressShaper;
+    stConfig.IngressShaper = pstShaper->IngressShaper;
+
+    if( ANSC_STATUS_SUCCESS != XdslShaperSetConfig( &stConfig ) )
+    {
+        CcspTraceError(("%s Invalid shaper configuration\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    SetNVRamULONGConfiguration( PSM_SHAPER_ENABLE, stConfig.Enable );
+    SetNVRamULONGConfiguration( PSM_SHAPER_PERCENT, stConfig.Percent );
+    SetNVRamULONGConfiguration( PSM_SHAPER_PACKET_SIZE, stConfig.PacketSize );
+    SetNVRamULONGConfiguration( PSM_SHAPER_ATM_OVERHEAD, stConfig.AtmOverhead );
+    SetNVRamULONGConfiguration( PSM_SHAPER_PTM_OVERHEAD, stConfig.PtmOverhead );
+    SetNVRamULONGConfiguration( PSM_SHAPER_CHECK_INTERVAL, stConfig.CheckInterval );
+    SetNVRamULONGConfiguration( PSM_SHAPER_EGRESS_SHAPER, stConfig.EgressShaper );
+    SetNVRamULONGConfiguration( PSM_SHAPER_INGRESS_SHAPER, stConfig.IngressShaper );
+    XdslPsmCacheFlush();
+
+    //A line in showtime is republished with the new configuration and check interval
+    if( 0 <= giShaperLineIndex )
+    {
+        XdslReactorSubmit( DmlXdslShaperUpdateJob, NULL );
+        if( 0 <= giShaperTimerId )
+        {
+            XdslReactorSetTimer( giShaperTimerId, stConfig.CheckInterval * 1000, stConfig.CheckInterval * 1000 );
+        }
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetShaperRates() */
+ANSC_STATUS DmlXdslGetShaperRates( PDML_XDSL_X_RDK_SHAPER pstShaper )
+{
+    XDSL_SHAPER_RATES stRates = { 0 };
+
+    if( NULL == pstShaper )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    XdslShaperGetRates( &stRates );
+
+    switch( stRates.Encapsulation )
+    {
+        case XDSL_SHAPER_ENCAP_ATM:
+            snprintf( pstShaper->Encapsulation, sizeof(pstShaper->Encapsulation), "ATM" );
+            break;
+        case XDSL_SHAPER_ENCAP_PTM:
+            snprintf( pstShaper->Encapsulation, sizeof(pstShaper->Encapsulation), "PTM" );
+            break;
+        default:
+            snprintf( pstShaper->Encapsulation, sizeof(pstShaper->Encapsulation), "None" );
+            break;
+    }
+
+    pstShaper->UpstreamSyncRate   = stRates.UpstreamSyncRate;
+    pstShaper->DownstreamSyncRate = stRates.DownstreamSyncRate;
+    pstShaper->EgressRate         = stRates.EgressRate;
+    pstShaper->IngressRate        = stRates.IngressRate;
+    pstShaper->Updates            = stRates.Updates;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslPmHistoryInit() */
+ANSC_STATUS
+DmlXdslPmHistoryInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL                pMyObject     = (PDATAMODEL_XDSL)phContext;
+
+    if( ANSC_STATUS_SUCCESS != XdslPmHistoryInit( pMyObject->ulTotalNoofDSLLines ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    giPmHistoryLines = pMyObject->ulTotalNoofDSLLines;
+
+    giPmHistoryTimerId = XdslReactorAddTimer( DmlXdslPmHistoryTimer, NULL );
+    if( 0 > giPmHistoryTimerId )
+    {
+        CcspTraceError(("%s Failed to create PM history timer\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //First sample right away, the rollovers are detected from the second one on
+    XdslReactorSubmit( DmlXdslPmHistorySampleJob, NULL );
+    XdslReactorSetTimer( giPmHistoryTimerId, XDSL_PM_HISTORY_SAMPLE_INTERVAL_MS, XDSL_PM_HISTORY_SAMPLE_INTERVAL_MS );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslPmHistoryTimer() */
+static void DmlXdslPmHistoryTimer( PVOID pContext )
+{
+    //Timer callbacks must not block, the HAL is read on a worker
+    XdslReactorSubmit( DmlXdslPmHistorySampleJob, NULL );
+}
+
+/* DmlXdslPmHistorySampleJob() */
+static void DmlXdslPmHistorySampleJob( PVOID pContext )
+{
+    DML_XDSL_LINE_STATS        stLineStats;
+    DML_XDSL_CHANNEL_STATS     stChannelStats;
+    XDSL_PM_SAMPLE             stSample;
+    struct timespec            ts;
+    INT                        iLineIndex;
+    INT                        iLoopCount;
+
+    for( iLineIndex = 0; iLineIndex < giPmHistoryLines; iLineIndex++ )
+    {
+        memset( &stLineStats, 0, sizeof(stLineStats) );
+        memset( &stChannelStats, 0, sizeof(stChannelStats) );
+        memset( &stSample, 0, sizeof(stSample) );
+
+        //A missed sample only makes the interval it ends suspect
+        if( RETURN_OK != xdsl_hal_dslGetLineStats( iLineIndex, &stLineStats ) )
+        {
+            continue;
+        }
+
+        if( ( 0 < xdsl_hal_getTotalNoOfChannels( iLineIndex ) ) &&
+            ( RETURN_OK != xdsl_hal_dslGetChannelStats( iLineIndex, 0, &stChannelStats ) ) )
+        {
+            continue;
+        }
+
+        clock_gettime( CLOCK_MONOTONIC, &ts );
+        stSample.Uptime           = (ULONG)ts.tv_sec;
+        stSample.Time             = (ULONG)time( NULL );
+        stSample.QuarterHourStart = stLineStats.QuarterHourStart;
+        stSample.CurrentDayStart  = stLineStats.CurrentDayStart;
+
+        for( iLoopCount = 0; iLoopCount < (INT)( sizeof(g_PmSampleSources) / sizeof(g_PmSampleSources[0]) ); iLoopCount++ )
+        {
+            const XDSL_PM_SAMPLE_SOURCE *pstSource = &g_PmSampleSources[iLoopCount];
+            const char                  *pStats    = ( pstSource->bChannel ) ? (const char *)&stChannelStats : (const char *)&stLineStats;
+
+            if( 0 <= pstSource->QuarterHourOffset )
+            {
+                *(UINT *)( (char *)&stSample.stQuarterHour + pstSource->CounterOffset ) = *(const UINT *)( pStats + pstSource->QuarterHourOffset );
+            }
+            *(UINT *)( (char *)&stSample.stCurrentDay + pstSource->CounterOffset ) = *(const UINT *)( pStats + pstSource->CurrentDayOffset );
+        }
+
+        XdslPmHistoryUpdate( iLineIndex, &stSample );
+
+        DmlXdslTcaEvaluate( iLineIndex, &stSample );
+    }
+}
+
+/* DmlXdslGetPmHistory() */
+ANSC_STATUS DmlXdslGetPmHistory( INT LineIndex, PDML_XDSL_X_RDK_PM_HISTORY pstPmHistory )
+{
+    if( ( NULL == pstPmHistory ) || ( LineIndex < 0 ) )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Depth first, an interval stored while exporting only causes one more refresh
+    pstPmHistory->ulQuarterHourDepth      = XdslPmHistoryGetDepth( LineIndex, XDSL_PM_INTERVAL_QUARTER_HOUR );
+    pstPmHistory->ulDayDepth              = XdslPmHistoryGetDepth( LineIndex, XDSL_PM_INTERVAL_DAY );
+
+    pstPmHistory->ulTotalNoofQuarterHours = XdslPmHistoryExport( LineIndex, XDSL_PM_INTERVAL_QUARTER_HOUR,
+                                                                 pstPmHistory->stQuarterHour, XDSL_PM_HISTORY_QUARTER_HOURS );
+    pstPmHistory->ulTotalNoofDays         = XdslPmHistoryExport( LineIndex, XDSL_PM_INTERVAL_DAY,
+                                                                 pstPmHistory->stDay, XDSL_PM_HISTORY_DAYS );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslIsPmHistoryStale() */
+BOOL DmlXdslIsPmHistoryStale( INT LineIndex, XDSL_PM_INTERVAL interval, PDML_XDSL_X_RDK_PM_HISTORY pstPmHistory )
+{
+    ULONG ulDepth;
+
+    if( NULL == pstPmHistory )
+    {
+        return TRUE;
+    }
+
+    ulDepth = ( XDSL_PM_INTERVAL_DAY == interval ) ? pstPmHistory->ulDayDepth : pstPmHistory->ulQuarterHourDepth;
+
+    return ( XdslPmHistoryGetDepth( LineIndex, interval ) != ulDepth ) ? TRUE : FALSE;
+}
+
+/* Profiles shipped disabled, the first ones preset for the usual alarms */
+static const XDSL_TCA_PROFILE g_DefaultTcaProfiles[] =
+{
+    /* Enable   Counter                                   Interval                        Threshold   Hysteresis */
+    { FALSE,    XDSL_TCA_COUNTER_SEVERELY_ERRORED_SECS,   XDSL_TCA_INTERVAL_CURRENT_DAY,  120,        0 },
+    { FALSE,    XDSL_TCA_COUNTER_XTUR_CRC_ERRORS,         XDSL_TCA_INTERVAL_QUARTER_HOUR, 500,        0 },
+    { FALSE,    XDSL_TCA_COUNTER_DOWNSTREAM_NOISE_MARGIN, XDSL_TCA_INTERVAL_QUARTER_HOUR, 30,         10 },
+    { FALSE,    XDSL_TCA_COUNTER_UPSTREAM_NOISE_MARGIN,   XDSL_TCA_INTERVAL_QUARTER_HOUR, 30,         10 }
+};
+
+/* DmlXdslTcaInit() */
+ANSC_STATUS
+DmlXdslTcaInit
+    (
+        PANSC_HANDLE                phContext
+    )
+{
+    PDATAMODEL_XDSL                pMyObject     = (PDATAMODEL_XDSL)phContext;
+    PDML_XDSL_X_RDK_TCA            pDSLTcaTmp    = NULL;
+    XDSL_TCA_PROFILE               stProfile     = { 0 };
+    CHAR                           acParam[64]   = { 0 };
+    CHAR                           acValue[32]   = { 0 };
+    ULONG                          psmValue      = 0;
+    INT                            iValue        = 0;
+    INT                            iIndex        = 0;
+
+    if( ANSC_STATUS_SUCCESS != XdslTcaInit( pMyObject->ulTotalNoofDSLLines ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    for( iIndex = 0; iIndex < XDSL_TCA_MAX_PROFILES; iIndex++ )
+    {
+        memset( &stProfile, 0, sizeof(stProfile) );
+        if( iIndex < (INT)( sizeof(g_DefaultTcaProfiles) / sizeof(g_DefaultTcaProfiles[0]) ) )
+        {
+            memcpy( &stProfile, &g_DefaultTcaProfiles[iIndex], sizeof(stProfile) );
+        }
+
+        //PSM records are numbered by instance
+        snprintf( acParam, sizeof(acParam), PSM_TCA_ENABLE, iIndex + 1 );
+        if( CCSP_SUCCESS == GetNVRamULONGConfiguration( acParam, &psmValue ) )
+        {
+            stProfile.Enable = ( psmValue ) ? TRUE : FALSE;
+        }
+        snprintf( acParam, sizeof(acParam), PSM_TCA_COUNTER, iIndex + 1 );
+        if( ( CCSP_SUCCESS == GetNVRamStringConfiguration( acParam, acValue, sizeof(acValue) ) ) &&
+            ( 0 <= ( iValue = XdslTcaCounterFromName( acValue ) ) ) )
+        {
+            stProfile.Counter = iValue;
+        }
+        snprintf( acParam, sizeof(acParam), PSM_TCA_INTERVAL, iIndex + 1 );
+        if( ( CCSP_SUCCESS == GetNVRamStringConfiguration( acParam, acValue, sizeof(acValue) ) ) &&
+            ( 0 <= ( iValue = XdslTcaIntervalFromName( acValue ) ) ) )
+        {
+            stProfile.Interval = iValue;
+        }
+        //Noise margin thresholds can be negative, stored as a string
+        snprintf( acParam, sizeof(acParam), PSM_TCA_THRESHOLD, iIndex + 1 );
+        if( CCSP_SUCCESS == GetNVRamStringConfiguration( acParam, acValue, sizeof(acValue) ) )
+        {
+            stProfile.Threshold = atoi( acValue );
+        }
+        snprintf( acParam, sizeof(acParam), PSM_TCA_HYSTERESIS, iIndex + 1 );
+        if( CCSP_SUCCESS == GetNVRamULONGConfiguration( acParam, &psmValue ) )
+        {
+            stProfile.Hysteresis = psmValue;
+        }
+
+        XdslTcaSetProfile( iIndex, &stProfile );
+    }
+
+    pDSLTcaTmp = (PDML_XDSL_X_RDK_TCA) AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_TCA) );
+
+    //Return failure if allocation failiure
+    if( NULL == pDSLTcaTmp )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Memset all memory
+    memset( pDSLTcaTmp, 0, sizeof(DML_XDSL_X_RDK_TCA) );
+
+    for( iIndex = 0; iIndex < XDSL_TCA_MAX_PROFILES; iIndex++ )
+    {
+        DmlXdslGetTcaProfile( iIndex, &pDSLTcaTmp->stProfile[iIndex] );
+    }
+
+    //Assign the memory address to oringinal structure
+    pMyObject->pDSLTca = pDSLTcaTmp;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslGetTcaProfile() */
+ANSC_STATUS DmlXdslGetTcaProfile( INT ProfileIndex, PDML_XDSL_TCA_PROFILE pstProfile )
+{
+    XDSL_TCA_PROFILE stProfile = { 0 };
+
+    if( ( NULL == pstProfile ) || ( ANSC_STATUS_SUCCESS != XdslTcaGetProfile( ProfileIndex, &stProfile ) ) )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pstProfile->Enable     = stProfile.Enable;
+    snprintf( pstProfile->Counter, sizeof(pstProfile->Counter), "%s", XdslTcaCounterName( stProfile.Counter ) );
+    snprintf( pstProfile->Interval, sizeof(pstProfile->Interval), "%s", XdslTcaIntervalName( stProfile.Interval ) );
+    pstProfile->Threshold  = stProfile.Threshold;
+    pstProfile->Hysteresis = stProfile.Hysteresis;
+    pstProfile->Raised     = XdslTcaIsRaised( ProfileIndex );
+    pstProfile->bConfigChanged = FALSE;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslSetTcaProfile() */
+ANSC_STATUS DmlXdslSetTcaProfile( INT ProfileIndex, PDML_XDSL_TCA_PROFILE pstProfile )
+{
+    XDSL_TCA_PROFILE stProfile   = { 0 };
+    CHAR             acParam[64] = { 0 };
+    CHAR             acValue[32] = { 0 };
+    INT              iCounter;
+    INT              iInterval;
+
+    if( NULL == pstProfile )
+    {
+        CcspTraceError(("%s Invalid input\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    iCounter  = XdslTcaCounterFromName( pstProfile->Counter );
+    iInterval = XdslTcaIntervalFromName( pstProfile->Interval );
+    if( ( 0 > iCounter ) || ( 0 > iInterval ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    stProfile.Enable     = pstProfile->Enable;
+    stProfile.Counter    = iCounter;
+    stProfile.Interval   = iInterval;
+    stProfile.Threshold  = pstProfile->Threshold;
+    stProfile.Hysteresis = pstProfile->Hysteresis;
+
+    if( ANSC_STATUS_SUCCESS != XdslTcaSetProfile( ProfileIndex, &stProfile ) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    snprintf( acParam, sizeof(acParam), PSM_TCA_ENABLE, ProfileIndex + 1 );
+    SetNVRamULONGConfiguration( acParam, stProfile.Enable );
+    snprintf( acParam, sizeof(acParam), PSM_TCA_COUNTER, ProfileIndex + 1 );
+    SetNVRamStringConfiguration( acParam, pstProfile->Counter );
+    snprintf( acParam, sizeof(acParam), PSM_TCA_INTERVAL, ProfileIndex + 1 );
+    SetNVRamStringConfiguration( acParam, pstProfile->Interval );
+    snprintf( acParam, sizeof(acParam), PSM_TCA_THRESHOLD, ProfileIndex + 1 );
+    snprintf( acValue, sizeof(acValue), "%d", stProfile.Threshold );
+    SetNVRamStringConfiguration( acParam, acValue );
+    snprintf( acParam, sizeof(acParam), PSM_TCA_HYSTERESIS, ProfileIndex + 1 );
+    SetNVRamULONGConfiguration( acParam, stProfile.Hysteresis );
+    XdslPsmCacheFlush();
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* DmlXdslTcaEvaluate() */
+static void DmlXdslTcaEvaluate( INT LineIndex, const XDSL_PM_SAMPLE *pstSample )
+{
+    XDSL_TCA_SAMPLE            stTcaSample;
+    XDSL_TCA_EVENT             astEvents[XDSL_TCA_MAX_EVENTS];
+    DML_XDSL_LINE_LIVE         stLineLive;
+    CHAR                       acEvent[128] = { 0 };
+    CHAR                       acName[32]   = { 0 };
+    INT                        iEvents;
+    INT                        i;
+
+    memset( &stTcaSample, 0, sizeof(stTcaSample) );
+    memcpy( &stTcaSample.stQuarterHour, &pstSample->stQuarterHour, sizeof(stTcaSample.stQuarterHour) );
+    memcpy( &stTcaSample.stCurrentDay, &pstSample->stCurrentDay, sizeof(stTcaSample.stCurrentDay) );
+
+    //Margins and rates cost a HAL call, only read while a profile watches them
+    if( XdslTcaNeedsLineValues() )
+    {
+        //A failed read keeps the alerts as they are, only a line seen down clears them
+        if( RETURN_OK == xdsl_hal_dslGetLineLive( LineIndex, &stLineLive ) )
+        {
+            if( XDSL_LINK_STATUS_Up == stLineLive.LinkStatus )
+            {
+                stTcaSample.bLineValid            = TRUE;
+                stTcaSample.DownstreamNoiseMargin = stLineLive.DownstreamNoiseMargin;
+                stTcaSample.UpstreamNoiseMargin   = stLineLive.UpstreamNoiseMargin;
+                stTcaSample.DownstreamMaxBitRate  = stLineLive.DownstreamMaxBitRate;
+                stTcaSample.UpstreamMaxBitRate    = stLineLive.UpstreamMaxBitRate;
+            }
+            else
+            {
+                stTcaSample.bLineDown             = TRUE;
+            }
+        }
+    }
+
+    iEvents = XdslTcaEvaluate( LineIndex, &stTcaSample, astEvents, XDSL_TCA_MAX_EVENTS );
+    for( i = 0; i < iEvents; i++ )
+    {
+        //Line,Profile,Counter,Interval,raised|cleared,Value,Threshold with instance numbers
+        snprintf( acEvent, sizeof(acEvent), "%d,%d,%s,%s,%s,%ld,%d",
+                  astEvents[i].LineIndex + 1, astEvents[i].ProfileIndex + 1,
+                  XdslTcaCounterName( astEvents[i].Counter ), XdslTcaIntervalName( astEvents[i].Interval ),
+                  ( astEvents[i].bRaised ) ? "raised" : "cleared", astEvents[i].lValue, astEvents[i].Threshold );
+
+        CcspTraceWarning(("%s Threshold crossing %s\n", __FUNCTION__, acEvent));
+
+        //One key per line and profile, the crossings of one pass do not overwrite each other
+        snprintf( acName, sizeof(acName), SYSEVENT_TCA, astEvents[i].LineIndex + 1, astEvents[i].ProfileIndex + 1 );
+        sysevent_set( sysevent_fd, sysevent_token, acName, acEvent, 0 );
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_bringup.c
+    For CCSP Component:  dsl state machine instrumentation
+
+---------------------------------------------------------------
+
+    Description:
+
+    Duration histograms of the link bring-up phases (training, XTM
+    configuration, WAN Manager notification and the whole attempt) and
+    a ring of the most recent bring-up attempts. Timestamps come from
+    CLOCK_MONOTONIC so wall clock steps after NTP sync do not skew them.
+    Updates happen a few times per retrain, a single mutex is enough.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "xdsl_bringup.h"
+
+static const char *g_BringUpPhaseNames[XDSL_BRINGUP_PHASE_MAX] =
+{
+    "Training",
+    "XtmConfiguring",
+    "WanNotify",
+    "Total",
+    "TrainingHinted",
+    "TrainingFull"
+};
+
+static DML_XDSL_BRINGUP_PHASE g_BringUpPhase[XDSL_BRINGUP_PHASE_MAX];
+static DML_XDSL_BRINGUP_TRACE g_BringUpTrace[XDSL_BRINGUP_TRACE_MAX];
+static ULONG g_BringUpTraceNext = 0;
+static ULONG g_BringUpTraceCount = 0;
+static pthread_mutex_t gmBringUp_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+ULONGLONG XdslBringUpGetTimeMs( VOID )
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((ULONGLONG)ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+}
+
+static int XdslBringUpBucket( ULONG ulTimeMs )
+{
+    int bucket = 0;
+
+    while( (ulTimeMs >>= 1) != 0 && bucket < (XDSL_BRINGUP_BUCKETS - 1) )
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+VOID XdslBringUpRecordPhase( XDSL_BRINGUP_PHASE phase, ULONG ulTimeMs )
+{
+    PDML_XDSL_BRINGUP_PHASE pPhase = NULL;
+
+    if( phase >= XDSL_BRINGUP_PHASE_MAX )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmBringUp_mutex);
+    pPhase = &g_BringUpPhase[phase];
+    pPhase->Count++;
+    pPhase->TotalTime += ulTimeMs;
+    if( ulTimeMs > pPhase->MaxTime )
+    {
+        pPhase->MaxTime = ulTimeMs;
+    }
+    pPhase->Histogram[XdslBringUpBucket(ulTimeMs)]++;
+    pthread_mutex_unlock(&gmBringUp_mutex);
+}
+
+VOID XdslBringUpRecordTrace( PDML_XDSL_BRINGUP_TRACE pstTrace )
+{
+    if( pstTrace == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmBringUp_mutex);
+    memcpy(&g_BringUpTrace[g_BringUpTraceNext], pstTrace, sizeof(DML_XDSL_BRINGUP_TRACE));
+    g_BringUpTraceNext = (g_BringUpTraceNext + 1) % XDSL_BRINGUP_TRACE_MAX;
+    if( g_BringUpTraceCount < XDSL_BRINGUP_TRACE_MAX )
+    {
+        g_BringUpTraceCount++;
+    }
+    pthread_mutex_unlock(&gmBringUp_mutex);
+}
+
+ANSC_STATUS XdslBringUpGetPhaseStats( XDSL_BRINGUP_PHASE phase, PDML_XDSL_BRINGUP_PHASE pstPhase )
+{
+    if( phase >= XDSL_BRINGUP_PHASE_MAX || pstPhase == NULL )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock(&gmBringUp_mutex);
+    memcpy(pstPhase, &g_BringUpPhase[phase], sizeof(DML_XDSL_BRINGUP_PHASE));
+    pthread_mutex_unlock(&gmBringUp_mutex);
+
+    snprintf(pstPhase->Name, sizeof(pstPhase->Name), "%s", g_BringUpPhaseNames[phase]);
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* Copies up to ulMax attempts, most recent first, and returns how many were copied */
+ULONG XdslBringUpGetTraces( PDML_XDSL_BRINGUP_TRACE pstTraces, ULONG ulMax )
+{
+    ULONG ulCount;
+    ULONG i;
+
+    if( pstTraces == NULL )
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&gmBringUp_mutex);
+    ulCount = (g_BringUpTraceCount < ulMax) ? g_BringUpTraceCount : ulMax;
+    for( i = 0; i < ulCount; i++ )
+    {
+        ULONG ulSlot = (g_BringUpTraceNext + XDSL_BRINGUP_TRACE_MAX - 1 - i) % XDSL_BRINGUP_TRACE_MAX;
+
+        memcpy(&pstTraces[i], &g_BringUpTrace[ulSlot], sizeof(DML_XDSL_BRINGUP_TRACE));
+    }
+    pthread_mutex_unlock(&gmBringUp_mutex);
+
+    return ulCount;
+}
+
+/* Comma separated bucket counts, returns the string length */
+INT XdslBringUpFormatHistogram( const ULONG *pHistogram, char *pBuffer, size_t bufferLen )
+{
+    size_t length = 0;
+    int i;
+
+    if( pHistogram == NULL || pBuffer == NULL || bufferLen == 0 )
+    {
+        return 0;
+    }
+
+    pBuffer[0] = '\0';
+    for( i = 0; i < XDSL_BRINGUP_BUCKETS && length < bufferLen; i++ )
+    {
+        length += snprintf(pBuffer + length, bufferLen - length, "%s%lu", (i == 0) ? "" : ",", pHistogram[i]);
+    }
+
+    return (length < bufferLen) ? (INT)length : (INT)(bufferLen - 1);
+}
+
+VOID XdslBringUpReset( VOID )
+{
+    pthread_mutex_lock(&gmBringUp_mutex);
+    memset(g_BringUpPhase, 0, sizeof(g_BringUpPhase));
+    memset(g_BringUpTrace, 0, sizeof(g_BringUpTrace));
+    g_BringUpTraceNext = 0;
+    g_BringUpTraceCount = 0;
+    pthread_mutex_unlock(&gmBringUp_mutex);
+}
@@ -0,0 +1,147 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_bus_txn.c
+    For CCSP Component:  dsl cross component provisioning
+
+---------------------------------------------------------------
+
+    Description:
+
+    Builder for the PTM, ATM, VLAN and WAN Manager provisioning writes.
+    All parameters queued for one component are sent with a single
+    CcspBaseIf_setParameterValues carrying the commit, so the target
+    validates and applies them together and the link bring-up pays one
+    bus round trip instead of one per parameter.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "xdsl_bus_txn.h"
+
+extern ANSC_HANDLE bus_handle;
+
+VOID XdslBusTxnBegin( PXDSL_BUS_TXN pstTxn, const char *pComponent, const char *pBus )
+{
+    if( pstTxn == NULL )
+    {
+        return;
+    }
+
+    pstTxn->pComponent = pComponent;
+    pstTxn->pBus       = pBus;
+    pstTxn->iCount     = 0;
+    pstTxn->bOverflow  = FALSE;
+}
+
+ANSC_STATUS XdslBusTxnAddParam( PXDSL_BUS_TXN pstTxn, enum dataType_e type, const char *pValue, const char *pNameFormat, ... )
+{
+    va_list args;
+    INT iIndex;
+
+    if( pstTxn == NULL || pValue == NULL || pNameFormat == NULL )
+    {
+        CcspTraceError(("%s Invalid Buffer\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    if( pstTxn->iCount >= XDSL_BUS_TXN_MAX_PARAMS )
+    {
+        CcspTraceError(("%s More than %d parameters for %s\n", __FUNCTION__, XDSL_BUS_TXN_MAX_PARAMS, pstTxn->pComponent));
+        pstTxn->bOverflow = TRUE;
+        return ANSC_STATUS_FAILURE;
+    }
+
+    iIndex = pstTxn->iCount;
+
+    va_start(args, pNameFormat);
+    vsnprintf(pstTxn->Name[iIndex], sizeof(pstTxn->Name[iIndex]), pNameFormat, args);
+    va_end(args);
+
+    snprintf(pstTxn->Value[iIndex], sizeof(pstTxn->Value[iIndex]), "%s", pValue);
+    pstTxn->Type[iIndex] = type;
+    pstTxn->iCount++;
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslBusTxnCommit( PXDSL_BUS_TXN pstTxn )
+{
+    CCSP_MESSAGE_BUS_INFO *bus_info = (CCSP_MESSAGE_BUS_INFO *)bus_handle;
+    parameterValStruct_t   param_val[XDSL_BUS_TXN_MAX_PARAMS];
+    char                  *faultParam = NULL;
+    int                    ret;
+    INT                    i;
+
+    if( pstTxn == NULL )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Never apply a partial set of parameters
+    if( pstTxn->bOverflow )
+    {
+        CcspTraceError(("%s Dropping incomplete transaction for %s\n", __FUNCTION__, pstTxn->pComponent));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    if( pstTxn->iCount == 0 )
+    {
+        return ANSC_STATUS_SUCCESS;
+    }
+
+    memset(param_val, 0, sizeof(param_val));
+    for( i = 0; i < pstTxn->iCount; i++ )
+    {
+        param_val[i].parameterName  = pstTxn->Name[i];
+        param_val[i].parameterValue = pstTxn->Value[i];
+        param_val[i].type           = pstTxn->Type[i];
+    }
+
+    ret = CcspBaseIf_setParameterValues(
+                                        bus_handle,
+                                        (char *)pstTxn->pComponent,
+                                        (char *)pstTxn->pBus,
+                                        0,
+                                        0,
+                                        param_val,
+                                        pstTxn->iCount,
+                                        TRUE,
+                                        &faultParam
+                                       );
+
+    if( ret != CCSP_SUCCESS )
+    {
+        CcspTraceError(("%s-%d Failed to set %d parameters on %s, fault:%s ret:%d\n", __FUNCTION__, __LINE__,
+                        pstTxn->iCount, pstTxn->pComponent, (faultParam != NULL) ? faultParam : "none", ret));
+        if( faultParam != NULL )
+        {
+            bus_info->freefunc(faultParam);
+        }
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
@@ -0,0 +1,238 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_event_ring.c
+    For CCSP Component:  dsl event delivery
+
+---------------------------------------------------------------
+
+    Description:
+
+    Bounded multi-producer single-consumer ring carrying link events
+    from the HAL callback threads to the event handler. Each
+    slot has its own sequence number so producers claim slots with a
+    single compare-and-swap and the consumer never takes a lock. The
+    consumer is woken through an eventfd, which is only written when
+    no wakeup is already pending.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "xdsl_event_ring.h"
+
+#define XDSL_EVENT_RING_MASK                ( XDSL_EVENT_RING_SIZE - 1 )
+
+typedef struct
+_XDSL_EVENT_RING_SLOT
+{
+    UINT                uSequence;
+    XDSL_EVENT          stEvent;
+} XDSL_EVENT_RING_SLOT;
+
+static XDSL_EVENT_RING_SLOT g_EventRing[XDSL_EVENT_RING_SIZE];
+static UINT g_EventRingHead = 0;
+static UINT g_EventRingTail = 0;
+static UINT g_EventRingWakeupPending = 0;
+static UINT g_EventRingOverflow = 0;
+static INT g_EventRingFd = -1;
+static XDSL_EVENT_RING_STATS g_EventRingStats;
+
+ANSC_STATUS XdslEventRingInit( VOID )
+{
+    UINT i;
+
+    if( g_EventRingFd >= 0 )
+    {
+        return ANSC_STATUS_SUCCESS;
+    }
+
+    for( i = 0; i < XDSL_EVENT_RING_SIZE; i++ )
+    {
+        g_EventRing[i].uSequence = i;
+    }
+
+    g_EventRingFd = eventfd(0, EFD_CLOEXEC);
+    if( g_EventRingFd < 0 )
+    {
+        CcspTraceError(("%s Failed to create eventfd errno:%d\n", __FUNCTION__, errno));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+static VOID XdslEventRingWakeup( VOID )
+{
+    eventfd_t value = 1;
+
+    if( __atomic_exchange_n(&g_EventRingWakeupPending, 1, __ATOMIC_SEQ_CST) != 0 )
+    {
+        return;
+    }
+
+    __atomic_fetch_add(&g_EventRingStats.Wakeups, 1, __ATOMIC_RELAXED);
+    if( eventfd_write(g_EventRingFd, value) < 0 )
+    {
+        CcspTraceError(("%s Failed to signal eventfd errno:%d\n", __FUNCTION__, errno));
+    }
+}
+
+ANSC_STATUS XdslEventRingPush( PXDSL_EVENT pstEvent )
+{
+    XDSL_EVENT_RING_SLOT *pSlot = NULL;
+    UINT uPos;
+    UINT uSeq;
+
+    if( pstEvent == NULL || g_EventRingFd < 0 )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    uPos = __atomic_load_n(&g_EventRingHead, __ATOMIC_RELAXED);
+    for(;;)
+    {
+        pSlot = &g_EventRing[uPos & XDSL_EVENT_RING_MASK];
+        uSeq = __atomic_load_n(&pSlot->uSequence, __ATOMIC_ACQUIRE);
+
+        if( (INT)(uSeq - uPos) == 0 )
+        {
+            if( __atomic_compare_exchange_n(&g_EventRingHead, &uPos, uPos + 1, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+            {
+                break;
+            }
+        }
+        else if( (INT)(uSeq - uPos) < 0 )
+        {
+            /* Ring full, let the consumer resynchronise from the current state */
+            __atomic_fetch_add(&g_EventRingStats.Dropped, 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&g_EventRingOverflow, 1, __ATOMIC_SEQ_CST);
+            XdslEventRingWakeup();
+            return ANSC_STATUS_FAILURE;
+        }
+        else
+        {
+            uPos = __atomic_load_n(&g_EventRingHead, __ATOMIC_RELAXED);
+        }
+    }
+
+    memcpy(&pSlot->stEvent, pstEvent, sizeof(XDSL_EVENT));
+    pSlot->stEvent.ulSequence = uPos;
+    __atomic_store_n(&pSlot->uSequence, uPos + 1, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&g_EventRingStats.Pushed, 1, __ATOMIC_RELAXED);
+
+    XdslEventRingWakeup();
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* Single consumer only */
+BOOL XdslEventRingPop( PXDSL_EVENT pstEvent )
+{
+    XDSL_EVENT_RING_SLOT *pSlot = NULL;
+    UINT uPos = g_EventRingTail;
+
+    if( pstEvent == NULL )
+    {
+        return FALSE;
+    }
+
+    pSlot = &g_EventRing[uPos & XDSL_EVENT_RING_MASK];
+    if( (INT)(__atomic_load_n(&pSlot->uSequence, __ATOMIC_ACQUIRE) - (uPos + 1)) < 0 )
+    {
+        return FALSE;
+    }
+
+    memcpy(pstEvent, &pSlot->stEvent, sizeof(XDSL_EVENT));
+    __atomic_store_n(&pSlot->uSequence, uPos + XDSL_EVENT_RING_SIZE, __ATOMIC_RELEASE);
+    g_EventRingTail = uPos + 1;
+
+    return TRUE;
+}
+
+INT XdslEventRingGetFd( VOID )
+{
+    return g_EventRingFd;
+}
+
+/*
+ * Consume the eventfd wakeup, blocking if none is pending yet. The pending
+ * flag is cleared before returning so that any push racing with the
+ * following drain signals the eventfd again.
+ */
+ANSC_STATUS XdslEventRingWait( VOID )
+{
+    eventfd_t value = 0;
+
+    while( eventfd_read(g_EventRingFd, &value) < 0 )
+    {
+        if( errno != EINTR )
+        {
+            CcspTraceError(("%s Failed to read eventfd errno:%d\n", __FUNCTION__, errno));
+            return ANSC_STATUS_FAILURE;
+        }
+    }
+
+    __atomic_store_n(&g_EventRingWakeupPending, 0, __ATOMIC_SEQ_CST);
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+BOOL XdslEventRingTakeOverflow( VOID )
+{
+    return (__atomic_exchange_n(&g_EventRingOverflow, 0, __ATOMIC_SEQ_CST) != 0) ? TRUE : FALSE;
+}
+
+/* Single consumer only */
+BOOL XdslEventRingHasPending( VOID )
+{
+    UINT uPos = g_EventRingTail;
+
+    if( __atomic_load_n(&g_EventRingOverflow, __ATOMIC_SEQ_CST) != 0 )
+    {
+        return TRUE;
+    }
+
+    return ((INT)(__atomic_load_n(&g_EventRing[uPos & XDSL_EVENT_RING_MASK].uSequence, __ATOMIC_ACQUIRE) - (uPos + 1)) < 0) ? FALSE : TRUE;
+}
+
+VOID XdslEventRingRecordCoalesced( ULONG ulCount )
+{
+    __atomic_fetch_add(&g_EventRingStats.Coalesced, ulCount, __ATOMIC_RELAXED);
+}
+
+VOID XdslEventRingGetStats( PXDSL_EVENT_RING_STATS pstStats )
+{
+    if( pstStats == NULL )
+    {
+        return;
+    }
+
+    pstStats->Pushed    = __atomic_load_n(&g_EventRingStats.Pushed, __ATOMIC_RELAXED);
+    pstStats->Dropped   = __atomic_load_n(&g_EventRingStats.Dropped, __ATOMIC_RELAXED);
+    pstStats->Coalesced = __atomic_load_n(&g_EventRingStats.Coalesced, __ATOMIC_RELAXED);
+    pstStats->Wakeups   = __atomic_load_n(&g_EventRingStats.Wakeups, __ATOMIC_RELAXED);
+}
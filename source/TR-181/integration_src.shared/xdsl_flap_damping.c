@@ -0,0 +1,474 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_flap_damping.c
+    For CCSP Component:  dsl link status damping
+
+---------------------------------------------------------------
+
+    Description:
+
+    Sits between the HAL link status callback and everything that reacts
+    to it (WAN Manager PHY status, LED, line state machine). On marginal
+    loops the line retrains over and over and each cycle used to restart
+    the WAN stack, PPP and DHCP. A penalty that decays exponentially
+    suppresses the line once it flaps too often and lets it back in once
+    it has been quiet for long enough.
+
+    The decay is done in fixed point in sixteenths of a half-life so the
+    module does not need libm.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "xdsl_flap_damping.h"
+
+/* Decay steps per half-life */
+#define XDSL_FLAP_DAMPING_STEPS                     16
+
+/* Beyond this many half-lives the penalty is gone */
+#define XDSL_FLAP_DAMPING_MAX_HALF_LIVES            32
+
+typedef  struct
+_XDSL_FLAP_DAMPING_IFACE
+{
+    BOOL                    bUsed;
+    CHAR                    Name[64];
+    DML_XDSL_LINK_STATUS    RawStatus;
+    DML_XDSL_LINK_STATUS    DeliveredStatus;
+    ULONG                   ulPenalty;
+    ULONGLONG               ullLastDecay;
+    BOOL                    bSuppressed;
+    ULONGLONG               ullSuppressStart;
+}
+XDSL_FLAP_DAMPING_IFACE, *PXDSL_FLAP_DAMPING_IFACE;
+
+/* 2^(-k/16) in 16.16 fixed point */
+static const ULONG g_FlapDampingDecay[XDSL_FLAP_DAMPING_STEPS] =
+{
+    65536, 62757, 60097, 57549, 55109, 52773, 50535, 48393,
+    46341, 44376, 42495, 40693, 38968, 37316, 35734, 34219
+};
+
+static XDSL_FLAP_DAMPING_CONFIG g_FlapDampingConfig =
+{
+    XDSL_FLAP_DAMPING_DEFAULT_ENABLE,
+    XDSL_FLAP_DAMPING_DEFAULT_HALF_LIFE,
+    XDSL_FLAP_DAMPING_DEFAULT_SUPPRESS,
+    XDSL_FLAP_DAMPING_DEFAULT_REUSE,
+    XDSL_FLAP_DAMPING_DEFAULT_MAX_SUPPRESS_TIME
+};
+
+static XDSL_FLAP_DAMPING_IFACE g_FlapDampingIfaces[XDSL_FLAP_DAMPING_MAX_IFACES];
+static ULONG g_FlapDampingFlaps = 0;
+static ULONG g_FlapDampingSuppressedEvents = 0;
+static ULONG g_FlapDampingSuppressions = 0;
+static pthread_mutex_t gmFlapDamping_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static ULONGLONG XdslFlapDampingNowMs( VOID )
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((ULONGLONG)ts.tv_sec * 1000) + (ts.tv_nsec / 1000000);
+}
+
+static ULONGLONG XdslFlapDampingStepMs( VOID )
+{
+    ULONGLONG ullStepMs = ((ULONGLONG)g_FlapDampingConfig.HalfLife * 1000) / XDSL_FLAP_DAMPING_STEPS;
+
+    return (ullStepMs > 0) ? ullStepMs : 1;
+}
+
+/* Penalty left after ullSteps decay steps */
+static ULONG XdslFlapDampingDecayed( ULONG ulPenalty, ULONGLONG ullSteps )
+{
+    if( ullSteps >= (ULONGLONG)XDSL_FLAP_DAMPING_STEPS * XDSL_FLAP_DAMPING_MAX_HALF_LIVES )
+    {
+        return 0;
+    }
+
+    ulPenalty >>= (ullSteps / XDSL_FLAP_DAMPING_STEPS);
+
+    return (ULONG)(((ULONGLONG)ulPenalty * g_FlapDampingDecay[ullSteps % XDSL_FLAP_DAMPING_STEPS]) >> 16);
+}
+
+/* Applies the decay due since the last update, keeping the partial step for next time */
+static VOID XdslFlapDampingDecay( PXDSL_FLAP_DAMPING_IFACE pIface, ULONGLONG ullNow )
+{
+    ULONGLONG ullStepMs = XdslFlapDampingStepMs();
+    ULONGLONG ullSteps;
+
+    if( ullNow <= pIface->ullLastDecay )
+    {
+        return;
+    }
+
+    ullSteps = (ullNow - pIface->ullLastDecay) / ullStepMs;
+    if( ullSteps == 0 )
+    {
+        return;
+    }
+
+    pIface->ulPenalty = XdslFlapDampingDecayed(pIface->ulPenalty, ullSteps);
+    pIface->ullLastDecay += ullSteps * ullStepMs;
+}
+
+/*
+ * Highest penalty worth keeping: the one that decays to the reuse threshold
+ * in MaxSuppressTime, so a line is never held longer than that by decay alone.
+ */
+static ULONG XdslFlapDampingCeiling( VOID )
+{
+    ULONG ulHalfLives = g_FlapDampingConfig.MaxSuppressTime / g_FlapDampingConfig.HalfLife;
+    ULONGLONG ullCeiling;
+
+    if( ulHalfLives > 16 )
+    {
+        ulHalfLives = 16;
+    }
+
+    ullCeiling = (ULONGLONG)g_FlapDampingConfig.ReuseThreshold << ulHalfLives;
+    if( ullCeiling > 0x7FFFFFFF )
+    {
+        ullCeiling = 0x7FFFFFFF;
+    }
+
+    return ((ULONG)ullCeiling > g_FlapDampingConfig.SuppressThreshold) ? (ULONG)ullCeiling : g_FlapDampingConfig.SuppressThreshold;
+}
+
+/* Milliseconds until a suppressed line is due for release */
+static ULONG XdslFlapDampingTimeToReuse( PXDSL_FLAP_DAMPING_IFACE pIface, ULONGLONG ullNow )
+{
+    ULONGLONG ullStepMs = XdslFlapDampingStepMs();
+    ULONGLONG ullSteps  = 0;
+    ULONGLONG ullDecayMs;
+    ULONGLONG ullMaxMs;
+    ULONGLONG ullElapsed = (ullNow > pIface->ullLastDecay) ? (ullNow - pIface->ullLastDecay) : 0;
+
+    while( XdslFlapDampingDecayed(pIface->ulPenalty, ullSteps) >= g_FlapDampingConfig.ReuseThreshold )
+    {
+        ullSteps++;
+    }
+
+    ullDecayMs = ullSteps * ullStepMs;
+    ullDecayMs = (ullDecayMs > ullElapsed) ? (ullDecayMs - ullElapsed) : 0;
+
+    ullMaxMs = pIface->ullSuppressStart + ((ULONGLONG)g_FlapDampingConfig.MaxSuppressTime * 1000);
+    ullMaxMs = (ullMaxMs > ullNow) ? (ullMaxMs - ullNow) : 0;
+
+    if( ullMaxMs < ullDecayMs )
+    {
+        ullDecayMs = ullMaxMs;
+    }
+
+    //A zero delay would disarm the timer
+    return (ullDecayMs > 0) ? (ULONG)ullDecayMs : 1;
+}
+
+static ULONG XdslFlapDampingNextCheck( ULONGLONG ullNow )
+{
+    ULONG ulNext = 0;
+    INT i;
+
+    for( i = 0; i < XDSL_FLAP_DAMPING_MAX_IFACES; i++ )
+    {
+        if( g_FlapDampingIfaces[i].bUsed && g_FlapDampingIfaces[i].bSuppressed )
+        {
+            ULONG ulReuse = XdslFlapDampingTimeToReuse(&g_FlapDampingIfaces[i], ullNow);
+
+            if( ulNext == 0 || ulReuse < ulNext )
+            {
+                ulNext = ulReuse;
+            }
+        }
+    }
+
+    return ulNext;
+}
+
+static PXDSL_FLAP_DAMPING_IFACE XdslFlapDampingFindIface( const char *ifname, ULONGLONG ullNow )
+{
+    PXDSL_FLAP_DAMPING_IFACE pFree = NULL;
+    INT i;
+
+    for( i = 0; i < XDSL_FLAP_DAMPING_MAX_IFACES; i++ )
+    {
+        if( g_FlapDampingIfaces[i].bUsed )
+        {
+            if( 0 == strcmp(g_FlapDampingIfaces[i].Name, ifname) )
+            {
+                return &g_FlapDampingIfaces[i];
+            }
+        }
+        else if( pFree == NULL )
+        {
+            pFree = &g_FlapDampingIfaces[i];
+        }
+    }
+
+    if( pFree != NULL )
+    {
+        memset(pFree, 0, sizeof(XDSL_FLAP_DAMPING_IFACE));
+        pFree->bUsed           = TRUE;
+        pFree->RawStatus       = XDSL_LINK_STATUS_Disabled;
+        pFree->DeliveredStatus = XDSL_LINK_STATUS_Disabled;
+        pFree->ullLastDecay    = ullNow;
+        snprintf(pFree->Name, sizeof(pFree->Name), "%s", ifname);
+    }
+
+    return pFree;
+}
+
+static BOOL XdslFlapDampingIsConfigValid( PXDSL_FLAP_DAMPING_CONFIG pstConfig )
+{
+    return ((pstConfig->HalfLife > 0) &&
+            (pstConfig->ReuseThreshold > 0) &&
+            (pstConfig->ReuseThreshold < pstConfig->SuppressThreshold) &&
+            (pstConfig->MaxSuppressTime >= pstConfig->HalfLife)) ? TRUE : FALSE;
+}
+
+ANSC_STATUS XdslFlapDampingInit( PXDSL_FLAP_DAMPING_CONFIG pstConfig )
+{
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+    memset(g_FlapDampingIfaces, 0, sizeof(g_FlapDampingIfaces));
+    g_FlapDampingFlaps = 0;
+    g_FlapDampingSuppressedEvents = 0;
+    g_FlapDampingSuppressions = 0;
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+
+    if( pstConfig == NULL )
+    {
+        return ANSC_STATUS_SUCCESS;
+    }
+
+    return XdslFlapDampingSetConfig(pstConfig);
+}
+
+ANSC_STATUS XdslFlapDampingSetConfig( PXDSL_FLAP_DAMPING_CONFIG pstConfig )
+{
+    if( pstConfig == NULL || !XdslFlapDampingIsConfigValid(pstConfig) )
+    {
+        CcspTraceError(("%s Invalid damping configuration\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+    memcpy(&g_FlapDampingConfig, pstConfig, sizeof(XDSL_FLAP_DAMPING_CONFIG));
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+
+    CcspTraceInfo(("%s Enable:%d HalfLife:%lu Suppress:%lu Reuse:%lu MaxSuppressTime:%lu\n", __FUNCTION__,
+                   pstConfig->Enable, pstConfig->HalfLife, pstConfig->SuppressThreshold,
+                   pstConfig->ReuseThreshold, pstConfig->MaxSuppressTime));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+VOID XdslFlapDampingGetConfig( PXDSL_FLAP_DAMPING_CONFIG pstConfig )
+{
+    if( pstConfig == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+    memcpy(pstConfig, &g_FlapDampingConfig, sizeof(XDSL_FLAP_DAMPING_CONFIG));
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+}
+
+BOOL XdslFlapDampingApply( const char *ifname, DML_XDSL_LINK_STATUS enLinkStatus, ULONG *pulNextCheckMs )
+{
+    PXDSL_FLAP_DAMPING_IFACE pIface;
+    ULONGLONG ullNow = XdslFlapDampingNowMs();
+    BOOL bDeliver = TRUE;
+
+    if( pulNextCheckMs != NULL )
+    {
+        *pulNextCheckMs = 0;
+    }
+
+    if( ifname == NULL )
+    {
+        return TRUE;
+    }
+
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+
+    pIface = XdslFlapDampingFindIface(ifname, ullNow);
+    if( pIface == NULL )
+    {
+        //Untracked lines are never damped
+        pthread_mutex_unlock(&gmFlapDamping_mutex);
+        return TRUE;
+    }
+
+    XdslFlapDampingDecay(pIface, ullNow);
+
+    //Dropping out of showtime is a flap
+    if( pIface->RawStatus == XDSL_LINK_STATUS_Up && enLinkStatus != XDSL_LINK_STATUS_Up )
+    {
+        ULONG ulCeiling = XdslFlapDampingCeiling();
+
+        g_FlapDampingFlaps++;
+        pIface->ulPenalty += XDSL_FLAP_DAMPING_PENALTY;
+        if( pIface->ulPenalty > ulCeiling )
+        {
+            pIface->ulPenalty = ulCeiling;
+        }
+
+        if( g_FlapDampingConfig.Enable && !pIface->bSuppressed &&
+            pIface->ulPenalty >= g_FlapDampingConfig.SuppressThreshold )
+        {
+            pIface->bSuppressed      = TRUE;
+            pIface->ullSuppressStart = ullNow;
+            g_FlapDampingSuppressions++;
+            CcspTraceWarning(("%s - %s flapping, penalty %lu, holding it down\n", __FUNCTION__, ifname, pIface->ulPenalty));
+        }
+    }
+    pIface->RawStatus = enLinkStatus;
+
+    //A line going down is always reported, everything after that waits for the release
+    if( pIface->bSuppressed &&
+        !(pIface->DeliveredStatus == XDSL_LINK_STATUS_Up && enLinkStatus != XDSL_LINK_STATUS_Up) )
+    {
+        bDeliver = FALSE;
+        if( enLinkStatus != pIface->DeliveredStatus )
+        {
+            g_FlapDampingSuppressedEvents++;
+            CcspTraceInfo(("%s - %s suppressed, withholding link status %d, penalty %lu\n", __FUNCTION__, ifname, enLinkStatus, pIface->ulPenalty));
+        }
+    }
+    else
+    {
+        pIface->DeliveredStatus = enLinkStatus;
+    }
+
+    if( pulNextCheckMs != NULL )
+    {
+        *pulNextCheckMs = XdslFlapDampingNextCheck(ullNow);
+    }
+
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+
+    return bDeliver;
+}
+
+INT XdslFlapDampingRelease( PXDSL_FLAP_DAMPING_RELEASE pstReleased, INT iMax, ULONG *pulNextCheckMs )
+{
+    ULONGLONG ullNow = XdslFlapDampingNowMs();
+    INT iCount = 0;
+    INT i;
+
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+
+    for( i = 0; i < XDSL_FLAP_DAMPING_MAX_IFACES; i++ )
+    {
+        PXDSL_FLAP_DAMPING_IFACE pIface = &g_FlapDampingIfaces[i];
+
+        if( !pIface->bUsed || !pIface->bSuppressed )
+        {
+            continue;
+        }
+
+        XdslFlapDampingDecay(pIface, ullNow);
+
+        if( g_FlapDampingConfig.Enable &&
+            pIface->ulPenalty >= g_FlapDampingConfig.ReuseThreshold &&
+            (ullNow - pIface->ullSuppressStart) < ((ULONGLONG)g_FlapDampingConfig.MaxSuppressTime * 1000) )
+        {
+            continue;
+        }
+
+        pIface->bSuppressed = FALSE;
+        CcspTraceInfo(("%s - %s released after %llu s, penalty %lu, link status %d\n", __FUNCTION__, pIface->Name,
+                       (ullNow - pIface->ullSuppressStart) / 1000, pIface->ulPenalty, pIface->RawStatus));
+
+        //Catch up with whatever the line did while it was held
+        if( pIface->RawStatus != pIface->DeliveredStatus && pstReleased != NULL && iCount < iMax )
+        {
+            snprintf(pstReleased[iCount].Name, sizeof(pstReleased[iCount].Name), "%s", pIface->Name);
+            pstReleased[iCount].LinkStatus = pIface->RawStatus;
+            pIface->DeliveredStatus = pIface->RawStatus;
+            iCount++;
+        }
+    }
+
+    if( pulNextCheckMs != NULL )
+    {
+        *pulNextCheckMs = XdslFlapDampingNextCheck(ullNow);
+    }
+
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+
+    return iCount;
+}
+
+VOID XdslFlapDampingGetStats( PXDSL_FLAP_DAMPING_STATS pstStats )
+{
+    ULONGLONG ullNow = XdslFlapDampingNowMs();
+    INT i;
+
+    if( pstStats == NULL )
+    {
+        return;
+    }
+
+    memset(pstStats, 0, sizeof(XDSL_FLAP_DAMPING_STATS));
+
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+    pstStats->Flaps            = g_FlapDampingFlaps;
+    pstStats->SuppressedEvents = g_FlapDampingSuppressedEvents;
+    pstStats->Suppressions     = g_FlapDampingSuppressions;
+
+    for( i = 0; i < XDSL_FLAP_DAMPING_MAX_IFACES; i++ )
+    {
+        if( !g_FlapDampingIfaces[i].bUsed )
+        {
+            continue;
+        }
+
+        XdslFlapDampingDecay(&g_FlapDampingIfaces[i], ullNow);
+        if( g_FlapDampingIfaces[i].ulPenalty > pstStats->Penalty )
+        {
+            pstStats->Penalty = g_FlapDampingIfaces[i].ulPenalty;
+        }
+        if( g_FlapDampingIfaces[i].bSuppressed )
+        {
+            pstStats->SuppressedLines++;
+        }
+    }
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+}
+
+VOID XdslFlapDampingResetStats( VOID )
+{
+    pthread_mutex_lock(&gmFlapDamping_mutex);
+    g_FlapDampingFlaps = 0;
+    g_FlapDampingSuppressedEvents = 0;
+    g_FlapDampingSuppressions = 0;
+    pthread_mutex_unlock(&gmFlapDamping_mutex);
+}
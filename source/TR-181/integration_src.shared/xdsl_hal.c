@@ -39,11 +39,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <limits.h>
+#include <time.h>
+#include <pthread.h>
 #include "xdsl_apis.h"
 #include "xdsl_hal.h"
 #include "xtm_internal.h"
 #include "xdsl_internal.h"
+#include "xdsl_hal_perf.h"
+#include "xdsl_line_policy.h"
+#include "xdsl_pm_store.h"
 
 #include "rpc-cli/rpc_client.h"
 #include <json-c/json.h>
@@ -54,10 +60,12 @@
 
 #define XDSL_LINE_ENABLE "Device.DSL.Line.%d.Enable"
 #define XDSL_LINE_INFO "Device.DSL.Line.%d."
+#define XDSL_LINE_INFO_PARAM "Device.DSL.Line.%d.%s"
 #define XDSL_LINE_STANDARD_USED "Device.DSL.Line.%d.StandardUsed"
 #define XDSL_LINE_STATS "Device.DSL.Line.%d.Stats."
 #define XDSL_LINE_LINKSTATUS "Device.DSL.Line.1.LinkStatus"
 #define XDSL_LINE_PROFILE "Device.DSL.Line.1.AllowedProfiles"
+#define XDSL_LINE_XTSE "Device.DSL.Line.1.XTSE"
 #define XDSL_LINE_DATA_GATHERING_ENABLE "Device.DSL.Line.%d.EnableDataGathering"
 
 #define XDSL_CHANNEL_INFO "Device.DSL.Channel.%d."
@@ -94,6 +102,8 @@
 
 #define XDSL_MAX_LINES 1
 #define HAL_CONNECTION_RETRY_MAX_COUNT 10
+/* json_hal_client gives up waiting for a reply after this long */
+#define HAL_RPC_REPLY_TIMEOUT_USEC 10000000UL
 
 #define CHECK(expr)                                                \
     if (!(expr))                                                   \
@@ -117,13 +127,19 @@ extern PBACKEND_MANAGER_OBJECT g_pBEManager;
 
 dsl_link_status_callback dsl_link_status_cb = NULL;
 static int subscribe_dsl_link_event();
-static int g_successful_retrains = -1;
+/*
+ * Showtimes after the first one since start. The day count follows the
+ * driver's CurrentDay, both counts are kept in the PM store. The day count
+ * is stored with the CurrentDayStart it was counted in, a smaller
+ * CurrentDayStart on the next read means the driver started a new day.
+ */
+static int g_successful_retrains = 0;
+static int g_lifetime_retrains = 0;
+static int g_first_up_seen = 0;
+static unsigned long g_retrains_day_start = 0;
+static pthread_mutex_t g_retrains_day_mutex = PTHREAD_MUTEX_INITIALIZER;
 static void *eventcb(const char *msg, const int len);
-static ANSC_STATUS configure_xdsl_driver();
-static ANSC_STATUS xtse_get_bit_position(char *StandardUsed, int *bit_position, int *bit_range);
-static ANSC_STATUS compare_with_standards_supported( char *standardsSupported, char *Xtse, int size);
-static ANSC_STATUS xdsl_hal_setXtsUsed(char *standardUsed, char *xtsUsedBuf, int size);
-static ANSC_STATUS xdsl_hal_setXtse(char *standardsSupported, char *xtseBuf, int size);
+static int xdsl_hal_dslGetLineConfig(char *allowedProfiles, int profilesLen, char *xtse, int xtseLen);
 static ANSC_STATUS getDestinationAddress(char *Interface, char *DestinationAddress);
 
 /**
@@ -170,10 +186,76 @@ static ANSC_STATUS get_ptm_link_stats(const json_object *reply_msg, PDML_PTM_STA
 
 static ANSC_STATUS get_atm_link_stats(const json_object *reply_msg, PDML_ATM_STATS link_stats);
 
+/**
+ * @brief Sends the request to the json hal server and accounts the call
+ * against the given entry point in the HAL performance counters.
+ *
+ * @param id       (IN)  - Entry point the request belongs to
+ * @param jmsg     (IN)  - Json request message
+ * @param jreply   (OUT) - Json response message
+ * @return Return value of json_hal_client_send_and_get_reply()
+ */
+static int xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_ID id, json_object *jmsg, json_object **jreply);
+
+static int xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_ID id, json_object *jmsg, json_object **jreply)
+{
+    int rc = RETURN_OK;
+    struct timespec start;
+    struct timespec end;
+    ULONG ulLatency = 0;
+    size_t bytesSent = 0;
+    size_t bytesReceived = 0;
+    XDSL_HAL_PERF_RESULT result = XDSL_HAL_PERF_RESULT_OK;
+
+    /* Callers free the reply on their error paths, it must never be left uninitialised */
+    *jreply = NULL;
+
+    if (!XdslHalPerfIsEnabled())
+    {
+        return json_hal_client_send_and_get_reply(jmsg, jreply);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    rc = json_hal_client_send_and_get_reply(jmsg, jreply);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    ulLatency = (ULONG)((end.tv_sec - start.tv_sec) * 1000000L + (end.tv_nsec - start.tv_nsec) / 1000L);
+
+    if (rc != RETURN_OK)
+    {
+        /*
+         * The client returns RETURN_ERR for every failure and keeps the
+         * return code of its timed wait to itself, so a failure without a
+         * reply that lasted the whole reply wait is the timeout.
+         */
+        result = ((*jreply == NULL) && (ulLatency >= HAL_RPC_REPLY_TIMEOUT_USEC)) ?
+                     XDSL_HAL_PERF_RESULT_TIMEOUT : XDSL_HAL_PERF_RESULT_ERROR;
+    }
+    else if (*jreply == NULL)
+    {
+        result = XDSL_HAL_PERF_RESULT_ERROR;
+    }
+
+    /* Sizing the messages means serialising them again, so it is opt-in */
+    if (XdslHalPerfIsByteCountingEnabled())
+    {
+        bytesSent = strlen(json_object_to_json_string(jmsg));
+        if (*jreply != NULL)
+        {
+            bytesReceived = strlen(json_object_to_json_string(*jreply));
+        }
+    }
+
+    XdslHalPerfRecord(id, ulLatency, result, bytesSent, bytesReceived);
+
+    return rc;
+}
+
 /* xdsl_hal_init() */
 int xdsl_hal_init( void )
 {
     int rc = RETURN_OK;
+    int dayStart = 0;
     rc = json_hal_client_init(XDSL_JSON_CONF_PATH);
     if (rc != RETURN_OK)
     {
@@ -216,6 +298,14 @@ int xdsl_hal_init( void )
         return RETURN_ERR;
     }
 
+    //Retrains counted before a restart, restored before the first link event can add to them
+    XdslPmStoreGetCounter(0, XDSL_PM_STORE_COUNTER_LIFETIME_RETRAINS, &g_lifetime_retrains);
+    if (XdslPmStoreGetCounter(0, XDSL_PM_STORE_COUNTER_DAY_START, &dayStart) &&
+        XdslPmStoreGetCounter(0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, &g_successful_retrains))
+    {
+        g_retrains_day_start = (unsigned long)dayStart;
+    }
+
     /* Event subscription for dsl link to hal-server. */
     rc = subscribe_dsl_link_event();
     if (rc != RETURN_OK)
@@ -223,15 +313,8 @@ int xdsl_hal_init( void )
         CcspTraceError(("Failed to subscribe DSL link event \n"));
     }
 
-    /**
-     * Configure xDSL driver.
-     */
-    rc = configure_xdsl_driver();
-    if (rc != ANSC_STATUS_SUCCESS)
-    {
-        CcspTraceError(("Failed to configure xDSL driver \n"));
-    }
-    return rc;
+    //Line profiles and standards are applied by the caller from the configured policy
+    return RETURN_OK;
 }
 
 /* xdsl_hal_registerDslLinkStatusCallback() */
@@ -277,7 +360,7 @@ int xdsl_hal_dslGetLineEnable( hal_param_t *req_param )
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jresponse_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_LINE_ENABLE, jmsg, &jresponse_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -334,7 +417,7 @@ int xdsl_hal_dslGetLineStandardUsed( hal_param_t *req_param, int line_index)
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jresponse_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_STANDARD_USED, jmsg, &jresponse_msg) != RETURN_OK)
     {
         FREE_JSON_OBJECT(jmsg);
         FREE_JSON_OBJECT(jresponse_msg);
@@ -380,7 +463,7 @@ int xdsl_hal_dslSetLineEnable( hal_param_t *req_msg )
     json_hal_add_param(jmsg, SET_REQUEST_MESSAGE, req_msg);
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_SET_LINE_ENABLE, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -416,6 +499,71 @@ int xdsl_hal_dslSetLineEnable( hal_param_t *req_msg )
     return rc;
 }
 
+/* xdsl_hal_dslSetLineParams() */
+int xdsl_hal_dslSetLineParams(hal_param_t *req_msgs, int count)
+{
+    int rc = RETURN_OK;
+    int i;
+
+    json_object *jmsg = NULL;
+    json_object *jreply_msg = NULL;
+    json_bool status = FALSE;
+
+    if (req_msgs == NULL || count <= 0)
+    {
+        return RETURN_ERR;
+    }
+
+    jmsg = json_hal_client_get_request_header(RPC_SET_PARAMETERS_REQUEST);
+    CHECK(jmsg);
+
+    for (i = 0; i < count; i++)
+    {
+        if (json_hal_add_param(jmsg, SET_REQUEST_MESSAGE, &req_msgs[i]) != RETURN_OK)
+        {
+            FREE_JSON_OBJECT(jmsg);
+            CcspTraceError(("[%s][%d] json_hal_add_param failed \n", __FUNCTION__, __LINE__));
+            return RETURN_ERR;
+        }
+    }
+
+    CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_SET_LINE_PARAMS, jmsg, &jreply_msg) != RETURN_OK)
+    {
+        CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
+        FREE_JSON_OBJECT(jmsg);
+        FREE_JSON_OBJECT(jreply_msg);
+        return RETURN_ERR;
+    }
+
+    CHECK(jreply_msg);
+
+    if (json_hal_get_result_status(jreply_msg, &status) == RETURN_OK)
+    {
+        if (status)
+        {
+            CcspTraceInfo(("%s - %d Set request for %d parameters is successful ", __FUNCTION__, __LINE__, count));
+            rc = RETURN_OK;
+        }
+        else
+        {
+            CcspTraceError(("%s - %d - Set request for %d parameters is failed \n", __FUNCTION__, __LINE__, count));
+            rc = RETURN_ERR;
+        }
+    }
+    else
+    {
+        CcspTraceError(("%s - %d Failed to get result status from json response, something wrong happened!!! \n", __FUNCTION__, __LINE__));
+        rc = RETURN_ERR;
+    }
+
+    // Free json objects.
+    FREE_JSON_OBJECT(jmsg);
+    FREE_JSON_OBJECT(jreply_msg);
+
+    return rc;
+}
+
 /* xdsl_hal_dslSetLineEnableDataGathering() */
 int xdsl_hal_dslSetLineEnableDataGathering(hal_param_t *req_msg)
 {
@@ -436,7 +584,7 @@ int xdsl_hal_dslSetLineEnableDataGathering(hal_param_t *req_msg)
     }
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK )
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_SET_DATA_GATHERING, jmsg, &jreply_msg) != RETURN_OK )
     {
         CcspTraceInfo(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -475,253 +623,141 @@ int xdsl_hal_dslSetLineEnableDataGathering(hal_param_t *req_msg)
     return rc;
 }
 
-static ANSC_STATUS xtse_get_bit_position(char *StandardUsed, int *bit_position, int *bit_range)
+/*
+ * Line attributes per tier, see XDSL_LINE_INFO_TIER_*. AllowedProfiles and XTSE
+ * are static unless xdsl_hal_dslConfigureLine() changes them, its caller marks
+ * the static tier pending again when it does.
+ */
+static const char *g_LineInfoStaticParams[] =
 {
-   if(StandardUsed != NULL)
-   {
-          if(!strcmp(StandardUsed,"G.992.1_Annex_A"))
-          {
-              *bit_position = G_992_1_POTS_NON_OVERLAPPED;
-          /* NOTE : More than one XTSE bits can be mapped to the same standard. So we need to filter out the repeated ones.
-               * If the standard is "G.992.1_Annex_A" , there are two bits corresponding to this standard,
-               G_992_1_POTS_NON_OVERLAPPED             = 3,  < Annex A >
-                   G_992_1_POTS_OVERLAPPED                 = 4,  < Annex A >
-           * Set both bits (G_992_1_POTS_NON_OVERLAPPED and G_992_1_POTS_OVERLAPPED)
-              */
-              *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.1_Annex_B"))
-          {
-              *bit_position = G_992_1_ISDN_NON_OVERLAPPED;
-              *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.1_Annex_C"))
-          {
-             *bit_position = G_992_1_TCM_ISDN_NON_OVERLAPPED;
-             *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"T1.413"))
-          {
-              *bit_position = T1_413;
-              *bit_range = 1;
-          }
-          else if(!strcmp(StandardUsed,"T1.413i2"))
-          {
-              *bit_position = T1_413;
-              *bit_range = 1;
-          }
-          else if(!strcmp(StandardUsed,"ETSI_101_388"))
-          {
-              *bit_position = ETSI_101_388;
-              *bit_range = 1;
-          }
-          else if(!strcmp(StandardUsed,"G.992.2"))
-          {
-              *bit_position = G_992_2_POTS_NON_OVERLAPPED;
-              *bit_range = 4;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_A"))
-          {
-              *bit_position = G_992_3_POTS_NON_OVERLAPPED;
-              *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_B"))
-          {
-               *bit_position = G_992_3_ISDN_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_C"))
-          {
-               *bit_position = G_992_3_TCM_ISDN_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_I"))
-          {
-               *bit_position = G_992_3_ANNEX_I_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_J"))
-          {
-               *bit_position = G_992_3_ANNEX_J_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_L"))
-          {
-               *bit_position = G_992_3_POTS_MODE_1;
-               *bit_range = 4;
-          }
-          else if(!strcmp(StandardUsed,"G.992.3_Annex_M"))
-          {
-               *bit_position = G_992_3_EXT_POTS_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.4"))
-          {
-               *bit_position = G_992_4_POTS_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.5_Annex_A"))
-          {
-               *bit_position = G_992_5_POTS_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.5_Annex_B"))
-          {
-               *bit_position = G_992_5_ISDN_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.5_Annex_C"))
-          {
-               *bit_position = G_992_5_TCM_ISDN_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.5_Annex_I"))
-          {
-               *bit_position = G_992_5_ANNEX_I_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.5_Annex_J"))
-          {
-               *bit_position = G_992_5_ANNEX_J_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.992.5_Annex_M"))
-          {
-               *bit_position = G_992_5_EXT_POTS_NON_OVERLAPPED;
-               *bit_range = 2;
-          }
-          else if(!strcmp(StandardUsed,"G.993.1"))
-          {
-              return ANSC_STATUS_FAILURE;
-          //To Do:  Find the bit position
-              // *bit_position = 0;
-              // *bit_range = 0;
-          }
-          else if(!strcmp(StandardUsed,"G.993.1_Annex_A"))
-          {
-              return ANSC_STATUS_FAILURE;
-              //To Do:  Find the bit position
-              // *bit_position = 0;
-              // *bit_range = 0;
-          }
-          else if(!strcmp(StandardUsed,"G.993.2_Annex_A"))
-          {
-               *bit_position = G_993_2_NORTH_AMERICA;
-               *bit_range = 1;
-          }
-          else if(!strcmp(StandardUsed,"G.993.2_Annex_B"))
-          {
-              *bit_position = G_993_2_EUROPE;
-              *bit_range = 1;
-          }
-          else if(!strcmp(StandardUsed,"G.993.2_Annex_C"))
-          {
-               *bit_position = G_993_2_JAPAN;
-               *bit_range = 1;
-          }
-          else
-          {
-           CcspTraceError(("%s : %s have no match with StandardsSupported\n", __FUNCTION__, StandardUsed));
-               return ANSC_STATUS_FAILURE;
-          }
-          return ANSC_STATUS_SUCCESS;
-     }
-     else
-     {
-          return ANSC_STATUS_FAILURE;
-     }
-}
+    "LineNumber", "FirmwareVersion", "AllowedProfiles", "XTSE",
+    "XTURVendor", "XTURCountry", "XTURANSIStd", "XTURANSIRev",
+    NULL
+};
 
-static ANSC_STATUS compare_with_standards_supported( char *standardsSupported, char *xtse, int size)
+static const char *g_LineInfoShowtimeParams[] =
 {
-    unsigned int bit_position, bit_range, octet, shift_bit;
-    unsigned int byte[8] = {0};
-    unsigned int temp_byte = 0x01;
-    unsigned int buf = 0;
-    int i = 0;
-
-    if(standardsSupported != NULL)
-    {
-        char *str;
-        str = strdup(standardsSupported);
-        int init_size = strlen(str);
-        char delim[] = ", ";
-        int i = 0;
-        char *ptr = strtok(str, delim);
-
-        while(ptr != NULL)
-        {
-            if(xtse_get_bit_position(ptr,&bit_position, &bit_range) == ANSC_STATUS_SUCCESS)
-            {
-                for(i=0; i< bit_range; i++)
-                {
-                    octet = (((bit_position + i) -1) / BITS);
-                    shift_bit = (((bit_position + i) - 1)% BITS);
-                    buf = (temp_byte << shift_bit);
-                    byte[octet] = (byte[octet] | buf);
-
-                    CcspTraceDebug(("bit_position :%d, octet : %d\n", bit_position, octet));
-                    buf = 0;  //clear buf
-                }
-            }
-            ptr = strtok(NULL, delim);
-        }
-
-        snprintf(xtse, size, "%02x%02x%02x%02x%02x%02x%02x%02x", byte[7],byte[6],byte[5],byte[4],byte[3],byte[2],byte[1],byte[0] );
-        return ANSC_STATUS_SUCCESS;
+    "StandardUsed", "CurrentProfile", "LineEncoding", "XTSUsed",
+    "XTUCVendor", "XTUCCountry", "XTUCANSIStd", "XTUCANSIRev",
+    "TRELLISds", "TRELLISus", "ACTSNRMODEds", "ACTSNRMODEus", "ACTUALCE",
+    "ACTRAMODEds", "ACTRAMODEus", "ACTINPROCds", "ACTINPROCus",
+    "SNRMROCds", "SNRMROCus", "UPBOKLE", "UPBOKLER", "UPBOKLEPb", "UPBOKLERPb",
+    "MREFPSDds", "MREFPSDus", "LIMITMASK", "US0MASK",
+    "VirtualNoisePSDds", "VirtualNoisePSDus", "RXTHRSHds",
+    "INMIATOds", "INMIATSds", "INMCCds", "INMINPEQMODEds",
+    "SuccessFailureCause", "LastStateTransmittedDownstream", "LastStateTransmittedUpstream",
+    NULL
+};
+
+static const char *g_LineInfoLiveParams[] =
+{
+    "Status", "LinkStatus", "LastChange", "PowerManagementState",
+    "UpstreamMaxBitRate", "DownstreamMaxBitRate",
+    "UpstreamAttenuation", "DownstreamAttenuation",
+    "UpstreamNoiseMargin", "DownstreamNoiseMargin",
+    "UpstreamPower", "DownstreamPower", "SNRMpbus", "SNRMpbds",
+    NULL
+};
+
+/* Narrow read of xdsl_hal_dslGetLineLive(), the live tier and the negotiated mode */
+static const char *g_LineLiveParams[] =
+{
+    "Status", "LinkStatus", "LastChange", "PowerManagementState",
+    "UpstreamMaxBitRate", "DownstreamMaxBitRate",
+    "UpstreamAttenuation", "DownstreamAttenuation",
+    "UpstreamNoiseMargin", "DownstreamNoiseMargin",
+    "UpstreamPower", "DownstreamPower", "StandardUsed", "CurrentProfile",
+    NULL
+};
+
+/* xdsl_hal_parseLinkStatus() */
+static void xdsl_hal_parseLinkStatus(const char *value, DML_XDSL_LINK_STATUS *pLinkStatus)
+{
+    if (strcmp(value, "Up") == 0)
+    {
+        *pLinkStatus = XDSL_LINK_STATUS_Up;
     }
-    else
+    else if (strcmp(value, "Initializing") == 0)
     {
-        return ANSC_STATUS_FAILURE;
+        *pLinkStatus = XDSL_LINK_STATUS_Initializing;
+    }
+    else if (strcmp(value, "EstablishingLink") == 0)
+    {
+        *pLinkStatus = XDSL_LINK_STATUS_EstablishingLink;
+    }
+    else if (strcmp(value, "NoSignal") == 0)
+    {
+        *pLinkStatus = XDSL_LINK_STATUS_NoSignal;
+    }
+    else if (strcmp(value, "Disabled") == 0)
+    {
+        *pLinkStatus = XDSL_LINK_STATUS_Disabled;
+    }
+    else if (strcmp(value, "Error") == 0)
+    {
+        *pLinkStatus = XDSL_LINK_STATUS_Error;
     }
 }
 
-static ANSC_STATUS xdsl_hal_setXtsUsed(char *standardUsed, char *xtsUsedBuf, int size)
+/* xdsl_hal_parseIfStatus() */
+static void xdsl_hal_parseIfStatus(const char *value, DML_XDSL_IF_STATUS *pStatus)
 {
-    unsigned int bit_position, bit_range, octet, shift_bit;
-    unsigned int byte[8] = {0};
-    unsigned int temp_byte = 0x01;
-    unsigned int buf = 0;
-    int i = 0;
-
-    if(xtse_get_bit_position(standardUsed, &bit_position, &bit_range) == ANSC_STATUS_SUCCESS)
+    if (strcmp(value, "Up") == 0)
     {
-       for(i=0; i < bit_range; i++)
-       {
-          octet = (((bit_position + i) - 1) / BITS);
-          shift_bit = (((bit_position + i) - 1) % BITS);
-          buf = (temp_byte << shift_bit);
-          byte[octet] = (byte[octet] | buf);
-
-          buf = 0; //clear buf
-       }
-       snprintf(xtsUsedBuf, size, "%02x%02x%02x%02x%02x%02x%02x%02x", byte[7],byte[6],byte[5],byte[4],byte[3],byte[2],byte[1],byte[0] );
-
-       return ANSC_STATUS_SUCCESS;
+        *pStatus = XDSL_IF_STATUS_Up;
     }
-    else
+    else if (strcmp(value, "Down") == 0)
     {
-       return ANSC_STATUS_FAILURE;
+        *pStatus = XDSL_IF_STATUS_Down;
+    }
+    else if (strcmp(value, "Unknown") == 0)
+    {
+        *pStatus = XDSL_IF_STATUS_Unknown;
+    }
+    else if (strcmp(value, "Dormant") == 0)
+    {
+        *pStatus = XDSL_IF_STATUS_Dormant;
+    }
+    else if (strcmp(value, "NotPresent") == 0)
+    {
+        *pStatus = XDSL_IF_STATUS_NotPresent;
+    }
+    else if (strcmp(value, "LowerLayerDown") == 0)
+    {
+        *pStatus = XDSL_IF_STATUS_LowerLayerDown;
+    }
+    else if (strcmp(value, "Error") == 0)
+    {
+        *pStatus = XDSL_IF_STATUS_Error;
     }
 }
 
-static ANSC_STATUS xdsl_hal_setXtse(char *standardsSupported, char *xtseBuf, int size)
+/* xdsl_hal_addLineInfoParams() */
+static int xdsl_hal_addLineInfoParams(json_object *jmsg, int lineNo, const char **ppParams)
 {
-    char tmpBuf[17] = {0};
-    if(compare_with_standards_supported(standardsSupported, &tmpBuf, sizeof(tmpBuf)) == ANSC_STATUS_SUCCESS)
-    {
-       snprintf(xtseBuf, size, "%s", tmpBuf);
-       return ANSC_STATUS_SUCCESS;
-    }
-    else
+    hal_param_t req_param;
+
+    for (; *ppParams != NULL; ppParams++)
     {
-       CcspTraceError(("Failed to retrieve XTSE\n"));
-       return ANSC_STATUS_FAILURE;
+        memset(&req_param, 0, sizeof(req_param));
+        snprintf(req_param.name, sizeof(req_param.name), XDSL_LINE_INFO_PARAM, lineNo, *ppParams);
+        if (json_hal_add_param(jmsg, GET_REQUEST_MESSAGE, &req_param) != RETURN_OK)
+        {
+            return RETURN_ERR;
+        }
     }
+
+    return RETURN_OK;
 }
 
 /* xdsl_hal_dslGetLineInfo() */
 int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo)
+{
+    return xdsl_hal_dslGetLineInfoTiers(lineNo, pstLineInfo, XDSL_LINE_INFO_TIER_ALL);
+}
+
+/* xdsl_hal_dslGetLineInfoTiers() */
+int xdsl_hal_dslGetLineInfoTiers(int lineNo, PDML_XDSL_LINE pstLineInfo, unsigned int tiers)
 {
     int rc = RETURN_OK;
     char xtseBuf[17]    = { 0 };
@@ -741,15 +777,36 @@ int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo)
     jmsg = json_hal_client_get_request_header(RPC_GET_PARAMETERS_REQUEST);
     CHECK(jmsg);
 
-    snprintf(req_param.name, sizeof(req_param.name), XDSL_LINE_INFO, lineNo);
-    if(json_hal_add_param(jmsg, GET_REQUEST_MESSAGE, &req_param) != RETURN_OK)
+    if ((tiers & XDSL_LINE_INFO_TIER_ALL) == XDSL_LINE_INFO_TIER_ALL)
+    {
+        //Whole subtree in one partial path request
+        snprintf(req_param.name, sizeof(req_param.name), XDSL_LINE_INFO, lineNo);
+        rc = json_hal_add_param(jmsg, GET_REQUEST_MESSAGE, &req_param);
+    }
+    else
+    {
+        if ((rc == RETURN_OK) && (tiers & XDSL_LINE_INFO_TIER_STATIC))
+        {
+            rc = xdsl_hal_addLineInfoParams(jmsg, lineNo, g_LineInfoStaticParams);
+        }
+        if ((rc == RETURN_OK) && (tiers & XDSL_LINE_INFO_TIER_SHOWTIME))
+        {
+            rc = xdsl_hal_addLineInfoParams(jmsg, lineNo, g_LineInfoShowtimeParams);
+        }
+        if ((rc == RETURN_OK) && (tiers & XDSL_LINE_INFO_TIER_LIVE))
+        {
+            rc = xdsl_hal_addLineInfoParams(jmsg, lineNo, g_LineInfoLiveParams);
+        }
+    }
+
+    if(rc != RETURN_OK)
     {
         FREE_JSON_OBJECT(jmsg);
         return RETURN_ERR;
     }
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
-    if (json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK )
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_LINE_INFO, jmsg, &jreply_msg) != RETURN_OK )
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -788,61 +845,11 @@ int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo)
              */
             if (strstr(resp_param.name, "Link"))
             {
-                if (strcmp(resp_param.value, "Up") == 0)
-                {
-                    pstLineInfo->LinkStatus = XDSL_LINK_STATUS_Up;
-                }
-                else if (strcmp(resp_param.value, "Initializing") == 0)
-                {
-                    pstLineInfo->LinkStatus = XDSL_LINK_STATUS_Initializing;
-                }
-                else if (strcmp(resp_param.value, "EstablishingLink") == 0)
-                {
-                    pstLineInfo->LinkStatus = XDSL_LINK_STATUS_EstablishingLink;
-                }
-                else if (strcmp(resp_param.value, "NoSignal") == 0)
-                {
-                    pstLineInfo->LinkStatus = XDSL_LINK_STATUS_NoSignal;
-                }
-                else if (strcmp(resp_param.value, "Disabled") == 0)
-                {
-                    pstLineInfo->LinkStatus = XDSL_LINK_STATUS_Disabled;
-                }
-                else if (strcmp(resp_param.value, "Error") == 0)
-                {
-                    pstLineInfo->LinkStatus = XDSL_LINK_STATUS_Error;
-                }
+                xdsl_hal_parseLinkStatus(resp_param.value, &pstLineInfo->LinkStatus);
             }
             else //IfStatus
             {
-                if (strcmp(resp_param.value, "Up") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_Up;
-                }
-                else if (strcmp(resp_param.value, "Down") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_Down;
-                }
-                else if (strcmp(resp_param.value, "Unknown") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_Unknown;
-                }
-                else if (strcmp(resp_param.value, "Dormant") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_Dormant;
-                }
-                else if (strcmp(resp_param.value, "NotPresent") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_NotPresent;
-                }
-                else if (strcmp(resp_param.value, "LowerLayerDown") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_LowerLayerDown;
-                }
-                else if (strcmp(resp_param.value, "Error") == 0)
-                {
-                    pstLineInfo->Status = XDSL_IF_STATUS_Error;
-                }
+                xdsl_hal_parseIfStatus(resp_param.value, &pstLineInfo->Status);
             }
         }
         else if (strstr (resp_param.name, "LastChange")) {
@@ -1023,7 +1030,7 @@ int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo)
     {
        if(strlen(pstLineInfo->StandardsSupported) != 0)
        {
-         if(xdsl_hal_setXtse(pstLineInfo->StandardsSupported, &xtseBuf, sizeof(xtseBuf)) == ANSC_STATUS_SUCCESS)
+         if(XdslLinePolicyStandardsToXtse(pstLineInfo->StandardsSupported, xtseBuf, sizeof(xtseBuf)) == ANSC_STATUS_SUCCESS)
          {
             snprintf(pstLineInfo->XTSE, sizeof(pstLineInfo->XTSE), "%s", xtseBuf);
          }
@@ -1034,7 +1041,7 @@ int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo)
     {
        if(strlen(pstLineInfo->StandardUsed) != 0)
        {
-         if(xdsl_hal_setXtsUsed(pstLineInfo->StandardUsed, &xtsUsedBuf, sizeof(xtsUsedBuf)) == ANSC_STATUS_SUCCESS)
+         if(XdslLinePolicyStandardsToXtse(pstLineInfo->StandardUsed, xtsUsedBuf, sizeof(xtsUsedBuf)) == ANSC_STATUS_SUCCESS)
          {
             snprintf(pstLineInfo->XTSUsed, sizeof(pstLineInfo->XTSUsed), "%s", xtsUsedBuf);
          }
@@ -1047,6 +1054,116 @@ int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo)
     return rc;
 }
 
+/* xdsl_hal_dslGetLineLive() */
+int xdsl_hal_dslGetLineLive(int lineNo, PDML_XDSL_LINE_LIVE pstLineLive)
+{
+    hal_param_t resp_param;
+    const char *leaf = NULL;
+    int total_param_count = 0;
+
+    json_object *jmsg = NULL;
+    json_object *jreply_msg = NULL;
+    json_object *jparams = NULL;
+
+    if (pstLineLive == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    jmsg = json_hal_client_get_request_header(RPC_GET_PARAMETERS_REQUEST);
+    if (jmsg == NULL)
+    {
+        return RETURN_ERR;
+    }
+
+    if (xdsl_hal_addLineInfoParams(jmsg, lineNo, g_LineLiveParams) != RETURN_OK)
+    {
+        FREE_JSON_OBJECT(jmsg);
+        return RETURN_ERR;
+    }
+
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_LINE_INFO, jmsg, &jreply_msg) != RETURN_OK)
+    {
+        CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
+        FREE_JSON_OBJECT(jmsg);
+        FREE_JSON_OBJECT(jreply_msg);
+        return RETURN_ERR;
+    }
+
+    if ((jreply_msg == NULL) || !json_object_object_get_ex(jreply_msg, JSON_RPC_FIELD_PARAMS, &jparams))
+    {
+        FREE_JSON_OBJECT(jmsg);
+        FREE_JSON_OBJECT(jreply_msg);
+        return RETURN_ERR;
+    }
+
+    memset(pstLineLive, 0, sizeof(DML_XDSL_LINE_LIVE));
+    total_param_count = json_object_array_length(jparams);
+
+    for (int index = 0; index < total_param_count; index++)
+    {
+        memset(&resp_param, 0, sizeof(resp_param));
+        if (json_hal_get_param(jreply_msg, index, GET_RESPONSE_MESSAGE, &resp_param) != RETURN_OK)
+        {
+            CcspTraceError(("%s - %d Failed to get required params from the response message \n", __FUNCTION__, __LINE__));
+            FREE_JSON_OBJECT(jmsg);
+            FREE_JSON_OBJECT(jreply_msg);
+            return RETURN_ERR;
+        }
+
+        leaf = strrchr(resp_param.name, '.');
+        leaf = (leaf != NULL) ? leaf + 1 : resp_param.name;
+
+        if (strcmp(leaf, "LinkStatus") == 0) {
+            xdsl_hal_parseLinkStatus(resp_param.value, &pstLineLive->LinkStatus);
+        }
+        else if (strcmp(leaf, "Status") == 0) {
+            xdsl_hal_parseIfStatus(resp_param.value, &pstLineLive->Status);
+        }
+        else if (strcmp(leaf, "LastChange") == 0) {
+            pstLineLive->LastChange = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "PowerManagementState") == 0) {
+            pstLineLive->PowerManagementState = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "UpstreamMaxBitRate") == 0) {
+            pstLineLive->UpstreamMaxBitRate = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "DownstreamMaxBitRate") == 0) {
+            pstLineLive->DownstreamMaxBitRate = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "UpstreamAttenuation") == 0) {
+            pstLineLive->UpstreamAttenuation = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "DownstreamAttenuation") == 0) {
+            pstLineLive->DownstreamAttenuation = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "UpstreamNoiseMargin") == 0) {
+            pstLineLive->UpstreamNoiseMargin = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "DownstreamNoiseMargin") == 0) {
+            pstLineLive->DownstreamNoiseMargin = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "UpstreamPower") == 0) {
+            pstLineLive->UpstreamPower = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "DownstreamPower") == 0) {
+            pstLineLive->DownstreamPower = atoi(resp_param.value);
+        }
+        else if (strcmp(leaf, "StandardUsed") == 0) {
+            snprintf(pstLineLive->StandardUsed, sizeof(pstLineLive->StandardUsed), "%s", resp_param.value);
+        }
+        else if (strcmp(leaf, "CurrentProfile") == 0) {
+            snprintf(pstLineLive->CurrentProfile, sizeof(pstLineLive->CurrentProfile), "%s", resp_param.value);
+        }
+    }
+
+    FREE_JSON_OBJECT(jmsg);
+    FREE_JSON_OBJECT(jreply_msg);
+
+    return RETURN_OK;
+}
+
 static void *eventcb(const char *msg, const int len)
 {
     json_object *msg_param = NULL;
@@ -1106,7 +1223,17 @@ static void *eventcb(const char *msg, const int len)
             if ( strncmp(event_val, "up", 2) == 0 )
             {
                 link_status = LINK_UP;
-                g_successful_retrains = g_successful_retrains + 1;
+                //The first showtime after start is the initial training, not a retrain
+                if (__atomic_exchange_n(&g_first_up_seen, 1, __ATOMIC_SEQ_CST))
+                {
+                    pthread_mutex_lock(&g_retrains_day_mutex);
+                    XdslPmStoreSetCounter(0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS,
+                                          __atomic_add_fetch(&g_successful_retrains, 1, __ATOMIC_SEQ_CST));
+                    XdslPmStoreSetCounter(0, XDSL_PM_STORE_COUNTER_DAY_START, (int)g_retrains_day_start);
+                    pthread_mutex_unlock(&g_retrains_day_mutex);
+                    XdslPmStoreSetCounter(0, XDSL_PM_STORE_COUNTER_LIFETIME_RETRAINS,
+                                          __atomic_add_fetch(&g_lifetime_retrains, 1, __ATOMIC_SEQ_CST));
+                }
             }
             else if ( strncmp(event_val,"training",8) == 0 )
             {
@@ -1158,7 +1285,7 @@ int xdsl_hal_dslGetLineStats(int lineNo, PDML_XDSL_LINE_STATS pstLineStats)
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_LINE_STATS, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceInfo(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -1274,7 +1401,7 @@ int xdsl_hal_dslGetLineStats(int lineNo, PDML_XDSL_LINE_STATS pstLineStats)
             pstLineStats->stCurrentDay.X_RDK_InitTimeouts = atoi(resp_param.value);
         }
         else if (strstr (resp_param.name, "Stats.CurrentDay.X_RDK_SuccessfulRetrains")) {
-            pstLineStats->stCurrentDay.X_RDK_SuccessfulRetrains = g_successful_retrains;
+            //Counted from the link events, filled in below
         }
         else if (strstr (resp_param.name, "Stats.QuarterHour.ErroredSecs")) {
             pstLineStats->stQuarterHour.ErroredSecs = atoi(resp_param.value);
@@ -1284,6 +1411,24 @@ int xdsl_hal_dslGetLineStats(int lineNo, PDML_XDSL_LINE_STATS pstLineStats)
         }
     }
 
+    //The link events are those of the first line
+    if (lineNo == 0)
+    {
+        pthread_mutex_lock(&g_retrains_day_mutex);
+        if (pstLineStats->CurrentDayStart < g_retrains_day_start)
+        {
+            //The driver started a new day
+            __atomic_store_n(&g_successful_retrains, 0, __ATOMIC_SEQ_CST);
+            XdslPmStoreSetCounter(0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, 0);
+            XdslPmStoreSetCounter(0, XDSL_PM_STORE_COUNTER_DAY_START, (int)pstLineStats->CurrentDayStart);
+        }
+        g_retrains_day_start = pstLineStats->CurrentDayStart;
+        pthread_mutex_unlock(&g_retrains_day_mutex);
+
+        pstLineStats->stCurrentDay.X_RDK_SuccessfulRetrains = __atomic_load_n(&g_successful_retrains, __ATOMIC_SEQ_CST);
+        pstLineStats->X_RDK_LifetimeSuccessfulRetrains      = __atomic_load_n(&g_lifetime_retrains, __ATOMIC_SEQ_CST);
+    }
+
     // Free json objects
     FREE_JSON_OBJECT(jmsg);
     FREE_JSON_OBJECT(jreply_msg);
@@ -1326,7 +1471,7 @@ int xdsl_hal_dslGetChannelInfo(int lineNo, int channelNo, PDML_XDSL_CHANNEL pstC
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_CHANNEL_INFO, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -1477,7 +1622,7 @@ int xdsl_hal_dslGetChannelStats(int lineNo, int channelNo, PDML_XDSL_CHANNEL_STA
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK )
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_CHANNEL_STATS, jmsg, &jreply_msg) != RETURN_OK )
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -1698,7 +1843,7 @@ int xdsl_hal_dslGetXRdk_Nlm( PDML_XDSL_X_RDK_NLNM pstNlmInfo )
         return RETURN_ERR;
     }
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_NLM, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -1744,23 +1889,140 @@ int xdsl_hal_dslGetXRdk_Nlm( PDML_XDSL_X_RDK_NLNM pstNlmInfo )
 
     return rc;
 }
-static ANSC_STATUS configure_xdsl_driver()
+/* xdsl_hal_dslGetLineConfig() */
+static int xdsl_hal_dslGetLineConfig(char *allowedProfiles, int profilesLen, char *xtse, int xtseLen)
+{
+    int total_param_count = 0;
+    hal_param_t req_param;
+    hal_param_t resp_param;
+
+    json_object *jmsg = NULL;
+    json_object *jreply_msg = NULL;
+    json_object *jparams = NULL;
+
+    jmsg = json_hal_client_get_request_header(RPC_GET_PARAMETERS_REQUEST);
+    CHECK(jmsg);
+
+    //Both values in one request
+    memset(&req_param, 0, sizeof(req_param));
+    snprintf(req_param.name, sizeof(req_param.name), "%s", XDSL_LINE_PROFILE);
+    if (json_hal_add_param(jmsg, GET_REQUEST_MESSAGE, &req_param) != RETURN_OK)
+    {
+        FREE_JSON_OBJECT(jmsg);
+        return RETURN_ERR;
+    }
+
+    memset(&req_param, 0, sizeof(req_param));
+    snprintf(req_param.name, sizeof(req_param.name), "%s", XDSL_LINE_XTSE);
+    if (json_hal_add_param(jmsg, GET_REQUEST_MESSAGE, &req_param) != RETURN_OK)
+    {
+        FREE_JSON_OBJECT(jmsg);
+        return RETURN_ERR;
+    }
+
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_GET_LINE_INFO, jmsg, &jreply_msg) != RETURN_OK)
+    {
+        CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
+        FREE_JSON_OBJECT(jmsg);
+        FREE_JSON_OBJECT(jreply_msg);
+        return RETURN_ERR;
+    }
+
+    if (jreply_msg == NULL || !json_object_object_get_ex(jreply_msg, JSON_RPC_FIELD_PARAMS, &jparams) || jparams == NULL)
+    {
+        FREE_JSON_OBJECT(jmsg);
+        FREE_JSON_OBJECT(jreply_msg);
+        return RETURN_ERR;
+    }
+
+    total_param_count = json_object_array_length(jparams);
+    for (int index = 0; index < total_param_count; index++)
+    {
+        memset(&resp_param, 0, sizeof(resp_param));
+        if (json_hal_get_param(jreply_msg, index, GET_RESPONSE_MESSAGE, &resp_param) != RETURN_OK)
+        {
+            CcspTraceError(("%s - %d Failed to get required params from the response message \n", __FUNCTION__, __LINE__));
+            FREE_JSON_OBJECT(jmsg);
+            FREE_JSON_OBJECT(jreply_msg);
+            return RETURN_ERR;
+        }
+
+        if (strstr(resp_param.name, "AllowedProfiles"))
+        {
+            snprintf(allowedProfiles, profilesLen, "%s", resp_param.value);
+        }
+        else if (strstr(resp_param.name, "XTSE"))
+        {
+            snprintf(xtse, xtseLen, "%s", resp_param.value);
+        }
+    }
+
+    FREE_JSON_OBJECT(jmsg);
+    FREE_JSON_OBJECT(jreply_msg);
+
+    return RETURN_OK;
+}
+
+/* xdsl_hal_dslConfigureLine() */
+int xdsl_hal_dslConfigureLine(const char *allowedProfiles, const char *xtse, int *changed)
 {
     int rc = RETURN_OK;
+    int count = 0;
+    char currentProfiles[256] = { 0 };
+    char currentXtse[XDSL_LINE_POLICY_XTSE_LEN] = { 0 };
     json_object *jmsg = NULL;
     json_object *jreply_msg = NULL;
     json_bool status = FALSE;
+    hal_param_t req_msg;
+
+    if (changed != NULL)
+    {
+        *changed = 0;
+    }
+
+    //Unknown current configuration, apply everything
+    if (xdsl_hal_dslGetLineConfig(currentProfiles, sizeof(currentProfiles), currentXtse, sizeof(currentXtse)) != RETURN_OK)
+    {
+        CcspTraceWarning(("%s - %d Failed to read the line configuration from the driver\n", __FUNCTION__, __LINE__));
+        currentProfiles[0] = '\0';
+        currentXtse[0] = '\0';
+    }
 
     jmsg = json_hal_client_get_request_header(RPC_SET_PARAMETERS_REQUEST);
     CHECK(jmsg);
-    hal_param_t req_msg;
-    memset(&req_msg, 0,sizeof(req_msg));
-    strncpy(req_msg.name, XDSL_LINE_PROFILE, sizeof(req_msg.name));
-    req_msg.type = PARAM_STRING;
-    snprintf(req_msg.value, sizeof(req_msg.value), "%s,%s,%s,%s", "8b", "12a", "17a", "35b");
-    json_hal_add_param(jmsg, SET_REQUEST_MESSAGE, &req_msg);
+
+    //Every set retrains the line, only send what differs
+    if (allowedProfiles != NULL && allowedProfiles[0] != '\0' && !XdslLinePolicyProfilesEqual(allowedProfiles, currentProfiles))
+    {
+        memset(&req_msg, 0, sizeof(req_msg));
+        snprintf(req_msg.name, sizeof(req_msg.name), "%s", XDSL_LINE_PROFILE);
+        snprintf(req_msg.value, sizeof(req_msg.value), "%s", allowedProfiles);
+        req_msg.type = PARAM_STRING;
+        json_hal_add_param(jmsg, SET_REQUEST_MESSAGE, &req_msg);
+        CcspTraceInfo(("%s - %d AllowedProfiles [%s] -> [%s]\n", __FUNCTION__, __LINE__, currentProfiles, allowedProfiles));
+        count++;
+    }
+
+    if (xtse != NULL && xtse[0] != '\0' && strcasecmp(xtse, currentXtse) != 0)
+    {
+        memset(&req_msg, 0, sizeof(req_msg));
+        snprintf(req_msg.name, sizeof(req_msg.name), "%s", XDSL_LINE_XTSE);
+        snprintf(req_msg.value, sizeof(req_msg.value), "%s", xtse);
+        req_msg.type = PARAM_STRING;
+        json_hal_add_param(jmsg, SET_REQUEST_MESSAGE, &req_msg);
+        CcspTraceInfo(("%s - %d XTSE [%s] -> [%s]\n", __FUNCTION__, __LINE__, currentXtse, xtse));
+        count++;
+    }
+
+    if (count == 0)
+    {
+        CcspTraceInfo(("%s - %d Driver already matches the line policy, nothing to set\n", __FUNCTION__, __LINE__));
+        FREE_JSON_OBJECT(jmsg);
+        return RETURN_OK;
+    }
+
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
-    if (json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_DSL_CONFIGURE_DRIVER, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -1774,6 +2036,10 @@ static ANSC_STATUS configure_xdsl_driver()
         if (status)
         {
             CcspTraceInfo(("%s - %d configure request is successful ", __FUNCTION__, __LINE__));
+            if (changed != NULL)
+            {
+                *changed = count;
+            }
             rc = RETURN_OK;
         }
         else
@@ -1810,7 +2076,7 @@ ANSC_STATUS xtm_hal_setLinkInfoParam(hal_param_t *set_param)
     jrequest = create_json_request_message(SET_REQUEST_MESSAGE, set_param->name, set_param->type, set_param->value);
     CHECK(jrequest != NULL);
 
-    if (json_hal_client_send_and_get_reply(jrequest, &jreply_msg) == RETURN_ERR)
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_XTM_SET_LINK_INFO, jrequest, &jreply_msg) == RETURN_ERR)
     {
         CcspTraceError(("%s - %d Failed to get reply for the json request \n", __FUNCTION__, __LINE__));
         return rc;
@@ -1881,7 +2147,7 @@ ANSC_STATUS xtm_hal_getLinkStats(const CHAR *param_name, PDML_PTM_STATS link_sta
     json_object *jrequest = create_json_request_message(GET_REQUEST_MESSAGE, param_name, NULL_TYPE , NULL);
     CHECK(jrequest != NULL);
 
-    if (json_hal_client_send_and_get_reply(jrequest, &jreply_msg) == RETURN_ERR)
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_XTM_GET_LINK_STATS, jrequest, &jreply_msg) == RETURN_ERR)
     {
         CcspTraceError(("%s - %d Failed to get reply for the json request \n", __FUNCTION__, __LINE__));
         return ANSC_STATUS_FAILURE;
@@ -1922,7 +2188,7 @@ static ANSC_STATUS get_link_info(hal_param_t *get_param)
 
     CcspTraceInfo(("%s - %d Json request message = %s \n", __FUNCTION__, __LINE__, json_object_to_json_string_ext(jrequest, JSON_C_TO_STRING_PRETTY)));
 
-    if (json_hal_client_send_and_get_reply(jrequest, &jreply_msg) == RETURN_ERR)
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_XTM_GET_LINK_INFO, jrequest, &jreply_msg) == RETURN_ERR)
     {
         CcspTraceError(("%s - %d Failed to get reply for the json request \n", __FUNCTION__, __LINE__));
         return rc;
@@ -2253,7 +2519,7 @@ ANSC_STATUS atm_hal_setLinkInfoParam(PDML_ATM config)
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_ATM_SET_LINK_INFO, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -2329,16 +2595,35 @@ static ANSC_STATUS getDestinationAddress(char *Interface, char *DestinationAddre
 }
 
 ANSC_STATUS atm_hal_startAtmLoopbackDiagnostics(PDML_ATM_DIAG pDiag)
+{
+    char DestinationAddress[128] = {'\0'};
+
+    if (NULL == pDiag)
+    {
+        CcspTraceError(("Error: Invalid arguement \n"));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    /* Get the destination address of the given interface */
+    if ( getDestinationAddress(pDiag->Interface, DestinationAddress) == RETURN_ERR)
+    {
+        CcspTraceError(("Error: getDestinationAddress failed \n"));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return atm_hal_startAtmLoopbackDiagnosticsOnPvc(pDiag, DestinationAddress);
+}
+
+ANSC_STATUS atm_hal_startAtmLoopbackDiagnosticsOnPvc(PDML_ATM_DIAG pDiag, const char *DestinationAddress)
 {
     json_object *jmsg = NULL;
     json_object *jreply_msg = NULL;
     json_bool status = FALSE;
     hal_param_t param;
     int total_param_count = 0;
-    char DestinationAddress[128] = {'\0'};
     int index = 0;
     
-    if (NULL == pDiag)
+    if (NULL == pDiag || NULL == DestinationAddress)
     {
         CcspTraceError(("Error: Invalid arguement \n"));
         return ANSC_STATUS_FAILURE;
@@ -2353,14 +2638,6 @@ ANSC_STATUS atm_hal_startAtmLoopbackDiagnostics(PDML_ATM_DIAG pDiag)
     param.type = PARAM_STRING;
     json_hal_add_param(jmsg, SET_REQUEST_MESSAGE, &param);
 
-    /* Get the destination address of the given interface */
-    if ( getDestinationAddress(pDiag->Interface, DestinationAddress) == RETURN_ERR)
-    {
-        CcspTraceError(("Error: getDestinationAddress failed \n"));
-        FREE_JSON_OBJECT(jmsg);
-        return ANSC_STATUS_FAILURE;
-    }
-
     sscanf(pDiag->Interface, "%*[^0-9]%d", &index);
 
     memset(&param, 0, sizeof(param));
@@ -2394,7 +2671,7 @@ ANSC_STATUS atm_hal_startAtmLoopbackDiagnostics(PDML_ATM_DIAG pDiag)
 
     CcspTraceInfo(("JSON Request message = %s \n", json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if( json_hal_client_send_and_get_reply(jmsg, &jreply_msg) != RETURN_OK)
+    if( xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_ATM_LOOPBACK_DIAGNOSTICS, jmsg, &jreply_msg) != RETURN_OK)
     {
         CcspTraceError(("[%s][%d] RPC message failed \n", __FUNCTION__, __LINE__));
         FREE_JSON_OBJECT(jmsg);
@@ -2427,7 +2704,7 @@ ANSC_STATUS atm_hal_startAtmLoopbackDiagnostics(PDML_ATM_DIAG pDiag)
 
     CcspTraceInfo(("%s - %d Json request message = %s \n", __FUNCTION__, __LINE__, json_object_to_json_string_ext(jmsg, JSON_C_TO_STRING_PRETTY)));
 
-    if (json_hal_client_send_and_get_reply(jmsg, &jreply_msg) == RETURN_ERR)
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_ATM_LOOPBACK_DIAGNOSTICS, jmsg, &jreply_msg) == RETURN_ERR)
     {
         CcspTraceError(("%s - %d Failed to get reply for the json request \n", __FUNCTION__, __LINE__));
         return ANSC_STATUS_FAILURE;
@@ -2519,7 +2796,7 @@ ANSC_STATUS atm_hal_getLinkStats(const CHAR *param_name, PDML_ATM_STATS link_sta
     json_object *jrequest = create_json_request_message(GET_REQUEST_MESSAGE, param_name, NULL_TYPE , NULL);
     CHECK(jrequest != NULL);
 
-    if (json_hal_client_send_and_get_reply(jrequest, &jreply_msg) == RETURN_ERR)
+    if (xdsl_hal_send_and_get_reply(XDSL_HAL_PERF_ATM_GET_LINK_STATS, jrequest, &jreply_msg) == RETURN_ERR)
     {
         CcspTraceError(("%s - %d Failed to get reply for the json request \n", __FUNCTION__, __LINE__));
         return ANSC_STATUS_FAILURE;
@@ -46,6 +46,16 @@ typedef enum _DslLinkStatus_t {
     LINK_ERROR
 }DslLinkStatus_t;
 
+/*
+ * Line attribute tiers for xdsl_hal_dslGetLineInfoTiers(). Static attributes
+ * describe the CPE modem itself, per-showtime attributes are negotiated during
+ * training and only change on a retrain, live attributes move during showtime.
+ */
+#define XDSL_LINE_INFO_TIER_STATIC      0x01
+#define XDSL_LINE_INFO_TIER_SHOWTIME    0x02
+#define XDSL_LINE_INFO_TIER_LIVE        0x04
+#define XDSL_LINE_INFO_TIER_ALL         ( XDSL_LINE_INFO_TIER_STATIC | XDSL_LINE_INFO_TIER_SHOWTIME | XDSL_LINE_INFO_TIER_LIVE )
+
 enum dsl_xtse_bit {
         /* Octet 1 - ADSL */
         T1_413                                  = 1,
@@ -181,6 +191,30 @@ int xdsl_hal_dslSetLineEnable( hal_param_t *req_msg );
  */
 int xdsl_hal_dslSetLineEnableDataGathering( hal_param_t *req_msg );
 
+/**
+ * This function sets several DSL line parameters in a single request, the
+ * HAL applies all of them or none.
+ *
+ * @param[in] req_msgs - parameters to set
+ * @param[in] count    - number of entries in req_msgs
+ *
+ * @return 0 on success. Otherwise a negative value is returned
+ */
+int xdsl_hal_dslSetLineParams( hal_param_t *req_msgs, int count );
+
+/**
+ * This function applies AllowedProfiles and XTSE to the DSL driver. The current
+ * driver values are read first and only the ones that differ are set, since
+ * every change retrains the line.
+ *
+ * @param[in] allowedProfiles - comma separated VDSL2 profiles, NULL or empty to leave unchanged
+ * @param[in] xtse            - XTSE as 16 hex digits, NULL or empty to leave unchanged
+ * @param[out] changed        - number of values that were set, may be NULL
+ *
+ * @return 0 on success. Otherwise a negative value is returned
+ */
+int xdsl_hal_dslConfigureLine( const char *allowedProfiles, const char *xtse, int *changed );
+
 /**
  * This function gets the number of DSL lines
  *
@@ -208,6 +242,28 @@ int xdsl_hal_getTotalNoOfChannels(int lineNo);
  */
 int xdsl_hal_dslGetLineInfo(int lineNo, PDML_XDSL_LINE pstLineInfo);
 
+/**
+ * This function gets the DSL line attributes of the given tiers only,
+ * fields of the other tiers are left untouched
+ *
+ * @param[in] lineNo - The line number which starts with 0
+ * @param[out] lineInfo - The output parameter to receive the data
+ * @param[in] tiers - Mask of XDSL_LINE_INFO_TIER_* values
+ *
+ * @return 0 on success. Otherwise a negative value is returned
+ */
+int xdsl_hal_dslGetLineInfoTiers(int lineNo, PDML_XDSL_LINE pstLineInfo, unsigned int tiers);
+
+/**
+ * This function gets the live state and the negotiated mode of a DSL line
+ *
+ * @param[in] lineNo - The line number which starts with 0
+ * @param[out] pstLineLive - The output parameter to receive the data
+ *
+ * @return 0 on success. Otherwise a negative value is returned
+ */
+int xdsl_hal_dslGetLineLive(int lineNo, PDML_XDSL_LINE_LIVE pstLineLive);
+
 /**
  * This function gets the statistics counters of a DSL line
  *
@@ -343,5 +399,21 @@ ANSC_STATUS atm_hal_setLinkInfoParam (PDML_ATM link);
 */
 ANSC_STATUS atm_hal_getLinkStats(const CHAR *param_name, PDML_ATM_STATS link_stats);
 
+/**
+* @brief Run an ATM F5 loopback on the given PVC of an ATM link
+*
+* Same as atm_hal_startAtmLoopbackDiagnostics() except that the PVC is passed
+* in instead of being taken from the link, so candidates can be probed
+* before the link is configured with one of them.
+*
+* @param Structure pointer holding the diagnostics request, filled with the result
+* @param PVC in the form "PVC: VPI/VCI"
+*
+* @return The status of the operation
+* @retval ANSC_STATUS_SUCCESS if successful
+* @retval ANSC_STATUS_FAILURE if any error is detected
+*/
+ANSC_STATUS atm_hal_startAtmLoopbackDiagnosticsOnPvc(PDML_ATM_DIAG pDiag, const char *DestinationAddress);
+
 
 #endif /* _XDSL_JSON_APIS_H */
@@ -0,0 +1,346 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_hal_perf.c
+    For CCSP Component:  dsl hal instrumentation
+
+---------------------------------------------------------------
+
+    Description:
+
+    Per entry point call, error, timeout, byte and latency counters for
+    the JSON HAL client calls, plus hit/miss counters of the callers that
+    memoize a HAL reply. Counters are updated with relaxed atomics so the
+    recording path never takes a lock. A dump requested from a signal
+    handler only writes a byte to a pipe; a dump thread blocked on the
+    other end writes the statistics file.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <pthread.h>
+#include "xdsl_hal_perf.h"
+
+typedef struct
+_XDSL_HAL_PERF_COUNTERS
+{
+    ULONG               Calls;
+    ULONG               Errors;
+    ULONG               Timeouts;
+    ULONGLONG           BytesSent;
+    ULONGLONG           BytesReceived;
+    ULONGLONG           TotalLatency;
+    ULONG               MaxLatency;
+    ULONG               Histogram[XDSL_HAL_PERF_BUCKETS];
+    ULONG               CacheHits;
+    ULONG               CacheMisses;
+} XDSL_HAL_PERF_COUNTERS;
+
+static const char *g_HalPerfNames[XDSL_HAL_PERF_MAX] =
+{
+    "xdsl_hal_dslGetLineEnable",
+    "xdsl_hal_dslGetLineStandardUsed",
+    "xdsl_hal_dslSetLineEnable",
+    "xdsl_hal_dslSetLineEnableDataGathering",
+    "xdsl_hal_dslGetLineInfo",
+    "xdsl_hal_dslGetLineStats",
+    "xdsl_hal_dslGetChannelInfo",
+    "xdsl_hal_dslGetChannelStats",
+    "xdsl_hal_dslGetXRDK_NLM",
+    "xdsl_hal_dslConfigureLine",
+    "xtm_hal_setLinkInfoParam",
+    "xtm_hal_getLinkInfoParam",
+    "xtm_hal_getLinkStats",
+    "atm_hal_setLinkInfoParam",
+    "atm_hal_startAtmLoopbackDiagnostics",
+    "atm_hal_getLinkStats",
+    "xdsl_hal_dslSetLineParams"
+};
+
+static XDSL_HAL_PERF_COUNTERS g_HalPerf[XDSL_HAL_PERF_MAX];
+static BOOL g_HalPerfEnable = TRUE;
+static BOOL g_HalPerfByteCounting = FALSE;
+static int g_HalPerfDumpPipe[2] = { -1, -1 };
+
+BOOL XdslHalPerfIsEnabled( VOID )
+{
+    return __atomic_load_n(&g_HalPerfEnable, __ATOMIC_RELAXED);
+}
+
+VOID XdslHalPerfSetEnable( BOOL bEnable )
+{
+    __atomic_store_n(&g_HalPerfEnable, bEnable, __ATOMIC_RELAXED);
+}
+
+BOOL XdslHalPerfIsByteCountingEnabled( VOID )
+{
+    return __atomic_load_n(&g_HalPerfByteCounting, __ATOMIC_RELAXED);
+}
+
+VOID XdslHalPerfSetByteCounting( BOOL bEnable )
+{
+    __atomic_store_n(&g_HalPerfByteCounting, bEnable, __ATOMIC_RELAXED);
+}
+
+static int XdslHalPerfBucket( ULONG ulLatencyUsec )
+{
+    int bucket = 0;
+
+    while( (ulLatencyUsec >>= 1) != 0 && bucket < (XDSL_HAL_PERF_BUCKETS - 1) )
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+VOID XdslHalPerfRecord( XDSL_HAL_PERF_ID id, ULONG ulLatencyUsec, XDSL_HAL_PERF_RESULT result, size_t bytesSent, size_t bytesReceived )
+{
+    XDSL_HAL_PERF_COUNTERS *pCounters = NULL;
+    ULONG ulMax = 0;
+
+    if( id >= XDSL_HAL_PERF_MAX )
+    {
+        return;
+    }
+
+    pCounters = &g_HalPerf[id];
+
+    __atomic_fetch_add(&pCounters->Calls, 1, __ATOMIC_RELAXED);
+    if( result == XDSL_HAL_PERF_RESULT_ERROR )
+    {
+        __atomic_fetch_add(&pCounters->Errors, 1, __ATOMIC_RELAXED);
+    }
+    else if( result == XDSL_HAL_PERF_RESULT_TIMEOUT )
+    {
+        __atomic_fetch_add(&pCounters->Timeouts, 1, __ATOMIC_RELAXED);
+    }
+
+    if( bytesSent > 0 )
+    {
+        __atomic_fetch_add(&pCounters->BytesSent, bytesSent, __ATOMIC_RELAXED);
+    }
+    if( bytesReceived > 0 )
+    {
+        __atomic_fetch_add(&pCounters->BytesReceived, bytesReceived, __ATOMIC_RELAXED);
+    }
+
+    __atomic_fetch_add(&pCounters->TotalLatency, ulLatencyUsec, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pCounters->Histogram[XdslHalPerfBucket(ulLatencyUsec)], 1, __ATOMIC_RELAXED);
+
+    ulMax = __atomic_load_n(&pCounters->MaxLatency, __ATOMIC_RELAXED);
+    while( ulLatencyUsec > ulMax &&
+           !__atomic_compare_exchange_n(&pCounters->MaxLatency, &ulMax, ulLatencyUsec, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED) )
+    {
+        ;
+    }
+}
+
+VOID XdslHalPerfRecordCache( XDSL_HAL_PERF_ID id, BOOL bHit )
+{
+    if( id >= XDSL_HAL_PERF_MAX )
+    {
+        return;
+    }
+
+    if( bHit )
+    {
+        __atomic_fetch_add(&g_HalPerf[id].CacheHits, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        __atomic_fetch_add(&g_HalPerf[id].CacheMisses, 1, __ATOMIC_RELAXED);
+    }
+}
+
+ANSC_STATUS XdslHalPerfGetStats( XDSL_HAL_PERF_ID id, PDML_XDSL_HAL_PERF pstPerf )
+{
+    XDSL_HAL_PERF_COUNTERS *pCounters = NULL;
+    int i;
+
+    if( id >= XDSL_HAL_PERF_MAX || pstPerf == NULL )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pCounters = &g_HalPerf[id];
+
+    memset(pstPerf, 0, sizeof(DML_XDSL_HAL_PERF));
+    snprintf(pstPerf->Name, sizeof(pstPerf->Name), "%s", g_HalPerfNames[id]);
+    pstPerf->Calls         = __atomic_load_n(&pCounters->Calls, __ATOMIC_RELAXED);
+    pstPerf->Errors        = __atomic_load_n(&pCounters->Errors, __ATOMIC_RELAXED);
+    pstPerf->Timeouts      = __atomic_load_n(&pCounters->Timeouts, __ATOMIC_RELAXED);
+    pstPerf->BytesSent     = __atomic_load_n(&pCounters->BytesSent, __ATOMIC_RELAXED);
+    pstPerf->BytesReceived = __atomic_load_n(&pCounters->BytesReceived, __ATOMIC_RELAXED);
+    pstPerf->TotalLatency  = __atomic_load_n(&pCounters->TotalLatency, __ATOMIC_RELAXED);
+    pstPerf->MaxLatency    = __atomic_load_n(&pCounters->MaxLatency, __ATOMIC_RELAXED);
+    pstPerf->CacheHits     = __atomic_load_n(&pCounters->CacheHits, __ATOMIC_RELAXED);
+    pstPerf->CacheMisses   = __atomic_load_n(&pCounters->CacheMisses, __ATOMIC_RELAXED);
+    for( i = 0; i < XDSL_HAL_PERF_BUCKETS; i++ )
+    {
+        pstPerf->Histogram[i] = __atomic_load_n(&pCounters->Histogram[i], __ATOMIC_RELAXED);
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+VOID XdslHalPerfReset( VOID )
+{
+    int id, i;
+
+    for( id = 0; id < XDSL_HAL_PERF_MAX; id++ )
+    {
+        XDSL_HAL_PERF_COUNTERS *pCounters = &g_HalPerf[id];
+
+        __atomic_store_n(&pCounters->Calls, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->Errors, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->Timeouts, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->BytesSent, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->BytesReceived, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->TotalLatency, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->MaxLatency, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->CacheHits, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&pCounters->CacheMisses, 0, __ATOMIC_RELAXED);
+        for( i = 0; i < XDSL_HAL_PERF_BUCKETS; i++ )
+        {
+            __atomic_store_n(&pCounters->Histogram[i], 0, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+VOID XdslHalPerfDump( VOID )
+{
+    DML_XDSL_HAL_PERF stPerf;
+    FILE *fp = NULL;
+    int id, i;
+
+    fp = fopen(XDSL_HAL_PERF_DUMP_FILE, "w");
+    if( fp == NULL )
+    {
+        CcspTraceError(("%s - Failed to open %s\n", __FUNCTION__, XDSL_HAL_PERF_DUMP_FILE));
+        return;
+    }
+
+    fprintf(fp, "%-40s %10s %8s %8s %12s %12s %10s %10s %10s %10s  histogram(log2 us)\n",
+            "entry", "calls", "errors", "timeouts", "tx_bytes", "rx_bytes", "avg_us", "max_us", "cache_hit", "cache_miss");
+
+    for( id = 0; id < XDSL_HAL_PERF_MAX; id++ )
+    {
+        if( XdslHalPerfGetStats(id, &stPerf) != ANSC_STATUS_SUCCESS )
+        {
+            continue;
+        }
+
+        fprintf(fp, "%-40s %10lu %8lu %8lu %12llu %12llu %10llu %10lu %10lu %10lu ",
+                stPerf.Name, stPerf.Calls, stPerf.Errors, stPerf.Timeouts,
+                stPerf.BytesSent, stPerf.BytesReceived,
+                (stPerf.Calls > 0) ? (stPerf.TotalLatency / stPerf.Calls) : 0ULL,
+                stPerf.MaxLatency, stPerf.CacheHits, stPerf.CacheMisses);
+        for( i = 0; i < XDSL_HAL_PERF_BUCKETS; i++ )
+        {
+            fprintf(fp, "%s%lu", (i == 0) ? " " : ",", stPerf.Histogram[i]);
+        }
+        fprintf(fp, "\n");
+    }
+
+    fclose(fp);
+    CcspTraceInfo(("%s - HAL call statistics written to %s\n", __FUNCTION__, XDSL_HAL_PERF_DUMP_FILE));
+}
+
+static void *XdslHalPerfDumpThread( void *arg )
+{
+    char requests[16];
+    ssize_t got;
+
+    pthread_detach(pthread_self());
+
+    while( 1 )
+    {
+        got = read(g_HalPerfDumpPipe[0], requests, sizeof(requests));
+        if( got < 0 && errno == EINTR )
+        {
+            continue;
+        }
+        if( got <= 0 )
+        {
+            break;
+        }
+
+        //Requests made while a dump is being written are folded into one
+        XdslHalPerfDump();
+    }
+
+    return NULL;
+}
+
+ANSC_STATUS XdslHalPerfDumpInit( VOID )
+{
+    pthread_t dumpThread;
+
+    if( g_HalPerfDumpPipe[1] >= 0 )
+    {
+        return ANSC_STATUS_SUCCESS;
+    }
+
+    if( pipe(g_HalPerfDumpPipe) != 0 )
+    {
+        CcspTraceError(("%s - Failed to create the dump pipe\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //A full pipe already has a dump pending, the signal handler must not block on it
+    fcntl(g_HalPerfDumpPipe[0], F_SETFD, FD_CLOEXEC);
+    fcntl(g_HalPerfDumpPipe[1], F_SETFD, FD_CLOEXEC);
+    fcntl(g_HalPerfDumpPipe[1], F_SETFL, O_NONBLOCK);
+
+    if( pthread_create(&dumpThread, NULL, XdslHalPerfDumpThread, NULL) != 0 )
+    {
+        CcspTraceError(("%s - Failed to start the dump thread\n", __FUNCTION__));
+        close(g_HalPerfDumpPipe[0]);
+        close(g_HalPerfDumpPipe[1]);
+        g_HalPerfDumpPipe[0] = g_HalPerfDumpPipe[1] = -1;
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+VOID XdslHalPerfRequestDump( VOID )
+{
+    int savedErrno = errno;
+    char request = 1;
+    ssize_t written;
+
+    //write() is async-signal-safe, nothing else is done here
+    if( g_HalPerfDumpPipe[1] >= 0 )
+    {
+        written = write(g_HalPerfDumpPipe[1], &request, sizeof(request));
+        (void)written;
+    }
+
+    errno = savedErrno;
+}
@@ -0,0 +1,331 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_instance_cache.c
+    For CCSP Component:  dsl cross component lookups
+
+---------------------------------------------------------------
+
+    Description:
+
+    Name to instance index of the WAN Manager, PTM, ATM and VLAN tables.
+    A table is loaded with one partial path get and then kept until this
+    component adds or deletes a row in it or a lookup finds it stale.
+    A hit costs a single get to confirm the row still carries the key,
+    a miss costs one reload of the table.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "xdsl_instance_cache.h"
+
+#define XDSL_INSTANCE_CACHE_KEY_LENGTH      256
+
+typedef  struct
+_XDSL_INSTANCE_TABLE_INFO
+{
+    const char          *pComponent;
+    const char          *pBus;
+    const char          *pPrefix;
+    const char          *pKeyParam;
+    const char          *pNoeParam;
+}
+XDSL_INSTANCE_TABLE_INFO;
+
+typedef  struct
+_XDSL_INSTANCE_CACHE_ENTRY
+{
+    INT                 iInstance;
+    CHAR                Key[XDSL_INSTANCE_CACHE_KEY_LENGTH];
+}
+XDSL_INSTANCE_CACHE_ENTRY;
+
+typedef  struct
+_XDSL_INSTANCE_CACHE_TABLE
+{
+    BOOL                        bValid;
+    UINT                        uGeneration;
+    INT                         iCount;
+    XDSL_INSTANCE_CACHE_ENTRY   astEntry[XDSL_INSTANCE_CACHE_MAX_ENTRIES];
+}
+XDSL_INSTANCE_CACHE_TABLE;
+
+static const XDSL_INSTANCE_TABLE_INFO g_InstanceTableInfo[XDSL_INSTANCE_TABLE_MAX] =
+{
+    { "eRT.com.cisco.spvtg.ccsp.wanmanager",  "/com/cisco/spvtg/ccsp/wanmanager",
+      "Device.X_RDK_WanManager.CPEInterface.", "Name", "Device.X_RDK_WanManager.CPEInterfaceNumberOfEntries" },
+    { "eRT.com.cisco.spvtg.ccsp.xdslmanager", "/com/cisco/spvtg/ccsp/xdslmanager",
+      "Device.PTM.Link.", "LowerLayers", "Device.PTM.LinkNumberOfEntries" },
+    { "eRT.com.cisco.spvtg.ccsp.xdslmanager", "/com/cisco/spvtg/ccsp/xdslmanager",
+      "Device.ATM.Link.", "LowerLayers", "Device.ATM.LinkNumberOfEntries" },
+    { "eRT.com.cisco.spvtg.ccsp.vlanmanager", "/com/cisco/spvtg/ccsp/vlanmanager",
+      "Device.X_RDK_Ethernet.Link.", "LowerLayers", "Device.X_RDK_Ethernet.LinkNumberOfEntries" },
+};
+
+extern ANSC_HANDLE bus_handle;
+
+static XDSL_INSTANCE_CACHE_TABLE g_InstanceCache[XDSL_INSTANCE_TABLE_MAX];
+static pthread_mutex_t gmInstanceCache_mutex = PTHREAD_MUTEX_INITIALIZER;
+static XDSL_INSTANCE_CACHE_STATS g_InstanceCacheStats;
+
+/* Returns the instance if pParamName is "<prefix><instance>.<key>", -1 otherwise */
+static INT XdslInstanceCacheParseName( XDSL_INSTANCE_TABLE enTable, const char *pParamName )
+{
+    const XDSL_INSTANCE_TABLE_INFO *pInfo = &g_InstanceTableInfo[enTable];
+    size_t prefixLen = strlen(pInfo->pPrefix);
+    char *pEnd = NULL;
+    long lInstance;
+
+    if( strncmp(pParamName, pInfo->pPrefix, prefixLen) != 0 )
+    {
+        return -1;
+    }
+
+    lInstance = strtol(pParamName + prefixLen, &pEnd, 10);
+    if( pEnd == pParamName + prefixLen || *pEnd != '.' || lInstance <= 0 )
+    {
+        return -1;
+    }
+
+    if( strcmp(pEnd + 1, pInfo->pKeyParam) != 0 )
+    {
+        return -1;
+    }
+
+    return (INT)lInstance;
+}
+
+/* Returns the cached instance for pKey, -1 if the table is not loaded or has no such row */
+static INT XdslInstanceCacheFind( XDSL_INSTANCE_TABLE enTable, const char *pKey )
+{
+    XDSL_INSTANCE_CACHE_TABLE *pTable = &g_InstanceCache[enTable];
+    INT iInstance = -1;
+    INT i;
+
+    pthread_mutex_lock(&gmInstanceCache_mutex);
+    if( pTable->bValid )
+    {
+        for( i = 0; i < pTable->iCount; i++ )
+        {
+            if( strcmp(pTable->astEntry[i].Key, pKey) == 0 )
+            {
+                iInstance = pTable->astEntry[i].iInstance;
+                break;
+            }
+        }
+    }
+    pthread_mutex_unlock(&gmInstanceCache_mutex);
+
+    return iInstance;
+}
+
+/* Confirm with a single get that the row still carries pKey */
+static BOOL XdslInstanceCacheVerify( XDSL_INSTANCE_TABLE enTable, const char *pKey, INT iInstance )
+{
+    const XDSL_INSTANCE_TABLE_INFO *pInfo = &g_InstanceTableInfo[enTable];
+    parameterValStruct_t **retVal = NULL;
+    char acParamName[256] = { 0 };
+    char *ParamName[1];
+    int nval = 0;
+    BOOL bMatch = FALSE;
+
+    snprintf(acParamName, sizeof(acParamName), "%s%d.%s", pInfo->pPrefix, iInstance, pInfo->pKeyParam);
+    ParamName[0] = acParamName;
+
+    if( CCSP_SUCCESS == CcspBaseIf_getParameterValues(bus_handle,
+                                                      (char *)pInfo->pComponent,
+                                                      (char *)pInfo->pBus,
+                                                      ParamName,
+                                                      1,
+                                                      &nval,
+                                                      &retVal) )
+    {
+        if( nval >= 1 && NULL != retVal[0]->parameterValue && 0 == strcmp(retVal[0]->parameterValue, pKey) )
+        {
+            bMatch = TRUE;
+        }
+    }
+
+    if( retVal )
+    {
+        free_parameterValStruct_t(bus_handle, nval, retVal);
+    }
+
+    return bMatch;
+}
+
+/* Reload the whole table with one partial path get and look pKey up in the result */
+static ANSC_STATUS XdslInstanceCacheRefresh( XDSL_INSTANCE_TABLE enTable, const char *pKey, INT *piInstanceNumber )
+{
+    const XDSL_INSTANCE_TABLE_INFO *pInfo = &g_InstanceTableInfo[enTable];
+    XDSL_INSTANCE_CACHE_TABLE *pTable = &g_InstanceCache[enTable];
+    XDSL_INSTANCE_CACHE_ENTRY astEntry[XDSL_INSTANCE_CACHE_MAX_ENTRIES];
+    parameterValStruct_t **retVal = NULL;
+    char *ParamName[1];
+    int nval = 0;
+    int ret;
+    INT iCount = 0;
+    INT iRows = 0;
+    INT iInstance;
+    UINT uGeneration;
+    INT i;
+
+    pthread_mutex_lock(&gmInstanceCache_mutex);
+    uGeneration = pTable->uGeneration;
+    pthread_mutex_unlock(&gmInstanceCache_mutex);
+
+    ParamName[0] = (char *)pInfo->pPrefix;
+    ret = CcspBaseIf_getParameterValues(bus_handle,
+                                        (char *)pInfo->pComponent,
+                                        (char *)pInfo->pBus,
+                                        ParamName,
+                                        1,
+                                        &nval,
+                                        &retVal);
+
+    if( CCSP_SUCCESS != ret )
+    {
+        CcspTraceError(("%s Failed to get %s ret:%d\n", __FUNCTION__, pInfo->pPrefix, ret));
+        if( retVal )
+        {
+            free_parameterValStruct_t(bus_handle, nval, retVal);
+        }
+        return ANSC_STATUS_FAILURE;
+    }
+
+    for( i = 0; i < nval; i++ )
+    {
+        if( NULL == retVal[i]->parameterName || NULL == retVal[i]->parameterValue )
+        {
+            continue;
+        }
+
+        iInstance = XdslInstanceCacheParseName(enTable, retVal[i]->parameterName);
+        if( iInstance < 0 )
+        {
+            continue;
+        }
+
+        iRows++;
+
+        //Rows past the cache size are still searched, they are just not kept
+        if( iCount >= XDSL_INSTANCE_CACHE_MAX_ENTRIES )
+        {
+            if( *piInstanceNumber == -1 && 0 == strcmp(retVal[i]->parameterValue, pKey) )
+            {
+                *piInstanceNumber = iInstance;
+            }
+            continue;
+        }
+
+        astEntry[iCount].iInstance = iInstance;
+        snprintf(astEntry[iCount].Key, sizeof(astEntry[iCount].Key), "%s", retVal[i]->parameterValue);
+        if( *piInstanceNumber == -1 && 0 == strcmp(astEntry[iCount].Key, pKey) )
+        {
+            *piInstanceNumber = iInstance;
+        }
+        iCount++;
+    }
+
+    if( retVal )
+    {
+        free_parameterValStruct_t(bus_handle, nval, retVal);
+    }
+
+    if( iRows > iCount )
+    {
+        CcspTraceWarning(("%s %s has %d rows, only %d are cached\n", __FUNCTION__, pInfo->pPrefix, iRows, iCount));
+    }
+
+    pthread_mutex_lock(&gmInstanceCache_mutex);
+    memcpy(pTable->astEntry, astEntry, iCount * sizeof(XDSL_INSTANCE_CACHE_ENTRY));
+    pTable->iCount = iCount;
+    //Only trust the result if nothing was invalidated while it was being fetched
+    pTable->bValid = (pTable->uGeneration == uGeneration) ? TRUE : FALSE;
+    pthread_mutex_unlock(&gmInstanceCache_mutex);
+
+    __atomic_fetch_add(&g_InstanceCacheStats.Refreshes, 1, __ATOMIC_RELAXED);
+    CcspTraceInfo(("%s %s - %d rows\n", __FUNCTION__, pInfo->pPrefix, iCount));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+VOID XdslInstanceCacheInvalidate( XDSL_INSTANCE_TABLE enTable )
+{
+    if( enTable >= XDSL_INSTANCE_TABLE_MAX )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmInstanceCache_mutex);
+    g_InstanceCache[enTable].bValid = FALSE;
+    g_InstanceCache[enTable].uGeneration++;
+    pthread_mutex_unlock(&gmInstanceCache_mutex);
+
+    __atomic_fetch_add(&g_InstanceCacheStats.Invalidations, 1, __ATOMIC_RELAXED);
+}
+
+ANSC_STATUS XdslInstanceCacheLookup( XDSL_INSTANCE_TABLE enTable, char *pKey, INT *piInstanceNumber )
+{
+    INT iInstance;
+
+    if( enTable >= XDSL_INSTANCE_TABLE_MAX || NULL == pKey || NULL == piInstanceNumber )
+    {
+        CcspTraceError(("%s Invalid Buffer\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    *piInstanceNumber = -1;
+
+    iInstance = XdslInstanceCacheFind(enTable, pKey);
+    if( iInstance > 0 )
+    {
+        if( XdslInstanceCacheVerify(enTable, pKey, iInstance) )
+        {
+            __atomic_fetch_add(&g_InstanceCacheStats.Hits, 1, __ATOMIC_RELAXED);
+            *piInstanceNumber = iInstance;
+            return ANSC_STATUS_SUCCESS;
+        }
+
+        XdslInstanceCacheInvalidate(enTable);
+    }
+
+    __atomic_fetch_add(&g_InstanceCacheStats.Misses, 1, __ATOMIC_RELAXED);
+
+    return XdslInstanceCacheRefresh(enTable, pKey, piInstanceNumber);
+}
+
+VOID XdslInstanceCacheGetStats( PXDSL_INSTANCE_CACHE_STATS pstStats )
+{
+    if( pstStats == NULL )
+    {
+        return;
+    }
+
+    pstStats->Hits          = __atomic_load_n(&g_InstanceCacheStats.Hits, __ATOMIC_RELAXED);
+    pstStats->Misses        = __atomic_load_n(&g_InstanceCacheStats.Misses, __ATOMIC_RELAXED);
+    pstStats->Refreshes     = __atomic_load_n(&g_InstanceCacheStats.Refreshes, __ATOMIC_RELAXED);
+    pstStats->Invalidations = __atomic_load_n(&g_InstanceCacheStats.Invalidations, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,240 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_line_policy.c
+    For CCSP Component:  dsl line profile and standard policy
+
+---------------------------------------------------------------
+
+    Description:
+
+    Built-in VDSL2 profile and xDSL standard policy per region and the
+    mapping of TR-181 standard names to XTSE bits. The mapping is a
+    table of 64 bit masks built at compile time and searched by name,
+    converting a StandardsSupported list is one lookup per standard.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "xdsl_line_policy.h"
+#include "xdsl_hal.h"
+
+/* XTSE bits are numbered from 1, range consecutive bits map to the same standard */
+#define XTSE_BITS(position, range)      ( ( ( 1ULL << (range) ) - 1 ) << ( (position) - 1 ) )
+
+#define XDSL_LINE_POLICY_TOKEN_MAX      32
+#define XDSL_LINE_POLICY_PROFILES_MAX   16
+#define XDSL_LINE_POLICY_DELIMITERS     ", "
+
+typedef struct
+_XDSL_XTSE_MAP
+{
+    const char                 *pStandard;
+    unsigned long long          ullBits;
+} XDSL_XTSE_MAP;
+
+/*
+ * Sorted by standard name for bsearch(). G.993.1 has no XTSE bits and is not
+ * listed, T1.413 issue 2 shares the T1.413 bit.
+ */
+static const XDSL_XTSE_MAP g_XtseMap[] =
+{
+    { "ETSI_101_388",       XTSE_BITS( ETSI_101_388, 1 ) },
+    { "G.992.1_Annex_A",    XTSE_BITS( G_992_1_POTS_NON_OVERLAPPED, 2 ) },
+    { "G.992.1_Annex_B",    XTSE_BITS( G_992_1_ISDN_NON_OVERLAPPED, 2 ) },
+    { "G.992.1_Annex_C",    XTSE_BITS( G_992_1_TCM_ISDN_NON_OVERLAPPED, 2 ) },
+    { "G.992.2",            XTSE_BITS( G_992_2_POTS_NON_OVERLAPPED, 4 ) },
+    { "G.992.3_Annex_A",    XTSE_BITS( G_992_3_POTS_NON_OVERLAPPED, 2 ) },
+    { "G.992.3_Annex_B",    XTSE_BITS( G_992_3_ISDN_NON_OVERLAPPED, 2 ) },
+    { "G.992.3_Annex_C",    XTSE_BITS( G_992_3_TCM_ISDN_NON_OVERLAPPED, 2 ) },
+    { "G.992.3_Annex_I",    XTSE_BITS( G_992_3_ANNEX_I_NON_OVERLAPPED, 2 ) },
+    { "G.992.3_Annex_J",    XTSE_BITS( G_992_3_ANNEX_J_NON_OVERLAPPED, 2 ) },
+    { "G.992.3_Annex_L",    XTSE_BITS( G_992_3_POTS_MODE_1, 4 ) },
+    { "G.992.3_Annex_M",    XTSE_BITS( G_992_3_EXT_POTS_NON_OVERLAPPED, 2 ) },
+    { "G.992.4",            XTSE_BITS( G_992_4_POTS_NON_OVERLAPPED, 2 ) },
+    { "G.992.5_Annex_A",    XTSE_BITS( G_992_5_POTS_NON_OVERLAPPED, 2 ) },
+    { "G.992.5_Annex_B",    XTSE_BITS( G_992_5_ISDN_NON_OVERLAPPED, 2 ) },
+    { "G.992.5_Annex_C",    XTSE_BITS( G_992_5_TCM_ISDN_NON_OVERLAPPED, 2 ) },
+    { "G.992.5_Annex_I",    XTSE_BITS( G_992_5_ANNEX_I_NON_OVERLAPPED, 2 ) },
+    { "G.992.5_Annex_J",    XTSE_BITS( G_992_5_ANNEX_J_NON_OVERLAPPED, 2 ) },
+    { "G.992.5_Annex_M",    XTSE_BITS( G_992_5_EXT_POTS_NON_OVERLAPPED, 2 ) },
+    { "G.993.2_Annex_A",    XTSE_BITS( G_993_2_NORTH_AMERICA, 1 ) },
+    { "G.993.2_Annex_B",    XTSE_BITS( G_993_2_EUROPE, 1 ) },
+    { "G.993.2_Annex_C",    XTSE_BITS( G_993_2_JAPAN, 1 ) },
+    { "T1.413",             XTSE_BITS( T1_413, 1 ) },
+    { "T1.413i2",           XTSE_BITS( T1_413, 1 ) }
+};
+
+/*
+ * Region policies. Standards is left empty where the driver's own XTSE is
+ * what the region needs, only AllowedProfiles is then enforced.
+ */
+static const XDSL_LINE_POLICY g_LinePolicies[] =
+{
+    /* Region                           AllowedProfiles     Standards */
+    { XDSL_LINE_POLICY_REGION_DEFAULT,  "8b,12a,17a,35b",   "" }
+};
+
+static int XdslLinePolicyCompareXtse( const void *pKey, const void *pEntry )
+{
+    return strcmp( (const char *)pKey, ((const XDSL_XTSE_MAP *)pEntry)->pStandard );
+}
+
+/* Copies the next token of pList into pToken, returns the position after it or NULL at the end */
+static const char *XdslLinePolicyNextToken( const char *pList, char *pToken, size_t tokenLen )
+{
+    size_t length;
+
+    pList += strspn( pList, XDSL_LINE_POLICY_DELIMITERS );
+    if( *pList == '\0' )
+    {
+        return NULL;
+    }
+
+    length = strcspn( pList, XDSL_LINE_POLICY_DELIMITERS );
+    snprintf( pToken, tokenLen, "%.*s", (int)length, pList );
+
+    return pList + length;
+}
+
+VOID XdslLinePolicyGetDefault( const char *pRegion, PXDSL_LINE_POLICY pstPolicy )
+{
+    const XDSL_LINE_POLICY *pPolicy = &g_LinePolicies[0];   //First entry is the default
+    size_t i;
+
+    if( pstPolicy == NULL )
+    {
+        return;
+    }
+
+    for( i = 0; pRegion != NULL && i < sizeof(g_LinePolicies) / sizeof(g_LinePolicies[0]); i++ )
+    {
+        if( strcmp( pRegion, g_LinePolicies[i].Region ) == 0 )
+        {
+            pPolicy = &g_LinePolicies[i];
+            break;
+        }
+    }
+
+    if( pPolicy == &g_LinePolicies[0] && pRegion != NULL && strcmp( pRegion, pPolicy->Region ) != 0 )
+    {
+        CcspTraceWarning(( "%s : No policy for region %s, using %s\n", __FUNCTION__, pRegion, pPolicy->Region ));
+    }
+
+    memcpy( pstPolicy, pPolicy, sizeof(XDSL_LINE_POLICY) );
+}
+
+ANSC_STATUS XdslLinePolicyStandardsToXtse( const char *pStandards, char *pXtse, size_t xtseLen )
+{
+    char                 acToken[XDSL_LINE_POLICY_TOKEN_MAX];
+    const XDSL_XTSE_MAP *pMap;
+    unsigned long long   ullXtse = 0;
+    BOOL                 bMapped = FALSE;
+
+    if( pStandards == NULL || pXtse == NULL || xtseLen < XDSL_LINE_POLICY_XTSE_LEN )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    while( ( pStandards = XdslLinePolicyNextToken( pStandards, acToken, sizeof(acToken) ) ) != NULL )
+    {
+        pMap = bsearch( acToken, g_XtseMap, sizeof(g_XtseMap) / sizeof(g_XtseMap[0]), sizeof(g_XtseMap[0]), XdslLinePolicyCompareXtse );
+        if( pMap == NULL )
+        {
+            CcspTraceDebug(( "%s : %s has no XTSE bit\n", __FUNCTION__, acToken ));
+            continue;
+        }
+
+        ullXtse |= pMap->ullBits;
+        bMapped = TRUE;
+    }
+
+    //Nothing to report rather than an all zero bitmap
+    if( !bMapped )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Octet 8 first, as TR-181 writes XTSE
+    snprintf( pXtse, xtseLen, "%016llx", ullXtse );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+BOOL XdslLinePolicyProfilesEqual( const char *pProfilesA, const char *pProfilesB )
+{
+    char        acProfiles[XDSL_LINE_POLICY_PROFILES_MAX][XDSL_LINE_POLICY_TOKEN_MAX];
+    char        acToken[XDSL_LINE_POLICY_TOKEN_MAX];
+    BOOL        bSeen[XDSL_LINE_POLICY_PROFILES_MAX];
+    const char *pList;
+    int         iCount = 0;
+    int         i;
+
+    if( pProfilesA == NULL || pProfilesB == NULL )
+    {
+        return FALSE;
+    }
+
+    pList = pProfilesA;
+    while( ( pList = XdslLinePolicyNextToken( pList, acToken, sizeof(acToken) ) ) != NULL )
+    {
+        if( iCount == XDSL_LINE_POLICY_PROFILES_MAX )
+        {
+            return FALSE;
+        }
+        snprintf( acProfiles[iCount], sizeof(acProfiles[iCount]), "%s", acToken );
+        bSeen[iCount] = FALSE;
+        iCount++;
+    }
+
+    //Every profile of B has to be in A and every profile of A seen in B
+    pList = pProfilesB;
+    while( ( pList = XdslLinePolicyNextToken( pList, acToken, sizeof(acToken) ) ) != NULL )
+    {
+        for( i = 0; i < iCount; i++ )
+        {
+            if( strcasecmp( acProfiles[i], acToken ) == 0 )
+            {
+                bSeen[i] = TRUE;
+                break;
+            }
+        }
+        if( i == iCount )
+        {
+            return FALSE;
+        }
+    }
+
+    for( i = 0; i < iCount; i++ )
+    {
+        if( !bSeen[i] )
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
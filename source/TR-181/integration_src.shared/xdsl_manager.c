@@ -51,11 +51,14 @@
 
 /* ---- Include Files ---------------------------------------- */
 #include "xdsl_apis.h"
+#include "xdsl_reactor.h"
+#include "xdsl_bringup.h"
 #include <unistd.h>
 #include <pthread.h>
 
-#define LOOP_TIMEOUT                  50000 // timeout in milliseconds. This is the state machine loop interval
+#define LOOP_TIMEOUT                  50 // timeout in milliseconds. This is the state machine loop interval
 #define STANDARD_USED_QUERY_MAX_COUNT 30 // The maximum number of HAL request tries for StandardUsed value
+#define STANDARD_USED_QUERY_INTERVAL  2000 // interval in milliseconds between StandardUsed queries
 
 typedef enum {
     STATE_EXIT = 0,
@@ -65,8 +68,31 @@ typedef enum {
     STATE_WAN_LINK_UP
 } dslSmState_t;
 
-/* ---- Global Variables ------------------------------------ */
-pthread_key_t       sm_private_key;
+/* Per interface state machine context, driven by a reactor timer */
+typedef struct
+_XDSL_SM_CONTEXT
+{
+    XDSL_SM_PRIVATE_INFO    stPrivInfo;
+    dslSmState_t            currentSmState;
+    INT                     iTimerId;
+    INT                     iRetryCount;
+    bool                    isStandardUsedUpdated;
+    UINT                    uScheduled;
+    ULONGLONG               ullStateEnterTime;      // monotonic ms the current state was entered
+    ULONGLONG               ullAttemptStartTime;    // start of the bring-up in progress, 0 if none
+    ULONGLONG               ullTrainingStartTime;   // training first seen in this attempt, 0 if not seen
+    ULONGLONG               ullTrainedTime;         // line reported up in this attempt
+    DML_XDSL_BRINGUP_TRACE  stTrace;
+} XDSL_SM_CONTEXT, *PXDSL_SM_CONTEXT;
+
+static const char *g_SmStateNames[] =
+{
+    "Exit",
+    "Disconnected",
+    "Training",
+    "XtmConfiguring",
+    "WanLinkUp"
+};
 
 /* ---- Private Function Prototypes -------------------------- */
 /* STATES */
@@ -77,208 +103,300 @@ static dslSmState_t StateWanLinkUp( PXDSL_SM_PRIVATE_INFO pstPrivInfo );
 
 /* TRANSITIONS */
 static dslSmState_t TransitionStart( void );                         // initiliases the state machine.
+static dslSmState_t TransitionResume( PXDSL_SM_PRIVATE_INFO pstPrivInfo );                     // resumes a line that stayed up across a restart.
 static dslSmState_t TransitionTraining( PXDSL_SM_PRIVATE_INFO pstPrivInfo );                   // starts training DSL.
 static dslSmState_t TransitionTrained( PXDSL_SM_PRIVATE_INFO pstPrivInfo );                    // starts configuring PTM.
 static dslSmState_t TransitionWanLinkUp( PXDSL_SM_PRIVATE_INFO pstPrivInfo );                     // sets up the dsl interface.
 static dslSmState_t TransitionPhyInterfaceDown( PXDSL_SM_PRIVATE_INFO pstPrivInfo );                   // tears down the dsl interface.
 static dslSmState_t TransitionExit( PXDSL_SM_PRIVATE_INFO pstPrivInfo );                         //Exit from state machine
 
-static void* DslStateMachineThread( void *arg );
+static VOID DslStateMachineTimer( PVOID pContext );
+static VOID DslStateMachineStep( PVOID pContext );
+static bool DslStateMachineQueryStandardUsed( PXDSL_SM_CONTEXT pstContext );
+static VOID DslStateMachineStop( PXDSL_SM_CONTEXT pstContext );
+static VOID DslStateMachineRecordTransition( PXDSL_SM_CONTEXT pstContext, dslSmState_t fromState, dslSmState_t toState, ULONGLONG ullStart, ULONGLONG ullEnd );
 #ifdef _HUB4_PRODUCT_REQ_
-static bool isAdslAllowed();
+static bool isAdslAllowed( PDML_XDSL_LINE_GLOBALINFO pstGlobalInfo );
 #endif
 /* ***************************************************************************************** */
 
 /* XdslManager_Start_StateMachine() */
 void XdslManager_Start_StateMachine( PXDSL_SM_PRIVATE_INFO pstMPrivateInfo )
 {
-    PXDSL_SM_PRIVATE_INFO     pstPInfo       = NULL;
-    pthread_t                dslThreadId;
-    int                      iErrorCode     = 0;
-    static int               siKeyCreated   = 0;
+    PXDSL_SM_CONTEXT         pstContext     = NULL;
 
-    //Need to create pthread key at once
-    if( 0 == siKeyCreated )
+    //Allocate memory and pass it to the timer
+    pstContext = ( PXDSL_SM_CONTEXT )malloc( sizeof( XDSL_SM_CONTEXT ) );
+    if( NULL == pstContext )
     {
-        if ( 0 != pthread_key_create( &sm_private_key, NULL ) )
-        {
-          CcspTraceError(("%s %d Unable to create pthread_key\n", __FUNCTION__, __LINE__));
-          return;
-        }
-
-        siKeyCreated = 1;
+        CcspTraceError(("%s %d Failed to allocate memory\n", __FUNCTION__, __LINE__));
+        return;
     }
 
-    //Allocate memory and pass it to thread
-    pstPInfo = ( PXDSL_SM_PRIVATE_INFO )malloc( sizeof( XDSL_SM_PRIVATE_INFO ) );
-    if( NULL == pstPInfo )
+    //Copy buffer
+    memset( pstContext, 0, sizeof( XDSL_SM_CONTEXT ) );
+    memcpy( &pstContext->stPrivInfo, pstMPrivateInfo, sizeof( XDSL_SM_PRIVATE_INFO ) );
+    pstContext->currentSmState = STATE_EXIT;
+
+    //DSL state machine timer
+    pstContext->iTimerId = XdslReactorAddTimer( DslStateMachineTimer, (PVOID)pstContext );
+    if( 0 > pstContext->iTimerId )
     {
-        CcspTraceError(("%s %d Failed to allocate memory\n", __FUNCTION__, __LINE__));
+        CcspTraceInfo(("%s %d - Failed to start DSL State Machine\n", __FUNCTION__, __LINE__ ));
+        free( pstContext );
         return;
     }
 
-    //Copy buffer
-    memcpy( pstPInfo, pstMPrivateInfo, sizeof( XDSL_SM_PRIVATE_INFO ) );
+    //Mark the interface busy until the state machine exits
+    DmlXdslLine_UpdateIfaceTidByGivenIfName( pstContext->stPrivInfo.Name, pthread_self() );
+
+    //First StandardUsed query runs straight away, the timer paces the retries
+    pstContext->uScheduled = 1;
+    if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DslStateMachineStep, (PVOID)pstContext ) )
+    {
+        pstContext->uScheduled = 0;
+    }
+    XdslReactorSetTimer( pstContext->iTimerId, STANDARD_USED_QUERY_INTERVAL, STANDARD_USED_QUERY_INTERVAL );
 
-    //DSL state machine thread
-    iErrorCode = pthread_create( &dslThreadId, NULL, &DslStateMachineThread, (void*)pstPInfo );
+    CcspTraceInfo(("%s %d - DSL State Machine Started Successfully\n", __FUNCTION__, __LINE__ ));
+}
+
+/* DslStateMachineTimer() */
+static VOID DslStateMachineTimer( PVOID pContext )
+{
+    PXDSL_SM_CONTEXT pstContext = ( PXDSL_SM_CONTEXT )pContext;
 
-    if( 0 != iErrorCode )
+    //Skip the tick while the previous step is still running on a worker
+    if( 0 != __atomic_exchange_n( &pstContext->uScheduled, 1, __ATOMIC_SEQ_CST ) )
     {
-        CcspTraceInfo(("%s %d - Failed to start DSL State Machine Thread EC:%d\n", __FUNCTION__, __LINE__, iErrorCode ));
+        return;
     }
-    else
+
+    if( ANSC_STATUS_SUCCESS != XdslReactorSubmit( DslStateMachineStep, pContext ) )
     {
-        CcspTraceInfo(("%s %d - DSL State Machine Thread Started Successfully\n", __FUNCTION__, __LINE__ ));
+        __atomic_store_n( &pstContext->uScheduled, 0, __ATOMIC_SEQ_CST );
     }
 }
 
-/* DslStateMachineThread() */
-static void* DslStateMachineThread( void *arg )
+/* DslStateMachineQueryStandardUsed() */
+static bool DslStateMachineQueryStandardUsed( PXDSL_SM_CONTEXT pstContext )
 {
-    dslSmState_t currentSmState   = STATE_EXIT;
-    PXDSL_SM_PRIVATE_INFO  pstPrivInfo = NULL;
     CHAR StandardUsed[XDSL_STANDARD_USED_STR_MAX] = {0};
-    pthread_t thread_id = 0;
-    bool isStandardUsedUpdated = false;
-    int retry_count = 0;
 
-    // event handler
-    int n=0;
-    struct timeval tv;
+    //update standardused in global structure
+    if (ANSC_STATUS_SUCCESS == DmlGetXdslStandardUsed(StandardUsed))
+    {
+        if (StandardUsed[0] != '\0')
+        {
+            DmlXdslLine_UpdateStandardUsedByGivenIfName(pstContext->stPrivInfo.Name, StandardUsed);
+            return true;
+        }
+    }
+
+    pstContext->iRetryCount++;
 
-    //Validate buffer
-    if ( NULL == arg )
+    return false;
+}
+
+/* DslStateMachineStep() */
+static VOID DslStateMachineStep( PVOID pContext )
+{
+    PXDSL_SM_CONTEXT       pstContext  = ( PXDSL_SM_CONTEXT )pContext;
+    PXDSL_SM_PRIVATE_INFO  pstPrivInfo = &pstContext->stPrivInfo;
+    dslSmState_t           prevSmState;
+    ULONGLONG              ullStepStart;
+
+    if ( false == pstContext->isStandardUsedUpdated )
     {
-       CcspTraceError(("%s %d Invalid buffer\n", __FUNCTION__,__LINE__));
+        if ( false == DslStateMachineQueryStandardUsed( pstContext ) )
+        {
+            //terminate state machine if standardused value is not available
+            if ( pstContext->iRetryCount >= STANDARD_USED_QUERY_MAX_COUNT )
+            {
+                CcspTraceError(("%s %d Unable to get StandardUsed value from driver.. Stopping xdsl state machine \n", __FUNCTION__,__LINE__));
+                DslStateMachineStop( pstContext );
+                return;
+            }
+
+            __atomic_store_n( &pstContext->uScheduled, 0, __ATOMIC_SEQ_CST );
+            return;
+        }
+
+        pstContext->isStandardUsedUpdated = true;
 
-       //Cleanup current thread when exit
-       pthread_exit(NULL);
+        // initialise state machine, a line left in showtime by the previous instance keeps its XTM link and WAN
+        if ( ANSC_STATUS_SUCCESS == DmlXdslWarmRestartResume( pstPrivInfo->Name, STATE_WAN_LINK_UP ) )
+        {
+            pstContext->currentSmState = TransitionResume( pstPrivInfo );
+        }
+        else
+        {
+            pstContext->currentSmState = TransitionStart(); // do this first before anything else to init variables
+        }
+        pstContext->ullStateEnterTime = XdslBringUpGetTimeMs();
+        XdslReactorSetTimer( pstContext->iTimerId, LOOP_TIMEOUT, LOOP_TIMEOUT );
     }
 
-    //update global iface id
-    pstPrivInfo = (PXDSL_SM_PRIVATE_INFO)arg;
-    thread_id = pthread_self();
-    DmlXdslLine_UpdateIfaceTidByGivenIfName(pstPrivInfo->Name, thread_id);
+    prevSmState  = pstContext->currentSmState;
+    ullStepStart = XdslBringUpGetTimeMs();
 
-    //update standardused in global structure
-    while(retry_count < STANDARD_USED_QUERY_MAX_COUNT)
+    // process state
+    switch (pstContext->currentSmState)
     {
-        if (ANSC_STATUS_SUCCESS == DmlGetXdslStandardUsed(StandardUsed))
-        {
-            if (StandardUsed[0] != '\0')
+        case STATE_DISCONNECTED:
             {
-                DmlXdslLine_UpdateStandardUsedByGivenIfName(pstPrivInfo->Name, StandardUsed);
-                isStandardUsedUpdated = true;
+                pstContext->currentSmState = StateDisconnected( pstPrivInfo );
                 break;
             }
+
+        case STATE_TRAINING:
+            {
+                pstContext->currentSmState = StateTraining( pstPrivInfo );
+                break;
+            }
+
+        case STATE_XTM_CONFIGURING:
+            {
+                pstContext->currentSmState = StateXtmConfiguring( pstPrivInfo );
+                break;
+            }
+
+        case STATE_WAN_LINK_UP:
+            {
+                pstContext->currentSmState = StateWanLinkUp( pstPrivInfo );
+                break;
+            }
+
+        case STATE_EXIT:
+        default:
+        {
+            CcspTraceInfo(("%s %d - Exit from state machine\n", __FUNCTION__, __LINE__));
+            DslStateMachineStop( pstContext );
+            return;
         }
 
-        retry_count++;
-        sleep(2);
     }
 
-    //terminate state machine if standardused value is not available
-    if (isStandardUsedUpdated == false)
+    if ( prevSmState != pstContext->currentSmState )
     {
-        CcspTraceError(("%s %d Unable to get StandardUsed value from driver.. Stopping xdsl state machine \n", __FUNCTION__,__LINE__));
-        goto EXIT;
+        DslStateMachineRecordTransition( pstContext, prevSmState, pstContext->currentSmState, ullStepStart, XdslBringUpGetTimeMs() );
     }
 
-    //detach thread from caller stack
-    pthread_detach(pthread_self());
+    __atomic_store_n( &pstContext->uScheduled, 0, __ATOMIC_SEQ_CST );
+}
+
+/* DslStateMachineFinishTrace() */
+static VOID DslStateMachineFinishTrace( PXDSL_SM_CONTEXT pstContext, const char *pResult, ULONGLONG ullEnd )
+{
+    PDML_XDSL_BRINGUP_TRACE pstTrace = &pstContext->stTrace;
 
-    //Set thread specific private data
-    if ( 0 != pthread_setspecific( sm_private_key, arg ) )
+    if ( 0 == pstContext->ullAttemptStartTime )
     {
-       CcspTraceError(("%s %d Unable to set private key so exiting\n", __FUNCTION__, __LINE__));
-       if( NULL != arg )
-       {
-           free( arg );
-           arg = NULL;
-       }
-
-       //Cleanup current thread when exit
-       pthread_exit(NULL);
+        return;
     }
 
-    // local variables
-    bool bRunning = true;
+    snprintf( pstTrace->Interface, sizeof( pstTrace->Interface ), "%s", pstContext->stPrivInfo.Name );
+    snprintf( pstTrace->Result, sizeof( pstTrace->Result ), "%s", pResult );
+    pstTrace->StartTime = (ULONG)( pstContext->ullAttemptStartTime / 1000 );
+    pstTrace->TotalTime = (ULONG)( ullEnd - pstContext->ullAttemptStartTime );
+    XdslBringUpRecordTrace( pstTrace );
 
-    // initialise state machine
-    currentSmState = TransitionStart(); // do this first before anything else to init variables
+    CcspTraceInfo(("%s - %s:IfName:%s bring-up %s train:%lu xtm:%lu wan:%lu total:%lu ms\n", __FUNCTION__, XDSL_MARKER_SM_TRANSITION,
+                   pstTrace->Interface, pstTrace->Result, pstTrace->TrainTime, pstTrace->XtmConfigTime, pstTrace->WanNotifyTime, pstTrace->TotalTime));
 
-    while (bRunning)
-    {
-        /* Wait up to 500 milliseconds */
-        tv.tv_sec = 0;
-        tv.tv_usec = LOOP_TIMEOUT;
+    memset( pstTrace, 0, sizeof( DML_XDSL_BRINGUP_TRACE ) );
+    pstContext->ullAttemptStartTime  = 0;
+    pstContext->ullTrainingStartTime = 0;
+    pstContext->ullTrainedTime       = 0;
+}
+
+/*
+ * Called after every state change. ullStart is when the step that changed
+ * state began and ullEnd when it returned, the difference is the time spent
+ * in the transition itself (PTM/ATM job queueing, WAN Manager notification).
+ */
+static VOID DslStateMachineRecordTransition( PXDSL_SM_CONTEXT pstContext, dslSmState_t fromState, dslSmState_t toState, ULONGLONG ullStart, ULONGLONG ullEnd )
+{
+    PDML_XDSL_BRINGUP_TRACE pstTrace = &pstContext->stTrace;
+
+    CcspTraceInfo(("%s - IfName:%s %s -> %s after %llu ms, transition took %llu ms\n", __FUNCTION__, pstContext->stPrivInfo.Name,
+                   g_SmStateNames[fromState], g_SmStateNames[toState],
+                   ullStart - pstContext->ullStateEnterTime, ullEnd - ullStart));
+
+    pstContext->ullStateEnterTime = ullEnd;
 
-        n = select(0, NULL, NULL, NULL, &tv);
-        if (n < 0)
+    switch ( toState )
+    {
+        case STATE_TRAINING:
         {
-            /* interrupted by signal or something, continue */
-            continue;
+            if ( 0 == pstContext->ullAttemptStartTime )
+            {
+                pstContext->ullAttemptStartTime = ullStart;
+            }
+            pstContext->ullTrainingStartTime = ullStart;
+            DmlXdslTrainHintTraining( pstContext->stPrivInfo.Name );
+            break;
         }
 
-        //Get thread specific data
-        pstPrivInfo = ( PXDSL_SM_PRIVATE_INFO ) pthread_getspecific( sm_private_key );
-
-        // process state
-        switch (currentSmState)
+        case STATE_XTM_CONFIGURING:
         {
-            case STATE_DISCONNECTED:
-                {
-                    currentSmState = StateDisconnected( pstPrivInfo );
-                    break;
-                }
-
-            case STATE_TRAINING:
-                {
-                    currentSmState = StateTraining( pstPrivInfo );
-                    break;
-                }
-
-            case STATE_XTM_CONFIGURING:
-                {
-                    currentSmState = StateXtmConfiguring( pstPrivInfo );
-                    break;
-                }
-
-            case STATE_WAN_LINK_UP:
-                {
-                    currentSmState = StateWanLinkUp( pstPrivInfo );
-                    break;
-                }
-
-            case STATE_EXIT:
-            default:
+            bool isHinted = DmlXdslTrainHintTrained( pstContext->stPrivInfo.Name );
+
+            //Line may already be up when the state machine starts, training is then not seen
+            if ( 0 == pstContext->ullAttemptStartTime )
+            {
+                pstContext->ullAttemptStartTime = ullStart;
+            }
+            if ( 0 != pstContext->ullTrainingStartTime )
             {
-                bRunning = false;
+                pstTrace->TrainTime = (ULONG)( ullStart - pstContext->ullTrainingStartTime );
+                XdslBringUpRecordPhase( XDSL_BRINGUP_PHASE_TRAINING, pstTrace->TrainTime );
+                //Split by what the driver was offered, the difference is what the last good configuration saves
+                XdslBringUpRecordPhase( isHinted ? XDSL_BRINGUP_PHASE_TRAINING_HINTED : XDSL_BRINGUP_PHASE_TRAINING_FULL, pstTrace->TrainTime );
+            }
+            pstContext->ullTrainedTime = ullStart;
+            break;
+        }
 
-                CcspTraceInfo(("%s %d - Exit from state machine\n", __FUNCTION__, __LINE__));
+        case STATE_WAN_LINK_UP:
+        {
+            //WAN was already up when the state machine started, nothing was brought up
+            if ( STATE_XTM_CONFIGURING != fromState )
+            {
                 break;
             }
 
+            pstTrace->XtmConfigTime = (ULONG)( ullStart - pstContext->ullTrainedTime );
+            pstTrace->WanNotifyTime = (ULONG)( ullEnd - ullStart );
+            XdslBringUpRecordPhase( XDSL_BRINGUP_PHASE_XTM_CONFIG, pstTrace->XtmConfigTime );
+            XdslBringUpRecordPhase( XDSL_BRINGUP_PHASE_WAN_NOTIFY, pstTrace->WanNotifyTime );
+            XdslBringUpRecordPhase( XDSL_BRINGUP_PHASE_TOTAL, (ULONG)( ullEnd - pstContext->ullAttemptStartTime ) );
+            DslStateMachineFinishTrace( pstContext, "Up", ullEnd );
+            break;
         }
-    }
 
-EXIT:
-    //Clean iface id thread
-    pstPrivInfo = ( PXDSL_SM_PRIVATE_INFO ) pthread_getspecific( sm_private_key );
-    DmlXdslLine_UpdateIfaceTidByGivenIfName(pstPrivInfo->Name, 0);
-
-    //Free current private resource before exit
-    if( NULL != pstPrivInfo )
-    {
-        free(pstPrivInfo);
-        pstPrivInfo = NULL;
+        case STATE_DISCONNECTED:
+        case STATE_EXIT:
+        default:
+        {
+            //Attempt abandoned, keep the trace of how far it got
+            DslStateMachineFinishTrace( pstContext, g_SmStateNames[fromState], ullEnd );
+            break;
+        }
     }
+}
+
+/* DslStateMachineStop() */
+static VOID DslStateMachineStop( PXDSL_SM_CONTEXT pstContext )
+{
+    //No tick can queue another step once the timer is gone
+    XdslReactorRemoveTimer( pstContext->iTimerId );
 
-    //Cleanup current thread when exit
-    pthread_exit(NULL);
+    //Clean iface id
+    DmlXdslLine_UpdateIfaceTidByGivenIfName( pstContext->stPrivInfo.Name, 0 );
 
-    return NULL;
+    //Free current private resource before exit
+    free( pstContext );
 }
 
 static dslSmState_t StateDisconnected( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
@@ -334,22 +452,24 @@ static dslSmState_t StateTraining( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
 static dslSmState_t StateXtmConfiguring( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
 {
     DML_XDSL_LINE_GLOBALINFO stGlobalInfo = { 0 };
-    char StandardUsed[XDSL_STANDARD_USED_STR_MAX] = {'\0'};
     bool is_adsl_allowed = TRUE;
+
+    //Get current DSL link status, standard family and region were resolved when the line trained
+    DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( pstPrivInfo->Name, &stGlobalInfo );
+
 #ifdef _HUB4_PRODUCT_REQ_
-    is_adsl_allowed = isAdslAllowed();
+    is_adsl_allowed = isAdslAllowed( &stGlobalInfo );
 #endif
-    if ( is_adsl_allowed && ANSC_STATUS_SUCCESS == DmlXdslLine_GetStandardUsedByGivenIfName(pstPrivInfo->Name, StandardUsed))
+    //ADSL WAN is only reported up once the ATM link creation job has run
+    if ( is_adsl_allowed && ( XDSL_STANDARD_FAMILY_ADSL == stGlobalInfo.StandardFamily ) &&
+         ( XDSL_LINE_WAN_UP != stGlobalInfo.WanStatus ) &&
+         DmlXdslIsXTMJobDone(pstPrivInfo->Name, pstPrivInfo->ulXtmJobTicket, NULL) )
     {
-        if(strstr(StandardUsed,"G.992.1") || strstr(StandardUsed,"T1.413")  ||
-           strstr(StandardUsed,"G.992.2") || strstr(StandardUsed,"G.992.3") ||
-           strstr(StandardUsed,"G.992.5")) /* ADSL */
+        if ( ANSC_STATUS_SUCCESS == DmlXdslLineSetWanStatus( 0, XDSL_LINE_WAN_UP ) )
         {
-            DmlXdslLineSetWanStatus( 0, XDSL_LINE_WAN_UP );
+            stGlobalInfo.WanStatus = XDSL_LINE_WAN_UP;
         }
     }
-    //Get current DSL link status
-    DmlXdslLineGetCopyOfGlobalInfoForGivenIfName( pstPrivInfo->Name, &stGlobalInfo );
 
     if( XDSL_LINE_WAN_UP == stGlobalInfo.WanStatus )
     {
@@ -388,6 +508,19 @@ static dslSmState_t TransitionStart( void )
     return STATE_DISCONNECTED;
 }
 
+static dslSmState_t TransitionResume( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
+{
+    /*
+     *   1. Runtime snapshot matched the live HAL, PTM/ATM and WAN state, nothing to bring up
+     */
+
+    DmlXdslShaperLinkUp( pstPrivInfo->Name );
+
+    CcspTraceInfo(("%s - %s:IfName:%s STATE_WAN_LINK_UP (warm restart)\n",__FUNCTION__,XDSL_MARKER_SM_TRANSITION,pstPrivInfo->Name));
+
+    return STATE_WAN_LINK_UP;
+}
+
 static dslSmState_t TransitionTraining( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
 {
     CcspTraceInfo(("%s - %s:IfName:%s STATE_TRAINING\n",__FUNCTION__,XDSL_MARKER_SM_TRANSITION,pstPrivInfo->Name));
@@ -401,7 +534,7 @@ static dslSmState_t TransitionTrained( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
      *   1. Notify to PTM to create and enable interface link
      */
 
-    if ( ANSC_STATUS_SUCCESS != DmlXdslCreateXTMLink( pstPrivInfo->Name ) )
+    if ( ANSC_STATUS_SUCCESS != DmlXdslCreateXTMLink( pstPrivInfo->Name, &pstPrivInfo->ulXtmJobTicket ) )
     {
         CcspTraceError(("%s Failed to create PTM link\n", __FUNCTION__));
     }
@@ -422,6 +555,12 @@ static dslSmState_t TransitionWanLinkUp( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
         CcspTraceError(("%s Failed to set LinkUp to WAN\n", __FUNCTION__));
     }
 
+    //Lets a restarted xdslmanager pick the line up where it is
+    DmlXdslWarmRestartSave( pstPrivInfo->Name, STATE_WAN_LINK_UP );
+
+    //Shaping rate from the rates the line trained at
+    DmlXdslShaperLinkUp( pstPrivInfo->Name );
+
     CcspTraceInfo(("%s - %s:IfName:%s STATE_WAN_LINK_UP\n",__FUNCTION__,XDSL_MARKER_SM_TRANSITION,pstPrivInfo->Name));
 
     return STATE_WAN_LINK_UP;
@@ -433,7 +572,14 @@ static dslSmState_t TransitionPhyInterfaceDown( PXDSL_SM_PRIVATE_INFO pstPrivInf
      *   1. Notify to PTM to disable and delete interface link
      *   2. Notify to WAN for Down event
      */
-    if ( ANSC_STATUS_SUCCESS != DmlXdslDeleteXTMLink( pstPrivInfo->Name ) )
+    DmlXdslWarmRestartClear( pstPrivInfo->Name );
+
+    //Offer the last good configuration to the retrain
+    DmlXdslTrainHintLineDown( pstPrivInfo->Name );
+
+    DmlXdslShaperLinkDown( pstPrivInfo->Name );
+
+    if ( ANSC_STATUS_SUCCESS != DmlXdslDeleteXTMLink( pstPrivInfo->Name, &pstPrivInfo->ulXtmJobTicket ) )
     {
         CcspTraceError(("%s Failed to delete PTM link\n", __FUNCTION__));
     }
@@ -453,6 +599,7 @@ static dslSmState_t TransitionExit( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
     /*
      *  1. Exit fro state machine
      */
+    DmlXdslWarmRestartClear( pstPrivInfo->Name );
 
     CcspTraceInfo(("%s - %s:IfName:%s STATE_EXIT\n",__FUNCTION__,XDSL_MARKER_SM_TRANSITION,pstPrivInfo->Name));
 
@@ -461,17 +608,8 @@ static dslSmState_t TransitionExit( PXDSL_SM_PRIVATE_INFO pstPrivInfo )
 
 
 #ifdef _HUB4_PRODUCT_REQ_
-static bool isAdslAllowed()
+static bool isAdslAllowed( PDML_XDSL_LINE_GLOBALINFO pstGlobalInfo )
 {
-    char region[16] = {'\0'};
-    int ret = platform_hal_GetRouterRegion(region);
-    if (ret == 0)
-    {
-        if ((strncmp(region, "GB", strlen("GB"))== 0))
-        {
-            return TRUE;
-        }
-    }
-    return FALSE;
+    return ( XDSL_ROUTER_REGION_GB == pstGlobalInfo->RouterRegion );
 }
 #endif
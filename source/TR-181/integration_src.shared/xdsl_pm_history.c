@@ -0,0 +1,224 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_pm_history.c
+    For CCSP Component:  dsl performance monitoring history
+
+---------------------------------------------------------------
+
+    Description:
+
+    Keeps the counters of completed 15 minute and 1 day intervals, which
+    the driver discards on rollover. The running interval counters are
+    sampled periodically, when the interval start moves back the counters
+    of the previous sample are the totals of the interval that ended and
+    are appended to the ring of the line and interval type in the PM store.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "xdsl_pm_history.h"
+#include "xdsl_pm_store.h"
+
+typedef  struct
+_XDSL_PM_LINE
+{
+    XDSL_PM_SAMPLE          stLast;
+    BOOL                    bLastValid;
+    UINT                    uDayInitErrorsMark;     /* day InitErrors when the running quarter hour started */
+}
+XDSL_PM_LINE;
+
+static XDSL_PM_LINE    *g_pPmLines = NULL;
+static INT              giPmLines  = 0;
+static pthread_mutex_t  g_PmHistoryMutex = PTHREAD_MUTEX_INITIALIZER;
+
+ANSC_STATUS XdslPmHistoryInit( INT iLines )
+{
+    XDSL_PM_LINE *pLines;
+
+    if( iLines <= 0 )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pLines = (XDSL_PM_LINE *)calloc( iLines, sizeof(XDSL_PM_LINE) );
+    if( pLines == NULL )
+    {
+        CcspTraceError(( "%s Failed to allocate the history of %d lines\n", __FUNCTION__, iLines ));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    if( iLines > XDSL_PM_STORE_MAX_LINES )
+    {
+        CcspTraceWarning(( "%s Only the first %d of %d lines keep a history\n", __FUNCTION__, XDSL_PM_STORE_MAX_LINES, iLines ));
+    }
+
+    pthread_mutex_lock( &g_PmHistoryMutex );
+    free( g_pPmLines );
+    g_pPmLines = pLines;
+    giPmLines  = iLines;
+    pthread_mutex_unlock( &g_PmHistoryMutex );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* Stores the interval the previous sample belonged to */
+static VOID XdslPmHistoryPush( INT LineIndex, XDSL_PM_INTERVAL interval, ULONG ulLength, const XDSL_PM_SAMPLE *pstLast, ULONG ulLastStart, const DML_XDSL_PM_COUNTERS *pCounters )
+{
+    DML_XDSL_PM_INTERVAL stBin;
+
+    //Drivers may report the full length on the last second
+    if( ulLastStart > ulLength )
+    {
+        ulLastStart = ulLength;
+    }
+
+    memset( &stBin, 0, sizeof(stBin) );
+    stBin.IntervalEnd = pstLast->Time + ( ulLength - ulLastStart );
+    stBin.Elapsed     = ulLastStart;
+    stBin.Suspect     = ( ulLastStart + XDSL_PM_HISTORY_SUSPECT_SECS < ulLength ) ? TRUE : FALSE;
+    memcpy( &stBin.stCounters, pCounters, sizeof(DML_XDSL_PM_COUNTERS) );
+
+    XdslPmStoreAppend( LineIndex, interval, &stBin );
+}
+
+/*
+ * Intervals that started and ended between two samples, the line was not
+ * read, e.g. the HAL did not answer. They are stored empty and suspect so
+ * the history keeps one bin per interval.
+ */
+static VOID XdslPmHistoryPushMissed( INT LineIndex, XDSL_PM_INTERVAL interval, ULONG ulLength, ULONG ulMaxBins,
+                                     const XDSL_PM_SAMPLE *pstLast, ULONG ulLastStart, const XDSL_PM_SAMPLE *pstSample, ULONG ulStart )
+{
+    DML_XDSL_PM_INTERVAL stBin;
+    ULONG                ulLastEnd;
+    ULONG                ulGap;
+    ULONG                ulMissed;
+    ULONG                i;
+
+    if( ulLastStart > ulLength )
+    {
+        ulLastStart = ulLength;
+    }
+
+    //Uptime based, a step of the wall clock does not make up intervals
+    ulLastEnd = pstLast->Uptime + ( ulLength - ulLastStart );
+    if( ( pstSample->Uptime < ulStart ) || ( pstSample->Uptime - ulStart <= ulLastEnd ) )
+    {
+        return;
+    }
+
+    ulGap    = ( pstSample->Uptime - ulStart ) - ulLastEnd;
+    ulMissed = ulGap / ulLength;
+
+    //Older ones would be overwritten by the newer ones straight away
+    i = ( ulMissed > ulMaxBins ) ? ( ulMissed - ulMaxBins ) : 0;
+
+    memset( &stBin, 0, sizeof(stBin) );
+    stBin.Suspect = TRUE;
+    for( i++; i <= ulMissed; i++ )
+    {
+        stBin.IntervalEnd = pstLast->Time + ( ulLength - ulLastStart ) + ( i * ulLength );
+        XdslPmStoreAppend( LineIndex, interval, &stBin );
+    }
+}
+
+/* The running interval restarted, or a whole interval went by between the samples */
+static BOOL XdslPmHistoryRolledOver( ULONG ulLastStart, ULONG ulStart, ULONG ulElapsed, ULONG ulLength )
+{
+    return ( ulStart < ulLastStart ) || ( ulElapsed >= ulLength );
+}
+
+VOID XdslPmHistoryUpdate( INT LineIndex, const XDSL_PM_SAMPLE *pstSample )
+{
+    XDSL_PM_LINE         *pLine;
+    DML_XDSL_PM_COUNTERS  stQuarterHour;
+    ULONG                 ulElapsed;
+    BOOL                  bDayRollover;
+
+    if( pstSample == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_lock( &g_PmHistoryMutex );
+    if( LineIndex < 0 || LineIndex >= giPmLines )
+    {
+        pthread_mutex_unlock( &g_PmHistoryMutex );
+        return;
+    }
+
+    pLine = &g_pPmLines[LineIndex];
+    if( !pLine->bLastValid )
+    {
+        //Part of the running quarter hour is already gone, count only what is left
+        pLine->uDayInitErrorsMark = pstSample->stCurrentDay.InitErrors;
+        memcpy( &pLine->stLast, pstSample, sizeof(XDSL_PM_SAMPLE) );
+        pLine->bLastValid = TRUE;
+        pthread_mutex_unlock( &g_PmHistoryMutex );
+        return;
+    }
+
+    ulElapsed = pstSample->Uptime - pLine->stLast.Uptime;
+
+    if( XdslPmHistoryRolledOver( pLine->stLast.QuarterHourStart, pstSample->QuarterHourStart, ulElapsed, XDSL_PM_HISTORY_QUARTER_HOUR_SECS ) )
+    {
+        //The driver has no quarter hour InitErrors, take the day counter's increase
+        memcpy( &stQuarterHour, &pLine->stLast.stQuarterHour, sizeof(stQuarterHour) );
+        stQuarterHour.InitErrors = ( pLine->stLast.stCurrentDay.InitErrors >= pLine->uDayInitErrorsMark ) ?
+                                   ( pLine->stLast.stCurrentDay.InitErrors - pLine->uDayInitErrorsMark ) :
+                                   pLine->stLast.stCurrentDay.InitErrors;
+
+        XdslPmHistoryPush( LineIndex, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOUR_SECS,
+                           &pLine->stLast, pLine->stLast.QuarterHourStart, &stQuarterHour );
+        XdslPmHistoryPushMissed( LineIndex, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOUR_SECS, XDSL_PM_HISTORY_QUARTER_HOURS,
+                                 &pLine->stLast, pLine->stLast.QuarterHourStart, pstSample, pstSample->QuarterHourStart );
+        pLine->uDayInitErrorsMark = pLine->stLast.stCurrentDay.InitErrors;
+    }
+
+    bDayRollover = XdslPmHistoryRolledOver( pLine->stLast.CurrentDayStart, pstSample->CurrentDayStart, ulElapsed, XDSL_PM_HISTORY_DAY_SECS );
+    if( bDayRollover )
+    {
+        XdslPmHistoryPush( LineIndex, XDSL_PM_INTERVAL_DAY, XDSL_PM_HISTORY_DAY_SECS,
+                           &pLine->stLast, pLine->stLast.CurrentDayStart, &pLine->stLast.stCurrentDay );
+        XdslPmHistoryPushMissed( LineIndex, XDSL_PM_INTERVAL_DAY, XDSL_PM_HISTORY_DAY_SECS, XDSL_PM_HISTORY_DAYS,
+                                 &pLine->stLast, pLine->stLast.CurrentDayStart, pstSample, pstSample->CurrentDayStart );
+        pLine->uDayInitErrorsMark = 0;
+    }
+
+    memcpy( &pLine->stLast, pstSample, sizeof(XDSL_PM_SAMPLE) );
+    pthread_mutex_unlock( &g_PmHistoryMutex );
+}
+
+ULONG XdslPmHistoryExport( INT LineIndex, XDSL_PM_INTERVAL interval, PDML_XDSL_PM_INTERVAL pstIntervals, ULONG ulMax )
+{
+    return XdslPmStoreExport( LineIndex, interval, pstIntervals, ulMax );
+}
+
+ULONG XdslPmHistoryGetDepth( INT LineIndex, XDSL_PM_INTERVAL interval )
+{
+    return XdslPmStoreGetDepth( LineIndex, interval );
+}
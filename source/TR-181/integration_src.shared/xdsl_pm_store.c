@@ -0,0 +1,540 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_pm_store.c
+    For CCSP Component:  dsl performance monitoring store
+
+---------------------------------------------------------------
+
+    Description:
+
+    Persistent rings of completed PM intervals and counters of each line,
+    in a memory mapped file. Bins are appended, never rewritten in place,
+    each carries a sequence number and a checksum. The counters and the
+    next sequence number of every ring are committed to one of two state
+    records in turn, the newer valid one wins on reload, so a crash while
+    committing leaves the previous state. Reloading is mapping the file
+    and rolling each ring forward over the bins appended after the last
+    commit, the bins are used in place.
+
+    Flash is written when a bin is appended, once per quarter hour and
+    line, and when changed counters are committed, at most once per
+    XDSL_PM_STORE_FLUSH_INTERVAL_MS.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "xdsl_pm_store.h"
+#include "xdsl_reactor.h"
+
+typedef  struct
+_XDSL_PM_STORE_BIN
+{
+    ULONG                   Seq;            /* 0 when never written */
+    DML_XDSL_PM_INTERVAL    stInterval;
+    ULONG                   Checksum;       /* over all fields above */
+}
+XDSL_PM_STORE_BIN;
+
+typedef  struct
+_XDSL_PM_STORE_STATE
+{
+    ULONG                   Seq;            /* commit number, 0 when never committed */
+    ULONG                   ulNextSeq[XDSL_PM_INTERVAL_MAX];
+    ULONG                   ulCounterMask;  /* bit per XDSL_PM_STORE_COUNTER stored */
+    INT                     iCounters[XDSL_PM_STORE_COUNTER_MAX];
+    ULONG                   Checksum;       /* over all fields above */
+}
+XDSL_PM_STORE_STATE;
+
+typedef  struct
+_XDSL_PM_STORE_LINE
+{
+    XDSL_PM_STORE_STATE     stState[2];
+    XDSL_PM_STORE_BIN       stQuarterHours[XDSL_PM_HISTORY_QUARTER_HOURS];
+    XDSL_PM_STORE_BIN       stDays[XDSL_PM_HISTORY_DAYS];
+}
+XDSL_PM_STORE_LINE;
+
+typedef  struct
+_XDSL_PM_STORE_MAP
+{
+    ULONG                   Magic;
+    ULONG                   Version;
+    ULONG                   Lines;
+    ULONG                   Size;           /* catches a file of a build with other type sizes */
+    ULONG                   Checksum;       /* over all fields above */
+    XDSL_PM_STORE_LINE      stLines[XDSL_PM_STORE_MAX_LINES];
+}
+XDSL_PM_STORE_MAP;
+
+/* Uncommitted state of a line */
+typedef  struct
+_XDSL_PM_STORE_RUNTIME
+{
+    XDSL_PM_STORE_STATE     stState;
+    INT                     iActive;        /* state record holding the last commit */
+    BOOL                    bDirty;
+}
+XDSL_PM_STORE_RUNTIME;
+
+static XDSL_PM_STORE_MAP       *g_pPmStore = NULL;
+static BOOL                     gbPmStoreMapped = FALSE;
+static XDSL_PM_STORE_RUNTIME    g_PmStoreRuntime[XDSL_PM_STORE_MAX_LINES];
+static pthread_mutex_t          g_PmStoreMutex = PTHREAD_MUTEX_INITIALIZER;
+static INT                      giPmStoreTimerId = -1;
+static BOOL                     gbPmStoreTimerArmed = FALSE;
+
+static BOOL XdslPmStoreScheduleFlush( VOID );
+
+static ULONG XdslPmStoreChecksum( const void *pData, size_t length )
+{
+    const unsigned char *pByte = (const unsigned char *)pData;
+    ULONG ulHash = 2166136261UL;
+    size_t i;
+
+    //FNV-1a
+    for( i = 0; i < length; i++ )
+    {
+        ulHash = ( ulHash ^ pByte[i] ) * 16777619UL;
+    }
+
+    return ulHash & 0xFFFFFFFFUL;
+}
+
+static XDSL_PM_STORE_BIN *XdslPmStoreRing( INT LineIndex, XDSL_PM_INTERVAL interval, ULONG *pulSize )
+{
+    XDSL_PM_STORE_LINE *pLine = &g_pPmStore->stLines[LineIndex];
+
+    if( interval == XDSL_PM_INTERVAL_DAY )
+    {
+        *pulSize = XDSL_PM_HISTORY_DAYS;
+        return pLine->stDays;
+    }
+
+    *pulSize = XDSL_PM_HISTORY_QUARTER_HOURS;
+    return pLine->stQuarterHours;
+}
+
+static BOOL XdslPmStoreBinValid( const XDSL_PM_STORE_BIN *pBin, ULONG ulSeq )
+{
+    return ( pBin->Seq == ulSeq ) &&
+           ( pBin->Checksum == XdslPmStoreChecksum( pBin, offsetof(XDSL_PM_STORE_BIN, Checksum) ) );
+}
+
+static BOOL XdslPmStoreStateValid( const XDSL_PM_STORE_STATE *pState )
+{
+    return ( pState->Seq != 0 ) &&
+           ( pState->Checksum == XdslPmStoreChecksum( pState, offsetof(XDSL_PM_STORE_STATE, Checksum) ) );
+}
+
+/* Loads the newer valid state record and the bins appended after it was committed */
+static VOID XdslPmStoreRestoreLine( INT LineIndex )
+{
+    XDSL_PM_STORE_LINE    *pLine    = &g_pPmStore->stLines[LineIndex];
+    XDSL_PM_STORE_RUNTIME *pRuntime = &g_PmStoreRuntime[LineIndex];
+    XDSL_PM_STORE_BIN     *pBins;
+    ULONG                  ulSize;
+    ULONG                  ulCommitted;
+    INT                    interval;
+    INT                    i;
+
+    memset( pRuntime, 0, sizeof(XDSL_PM_STORE_RUNTIME) );
+    pRuntime->iActive = -1;
+    for( i = 0; i < 2; i++ )
+    {
+        if( XdslPmStoreStateValid( &pLine->stState[i] ) &&
+             ( pRuntime->iActive < 0 || pLine->stState[i].Seq > pLine->stState[pRuntime->iActive].Seq ) )
+        {
+            pRuntime->iActive = i;
+        }
+    }
+
+    if( pRuntime->iActive >= 0 )
+    {
+        memcpy( &pRuntime->stState, &pLine->stState[pRuntime->iActive], sizeof(XDSL_PM_STORE_STATE) );
+    }
+    else
+    {
+        pRuntime->iActive = 1;
+    }
+
+    for( interval = 0; interval < XDSL_PM_INTERVAL_MAX; interval++ )
+    {
+        pBins = XdslPmStoreRing( LineIndex, interval, &ulSize );
+
+        if( pRuntime->stState.ulNextSeq[interval] == 0 )
+        {
+            pRuntime->stState.ulNextSeq[interval] = 1;
+        }
+
+        //Bins appended since the commit follow it with consecutive sequence numbers
+        ulCommitted = pRuntime->stState.ulNextSeq[interval];
+        while( ( pRuntime->stState.ulNextSeq[interval] - ulCommitted < ulSize ) &&
+                XdslPmStoreBinValid( &pBins[( pRuntime->stState.ulNextSeq[interval] - 1 ) % ulSize], pRuntime->stState.ulNextSeq[interval] ) )
+        {
+            pRuntime->stState.ulNextSeq[interval]++;
+        }
+    }
+}
+
+/* Maps the store file, returns NULL when it can not be opened or mapped */
+static XDSL_PM_STORE_MAP *XdslPmStoreMap( VOID )
+{
+    XDSL_PM_STORE_MAP *pMap;
+    struct stat        st;
+    int                fd;
+
+    fd = open( XDSL_PM_STORE_FILE, O_RDWR | O_CREAT, 0600 );
+    if( fd < 0 )
+    {
+        CcspTraceWarning(( "%s Failed to open %s, errno:%d\n", __FUNCTION__, XDSL_PM_STORE_FILE, errno ));
+        return NULL;
+    }
+
+    //A file of another size is reinitialised, growing it reads back as zeros
+    if( fstat( fd, &st ) != 0 ||
+         ( st.st_size != (off_t)sizeof(XDSL_PM_STORE_MAP) && ftruncate( fd, sizeof(XDSL_PM_STORE_MAP) ) != 0 ) )
+    {
+        CcspTraceWarning(( "%s Failed to size %s, errno:%d\n", __FUNCTION__, XDSL_PM_STORE_FILE, errno ));
+        close( fd );
+        return NULL;
+    }
+
+    pMap = (XDSL_PM_STORE_MAP *)mmap( NULL, sizeof(XDSL_PM_STORE_MAP), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( pMap == MAP_FAILED )
+    {
+        CcspTraceWarning(( "%s Failed to map %s, errno:%d\n", __FUNCTION__, XDSL_PM_STORE_FILE, errno ));
+        return NULL;
+    }
+
+    return pMap;
+}
+
+ANSC_STATUS XdslPmStoreInit( VOID )
+{
+    XDSL_PM_STORE_MAP *pMap;
+    BOOL               bMapped = TRUE;
+    INT                i;
+
+    pMap = XdslPmStoreMap();
+    if( pMap == NULL )
+    {
+        pMap = (XDSL_PM_STORE_MAP *)calloc( 1, sizeof(XDSL_PM_STORE_MAP) );
+        if( pMap == NULL )
+        {
+            CcspTraceError(( "%s Failed to allocate the PM store\n", __FUNCTION__ ));
+            return ANSC_STATUS_FAILURE;
+        }
+        bMapped = FALSE;
+        CcspTraceWarning(( "%s PM history and counters are not kept across restarts\n", __FUNCTION__ ));
+    }
+
+    if( pMap->Magic != XDSL_PM_STORE_MAGIC ||
+         pMap->Version != XDSL_PM_STORE_VERSION ||
+         pMap->Lines != XDSL_PM_STORE_MAX_LINES ||
+         pMap->Size != sizeof(XDSL_PM_STORE_MAP) ||
+         pMap->Checksum != XdslPmStoreChecksum( pMap, offsetof(XDSL_PM_STORE_MAP, Checksum) ) )
+    {
+        if( bMapped )
+        {
+            CcspTraceWarning(( "%s Reinitialising %s\n", __FUNCTION__, XDSL_PM_STORE_FILE ));
+        }
+
+        memset( pMap, 0, sizeof(XDSL_PM_STORE_MAP) );
+        pMap->Magic    = XDSL_PM_STORE_MAGIC;
+        pMap->Version  = XDSL_PM_STORE_VERSION;
+        pMap->Lines    = XDSL_PM_STORE_MAX_LINES;
+        pMap->Size     = sizeof(XDSL_PM_STORE_MAP);
+        pMap->Checksum = XdslPmStoreChecksum( pMap, offsetof(XDSL_PM_STORE_MAP, Checksum) );
+        if( bMapped )
+        {
+            msync( pMap, sizeof(XDSL_PM_STORE_MAP), MS_SYNC );
+        }
+    }
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    g_pPmStore      = pMap;
+    gbPmStoreMapped = bMapped;
+    for( i = 0; i < XDSL_PM_STORE_MAX_LINES; i++ )
+    {
+        XdslPmStoreRestoreLine( i );
+    }
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+VOID XdslPmStoreAppend( INT LineIndex, XDSL_PM_INTERVAL interval, const DML_XDSL_PM_INTERVAL *pstInterval )
+{
+    XDSL_PM_STORE_BIN  stBin;
+    XDSL_PM_STORE_BIN *pBins;
+    ULONG              ulSize;
+    ULONG             *pulNextSeq;
+    BOOL               bScheduled;
+
+    if( pstInterval == NULL || interval < 0 || interval >= XDSL_PM_INTERVAL_MAX )
+    {
+        return;
+    }
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    if( g_pPmStore == NULL || LineIndex < 0 || LineIndex >= XDSL_PM_STORE_MAX_LINES )
+    {
+        pthread_mutex_unlock( &g_PmStoreMutex );
+        return;
+    }
+
+    pBins      = XdslPmStoreRing( LineIndex, interval, &ulSize );
+    pulNextSeq = &g_PmStoreRuntime[LineIndex].stState.ulNextSeq[interval];
+
+    //Built aside so the padding is zero and the checksum reproducible
+    memset( &stBin, 0, sizeof(stBin) );
+    stBin.Seq = *pulNextSeq;
+    memcpy( &stBin.stInterval, pstInterval, sizeof(DML_XDSL_PM_INTERVAL) );
+    stBin.Checksum = XdslPmStoreChecksum( &stBin, offsetof(XDSL_PM_STORE_BIN, Checksum) );
+
+    memcpy( &pBins[( *pulNextSeq - 1 ) % ulSize], &stBin, sizeof(stBin) );
+    ( *pulNextSeq )++;
+
+    //Reloading only rolls forward over one ring of bins past the committed position
+    g_PmStoreRuntime[LineIndex].bDirty = TRUE;
+    bScheduled = XdslPmStoreScheduleFlush();
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    if( !bScheduled )
+    {
+        XdslPmStoreFlush();
+    }
+}
+
+ULONG XdslPmStoreExport( INT LineIndex, XDSL_PM_INTERVAL interval, PDML_XDSL_PM_INTERVAL pstIntervals, ULONG ulMax )
+{
+    XDSL_PM_STORE_BIN *pBins;
+    ULONG              ulSize;
+    ULONG              ulSeq;
+    ULONG              ulOldest;
+    ULONG              ulCount = 0;
+
+    if( pstIntervals == NULL || interval < 0 || interval >= XDSL_PM_INTERVAL_MAX )
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    if( g_pPmStore == NULL || LineIndex < 0 || LineIndex >= XDSL_PM_STORE_MAX_LINES )
+    {
+        pthread_mutex_unlock( &g_PmStoreMutex );
+        return 0;
+    }
+
+    pBins    = XdslPmStoreRing( LineIndex, interval, &ulSize );
+    ulSeq    = g_PmStoreRuntime[LineIndex].stState.ulNextSeq[interval];
+    ulOldest = ( ulSeq > ulSize ) ? ( ulSeq - ulSize ) : 1;
+
+    //Bins lost to a crash are skipped, not reported as empty intervals
+    while( ulSeq-- > ulOldest && ulCount < ulMax )
+    {
+        if( XdslPmStoreBinValid( &pBins[( ulSeq - 1 ) % ulSize], ulSeq ) )
+        {
+            memcpy( &pstIntervals[ulCount++], &pBins[( ulSeq - 1 ) % ulSize].stInterval, sizeof(DML_XDSL_PM_INTERVAL) );
+        }
+    }
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    return ulCount;
+}
+
+ULONG XdslPmStoreGetDepth( INT LineIndex, XDSL_PM_INTERVAL interval )
+{
+    ULONG ulDepth = 0;
+
+    if( interval < 0 || interval >= XDSL_PM_INTERVAL_MAX )
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    if( g_pPmStore != NULL && LineIndex >= 0 && LineIndex < XDSL_PM_STORE_MAX_LINES &&
+         g_PmStoreRuntime[LineIndex].stState.ulNextSeq[interval] > 0 )
+    {
+        ulDepth = g_PmStoreRuntime[LineIndex].stState.ulNextSeq[interval] - 1;
+    }
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    return ulDepth;
+}
+
+BOOL XdslPmStoreGetCounter( INT LineIndex, XDSL_PM_STORE_COUNTER counter, INT *piValue )
+{
+    BOOL bStored = FALSE;
+
+    if( piValue == NULL || counter < 0 || counter >= XDSL_PM_STORE_COUNTER_MAX ||
+         LineIndex < 0 || LineIndex >= XDSL_PM_STORE_MAX_LINES )
+    {
+        return FALSE;
+    }
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    if( g_pPmStore != NULL && ( g_PmStoreRuntime[LineIndex].stState.ulCounterMask & ( 1UL << counter ) ) )
+    {
+        *piValue = g_PmStoreRuntime[LineIndex].stState.iCounters[counter];
+        bStored  = TRUE;
+    }
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    return bStored;
+}
+
+static VOID XdslPmStoreFlushJob( PVOID pContext )
+{
+    (void)pContext;
+
+    XdslPmStoreFlush();
+}
+
+static VOID XdslPmStoreTimer( PVOID pContext )
+{
+    (void)pContext;
+
+    //Timer callbacks must not block, msync runs on a worker
+    XdslReactorSubmit( XdslPmStoreFlushJob, NULL );
+}
+
+/* Arms the one shot commit timer, FALSE when there is no event loop to run it */
+static BOOL XdslPmStoreScheduleFlush( VOID )
+{
+    if( giPmStoreTimerId < 0 )
+    {
+        giPmStoreTimerId = XdslReactorAddTimer( XdslPmStoreTimer, NULL );
+        if( giPmStoreTimerId < 0 )
+        {
+            return FALSE;
+        }
+    }
+
+    if( !gbPmStoreTimerArmed )
+    {
+        if( ANSC_STATUS_SUCCESS != XdslReactorSetTimer( giPmStoreTimerId, XDSL_PM_STORE_FLUSH_INTERVAL_MS, 0 ) )
+        {
+            return FALSE;
+        }
+        gbPmStoreTimerArmed = TRUE;
+    }
+
+    return TRUE;
+}
+
+VOID XdslPmStoreSetCounter( INT LineIndex, XDSL_PM_STORE_COUNTER counter, INT iValue )
+{
+    XDSL_PM_STORE_STATE *pState;
+    BOOL                 bScheduled;
+
+    if( counter < 0 || counter >= XDSL_PM_STORE_COUNTER_MAX ||
+         LineIndex < 0 || LineIndex >= XDSL_PM_STORE_MAX_LINES )
+    {
+        return;
+    }
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    if( g_pPmStore == NULL )
+    {
+        pthread_mutex_unlock( &g_PmStoreMutex );
+        return;
+    }
+
+    pState = &g_PmStoreRuntime[LineIndex].stState;
+    if( ( pState->ulCounterMask & ( 1UL << counter ) ) && pState->iCounters[counter] == iValue )
+    {
+        pthread_mutex_unlock( &g_PmStoreMutex );
+        return;
+    }
+
+    pState->iCounters[counter] = iValue;
+    pState->ulCounterMask     |= ( 1UL << counter );
+    g_PmStoreRuntime[LineIndex].bDirty = TRUE;
+    bScheduled = XdslPmStoreScheduleFlush();
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    if( !bScheduled )
+    {
+        XdslPmStoreFlush();
+    }
+}
+
+ANSC_STATUS XdslPmStoreFlush( VOID )
+{
+    XDSL_PM_STORE_RUNTIME *pRuntime;
+    XDSL_PM_STORE_STATE    stState;
+    XDSL_PM_STORE_STATE   *pActive;
+    INT                    i;
+
+    pthread_mutex_lock( &g_PmStoreMutex );
+    gbPmStoreTimerArmed = FALSE;
+    if( g_pPmStore == NULL )
+    {
+        pthread_mutex_unlock( &g_PmStoreMutex );
+        return ANSC_STATUS_FAILURE;
+    }
+
+    for( i = 0; i < XDSL_PM_STORE_MAX_LINES; i++ )
+    {
+        pRuntime = &g_PmStoreRuntime[i];
+        if( !pRuntime->bDirty )
+        {
+            continue;
+        }
+
+        //The other record is overwritten, the last commit stays valid until this one is complete
+        pActive = &g_pPmStore->stLines[i].stState[pRuntime->iActive];
+        memset( &stState, 0, sizeof(stState) );
+        memcpy( stState.ulNextSeq, pRuntime->stState.ulNextSeq, sizeof(stState.ulNextSeq) );
+        memcpy( stState.iCounters, pRuntime->stState.iCounters, sizeof(stState.iCounters) );
+        stState.ulCounterMask = pRuntime->stState.ulCounterMask;
+        stState.Seq           = XdslPmStoreStateValid( pActive ) ? ( pActive->Seq + 1 ) : 1;
+        stState.Checksum      = XdslPmStoreChecksum( &stState, offsetof(XDSL_PM_STORE_STATE, Checksum) );
+
+        pRuntime->iActive = 1 - pRuntime->iActive;
+        memcpy( &g_pPmStore->stLines[i].stState[pRuntime->iActive], &stState, sizeof(stState) );
+        pRuntime->stState.Seq = stState.Seq;
+        pRuntime->bDirty      = FALSE;
+    }
+
+    if( gbPmStoreMapped && msync( g_pPmStore, sizeof(XDSL_PM_STORE_MAP), MS_ASYNC ) != 0 )
+    {
+        CcspTraceWarning(( "%s Failed to sync %s, errno:%d\n", __FUNCTION__, XDSL_PM_STORE_FILE, errno ));
+    }
+    pthread_mutex_unlock( &g_PmStoreMutex );
+
+    return ANSC_STATUS_SUCCESS;
+}
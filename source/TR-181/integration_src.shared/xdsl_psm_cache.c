@@ -0,0 +1,309 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_psm_cache.c
+    For CCSP Component:  dsl PSM write-behind cache
+
+---------------------------------------------------------------
+
+    Description:
+
+    In-memory mirror of the PSM records used by xdslmanager. Records are
+    kept in an open addressed hash table keyed by name, a read hits PSM
+    only the first time and a write only marks the record dirty. Dirty
+    records are written to the PSM component in batches of up to
+    XDSL_BUS_TXN_MAX_PARAMS, one setParameterValues each, instead of one
+    read and one write per record.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "xdsl_psm_cache.h"
+#include "xdsl_bus_txn.h"
+#include "xdsl_reactor.h"
+#include "ccsp_psm_helper.h"
+
+typedef  struct
+_XDSL_PSM_CACHE_RECORD
+{
+    BOOL                bValid;
+    BOOL                bDirty;
+    ULONG               ulSeq;          /* bumped by every write, tells a flush whether it is stale */
+    CHAR                Name[XDSL_PSM_CACHE_NAME_LENGTH];
+    CHAR                Value[XDSL_PSM_CACHE_VALUE_LENGTH];
+}
+XDSL_PSM_CACHE_RECORD;
+
+/* Dirty record taken out of the table by a flush */
+typedef  struct
+_XDSL_PSM_CACHE_PENDING
+{
+    INT                 iSlot;
+    ULONG               ulSeq;
+}
+XDSL_PSM_CACHE_PENDING;
+
+extern ANSC_HANDLE bus_handle;
+extern char        g_Subsystem[32];
+
+static XDSL_PSM_CACHE_RECORD g_PsmCache[XDSL_PSM_CACHE_SLOTS];
+static pthread_mutex_t       g_PsmCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+/* Serialises flushes so an older batch never overtakes a newer one */
+static pthread_mutex_t       g_PsmCacheFlushMutex = PTHREAD_MUTEX_INITIALIZER;
+static INT                   giPsmCacheTimerId = -1;
+static BOOL                  gbPsmCacheTimerArmed = FALSE;
+
+static ULONG XdslPsmCacheHash( const char *pName )
+{
+    ULONG ulHash = 2166136261UL;
+
+    while( *pName != '\0' )
+    {
+        ulHash = ( ulHash ^ (unsigned char)*pName++ ) * 16777619UL;
+    }
+
+    return ulHash;
+}
+
+/*
+ * Slot of pName, or of the free slot it would go to. -1 when the table is
+ * full and pName is not in it. Called with g_PsmCacheMutex held.
+ */
+static INT XdslPsmCacheLookup( const char *pName )
+{
+    ULONG ulSlot = XdslPsmCacheHash( pName ) & ( XDSL_PSM_CACHE_SLOTS - 1 );
+    INT   i;
+
+    //Records are never removed, linear probing needs no tombstones
+    for( i = 0; i < XDSL_PSM_CACHE_SLOTS; i++ )
+    {
+        if( !g_PsmCache[ulSlot].bValid || strcmp( g_PsmCache[ulSlot].Name, pName ) == 0 )
+        {
+            return (INT)ulSlot;
+        }
+        ulSlot = ( ulSlot + 1 ) & ( XDSL_PSM_CACHE_SLOTS - 1 );
+    }
+
+    return -1;
+}
+
+static VOID XdslPsmCacheFlushJob( PVOID pContext )
+{
+    (void)pContext;
+
+    XdslPsmCacheFlush();
+}
+
+static VOID XdslPsmCacheTimer( PVOID pContext )
+{
+    (void)pContext;
+
+    XdslReactorSubmit( XdslPsmCacheFlushJob, NULL );
+}
+
+/* Arms the delayed flush, FALSE when there is no event loop to run it yet */
+static BOOL XdslPsmCacheScheduleFlush( VOID )
+{
+    if( giPsmCacheTimerId < 0 )
+    {
+        giPsmCacheTimerId = XdslReactorAddTimer( XdslPsmCacheTimer, NULL );
+        if( giPsmCacheTimerId < 0 )
+        {
+            return FALSE;
+        }
+    }
+
+    if( !gbPsmCacheTimerArmed )
+    {
+        if( ANSC_STATUS_SUCCESS != XdslReactorSetTimer( giPsmCacheTimerId, XDSL_PSM_CACHE_FLUSH_DELAY_MS, 0 ) )
+        {
+            return FALSE;
+        }
+        gbPsmCacheTimerArmed = TRUE;
+    }
+
+    return TRUE;
+}
+
+INT XdslPsmCacheGet( const char *pName, char *pValue, size_t valueLen )
+{
+    char *strValue = NULL;
+    INT   retPsmGet;
+    INT   iSlot;
+
+    if( pName == NULL || pValue == NULL || valueLen == 0 )
+    {
+        return CCSP_FAILURE;
+    }
+
+    pthread_mutex_lock( &g_PsmCacheMutex );
+    iSlot = XdslPsmCacheLookup( pName );
+    if( iSlot >= 0 && g_PsmCache[iSlot].bValid )
+    {
+        snprintf( pValue, valueLen, "%s", g_PsmCache[iSlot].Value );
+        pthread_mutex_unlock( &g_PsmCacheMutex );
+        return CCSP_SUCCESS;
+    }
+    pthread_mutex_unlock( &g_PsmCacheMutex );
+
+    //Missing records are not mirrored, they may still be created by a PSM default
+    retPsmGet = PSM_Get_Record_Value2( bus_handle, g_Subsystem, (char *)pName, NULL, &strValue );
+    if( retPsmGet != CCSP_SUCCESS )
+    {
+        return retPsmGet;
+    }
+
+    snprintf( pValue, valueLen, "%s", ( strValue != NULL ) ? strValue : "" );
+
+    pthread_mutex_lock( &g_PsmCacheMutex );
+    iSlot = XdslPsmCacheLookup( pName );
+    //A write made meanwhile is newer than what was just read
+    if( iSlot >= 0 && !g_PsmCache[iSlot].bValid )
+    {
+        snprintf( g_PsmCache[iSlot].Name, sizeof(g_PsmCache[iSlot].Name), "%s", pName );
+        snprintf( g_PsmCache[iSlot].Value, sizeof(g_PsmCache[iSlot].Value), "%s", pValue );
+        g_PsmCache[iSlot].bDirty = FALSE;
+        g_PsmCache[iSlot].bValid = TRUE;
+    }
+    pthread_mutex_unlock( &g_PsmCacheMutex );
+
+    if( strValue != NULL )
+    {
+        ((CCSP_MESSAGE_BUS_INFO *)bus_handle)->freefunc( strValue );
+    }
+
+    return CCSP_SUCCESS;
+}
+
+INT XdslPsmCacheSet( const char *pName, const char *pValue )
+{
+    INT iSlot;
+
+    if( pName == NULL || pValue == NULL )
+    {
+        return CCSP_FAILURE;
+    }
+
+    if( strlen( pName ) >= XDSL_PSM_CACHE_NAME_LENGTH || strlen( pValue ) >= XDSL_PSM_CACHE_VALUE_LENGTH )
+    {
+        return PSM_Set_Record_Value2( bus_handle, g_Subsystem, (char *)pName, ccsp_string, (char *)pValue );
+    }
+
+    pthread_mutex_lock( &g_PsmCacheMutex );
+    iSlot = XdslPsmCacheLookup( pName );
+    if( iSlot >= 0 && g_PsmCache[iSlot].bValid && strcmp( g_PsmCache[iSlot].Value, pValue ) == 0 )
+    {
+        pthread_mutex_unlock( &g_PsmCacheMutex );
+        return CCSP_SUCCESS;
+    }
+
+    if( iSlot < 0 || !XdslPsmCacheScheduleFlush() )
+    {
+        pthread_mutex_unlock( &g_PsmCacheMutex );
+        CcspTraceDebug(( "%s : Writing %s through\n", __FUNCTION__, pName ));
+        return PSM_Set_Record_Value2( bus_handle, g_Subsystem, (char *)pName, ccsp_string, (char *)pValue );
+    }
+
+    snprintf( g_PsmCache[iSlot].Name, sizeof(g_PsmCache[iSlot].Name), "%s", pName );
+    snprintf( g_PsmCache[iSlot].Value, sizeof(g_PsmCache[iSlot].Value), "%s", pValue );
+    g_PsmCache[iSlot].bValid = TRUE;
+    g_PsmCache[iSlot].bDirty = TRUE;
+    g_PsmCache[iSlot].ulSeq++;
+    pthread_mutex_unlock( &g_PsmCacheMutex );
+
+    return CCSP_SUCCESS;
+}
+
+ANSC_STATUS XdslPsmCacheFlush( VOID )
+{
+    XDSL_PSM_CACHE_PENDING stPending[XDSL_BUS_TXN_MAX_PARAMS];
+    XDSL_BUS_TXN           stTxn;
+    char                   acComponent[64];
+    ANSC_STATUS            returnStatus = ANSC_STATUS_SUCCESS;
+    INT                    iCount;
+    INT                    iSlot;
+    INT                    i;
+
+    snprintf( acComponent, sizeof(acComponent), "%s%s", g_Subsystem, CCSP_DBUS_PSM );
+
+    pthread_mutex_lock( &g_PsmCacheFlushMutex );
+
+    pthread_mutex_lock( &g_PsmCacheMutex );
+    gbPsmCacheTimerArmed = FALSE;
+    if( giPsmCacheTimerId >= 0 )
+    {
+        XdslReactorSetTimer( giPsmCacheTimerId, 0, 0 );
+    }
+
+    for( iSlot = 0; iSlot < XDSL_PSM_CACHE_SLOTS; )
+    {
+        //Take the next batch out of the table, the bus call runs unlocked
+        XdslBusTxnBegin( &stTxn, acComponent, CCSP_DBUS_PATH_PSM );
+        for( iCount = 0; iSlot < XDSL_PSM_CACHE_SLOTS && iCount < XDSL_BUS_TXN_MAX_PARAMS; iSlot++ )
+        {
+            if( !g_PsmCache[iSlot].bDirty )
+            {
+                continue;
+            }
+
+            XdslBusTxnAddParam( &stTxn, ccsp_string, g_PsmCache[iSlot].Value, "%s", g_PsmCache[iSlot].Name );
+            g_PsmCache[iSlot].bDirty  = FALSE;
+            stPending[iCount].iSlot   = iSlot;
+            stPending[iCount].ulSeq   = g_PsmCache[iSlot].ulSeq;
+            iCount++;
+        }
+
+        if( iCount == 0 )
+        {
+            continue;
+        }
+
+        pthread_mutex_unlock( &g_PsmCacheMutex );
+        if( ANSC_STATUS_SUCCESS == XdslBusTxnCommit( &stTxn ) )
+        {
+            pthread_mutex_lock( &g_PsmCacheMutex );
+            continue;
+        }
+
+        CcspTraceError(( "%s : Failed to write %d PSM records, retrying later\n", __FUNCTION__, iCount ));
+        returnStatus = ANSC_STATUS_FAILURE;
+
+        //Keep the records dirty unless they were written again meanwhile
+        pthread_mutex_lock( &g_PsmCacheMutex );
+        for( i = 0; i < iCount; i++ )
+        {
+            if( g_PsmCache[stPending[i].iSlot].ulSeq == stPending[i].ulSeq )
+            {
+                g_PsmCache[stPending[i].iSlot].bDirty = TRUE;
+            }
+        }
+        XdslPsmCacheScheduleFlush();
+    }
+    pthread_mutex_unlock( &g_PsmCacheMutex );
+
+    pthread_mutex_unlock( &g_PsmCacheFlushMutex );
+
+    return returnStatus;
+}
@@ -0,0 +1,174 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_pvc_search.c
+    For CCSP Component:  ATM PVC auto-detection
+
+---------------------------------------------------------------
+
+    Description:
+
+    Parsing of the ATM VPI/VCI pairs of DestinationAddress and
+    VCSearchList and the order candidates are probed in on ADSL
+    showtime. The PVC that answered last is tried first, a line that
+    comes back on the same DSLAM port costs a single F5 loopback.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "xdsl_pvc_search.h"
+
+#define XDSL_PVC_PREFIX                 "PVC:"
+#define XDSL_PVC_MAX_VPI                255
+#define XDSL_PVC_MIN_VCI                32      /* 0-31 are reserved for signalling and OAM */
+#define XDSL_PVC_MAX_VCI                65535
+
+BOOL XdslPvcParse( const char *pString, PXDSL_PVC pstPvc )
+{
+    unsigned long ulVpi;
+    unsigned long ulVci;
+    char *pEnd;
+
+    if( pString == NULL || pstPvc == NULL )
+    {
+        return FALSE;
+    }
+
+    while( isspace( (unsigned char)*pString ) )
+    {
+        pString++;
+    }
+
+    if( strncasecmp( pString, XDSL_PVC_PREFIX, strlen( XDSL_PVC_PREFIX ) ) == 0 )
+    {
+        pString += strlen( XDSL_PVC_PREFIX );
+    }
+
+    if( !isdigit( (unsigned char)*( pString + strspn( pString, " " ) ) ) )
+    {
+        return FALSE;
+    }
+
+    ulVpi = strtoul( pString, &pEnd, 10 );
+    if( *pEnd != '/' || !isdigit( (unsigned char)pEnd[1] ) )
+    {
+        return FALSE;
+    }
+
+    ulVci = strtoul( pEnd + 1, &pEnd, 10 );
+    while( isspace( (unsigned char)*pEnd ) )
+    {
+        pEnd++;
+    }
+
+    if( *pEnd != '\0' || ulVpi > XDSL_PVC_MAX_VPI || ulVci < XDSL_PVC_MIN_VCI || ulVci > XDSL_PVC_MAX_VCI )
+    {
+        return FALSE;
+    }
+
+    pstPvc->Vpi = (UINT)ulVpi;
+    pstPvc->Vci = (UINT)ulVci;
+
+    return TRUE;
+}
+
+VOID XdslPvcFormat( const XDSL_PVC *pstPvc, char *pString, size_t stringLen )
+{
+    if( pstPvc == NULL || pString == NULL || stringLen == 0 )
+    {
+        return;
+    }
+
+    snprintf( pString, stringLen, XDSL_PVC_PREFIX " %u/%u", pstPvc->Vpi, pstPvc->Vci );
+}
+
+/* Appends pstPvc unless it is already a candidate, returns the new count */
+static INT XdslPvcSearchAdd( const XDSL_PVC *pstPvc, PXDSL_PVC pstCandidates, INT iCount, INT iMaxCandidates )
+{
+    INT i;
+
+    for( i = 0; i < iCount; i++ )
+    {
+        if( pstCandidates[i].Vpi == pstPvc->Vpi && pstCandidates[i].Vci == pstPvc->Vci )
+        {
+            return iCount;
+        }
+    }
+
+    if( iCount < iMaxCandidates )
+    {
+        pstCandidates[iCount++] = *pstPvc;
+    }
+
+    return iCount;
+}
+
+INT XdslPvcSearchBuildCandidates( const char *pPreferred, const char *pSearchList, PXDSL_PVC pstCandidates, INT iMaxCandidates )
+{
+    char     acToken[XDSL_PVC_STR_LEN];
+    XDSL_PVC stPvc;
+    size_t   length;
+    INT      iCount = 0;
+
+    if( pstCandidates == NULL || iMaxCandidates <= 0 )
+    {
+        return 0;
+    }
+
+    if( pPreferred != NULL && XdslPvcParse( pPreferred, &stPvc ) )
+    {
+        iCount = XdslPvcSearchAdd( &stPvc, pstCandidates, iCount, iMaxCandidates );
+    }
+
+    if( pSearchList == NULL )
+    {
+        return iCount;
+    }
+
+    while( *pSearchList != '\0' )
+    {
+        length = strcspn( pSearchList, "," );
+        snprintf( acToken, sizeof(acToken), "%.*s", (int)length, pSearchList );
+
+        if( XdslPvcParse( acToken, &stPvc ) )
+        {
+            iCount = XdslPvcSearchAdd( &stPvc, pstCandidates, iCount, iMaxCandidates );
+        }
+        else if( acToken[strspn( acToken, " " )] != '\0' )
+        {
+            CcspTraceWarning(( "%s : Ignoring invalid PVC '%s' in VCSearchList\n", __FUNCTION__, acToken ));
+        }
+
+        pSearchList += length;
+        if( *pSearchList == ',' )
+        {
+            pSearchList++;
+        }
+    }
+
+    return iCount;
+}
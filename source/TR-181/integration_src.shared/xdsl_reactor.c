@@ -0,0 +1,405 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_reactor.c
+    For CCSP Component:  dsl event loop
+
+---------------------------------------------------------------
+
+    Description:
+
+    Single epoll loop shared by the whole manager. It watches the event
+    ring eventfd and one timerfd per periodic activity (line state
+    machines, report interval) and hands the resulting work to a small
+    fixed pool of worker threads, so blocking bus and HAL calls never
+    stall the loop and no thread is created per event.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include "xdsl_reactor.h"
+
+#define XDSL_REACTOR_WORK_QUEUE_MASK        ( XDSL_REACTOR_WORK_QUEUE_SIZE - 1 )
+
+typedef enum
+_XDSL_REACTOR_SOURCE_TYPE
+{
+    XDSL_REACTOR_SOURCE_FREE = 0,
+    XDSL_REACTOR_SOURCE_FD,
+    XDSL_REACTOR_SOURCE_TIMER
+} XDSL_REACTOR_SOURCE_TYPE;
+
+typedef struct
+_XDSL_REACTOR_SOURCE
+{
+    XDSL_REACTOR_SOURCE_TYPE    enType;
+    INT                         iFd;
+    UINT                        uGeneration;
+    XDSL_REACTOR_FD_HANDLER     pFdHandler;
+    XDSL_REACTOR_TIMER_HANDLER  pTimerHandler;
+    PVOID                       pContext;
+} XDSL_REACTOR_SOURCE;
+
+typedef struct
+_XDSL_REACTOR_WORK
+{
+    XDSL_REACTOR_WORK_HANDLER   pHandler;
+    PVOID                       pContext;
+} XDSL_REACTOR_WORK;
+
+static XDSL_REACTOR_SOURCE g_ReactorSources[XDSL_REACTOR_MAX_SOURCES];
+static pthread_mutex_t g_ReactorSourceMutex = PTHREAD_MUTEX_INITIALIZER;
+static INT g_ReactorEpollFd = -1;
+
+static XDSL_REACTOR_WORK g_ReactorWork[XDSL_REACTOR_WORK_QUEUE_SIZE];
+static UINT g_ReactorWorkHead = 0;
+static UINT g_ReactorWorkTail = 0;
+static pthread_mutex_t g_ReactorWorkMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_ReactorWorkCond = PTHREAD_COND_INITIALIZER;
+
+static void *XdslReactorThread( void *arg );
+static void *XdslReactorWorkerThread( void *arg );
+
+static ANSC_STATUS XdslReactorStartThread( void *(*pThreadFn)(void *) )
+{
+    pthread_attr_t attr;
+    pthread_t      threadId;
+    int            iErrorCode;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, XDSL_REACTOR_STACK_SIZE);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    iErrorCode = pthread_create(&threadId, &attr, pThreadFn, NULL);
+    pthread_attr_destroy(&attr);
+
+    if( iErrorCode != 0 )
+    {
+        CcspTraceError(("%s Failed to start thread EC:%d\n", __FUNCTION__, iErrorCode));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslReactorInit( VOID )
+{
+    int i;
+
+    if( g_ReactorEpollFd >= 0 )
+    {
+        return ANSC_STATUS_SUCCESS;
+    }
+
+    g_ReactorEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    if( g_ReactorEpollFd < 0 )
+    {
+        CcspTraceError(("%s Failed to create epoll fd errno:%d\n", __FUNCTION__, errno));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    for( i = 0; i < XDSL_REACTOR_WORKERS; i++ )
+    {
+        if( XdslReactorStartThread(XdslReactorWorkerThread) != ANSC_STATUS_SUCCESS )
+        {
+            return ANSC_STATUS_FAILURE;
+        }
+    }
+
+    if( XdslReactorStartThread(XdslReactorThread) != ANSC_STATUS_SUCCESS )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    CcspTraceInfo(("%s - Event loop started with %d workers\n", __FUNCTION__, XDSL_REACTOR_WORKERS));
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/* Caller holds g_ReactorSourceMutex */
+static INT XdslReactorAddSource( XDSL_REACTOR_SOURCE_TYPE enType, INT iFd, XDSL_REACTOR_FD_HANDLER pFdHandler, XDSL_REACTOR_TIMER_HANDLER pTimerHandler, PVOID pContext )
+{
+    struct epoll_event stEvent;
+    int i;
+
+    for( i = 0; i < XDSL_REACTOR_MAX_SOURCES; i++ )
+    {
+        if( g_ReactorSources[i].enType == XDSL_REACTOR_SOURCE_FREE )
+        {
+            break;
+        }
+    }
+
+    if( i == XDSL_REACTOR_MAX_SOURCES )
+    {
+        CcspTraceError(("%s No free reactor source for fd %d\n", __FUNCTION__, iFd));
+        return -1;
+    }
+
+    g_ReactorSources[i].uGeneration++;
+
+    memset(&stEvent, 0, sizeof(stEvent));
+    stEvent.events = EPOLLIN;
+    stEvent.data.u64 = ((uint64_t)g_ReactorSources[i].uGeneration << 32) | (uint64_t)i;
+    if( epoll_ctl(g_ReactorEpollFd, EPOLL_CTL_ADD, iFd, &stEvent) < 0 )
+    {
+        CcspTraceError(("%s Failed to watch fd %d errno:%d\n", __FUNCTION__, iFd, errno));
+        return -1;
+    }
+
+    g_ReactorSources[i].enType        = enType;
+    g_ReactorSources[i].iFd           = iFd;
+    g_ReactorSources[i].pFdHandler    = pFdHandler;
+    g_ReactorSources[i].pTimerHandler = pTimerHandler;
+    g_ReactorSources[i].pContext      = pContext;
+
+    return i;
+}
+
+/* Caller holds g_ReactorSourceMutex */
+static XDSL_REACTOR_SOURCE *XdslReactorFindSource( INT iFd )
+{
+    int i;
+
+    for( i = 0; i < XDSL_REACTOR_MAX_SOURCES; i++ )
+    {
+        if( g_ReactorSources[i].enType != XDSL_REACTOR_SOURCE_FREE && g_ReactorSources[i].iFd == iFd )
+        {
+            return &g_ReactorSources[i];
+        }
+    }
+
+    return NULL;
+}
+
+ANSC_STATUS XdslReactorAddFd( INT iFd, XDSL_REACTOR_FD_HANDLER pHandler, PVOID pContext )
+{
+    INT iSlot;
+
+    if( iFd < 0 || pHandler == NULL || g_ReactorEpollFd < 0 )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock(&g_ReactorSourceMutex);
+    iSlot = XdslReactorAddSource(XDSL_REACTOR_SOURCE_FD, iFd, pHandler, NULL, pContext);
+    pthread_mutex_unlock(&g_ReactorSourceMutex);
+
+    return (iSlot < 0) ? ANSC_STATUS_FAILURE : ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslReactorRemoveFd( INT iFd )
+{
+    XDSL_REACTOR_SOURCE *pSource = NULL;
+
+    pthread_mutex_lock(&g_ReactorSourceMutex);
+    pSource = XdslReactorFindSource(iFd);
+    if( pSource != NULL )
+    {
+        epoll_ctl(g_ReactorEpollFd, EPOLL_CTL_DEL, iFd, NULL);
+        pSource->enType = XDSL_REACTOR_SOURCE_FREE;
+    }
+    pthread_mutex_unlock(&g_ReactorSourceMutex);
+
+    return (pSource == NULL) ? ANSC_STATUS_FAILURE : ANSC_STATUS_SUCCESS;
+}
+
+/* Timers are created disarmed, the returned id is the underlying timerfd */
+INT XdslReactorAddTimer( XDSL_REACTOR_TIMER_HANDLER pHandler, PVOID pContext )
+{
+    INT iTimerFd;
+    INT iSlot;
+
+    if( pHandler == NULL || g_ReactorEpollFd < 0 )
+    {
+        return -1;
+    }
+
+    iTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if( iTimerFd < 0 )
+    {
+        CcspTraceError(("%s Failed to create timerfd errno:%d\n", __FUNCTION__, errno));
+        return -1;
+    }
+
+    pthread_mutex_lock(&g_ReactorSourceMutex);
+    iSlot = XdslReactorAddSource(XDSL_REACTOR_SOURCE_TIMER, iTimerFd, NULL, pHandler, pContext);
+    pthread_mutex_unlock(&g_ReactorSourceMutex);
+
+    if( iSlot < 0 )
+    {
+        close(iTimerFd);
+        return -1;
+    }
+
+    return iTimerFd;
+}
+
+/* ulFirstMs of 0 disarms the timer, ulIntervalMs of 0 makes it one-shot */
+ANSC_STATUS XdslReactorSetTimer( INT iTimerId, ULONG ulFirstMs, ULONG ulIntervalMs )
+{
+    struct itimerspec stSpec;
+
+    memset(&stSpec, 0, sizeof(stSpec));
+    stSpec.it_value.tv_sec     = ulFirstMs / 1000;
+    stSpec.it_value.tv_nsec    = (ulFirstMs % 1000) * 1000000;
+    stSpec.it_interval.tv_sec  = ulIntervalMs / 1000;
+    stSpec.it_interval.tv_nsec = (ulIntervalMs % 1000) * 1000000;
+
+    if( timerfd_settime(iTimerId, 0, &stSpec, NULL) < 0 )
+    {
+        CcspTraceError(("%s Failed to arm timer %d errno:%d\n", __FUNCTION__, iTimerId, errno));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+/*
+ * Once this returns the handler is not running and will not run again, so
+ * the caller may release the timer context.
+ */
+ANSC_STATUS XdslReactorRemoveTimer( INT iTimerId )
+{
+    if( XdslReactorRemoveFd(iTimerId) != ANSC_STATUS_SUCCESS )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    close(iTimerId);
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslReactorSubmit( XDSL_REACTOR_WORK_HANDLER pHandler, PVOID pContext )
+{
+    if( pHandler == NULL )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock(&g_ReactorWorkMutex);
+    if( (g_ReactorWorkHead - g_ReactorWorkTail) == XDSL_REACTOR_WORK_QUEUE_SIZE )
+    {
+        pthread_mutex_unlock(&g_ReactorWorkMutex);
+        CcspTraceError(("%s Work queue full\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    g_ReactorWork[g_ReactorWorkHead & XDSL_REACTOR_WORK_QUEUE_MASK].pHandler = pHandler;
+    g_ReactorWork[g_ReactorWorkHead & XDSL_REACTOR_WORK_QUEUE_MASK].pContext = pContext;
+    g_ReactorWorkHead++;
+    pthread_cond_signal(&g_ReactorWorkCond);
+    pthread_mutex_unlock(&g_ReactorWorkMutex);
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+static void XdslReactorDispatch( uint64_t u64Data )
+{
+    XDSL_REACTOR_SOURCE *pSource = NULL;
+    UINT                 uSlot   = (UINT)(u64Data & 0xFFFFFFFF);
+    UINT                 uGen    = (UINT)(u64Data >> 32);
+    uint64_t             u64Expirations;
+
+    if( uSlot >= XDSL_REACTOR_MAX_SOURCES )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&g_ReactorSourceMutex);
+    pSource = &g_ReactorSources[uSlot];
+
+    //Ignore events of a source removed earlier in the same epoll batch
+    if( pSource->enType != XDSL_REACTOR_SOURCE_FREE && pSource->uGeneration == uGen )
+    {
+        if( pSource->enType == XDSL_REACTOR_SOURCE_TIMER )
+        {
+            if( read(pSource->iFd, &u64Expirations, sizeof(u64Expirations)) == sizeof(u64Expirations) )
+            {
+                pSource->pTimerHandler(pSource->pContext);
+            }
+        }
+        else
+        {
+            pSource->pFdHandler(pSource->iFd, EPOLLIN, pSource->pContext);
+        }
+    }
+    pthread_mutex_unlock(&g_ReactorSourceMutex);
+}
+
+static void *XdslReactorThread( void *arg )
+{
+    struct epoll_event astEvents[XDSL_REACTOR_MAX_SOURCES];
+    int                iCount;
+    int                i;
+
+    while( 1 )
+    {
+        iCount = epoll_wait(g_ReactorEpollFd, astEvents, XDSL_REACTOR_MAX_SOURCES, -1);
+        if( iCount < 0 )
+        {
+            if( errno == EINTR )
+            {
+                continue;
+            }
+
+            CcspTraceError(("%s epoll_wait failed errno:%d\n", __FUNCTION__, errno));
+            break;
+        }
+
+        for( i = 0; i < iCount; i++ )
+        {
+            XdslReactorDispatch(astEvents[i].data.u64);
+        }
+    }
+
+    return NULL;
+}
+
+static void *XdslReactorWorkerThread( void *arg )
+{
+    XDSL_REACTOR_WORK stWork;
+
+    while( 1 )
+    {
+        pthread_mutex_lock(&g_ReactorWorkMutex);
+        while( g_ReactorWorkHead == g_ReactorWorkTail )
+        {
+            pthread_cond_wait(&g_ReactorWorkCond, &g_ReactorWorkMutex);
+        }
+        stWork = g_ReactorWork[g_ReactorWorkTail & XDSL_REACTOR_WORK_QUEUE_MASK];
+        g_ReactorWorkTail++;
+        pthread_mutex_unlock(&g_ReactorWorkMutex);
+
+        stWork.pHandler(stWork.pContext);
+    }
+
+    return NULL;
+}
@@ -39,6 +39,7 @@
 #include "xdsl_apis.h"
 #include "xdsl_report.h"
 #include "xdsl_hal.h"
+#include "xdsl_reactor.h"
 
 char *rt_schema_buffer = NULL;
 
@@ -50,8 +51,11 @@ static ULONG CurrentOverrideReportingPeriod = 0;
 extern ANSC_HANDLE bus_handle;
 char deviceMAC[32] = {'\0'};
 
-static pthread_mutex_t XdslReportMutex = PTHREAD_MUTEX_INITIALIZER;
-static pthread_cond_t XdslReportCond = PTHREAD_COND_INITIALIZER;
+static INT XdslReportTimerId = -1;
+static UINT XdslReportScheduled = 0;
+static BOOL XdslReportParodusReady = FALSE;
+static ULONG XdslReportParodusRetrySec = 0;
+static pthread_mutex_t XdslReportTimer_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t device_mac_mutex = PTHREAD_MUTEX_INITIALIZER;
 static BOOL rt_schema_file_parsed = FALSE;
 static avro_value_iface_t *iface = NULL;
@@ -65,19 +69,23 @@ static size_t AvroRTSerializedSize;
 static size_t OneAvroRTSerializedSize;
 static char AvroRTSerializedBuf[WRITER_BUF_SIZE];
 
-// MD5SUM XdslReport.avsc = 5f2f0ce458e6b7c75faf7c0cf5a1d641
+// MD5SUM XdslReport.avsc = f2075de2ab731b561db4f60fc26f05fa
 
-static uint8_t RT_HASH[16] = {0x5f,0x2f,0x0c,0xe4,0x58,0xe6,0xb7,0xc7,
-                              0x5f,0xaf,0x7c,0x0c,0xf5,0xa1,0xd6,0x41};
+static uint8_t RT_HASH[16] = {0xf2,0x07,0x5d,0xe2,0xab,0x73,0x1b,0x56,
+                              0x1d,0xb4,0xf6,0x0f,0xc2,0x6f,0x05,0xfa};
 
 // TODO: Need to check and include correct UUID below
 static uint8_t RT_UUID[16] = {0xc3,0x93,0x4a,0xec,0x72,0x3e,0x4c,0x98,
                               0x88,0xb5,0xaa,0x02,0x93,0x1d,0x5d,0xe5};
 
-char * XdslReportSchemaID = "c3934aec-723e-4c98-88b5-aa02931d5de5/5f2f0ce458e6b7c75faf7c0cf5a1d641";
+char * XdslReportSchemaID = "c3934aec-723e-4c98-88b5-aa02931d5de5/f2075de2ab731b561db4f60fc26f05fa";
 
 #define DEFAULT_WAIT_TIME_1_SEC 1
 
+/* Parodus connect retries back off as 2^c - 1 seconds, c from 2 up to 9 */
+#define PARODUS_RETRY_MIN_SEC   3
+#define PARODUS_RETRY_MAX_SEC   511
+
 /*
  * Returns the size of Schema contents
  */
@@ -248,6 +256,40 @@ static ANSC_STATUS XdslPrepareReportData(int line_id, int channel_id, XdslReport
         CcspTraceError(("%s Failed to get xDSL line statistics information \n", __FUNCTION__));
     }
 
+    /**
+     * Get link bring-up statistics, durations are in milliseconds.
+     */
+    DML_XDSL_BRINGUP_PHASE stPhase;
+    DML_XDSL_BRINGUP_TRACE stTrace;
+    memset(&stPhase, 0, sizeof(stPhase));
+    if (XdslBringUpGetPhaseStats(XDSL_BRINGUP_PHASE_TRAINING, &stPhase) == ANSC_STATUS_SUCCESS)
+    {
+        XdslBringUpFormatHistogram(stPhase.Histogram, stReportData->TrainTimeHistogram, sizeof(stReportData->TrainTimeHistogram));
+    }
+    if (XdslBringUpGetPhaseStats(XDSL_BRINGUP_PHASE_XTM_CONFIG, &stPhase) == ANSC_STATUS_SUCCESS)
+    {
+        XdslBringUpFormatHistogram(stPhase.Histogram, stReportData->XtmConfigTimeHistogram, sizeof(stReportData->XtmConfigTimeHistogram));
+    }
+    if (XdslBringUpGetPhaseStats(XDSL_BRINGUP_PHASE_WAN_NOTIFY, &stPhase) == ANSC_STATUS_SUCCESS)
+    {
+        XdslBringUpFormatHistogram(stPhase.Histogram, stReportData->WanNotifyTimeHistogram, sizeof(stReportData->WanNotifyTimeHistogram));
+    }
+    if (XdslBringUpGetPhaseStats(XDSL_BRINGUP_PHASE_TOTAL, &stPhase) == ANSC_STATUS_SUCCESS)
+    {
+        stReportData->BringUpCount = stPhase.Count;
+        XdslBringUpFormatHistogram(stPhase.Histogram, stReportData->BringUpTimeHistogram, sizeof(stReportData->BringUpTimeHistogram));
+    }
+
+    memset(&stTrace, 0, sizeof(stTrace));
+    if (XdslBringUpGetTraces(&stTrace, 1) == 1)
+    {
+        stReportData->LastTrainTime = stTrace.TrainTime;
+        stReportData->LastXtmConfigTime = stTrace.XtmConfigTime;
+        stReportData->LastWanNotifyTime = stTrace.WanNotifyTime;
+        stReportData->LastBringUpTime = stTrace.TotalTime;
+        strncpy(stReportData->LastBringUpResult, stTrace.Result, sizeof(stReportData->LastBringUpResult) - 1);
+    }
+
     return ANSC_STATUS_SUCCESS;
 }
 
@@ -871,6 +913,136 @@ static int harvester_report_Xdsl(XdslReportData *head)
     if (CHK_AVRO_ERR)
         CcspTraceInfo(("%s\n", avro_strerror()));
 
+    // BringUpCount
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "BringUpCount", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_long(&optional, (long)ptr->BringUpCount);
+    CcspTraceInfo(("BringUpCount\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // LastTrainTime
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "LastTrainTime", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_long(&optional, (long)ptr->LastTrainTime);
+    CcspTraceInfo(("LastTrainTime\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // LastXtmConfigTime
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "LastXtmConfigTime", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_long(&optional, (long)ptr->LastXtmConfigTime);
+    CcspTraceInfo(("LastXtmConfigTime\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // LastWanNotifyTime
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "LastWanNotifyTime", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_long(&optional, (long)ptr->LastWanNotifyTime);
+    CcspTraceInfo(("LastWanNotifyTime\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // LastBringUpTime
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "LastBringUpTime", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_long(&optional, (long)ptr->LastBringUpTime);
+    CcspTraceInfo(("LastBringUpTime\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // LastBringUpResult - string
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "LastBringUpResult", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_string(&optional, ptr->LastBringUpResult);
+    CcspTraceInfo(("LastBringUpResult\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // TrainTimeHistogram - string
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "TrainTimeHistogram", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_string(&optional, ptr->TrainTimeHistogram);
+    CcspTraceInfo(("TrainTimeHistogram\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // XtmConfigTimeHistogram - string
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "XtmConfigTimeHistogram", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_string(&optional, ptr->XtmConfigTimeHistogram);
+    CcspTraceInfo(("XtmConfigTimeHistogram\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // WanNotifyTimeHistogram - string
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "WanNotifyTimeHistogram", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_string(&optional, ptr->WanNotifyTimeHistogram);
+    CcspTraceInfo(("WanNotifyTimeHistogram\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
+    // BringUpTimeHistogram - string
+    avro_value_get_by_name(&adr, "data", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_get_by_name(&adrField, "BringUpTimeHistogram", &adrField, NULL);
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s LINE %d\n", avro_strerror(), __LINE__));
+    avro_value_set_branch(&adrField, 1, &optional);
+    avro_value_set_string(&optional, ptr->BringUpTimeHistogram);
+    CcspTraceInfo(("BringUpTimeHistogram\tType: %d\n", avro_value_get_type(&optional)));
+    if (CHK_AVRO_ERR)
+        CcspTraceInfo(("%s\n", avro_strerror()));
+
     /* check for writer size, if buffer is almost full, skip trailing linklist */
     avro_value_sizeof(&adr, &AvroRTSerializedSize);
     OneAvroRTSerializedSize = (OneAvroRTSerializedSize == 0) ? AvroRTSerializedSize : OneAvroRTSerializedSize;
@@ -962,37 +1134,6 @@ static void rt_avro_cleanup()
     rt_schema_file_parsed = FALSE;
 }
 
-/*
- * Function to wait for ReportingPeriod
- */
-static void WaitForPthreadConditionTimeout(ULONG waitingPeriod)
-{
-    struct timespec _ts;
-    struct timespec _now;
-    int n;
-
-    memset(&_ts, 0, sizeof(struct timespec));
-    memset(&_now, 0, sizeof(struct timespec));
-
-    pthread_mutex_lock(&XdslReportMutex);
-
-    clock_gettime(CLOCK_REALTIME, &_now);
-    _ts.tv_sec = _now.tv_sec + waitingPeriod;
-    CcspTraceInfo(("XDSL REPORT %s : Waiting for %d sec\n", __FUNCTION__, waitingPeriod));
-
-    n = pthread_cond_timedwait(&XdslReportCond, &XdslReportMutex, &_ts);
-    if (n == 0)
-    {
-        CcspTraceInfo(("XDSL REPORT %s : pthread_cond_timedwait SIGNALLED OK!!!\n", __FUNCTION__));
-    }
-    else if (n != ETIMEDOUT)
-    {
-        CcspTraceInfo(("XDSL REPORT %s : pthread_cond_timedwait ERROR(%d)!!!. %s \n", __FUNCTION__, n, strerror(n)));
-    }
-
-    pthread_mutex_unlock(&XdslReportMutex);
-}
-
 static int PrepareAndSendXdslReport()
 {
     int ret = 0;
@@ -1027,82 +1168,148 @@ static int PrepareAndSendXdslReport()
 }
 
 /*
- *  XDSL Report Thread Function
+ *  Stops XDSL Data Harvesting, runs on a reactor worker
  */
-static void *StartXdslReporting()
+static void StopXdslReporting()
+{
+    XdslReactorSetTimer(XdslReportTimerId, 0, 0);
+    XdslReportSetStatus(FALSE);
+    XdslReportParodusReady = FALSE;
+    XdslReportParodusRetrySec = 0;
+    rt_avro_cleanup();
+    CcspTraceInfo(("XDSL REPORT %s EXIT \n", __FUNCTION__));
+    CcspTraceInfo(("XDSL REPORT %s Stopped XDSL Data Harvesting  \n", __FUNCTION__));
+}
+
+/*
+ *  Arms the report timer unless reporting was disabled meanwhile,
+ *  returns FALSE when reporting is disabled
+ */
+static BOOL XdslReportArmTimer(ULONG ulFirstMs)
+{
+    BOOL bEnabled;
+
+    pthread_mutex_lock(&XdslReportTimer_mutex);
+    bEnabled = XdslReportStatus;
+    if (bEnabled && XdslReactorSetTimer(XdslReportTimerId, ulFirstMs, 0) != ANSC_STATUS_SUCCESS)
+    {
+        CcspTraceWarning(("XDSL REPORT %s : Failed to arm report timer  \n", __FUNCTION__));
+    }
+    pthread_mutex_unlock(&XdslReportTimer_mutex);
+
+    return bEnabled;
+}
+
+/*
+ *  XDSL Report Step, runs on a reactor worker and rearms the report timer
+ *  for the next reporting period
+ */
+static void XdslReportStep(PVOID pContext)
 {
-    CcspTraceInfo(("XDSL REPORT %s ENTER \n", __FUNCTION__));
-    CcspTraceWarning(("XDSL REPORT %s Starting Thread to start XDSL Data Harvesting  \n", __FUNCTION__));
     int ret = 0;
     ULONG uDftOverrideTTL = 0;
     ULONG uDftReportingPeriod = 0;
     ULONG uOverrideReportingPeriod = 0;
     ULONG waitingTimePeriod = DEFAULT_WAIT_TIME_1_SEC;
 
-    while (!ret && XdslReportGetStatus())
+    if (!XdslReportGetStatus())
+    {
+        StopXdslReporting();
+        __atomic_store_n(&XdslReportScheduled, 0, __ATOMIC_SEQ_CST);
+        return;
+    }
+
+    if (!XdslReportParodusReady)
     {
-        uDftOverrideTTL = XdslReportGetDefaultOverrideTTL();
-        uDftReportingPeriod = XdslReportGetDefaultReportingPeriod();
-        uOverrideReportingPeriod = XdslReportGetReportingPeriod();
-        if (uDftOverrideTTL != 0)
+        CcspTraceWarning(("XDSL REPORT %s Starting XDSL Data Harvesting  \n", __FUNCTION__));
+        //Single attempt, the worker is shared with the state machine and XTM jobs
+        if (ParodusClientInit() != ANSC_STATUS_SUCCESS)
         {
-            if (uOverrideReportingPeriod == 0)
-            {
-                waitingTimePeriod = uDftOverrideTTL;
-                XdslReportSetDefaultOverrideTTL(0);
-            }
-            else
+            XdslReportParodusRetrySec = (XdslReportParodusRetrySec == 0) ? PARODUS_RETRY_MIN_SEC :
+                                        ((XdslReportParodusRetrySec * 2 + 1 > PARODUS_RETRY_MAX_SEC) ? PARODUS_RETRY_MAX_SEC : XdslReportParodusRetrySec * 2 + 1);
+            CcspTraceInfo(("XDSL REPORT %s : Parodus not ready, retrying in %lu sec\n", __FUNCTION__, XdslReportParodusRetrySec));
+            if (!XdslReportArmTimer(XdslReportParodusRetrySec * 1000))
             {
-                if (CurrentOverrideReportingPeriod >= uDftOverrideTTL)
-                {
-                    CurrentOverrideReportingPeriod = 0;
-                    XdslReportSetDefaultOverrideTTL(0);
-                    waitingTimePeriod = DEFAULT_WAIT_TIME_1_SEC; 
-                }
-                else
-                {
-                    CurrentOverrideReportingPeriod = CurrentOverrideReportingPeriod + uOverrideReportingPeriod;
-                    CcspTraceInfo(("CurrentOverrideReportingPeriod[%ld]\n", CurrentOverrideReportingPeriod));
-                    ret = PrepareAndSendXdslReport();
-                    waitingTimePeriod = uOverrideReportingPeriod;
-                }
+                StopXdslReporting();
             }
+            __atomic_store_n(&XdslReportScheduled, 0, __ATOMIC_SEQ_CST);
+            return;
+        }
+        XdslReportParodusReady = TRUE;
+        XdslReportParodusRetrySec = 0;
+    }
+
+    uDftOverrideTTL = XdslReportGetDefaultOverrideTTL();
+    uDftReportingPeriod = XdslReportGetDefaultReportingPeriod();
+    uOverrideReportingPeriod = XdslReportGetReportingPeriod();
+    if (uDftOverrideTTL != 0)
+    {
+        if (uOverrideReportingPeriod == 0)
+        {
+            waitingTimePeriod = uDftOverrideTTL;
+            XdslReportSetDefaultOverrideTTL(0);
         }
         else
         {
-            if (uDftReportingPeriod != 0)
+            if (CurrentOverrideReportingPeriod >= uDftOverrideTTL)
             {
-                ret = PrepareAndSendXdslReport();
-                waitingTimePeriod = uDftReportingPeriod;
+                CurrentOverrideReportingPeriod = 0;
+                XdslReportSetDefaultOverrideTTL(0);
+                waitingTimePeriod = DEFAULT_WAIT_TIME_1_SEC; 
             }
             else
             {
-                waitingTimePeriod = DEFAULT_WAIT_TIME_1_SEC; 
+                CurrentOverrideReportingPeriod = CurrentOverrideReportingPeriod + uOverrideReportingPeriod;
+                CcspTraceInfo(("CurrentOverrideReportingPeriod[%ld]\n", CurrentOverrideReportingPeriod));
+                ret = PrepareAndSendXdslReport();
+                waitingTimePeriod = uOverrideReportingPeriod;
             }
         }
-        WaitForPthreadConditionTimeout(waitingTimePeriod);
+    }
+    else
+    {
+        if (uDftReportingPeriod != 0)
+        {
+            ret = PrepareAndSendXdslReport();
+            waitingTimePeriod = uDftReportingPeriod;
+        }
+        else
+        {
+            waitingTimePeriod = DEFAULT_WAIT_TIME_1_SEC; 
+        }
     }
 
-    XdslReportSetStatus(FALSE);
-    rt_avro_cleanup();
-    CcspTraceInfo(("XDSL REPORT %s EXIT \n", __FUNCTION__));
-    CcspTraceInfo(("XDSL REPORT %s Stopped Thread for XDSL Data Harvesting  \n", __FUNCTION__));
+    if (ret)
+    {
+        StopXdslReporting();
+    }
+    else
+    {
+        CcspTraceInfo(("XDSL REPORT %s : Waiting for %d sec\n", __FUNCTION__, waitingTimePeriod));
+        if (!XdslReportArmTimer(waitingTimePeriod * 1000))
+        {
+            //Disabled while this step ran, its own step may have been dropped
+            StopXdslReporting();
+        }
+    }
 
-    return NULL; // shouldn't return;
+    __atomic_store_n(&XdslReportScheduled, 0, __ATOMIC_SEQ_CST);
 }
 
 /*
- *  XDSL Report Thread Function
+ *  Queues one report step unless one is already queued or running
  */
-void * XdslReportingThread(void *args)
+static void XdslReportSchedule(PVOID pContext)
 {
-    int ret = 0;
-    ret = ParodusClientInit();
-    if (ret == ANSC_STATUS_SUCCESS) 
+    if (__atomic_exchange_n(&XdslReportScheduled, 1, __ATOMIC_SEQ_CST) != 0)
     {
-        StartXdslReporting();
+        return;
+    }
+
+    if (XdslReactorSubmit(XdslReportStep, NULL) != ANSC_STATUS_SUCCESS)
+    {
+        __atomic_store_n(&XdslReportScheduled, 0, __ATOMIC_SEQ_CST);
     }
-    return NULL;
 }
 
 /*
@@ -1112,39 +1319,38 @@ int XdslReportSetStatus(BOOL status)
 {
     CcspTraceInfo(("XDSL REPORT %s ENTER\n", __FUNCTION__));
     CcspTraceInfo(("XDSL REPORT %s  Old[%d] New[%d] \n", __FUNCTION__, XdslReportGetStatus, status));
+    pthread_mutex_lock(&XdslReportTimer_mutex);
     if (XdslReportStatus != status)
+    {
         XdslReportStatus = status;
+    }
     else
+    {
+        pthread_mutex_unlock(&XdslReportTimer_mutex);
         return 0;
+    }
 
-
-    if (XdslReportStatus)
+    //No report may fire once disabled, the timer is only rearmed under this lock
+    if (!status && XdslReportTimerId >= 0)
     {
-        pthread_t tid;
-        CcspTraceInfo(("XDSL REPORT %s Starting Thread to start XDSL Data Harvesting  \n", __FUNCTION__));
-
-        if (pthread_create(&tid, NULL, XdslReportingThread, NULL))
-        {
-            CcspTraceWarning(("XDSL REPORT %s : Failed to Start Thread to start XDSL Harvesting  \n", __FUNCTION__));
-            return ANSC_STATUS_FAILURE;
-        }
+        XdslReactorSetTimer(XdslReportTimerId, 0, 0);
     }
-    else
+    pthread_mutex_unlock(&XdslReportTimer_mutex);
+
+
+    if (XdslReportTimerId < 0)
     {
-        int ret;
-        pthread_mutex_lock(&XdslReportMutex);
-        // Send signal to unblock thread that uses conditional variable XdslReportCond
-        ret = pthread_cond_signal(&XdslReportCond);
-        pthread_mutex_unlock(&XdslReportMutex);
-        if (ret == 0)
-        {
-            CcspTraceInfo(("XDSL REPORT %s : pthread_cond_signal success\n", __FUNCTION__));
-        }
-        else
+        XdslReportTimerId = XdslReactorAddTimer(XdslReportSchedule, NULL);
+        if (XdslReportTimerId < 0)
         {
-            CcspTraceInfo(("XDSL REPORT %s : pthread_cond_signal fail\n", __FUNCTION__));
+            CcspTraceWarning(("XDSL REPORT %s : Failed to create report timer  \n", __FUNCTION__));
+            return ANSC_STATUS_FAILURE;
         }
     }
+
+    // Start harvesting, or let a pending step notice the disable and clean up
+    CcspTraceInfo(("XDSL REPORT %s %s XDSL Data Harvesting  \n", __FUNCTION__, XdslReportStatus ? "Starting" : "Stopping"));
+    XdslReportSchedule(NULL);
     CcspTraceInfo(("XDSL REPORT %s : EXIT \n", __FUNCTION__));
 
     return 0;
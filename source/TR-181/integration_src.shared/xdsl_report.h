@@ -69,6 +69,16 @@ typedef struct _XdslReportData
         UINT    QuarterHourStart;
         char    AllowedProfiles[256];
         char    CurrentProfile[64];
+        UINT    BringUpCount;
+        UINT    LastTrainTime;
+        UINT    LastXtmConfigTime;
+        UINT    LastWanNotifyTime;
+        UINT    LastBringUpTime;
+        char    LastBringUpResult[32];
+        char    TrainTimeHistogram[256];
+        char    XtmConfigTimeHistogram[256];
+        char    WanNotifyTimeHistogram[256];
+        char    BringUpTimeHistogram[256];
 
 }XdslReportData;
 
@@ -142,27 +142,17 @@ static void get_parodus_url(char **url)
 }
 #endif
 
+/*
+ * One connect attempt to parodus. It runs on a shared reactor worker, so it
+ * never sleeps, the caller retries with backoff from its timer.
+ */
 int ParodusClientInit()
 {
-    CcspTraceInfo(("XDSL REPORT %s : LINE %d client_instance = %p\n", __FUNCTION__, __LINE__, client_instance));
-    int backoffRetryTime = 0;
-    int backoff_max_time = 9;
-    int max_retry_sleep;
-    //Retry Backoff count shall start at c=2 & calculate 2^c - 1.
-    int c =2;
-    int retval=-1;
     char *parodus_url = NULL;
+    int ret;
 
     CcspTraceInfo((" ******** Start of ParodusClientInit ********\n"));
 
-    CcspTraceInfo(("XDSL REPORT %s : LINE %d client_instance = %p\n", __FUNCTION__, __LINE__, client_instance));
-
-    max_retry_sleep = (int) pow(2, backoff_max_time) -1;
-    CcspTraceInfo((" max_retry_sleep is %d\n", max_retry_sleep ));
-
-    CcspTraceInfo((" Call parodus library init api \n"));
-
-    CcspTraceInfo(("XDSL REPORT %s : LINE %d client_instance = %p\n", __FUNCTION__, __LINE__, client_instance));
     get_parodus_url(&parodus_url);
     if(parodus_url == NULL)
     {
@@ -177,39 +167,15 @@ int ParodusClientInit()
 
     CcspTraceInfo((" Configurations => service_name : %s parodus_url : %s client_url : %s\n", cfg1.service_name, cfg1.parodus_url, cfg1.client_url ));
 
-    while(1)
+    ret = libparodus_init (&client_instance, &cfg1);
+    if(ret == 0)
     {
-        CcspTraceInfo(("XDSL REPORT %s : LINE %d client_instance = %p\n", __FUNCTION__, __LINE__, client_instance));
-        if(backoffRetryTime < max_retry_sleep)
-        {
-            backoffRetryTime = (int) pow(2, c) -1;
-        }
-
-        CcspTraceInfo((" New backoffRetryTime value calculated as %d seconds\n", backoffRetryTime));
-        int ret =libparodus_init (&client_instance, &cfg1);
-
-        CcspTraceInfo(("XDSL REPORT %s : LINE %d client_instance = %p\n", __FUNCTION__, __LINE__, client_instance));
-        CcspTraceInfo((" ret is %d\n",ret));
-        if(ret ==0)
-        {
-            CcspTraceInfo((" Init for parodus Success..!!\n"));
-            return ANSC_STATUS_SUCCESS;
-        }
-        else
-        {
-            CcspTraceWarning((" Init for parodus (url %s) failed: '%s'\n", parodus_url, libparodus_strerror(ret)));
-            if( NULL == parodus_url )
-            {
-                get_parodus_url(&parodus_url);
-                cfg1.parodus_url = parodus_url;
-            }
-            sleep(backoffRetryTime);
-            c++;
-        }
-        retval = libparodus_shutdown(client_instance);
-        CcspTraceInfo((" libparodus_shutdown retval: %d\n", retval));
+        CcspTraceInfo((" Init for parodus Success..!!\n"));
+        return ANSC_STATUS_SUCCESS;
     }
-    CcspTraceInfo((" libparodus_init failure \n"));
+
+    CcspTraceWarning((" Init for parodus (url %s) failed: '%s'\n", parodus_url, libparodus_strerror(ret)));
+    free(parodus_url);
     return ANSC_STATUS_FAILURE;
 }
 
@@ -0,0 +1,228 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_shaper.c
+    For CCSP Component:  dsl WAN shaper rate recommendation
+
+---------------------------------------------------------------
+
+    Description:
+
+    Turns the synchronised line rates into the rate a WAN shaper should
+    send at so the queue builds in the router, where it is managed, and
+    not in the modem. The line rate is what the PHY carries, the shaper
+    counts IP packets, so the per packet overhead of the transport is
+    taken off for a reference packet size:
+
+    ATM   every packet plus its encapsulation and the 8 byte AAL5 trailer
+          is padded to whole 48 byte cell payloads sent in 53 byte cells.
+    PTM   every packet plus its encapsulation is carried by 64/65 PTM-TC
+          encoding.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <string.h>
+#include <pthread.h>
+#include "xdsl_shaper.h"
+
+#define XDSL_SHAPER_ATM_CELL_SIZE           53
+#define XDSL_SHAPER_ATM_CELL_PAYLOAD        48
+#define XDSL_SHAPER_AAL5_TRAILER            8
+#define XDSL_SHAPER_PTM_CODEWORD_SIZE       65
+#define XDSL_SHAPER_PTM_CODEWORD_PAYLOAD    64
+
+#define XDSL_SHAPER_MIN_PACKET_SIZE         64
+#define XDSL_SHAPER_MAX_PACKET_SIZE         9216
+#define XDSL_SHAPER_MAX_OVERHEAD            256
+
+static XDSL_SHAPER_CONFIG g_ShaperConfig =
+{
+    XDSL_SHAPER_DEFAULT_ENABLE,
+    XDSL_SHAPER_DEFAULT_PERCENT,
+    XDSL_SHAPER_DEFAULT_PACKET_SIZE,
+    XDSL_SHAPER_DEFAULT_ATM_OVERHEAD,
+    XDSL_SHAPER_DEFAULT_PTM_OVERHEAD,
+    XDSL_SHAPER_DEFAULT_CHECK_INTERVAL,
+    0,
+    0
+};
+
+static XDSL_SHAPER_RATES g_ShaperRates;
+static BOOL g_ShaperPublished = FALSE;
+static pthread_mutex_t gmShaper_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+BOOL XdslShaperIsConfigValid( const XDSL_SHAPER_CONFIG *pstConfig )
+{
+    if( pstConfig == NULL )
+    {
+        return FALSE;
+    }
+
+    if( pstConfig->Percent == 0 || pstConfig->Percent > 100 ||
+        pstConfig->PacketSize < XDSL_SHAPER_MIN_PACKET_SIZE || pstConfig->PacketSize > XDSL_SHAPER_MAX_PACKET_SIZE ||
+        pstConfig->AtmOverhead > XDSL_SHAPER_MAX_OVERHEAD || pstConfig->PtmOverhead > XDSL_SHAPER_MAX_OVERHEAD ||
+        pstConfig->CheckInterval == 0 )
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+ANSC_STATUS XdslShaperInit( const XDSL_SHAPER_CONFIG *pstConfig )
+{
+    pthread_mutex_lock(&gmShaper_mutex);
+    memset(&g_ShaperRates, 0, sizeof(g_ShaperRates));
+    g_ShaperPublished = FALSE;
+    pthread_mutex_unlock(&gmShaper_mutex);
+
+    return XdslShaperSetConfig(pstConfig);
+}
+
+VOID XdslShaperGetConfig( PXDSL_SHAPER_CONFIG pstConfig )
+{
+    if( pstConfig == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmShaper_mutex);
+    memcpy(pstConfig, &g_ShaperConfig, sizeof(XDSL_SHAPER_CONFIG));
+    pthread_mutex_unlock(&gmShaper_mutex);
+}
+
+ANSC_STATUS XdslShaperSetConfig( const XDSL_SHAPER_CONFIG *pstConfig )
+{
+    if( !XdslShaperIsConfigValid(pstConfig) )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock(&gmShaper_mutex);
+    memcpy(&g_ShaperConfig, pstConfig, sizeof(XDSL_SHAPER_CONFIG));
+    //New overheads or shaper instances are published on the next update
+    g_ShaperPublished = FALSE;
+    pthread_mutex_unlock(&gmShaper_mutex);
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ULONG XdslShaperComputeRate( ULONG ulSyncRate, XDSL_SHAPER_ENCAP enEncap, const XDSL_SHAPER_CONFIG *pstConfig )
+{
+    unsigned long long ullPayload;
+    unsigned long long ullWire;
+    unsigned long long ullCells;
+
+    if( pstConfig == NULL || pstConfig->PacketSize == 0 )
+    {
+        return 0;
+    }
+
+    ullPayload = pstConfig->PacketSize;
+
+    switch( enEncap )
+    {
+        case XDSL_SHAPER_ENCAP_ATM:
+        {
+            //AAL5 pads the last cell, the cell tax is paid on the padding too
+            ullCells = (ullPayload + pstConfig->AtmOverhead + XDSL_SHAPER_AAL5_TRAILER + XDSL_SHAPER_ATM_CELL_PAYLOAD - 1) / XDSL_SHAPER_ATM_CELL_PAYLOAD;
+            ullWire  = ullCells * XDSL_SHAPER_ATM_CELL_SIZE;
+            break;
+        }
+
+        case XDSL_SHAPER_ENCAP_PTM:
+        {
+            //Scaled by 64 so the 64/65 codeword overhead stays in integers
+            ullPayload *= XDSL_SHAPER_PTM_CODEWORD_PAYLOAD;
+            ullWire     = (ullPayload / XDSL_SHAPER_PTM_CODEWORD_PAYLOAD + pstConfig->PtmOverhead) * XDSL_SHAPER_PTM_CODEWORD_SIZE;
+            break;
+        }
+
+        default:
+            return 0;
+    }
+
+    return (ULONG)((unsigned long long)ulSyncRate * ullPayload * pstConfig->Percent / (ullWire * 100));
+}
+
+static BOOL XdslShaperMoved( ULONG ulOld, ULONG ulNew )
+{
+    ULONG ulDelta = (ulOld > ulNew) ? ulOld - ulNew : ulNew - ulOld;
+
+    return ((unsigned long long)ulDelta * 100 >= (unsigned long long)ulOld * XDSL_SHAPER_CHANGE_PERCENT) ? TRUE : FALSE;
+}
+
+BOOL XdslShaperUpdate( XDSL_SHAPER_ENCAP enEncap, ULONG ulUpstreamSyncRate, ULONG ulDownstreamSyncRate, PXDSL_SHAPER_RATES pstRates )
+{
+    ULONG ulEgressRate;
+    ULONG ulIngressRate;
+    BOOL  bPublish = FALSE;
+
+    pthread_mutex_lock(&gmShaper_mutex);
+
+    ulEgressRate  = XdslShaperComputeRate(ulUpstreamSyncRate, enEncap, &g_ShaperConfig);
+    ulIngressRate = XdslShaperComputeRate(ulDownstreamSyncRate, enEncap, &g_ShaperConfig);
+
+    if( g_ShaperConfig.Enable && ulEgressRate != 0 && ulIngressRate != 0 &&
+        (!g_ShaperPublished || enEncap != g_ShaperRates.Encapsulation ||
+         XdslShaperMoved(g_ShaperRates.EgressRate, ulEgressRate) ||
+         XdslShaperMoved(g_ShaperRates.IngressRate, ulIngressRate)) )
+    {
+        g_ShaperRates.Encapsulation      = enEncap;
+        g_ShaperRates.UpstreamSyncRate   = ulUpstreamSyncRate;
+        g_ShaperRates.DownstreamSyncRate = ulDownstreamSyncRate;
+        g_ShaperRates.EgressRate         = ulEgressRate;
+        g_ShaperRates.IngressRate        = ulIngressRate;
+        g_ShaperRates.Updates++;
+        g_ShaperPublished = TRUE;
+        bPublish = TRUE;
+    }
+
+    if( pstRates != NULL )
+    {
+        memcpy(pstRates, &g_ShaperRates, sizeof(XDSL_SHAPER_RATES));
+    }
+
+    pthread_mutex_unlock(&gmShaper_mutex);
+
+    return bPublish;
+}
+
+VOID XdslShaperReset( VOID )
+{
+    pthread_mutex_lock(&gmShaper_mutex);
+    g_ShaperPublished = FALSE;
+    pthread_mutex_unlock(&gmShaper_mutex);
+}
+
+VOID XdslShaperGetRates( PXDSL_SHAPER_RATES pstRates )
+{
+    if( pstRates == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmShaper_mutex);
+    memcpy(pstRates, &g_ShaperRates, sizeof(XDSL_SHAPER_RATES));
+    pthread_mutex_unlock(&gmShaper_mutex);
+}
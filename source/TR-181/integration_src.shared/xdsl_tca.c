@@ -0,0 +1,344 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_tca.c
+    For CCSP Component:  dsl threshold crossing alerts
+
+---------------------------------------------------------------
+
+    Description:
+
+    Threshold crossing alert profiles on the line and channel counters.
+    Each stats refresh is compared with the enabled profiles only, a
+    profile keeps whether it is raised on a line and a crossing is
+    reported once, when it is raised and when the value is back over the
+    threshold by the hysteresis, not on every refresh in between.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <pthread.h>
+#include "xdsl_tca.h"
+
+typedef  struct
+_XDSL_TCA_COUNTER_INFO
+{
+    const char         *pName;
+    BOOL                bFalling;       /* raised when the value drops to the threshold */
+    BOOL                bLineValue;     /* read from the line, not from an interval */
+    size_t              offset;         /* in DML_XDSL_PM_COUNTERS for interval counters */
+}
+XDSL_TCA_COUNTER_INFO;
+
+/* Raised state of a profile on a line, with what it was raised on */
+typedef  struct
+_XDSL_TCA_STATE
+{
+    BOOL                bRaised;
+    XDSL_TCA_COUNTER    Counter;
+    XDSL_TCA_INTERVAL   Interval;
+    INT                 Threshold;
+}
+XDSL_TCA_STATE;
+
+#define XDSL_TCA_INTERVAL_COUNTER(name, member) \
+    { (name), FALSE, FALSE, offsetof(DML_XDSL_PM_COUNTERS, member) }
+
+#define XDSL_TCA_LINE_VALUE(name, falling) \
+    { (name), (falling), TRUE, 0 }
+
+/* Indexed by XDSL_TCA_COUNTER */
+static const XDSL_TCA_COUNTER_INFO g_TcaCounters[XDSL_TCA_COUNTER_MAX] =
+{
+    XDSL_TCA_INTERVAL_COUNTER( "ErroredSecs",         ErroredSecs ),
+    XDSL_TCA_INTERVAL_COUNTER( "SeverelyErroredSecs", SeverelyErroredSecs ),
+    XDSL_TCA_INTERVAL_COUNTER( "XTURCRCErrors",       XTURCRCErrors ),
+    XDSL_TCA_INTERVAL_COUNTER( "XTUCCRCErrors",       XTUCCRCErrors ),
+    XDSL_TCA_INTERVAL_COUNTER( "XTURFECErrors",       XTURFECErrors ),
+    XDSL_TCA_INTERVAL_COUNTER( "XTUCFECErrors",       XTUCFECErrors ),
+    XDSL_TCA_INTERVAL_COUNTER( "XTURHECErrors",       XTURHECErrors ),
+    XDSL_TCA_INTERVAL_COUNTER( "XTUCHECErrors",       XTUCHECErrors ),
+    XDSL_TCA_INTERVAL_COUNTER( "LinkRetrain",         LinkRetrain ),
+    XDSL_TCA_LINE_VALUE( "DownstreamNoiseMargin",     TRUE ),
+    XDSL_TCA_LINE_VALUE( "UpstreamNoiseMargin",       TRUE ),
+    XDSL_TCA_LINE_VALUE( "DownstreamMaxBitRate",      TRUE ),
+    XDSL_TCA_LINE_VALUE( "UpstreamMaxBitRate",        TRUE )
+};
+
+/* Indexed by XDSL_TCA_INTERVAL */
+static const char *g_TcaIntervals[XDSL_TCA_INTERVAL_MAX] =
+{
+    "QuarterHour",
+    "CurrentDay"
+};
+
+static XDSL_TCA_PROFILE     g_TcaProfiles[XDSL_TCA_MAX_PROFILES];
+static XDSL_TCA_STATE      *g_pTcaStates = NULL;   /* XDSL_TCA_MAX_PROFILES per line */
+static INT                  giTcaLines    = 0;
+static pthread_mutex_t      g_TcaMutex    = PTHREAD_MUTEX_INITIALIZER;
+
+ANSC_STATUS XdslTcaInit( INT iLines )
+{
+    XDSL_TCA_STATE *pStates;
+
+    if( iLines <= 0 )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pStates = (XDSL_TCA_STATE *)calloc( iLines * XDSL_TCA_MAX_PROFILES, sizeof(XDSL_TCA_STATE) );
+    if( pStates == NULL )
+    {
+        CcspTraceError(( "%s Failed to allocate the state of %d lines\n", __FUNCTION__, iLines ));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock( &g_TcaMutex );
+    free( g_pTcaStates );
+    g_pTcaStates = pStates;
+    giTcaLines   = iLines;
+    pthread_mutex_unlock( &g_TcaMutex );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslTcaSetProfile( INT ProfileIndex, const XDSL_TCA_PROFILE *pstProfile )
+{
+    if( pstProfile == NULL || ProfileIndex < 0 || ProfileIndex >= XDSL_TCA_MAX_PROFILES ||
+         pstProfile->Counter < 0 || pstProfile->Counter >= XDSL_TCA_COUNTER_MAX ||
+         pstProfile->Interval < 0 || pstProfile->Interval >= XDSL_TCA_INTERVAL_MAX )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock( &g_TcaMutex );
+    memcpy( &g_TcaProfiles[ProfileIndex], pstProfile, sizeof(XDSL_TCA_PROFILE) );
+    pthread_mutex_unlock( &g_TcaMutex );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslTcaGetProfile( INT ProfileIndex, PXDSL_TCA_PROFILE pstProfile )
+{
+    if( pstProfile == NULL || ProfileIndex < 0 || ProfileIndex >= XDSL_TCA_MAX_PROFILES )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pthread_mutex_lock( &g_TcaMutex );
+    memcpy( pstProfile, &g_TcaProfiles[ProfileIndex], sizeof(XDSL_TCA_PROFILE) );
+    pthread_mutex_unlock( &g_TcaMutex );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+BOOL XdslTcaIsRaised( INT ProfileIndex )
+{
+    BOOL bRaised = FALSE;
+    INT  i;
+
+    if( ProfileIndex < 0 || ProfileIndex >= XDSL_TCA_MAX_PROFILES )
+    {
+        return FALSE;
+    }
+
+    pthread_mutex_lock( &g_TcaMutex );
+    for( i = 0; i < giTcaLines && !bRaised; i++ )
+    {
+        bRaised = g_pTcaStates[i * XDSL_TCA_MAX_PROFILES + ProfileIndex].bRaised;
+    }
+    pthread_mutex_unlock( &g_TcaMutex );
+
+    return bRaised;
+}
+
+BOOL XdslTcaNeedsLineValues( VOID )
+{
+    BOOL bNeeded = FALSE;
+    INT  i;
+
+    pthread_mutex_lock( &g_TcaMutex );
+    for( i = 0; i < XDSL_TCA_MAX_PROFILES && !bNeeded; i++ )
+    {
+        bNeeded = g_TcaProfiles[i].Enable && g_TcaCounters[g_TcaProfiles[i].Counter].bLineValue;
+    }
+    pthread_mutex_unlock( &g_TcaMutex );
+
+    return bNeeded;
+}
+
+/* Value the profile watches, FALSE when the sample does not have it */
+static BOOL XdslTcaValue( const XDSL_TCA_SAMPLE *pstSample, const XDSL_TCA_PROFILE *pProfile, LONG *plValue )
+{
+    const DML_XDSL_PM_COUNTERS *pCounters;
+
+    switch( pProfile->Counter )
+    {
+        case XDSL_TCA_COUNTER_DOWNSTREAM_NOISE_MARGIN:
+            *plValue = pstSample->DownstreamNoiseMargin;
+            return pstSample->bLineValid;
+        case XDSL_TCA_COUNTER_UPSTREAM_NOISE_MARGIN:
+            *plValue = pstSample->UpstreamNoiseMargin;
+            return pstSample->bLineValid;
+        case XDSL_TCA_COUNTER_DOWNSTREAM_MAX_BIT_RATE:
+            *plValue = (LONG)pstSample->DownstreamMaxBitRate;
+            return pstSample->bLineValid;
+        case XDSL_TCA_COUNTER_UPSTREAM_MAX_BIT_RATE:
+            *plValue = (LONG)pstSample->UpstreamMaxBitRate;
+            return pstSample->bLineValid;
+        default:
+            break;
+    }
+
+    pCounters = ( pProfile->Interval == XDSL_TCA_INTERVAL_CURRENT_DAY ) ? &pstSample->stCurrentDay : &pstSample->stQuarterHour;
+    *plValue  = (LONG)*(const UINT *)( (const char *)pCounters + g_TcaCounters[pProfile->Counter].offset );
+
+    return TRUE;
+}
+
+static VOID XdslTcaAddEvent( PXDSL_TCA_EVENT pstEvent, INT LineIndex, INT ProfileIndex, const XDSL_TCA_STATE *pState, BOOL bRaised, LONG lValue )
+{
+    pstEvent->LineIndex    = LineIndex;
+    pstEvent->ProfileIndex = ProfileIndex;
+    pstEvent->Counter      = pState->Counter;
+    pstEvent->Interval     = pState->Interval;
+    pstEvent->bRaised      = bRaised;
+    pstEvent->lValue       = lValue;
+    pstEvent->Threshold    = pState->Threshold;
+}
+
+INT XdslTcaEvaluate( INT LineIndex, const XDSL_TCA_SAMPLE *pstSample, PXDSL_TCA_EVENT pstEvents, INT iMaxEvents )
+{
+    const XDSL_TCA_PROFILE *pProfile;
+    XDSL_TCA_STATE         *pState;
+    LONG                    lValue;
+    BOOL                    bCrossed;
+    INT                     iEvents = 0;
+    INT                     i;
+
+    if( pstSample == NULL || pstEvents == NULL )
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock( &g_TcaMutex );
+    if( LineIndex < 0 || LineIndex >= giTcaLines )
+    {
+        pthread_mutex_unlock( &g_TcaMutex );
+        return 0;
+    }
+
+    //A profile left out for lack of room is evaluated on the next refresh
+    for( i = 0; i < XDSL_TCA_MAX_PROFILES && iEvents < iMaxEvents; i++ )
+    {
+        pProfile = &g_TcaProfiles[i];
+        pState   = &g_pTcaStates[LineIndex * XDSL_TCA_MAX_PROFILES + i];
+
+        /*
+         * Disabled or now watching something else, clear what it was raised on.
+         * Margins and rates have no value out of showtime, without the clear
+         * an alert would stay raised for the whole outage.
+         */
+        if( pState->bRaised &&
+             ( !pProfile->Enable || pState->Counter != pProfile->Counter ||
+               ( !g_TcaCounters[pProfile->Counter].bLineValue && pState->Interval != pProfile->Interval ) ||
+               ( g_TcaCounters[pState->Counter].bLineValue && pstSample->bLineDown ) ) )
+        {
+            XdslTcaAddEvent( &pstEvents[iEvents++], LineIndex, i, pState, FALSE, 0 );
+            pState->bRaised = FALSE;
+            continue;
+        }
+
+        if( !pProfile->Enable || !XdslTcaValue( pstSample, pProfile, &lValue ) )
+        {
+            continue;
+        }
+
+        if( g_TcaCounters[pProfile->Counter].bFalling )
+        {
+            bCrossed = pState->bRaised ? ( lValue <= (LONG)pProfile->Threshold + (LONG)pProfile->Hysteresis ) :
+                                         ( lValue <= (LONG)pProfile->Threshold );
+        }
+        else
+        {
+            bCrossed = pState->bRaised ? ( lValue >= (LONG)pProfile->Threshold - (LONG)pProfile->Hysteresis ) :
+                                         ( lValue >= (LONG)pProfile->Threshold );
+        }
+
+        if( bCrossed == pState->bRaised )
+        {
+            continue;
+        }
+
+        pState->bRaised   = bCrossed;
+        pState->Counter   = pProfile->Counter;
+        pState->Interval  = pProfile->Interval;
+        pState->Threshold = pProfile->Threshold;
+        XdslTcaAddEvent( &pstEvents[iEvents++], LineIndex, i, pState, bCrossed, lValue );
+    }
+    pthread_mutex_unlock( &g_TcaMutex );
+
+    return iEvents;
+}
+
+const char *XdslTcaCounterName( XDSL_TCA_COUNTER counter )
+{
+    return ( counter >= 0 && counter < XDSL_TCA_COUNTER_MAX ) ? g_TcaCounters[counter].pName : NULL;
+}
+
+INT XdslTcaCounterFromName( const char *pName )
+{
+    INT i;
+
+    for( i = 0; pName != NULL && i < XDSL_TCA_COUNTER_MAX; i++ )
+    {
+        if( strcmp( pName, g_TcaCounters[i].pName ) == 0 )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+const char *XdslTcaIntervalName( XDSL_TCA_INTERVAL interval )
+{
+    return ( interval >= 0 && interval < XDSL_TCA_INTERVAL_MAX ) ? g_TcaIntervals[interval] : NULL;
+}
+
+INT XdslTcaIntervalFromName( const char *pName )
+{
+    INT i;
+
+    for( i = 0; pName != NULL && i < XDSL_TCA_INTERVAL_MAX; i++ )
+    {
+        if( strcmp( pName, g_TcaIntervals[i] ) == 0 )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,233 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_train_hint.c
+    For CCSP Component:  dsl last good training configuration
+
+---------------------------------------------------------------
+
+    Description:
+
+    Remembers the standard and VDSL2 profile the line last reached
+    showtime with. After a power cycle or a line drop the driver is
+    offered only that configuration, which skips the handshake rounds
+    spent on modes the DSLAM does not run. If the line does not train
+    on it within the fallback timeout the full policy is offered again
+    until the line trains and a new configuration is learnt.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <string.h>
+#include <pthread.h>
+#include "xdsl_train_hint.h"
+
+static BOOL g_TrainHintEnable = XDSL_TRAIN_HINT_DEFAULT_ENABLE;
+static ULONG g_TrainHintFallbackTimeout = XDSL_TRAIN_HINT_DEFAULT_FALLBACK_TIMEOUT;
+static BOOL g_TrainHintValid = FALSE;
+static BOOL g_TrainHintClockRunning = FALSE;
+static XDSL_TRAIN_HINT g_TrainHint;
+static XDSL_TRAIN_HINT_STATS g_TrainHintStats;
+static pthread_mutex_t gmTrainHint_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+VOID XdslTrainHintInit( BOOL bEnable, ULONG ulFallbackTimeout, const XDSL_TRAIN_HINT *pstLastGood )
+{
+    pthread_mutex_lock(&gmTrainHint_mutex);
+
+    g_TrainHintEnable = bEnable;
+    g_TrainHintFallbackTimeout = ulFallbackTimeout;
+    memset(&g_TrainHintStats, 0, sizeof(g_TrainHintStats));
+
+    g_TrainHintValid = (pstLastGood != NULL && pstLastGood->StandardUsed[0] != '\0') ? TRUE : FALSE;
+    if( g_TrainHintValid )
+    {
+        memcpy(&g_TrainHint, pstLastGood, sizeof(g_TrainHint));
+    }
+    else
+    {
+        memset(&g_TrainHint, 0, sizeof(g_TrainHint));
+    }
+
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
+
+VOID XdslTrainHintGetConfig( BOOL *pbEnable, ULONG *pulFallbackTimeout )
+{
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    if( pbEnable != NULL )
+    {
+        *pbEnable = g_TrainHintEnable;
+    }
+    if( pulFallbackTimeout != NULL )
+    {
+        *pulFallbackTimeout = g_TrainHintFallbackTimeout;
+    }
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
+
+VOID XdslTrainHintSetConfig( BOOL bEnable, ULONG ulFallbackTimeout )
+{
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    g_TrainHintEnable = bEnable;
+    g_TrainHintFallbackTimeout = ulFallbackTimeout;
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
+
+BOOL XdslTrainHintGetLastGood( PXDSL_TRAIN_HINT pstHint )
+{
+    BOOL bValid;
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    bValid = g_TrainHintValid;
+    if( pstHint != NULL )
+    {
+        memcpy(pstHint, &g_TrainHint, sizeof(g_TrainHint));
+    }
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+
+    return bValid;
+}
+
+BOOL XdslTrainHintSetLastGood( const XDSL_TRAIN_HINT *pstHint )
+{
+    BOOL bChanged = FALSE;
+
+    if( pstHint == NULL || pstHint->StandardUsed[0] == '\0' )
+    {
+        return FALSE;
+    }
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+
+    //Rates drift with every retrain, only a new mode is worth a PSM write
+    if( !g_TrainHintValid ||
+        strcmp(g_TrainHint.StandardUsed, pstHint->StandardUsed) != 0 ||
+        strcmp(g_TrainHint.CurrentProfile, pstHint->CurrentProfile) != 0 )
+    {
+        bChanged = TRUE;
+    }
+
+    memcpy(&g_TrainHint, pstHint, sizeof(g_TrainHint));
+    g_TrainHintValid = TRUE;
+
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+
+    return bChanged;
+}
+
+VOID XdslTrainHintForget( VOID )
+{
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    g_TrainHintValid = FALSE;
+    memset(&g_TrainHint, 0, sizeof(g_TrainHint));
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
+
+BOOL XdslTrainHintShouldOffer( VOID )
+{
+    BOOL bOffer;
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    bOffer = (g_TrainHintEnable && g_TrainHintValid && !g_TrainHintStats.FallenBack) ? TRUE : FALSE;
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+
+    return bOffer;
+}
+
+VOID XdslTrainHintSetOffered( BOOL bOffered )
+{
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    //Offering the same configuration again keeps the running deadline
+    if( g_TrainHintStats.Offered != bOffered )
+    {
+        g_TrainHintStats.Offered = bOffered;
+        g_TrainHintClockRunning = FALSE;
+    }
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
+
+BOOL XdslTrainHintTrainingStarted( VOID )
+{
+    BOOL bStart = FALSE;
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    //Retries after a failed handshake run against the same deadline
+    if( g_TrainHintStats.Offered && !g_TrainHintClockRunning )
+    {
+        g_TrainHintClockRunning = TRUE;
+        bStart = TRUE;
+    }
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+
+    return bStart;
+}
+
+BOOL XdslTrainHintTrained( VOID )
+{
+    BOOL bHinted;
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    bHinted = g_TrainHintStats.Offered;
+    g_TrainHintStats.FallenBack = FALSE;
+    g_TrainHintClockRunning = FALSE;
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+
+    return bHinted;
+}
+
+BOOL XdslTrainHintFallback( VOID )
+{
+    BOOL bFallback = FALSE;
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    //Line may have trained while the expired timer was queued
+    if( g_TrainHintStats.Offered && g_TrainHintClockRunning )
+    {
+        g_TrainHintStats.Offered = FALSE;
+        g_TrainHintStats.FallenBack = TRUE;
+        g_TrainHintClockRunning = FALSE;
+        g_TrainHintStats.Fallbacks++;
+        bFallback = TRUE;
+    }
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+
+    return bFallback;
+}
+
+VOID XdslTrainHintGetStats( PXDSL_TRAIN_HINT_STATS pstStats )
+{
+    if( pstStats == NULL )
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    memcpy(pstStats, &g_TrainHintStats, sizeof(g_TrainHintStats));
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
+
+VOID XdslTrainHintResetStats( VOID )
+{
+    pthread_mutex_lock(&gmTrainHint_mutex);
+    g_TrainHintStats.Fallbacks = 0;
+    pthread_mutex_unlock(&gmTrainHint_mutex);
+}
@@ -0,0 +1,164 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_warm_restart.c
+    For CCSP Component:  dsl state machine warm restart
+
+---------------------------------------------------------------
+
+    Description:
+
+    Persists the runtime state of a line in showtime (state, StandardUsed,
+    PTM/ATM and WAN Manager instances) so a restarted xdslmanager can
+    resume it instead of tearing the XTM link and WAN down. The file is
+    written to a temporary name and renamed into place, a crash while
+    saving leaves either the old or the new snapshot, never a torn one.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "xdsl_warm_restart.h"
+
+static ULONG XdslWarmRestartChecksum( const XDSL_WARM_RESTART_SNAPSHOT *pstSnapshot )
+{
+    const unsigned char *pData = (const unsigned char *)pstSnapshot;
+    ULONG ulHash = 2166136261UL;
+    size_t i;
+
+    //FNV-1a over everything in front of the checksum
+    for( i = 0; i < offsetof(XDSL_WARM_RESTART_SNAPSHOT, Checksum); i++ )
+    {
+        ulHash = (ulHash ^ pData[i]) * 16777619UL;
+    }
+
+    return ulHash & 0xFFFFFFFFUL;
+}
+
+ANSC_STATUS XdslWarmRestartSave( PXDSL_WARM_RESTART_SNAPSHOT pstSnapshot )
+{
+    char acPath[128];
+    char acTmpPath[136];
+    int fd;
+    ssize_t written;
+
+    if( pstSnapshot == NULL || pstSnapshot->Name[0] == '\0' )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    pstSnapshot->Magic    = XDSL_WARM_RESTART_MAGIC;
+    pstSnapshot->Version  = XDSL_WARM_RESTART_VERSION;
+    pstSnapshot->Checksum = XdslWarmRestartChecksum(pstSnapshot);
+
+    snprintf(acPath, sizeof(acPath), XDSL_WARM_RESTART_FILE_FORMAT, pstSnapshot->Name);
+    snprintf(acTmpPath, sizeof(acTmpPath), "%s.tmp", acPath);
+
+    fd = open(acTmpPath, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if( fd < 0 )
+    {
+        CcspTraceError(("%s Failed to open %s, errno:%d\n", __FUNCTION__, acTmpPath, errno));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    written = write(fd, pstSnapshot, sizeof(XDSL_WARM_RESTART_SNAPSHOT));
+    if( written != (ssize_t)sizeof(XDSL_WARM_RESTART_SNAPSHOT) || fsync(fd) != 0 )
+    {
+        CcspTraceError(("%s Failed to write %s, errno:%d\n", __FUNCTION__, acTmpPath, errno));
+        close(fd);
+        unlink(acTmpPath);
+        return ANSC_STATUS_FAILURE;
+    }
+    close(fd);
+
+    if( rename(acTmpPath, acPath) != 0 )
+    {
+        CcspTraceError(("%s Failed to rename %s, errno:%d\n", __FUNCTION__, acTmpPath, errno));
+        unlink(acTmpPath);
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+ANSC_STATUS XdslWarmRestartLoad( const char *ifname, PXDSL_WARM_RESTART_SNAPSHOT pstSnapshot )
+{
+    char acPath[128];
+    int fd;
+    ssize_t readLen;
+
+    if( ifname == NULL || pstSnapshot == NULL )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    snprintf(acPath, sizeof(acPath), XDSL_WARM_RESTART_FILE_FORMAT, ifname);
+
+    fd = open(acPath, O_RDONLY);
+    if( fd < 0 )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    memset(pstSnapshot, 0, sizeof(XDSL_WARM_RESTART_SNAPSHOT));
+    readLen = read(fd, pstSnapshot, sizeof(XDSL_WARM_RESTART_SNAPSHOT));
+    close(fd);
+
+    if( readLen != (ssize_t)sizeof(XDSL_WARM_RESTART_SNAPSHOT) ||
+        pstSnapshot->Magic != XDSL_WARM_RESTART_MAGIC ||
+        pstSnapshot->Version != XDSL_WARM_RESTART_VERSION ||
+        pstSnapshot->Checksum != XdslWarmRestartChecksum(pstSnapshot) )
+    {
+        CcspTraceWarning(("%s Discarding invalid snapshot %s\n", __FUNCTION__, acPath));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    //Terminate strings in case the file was written by a foreign build
+    pstSnapshot->Name[sizeof(pstSnapshot->Name) - 1] = '\0';
+    pstSnapshot->LowerLayers[sizeof(pstSnapshot->LowerLayers) - 1] = '\0';
+    pstSnapshot->StandardUsed[sizeof(pstSnapshot->StandardUsed) - 1] = '\0';
+
+    if( strcmp(pstSnapshot->Name, ifname) != 0 )
+    {
+        return ANSC_STATUS_FAILURE;
+    }
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+VOID XdslWarmRestartClear( const char *ifname )
+{
+    char acPath[128];
+
+    if( ifname == NULL )
+    {
+        return;
+    }
+
+    snprintf(acPath, sizeof(acPath), XDSL_WARM_RESTART_FILE_FORMAT, ifname);
+    unlink(acPath);
+}
@@ -20,10 +20,14 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <time.h>
 #include "xtm_apis.h"
 #include "xtm_internal.h"
 #include "plugin_main_apis.h"
 #include "xdsl_hal.h"
+#include "xdsl_hal_perf.h"
+#include "xdsl_instance_cache.h"
+#include "xdsl_bus_txn.h"
 
 /* ******************************************************************* */
 
@@ -50,9 +54,7 @@
 extern char                g_Subsystem[32];
 extern ANSC_HANDLE         bus_handle;
 
-static ANSC_STATUS CosaDmlXtmGetParamValues(char *pComponent, char *pBus, char *pParamName, char *pReturnVal);
 static ANSC_STATUS CosaDmlXtmSetParamValues(const char *pComponent, const char *pBus, const char *pParamName, const char *pParamVal, enum dataType_e type, unsigned int bCommitFlag);
-static ANSC_STATUS CosaDmlXtmGetParamNames(char *pComponent, char *pBus, char *pParamName, char a2cReturnVal[][256], int *pReturnSize);
 static ANSC_STATUS CosaDmlXtmGetLowerLayersInstanceInOtherAgent(PTM_NOTIFY_ENUM enNotifyAgent, char *pLowerLayers, INT *piInstanceNumber);
 /* ******************************************************************* */
 
@@ -132,95 +134,6 @@ SListGetEntryByInsNum
     return NULL;
 }
 
-/* Get data from the other component. */
-static ANSC_STATUS CosaDmlXtmGetParamNames(char *pComponent, char *pBus, char *pParamName, char a2cReturnVal[][256], int *pReturnSize)
-{
-    CCSP_MESSAGE_BUS_INFO *bus_info = (CCSP_MESSAGE_BUS_INFO *)bus_handle;
-    parameterInfoStruct_t **retInfo;
-    char *ParamName[1];
-    int ret = 0,
-        nval;
-
-    ret = CcspBaseIf_getParameterNames(
-        bus_handle,
-        pComponent,
-        pBus,
-        pParamName,
-        1,
-        &nval,
-        &retInfo);
-    
-    if (CCSP_SUCCESS == ret)
-    {
-        int iLoopCount;
-        *pReturnSize = nval;
-    
-        for (iLoopCount = 0; iLoopCount < nval; iLoopCount++)
-        {
-            if (NULL != retInfo[iLoopCount]->parameterName)
-            {
-                snprintf(a2cReturnVal[iLoopCount], strlen(retInfo[iLoopCount]->parameterName) + 1, "%s", retInfo[iLoopCount]->parameterName);
-            }
-        }
-    
-        if (retInfo)
-        {
-            free_parameterInfoStruct_t(bus_handle, nval, retInfo);
-        }
-    
-        return ANSC_STATUS_SUCCESS;
-    }
-    
-    if (retInfo)
-    {
-        free_parameterInfoStruct_t(bus_handle, nval, retInfo);
-    }
-    
-    return ANSC_STATUS_FAILURE;
-}
-/* *CosaDmlXtmGetParamValues() */
-static ANSC_STATUS CosaDmlXtmGetParamValues(char *pComponent, char *pBus, char *pParamName, char *pReturnVal)
-{
-    CCSP_MESSAGE_BUS_INFO *bus_info = (CCSP_MESSAGE_BUS_INFO *)bus_handle;
-    parameterValStruct_t **retVal;
-    char *ParamName[1];
-    int ret = 0,
-        nval;
-
-    //Assign address for get parameter name
-    ParamName[0] = pParamName;
-    
-    ret = CcspBaseIf_getParameterValues(
-        bus_handle,
-        pComponent,
-        pBus,
-        ParamName,
-        1,
-        &nval,
-        &retVal);
-    
-    //Copy the value
-    if (CCSP_SUCCESS == ret)
-    {
-        if (NULL != retVal[0]->parameterValue)
-        {
-            memcpy(pReturnVal, retVal[0]->parameterValue, strlen(retVal[0]->parameterValue) + 1);
-        }
-        if (retVal)
-        {
-            free_parameterValStruct_t(bus_handle, nval, retVal);
-        }
-        return ANSC_STATUS_SUCCESS;
-    }
-    
-    if (retVal)
-    {
-        free_parameterValStruct_t(bus_handle, nval, retVal);
-    }
-    
-    return ANSC_STATUS_FAILURE;
-}
-
 /* Notification to the Other component. */
 static ANSC_STATUS CosaDmlXtmSetParamValues(const char *pComponent, const char *pBus, const char *pParamName, const char *pParamVal, enum dataType_e type, unsigned int bCommitFlag)
 {
@@ -271,67 +184,9 @@ static ANSC_STATUS CosaDmlXtmGetLowerLayersInstanceInOtherAgent(PTM_NOTIFY_ENUM
     {
         case NOTIFY_TO_VLAN_AGENT:
         {
-           char acTmpReturnValue[256] = {0},
-                a2cTmpTableParams[10][256] = {0};
-           INT iLoopCount,
-               iTotalNoofEntries;
-        
-            if (ANSC_STATUS_FAILURE == CosaDmlXtmGetParamValues(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, VLAN_ETH_NOE_PARAM_NAME, acTmpReturnValue))
-            {
-               CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-               return ANSC_STATUS_FAILURE;
-            }
-
-            //Total count
-            iTotalNoofEntries = atoi(acTmpReturnValue);
-       
-            CcspTraceInfo(("%s %d - TotalNoofEntries:%d\n", __FUNCTION__, __LINE__, iTotalNoofEntries));
-        
-            if (0 >= iTotalNoofEntries)
-            {
-              return ANSC_STATUS_SUCCESS;
-            }
-
-            //Get table names
-            iTotalNoofEntries = 0;
-        
-            if (ANSC_STATUS_FAILURE == CosaDmlXtmGetParamNames(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, VLAN_ETH_LINK_TABLE_NAME, a2cTmpTableParams, &iTotalNoofEntries))
-            {
-                CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                return ANSC_STATUS_FAILURE;
-            }
-
-            //Traverse from loop
-            for (iLoopCount = 0; iLoopCount < iTotalNoofEntries; iLoopCount++)
-            {
-                char acTmpQueryParam[256] = {0};
-                
-                //Query
-                snprintf(acTmpQueryParam, sizeof(acTmpQueryParam), "%sLowerLayers", a2cTmpTableParams[iLoopCount]);
-                memset(acTmpReturnValue, 0, sizeof(acTmpReturnValue));
-                
-                if (ANSC_STATUS_FAILURE == CosaDmlXtmGetParamValues(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, acTmpQueryParam, acTmpReturnValue))
-                {
-                   CcspTraceError(("%s %d Failed to get param value\n", __FUNCTION__, __LINE__));
-                   continue;
-                }
-
-                //Compare lowerlayers
-                if (0 == strcmp(acTmpReturnValue, pLowerLayers))
-                {
-                    char tmpTableParam[256] = {0};
-                    const char *last_two;
-                
-                    //Copy table param
-                    snprintf(tmpTableParam, sizeof(tmpTableParam), "%s", a2cTmpTableParams[iLoopCount]);
-                
-                    //Get last two chareters from return value and cut the instance
-                    last_two = &tmpTableParam[strlen(tmpTableParam) - 2];
-                    *piInstanceNumber = atoi(last_two);
-                    break;
-                 }
-             }
-          }
+            //Cached index, refreshed with one bulk get when the row is not known
+            return XdslInstanceCacheLookup(XDSL_INSTANCE_TABLE_VLAN, pLowerLayers, piInstanceNumber);
+        }
           break; /* * NOTIFY_TO_PTM_MANAGER */
    
           default:
@@ -347,8 +202,7 @@ static ANSC_STATUS CosaDmlXtmGetLowerLayersInstanceInOtherAgent(PTM_NOTIFY_ENUM
 /* Create and Enable Ethernet.Link. */
 ANSC_STATUS DmlPtmCreateEthLink( PDML_PTM   pEntry )
 {
-    char acSetParamName[256] = { 0 };
-    char acSetParamValue[256] = { 0 };
+    XDSL_BUS_TXN stTxn;
     INT  iVLANInstance = -1;
     
     //Validate buffer
@@ -380,6 +234,8 @@ ANSC_STATUS DmlPtmCreateEthLink( PDML_PTM   pEntry )
             CcspTraceError(("%s Failed to add table %s\n", __FUNCTION__, acTableName));
             return ANSC_STATUS_FAILURE;
         }
+
+        XdslInstanceCacheInvalidate(XDSL_INSTANCE_TABLE_VLAN);
     
         //Assign new instance
         iVLANInstance = iNewTableInstance;
@@ -387,25 +243,17 @@ ANSC_STATUS DmlPtmCreateEthLink( PDML_PTM   pEntry )
 
     CcspTraceInfo(("%s %d VLANAgent -> Device.Ethernet.Link Instance:%d\n", __FUNCTION__, __LINE__, iVLANInstance));
 
-    //Set Alias
-    snprintf(acSetParamName, DATAMODEL_PARAM_LENGTH, VLAN_ETH_LINK_PARAM_ALIAS, iVLANInstance);
-    snprintf(acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", pEntry->Alias);
-    CosaDmlXtmSetParamValues(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string,FALSE);
-    
-    //Set Name
-    snprintf(acSetParamName, DATAMODEL_PARAM_LENGTH, VLAN_ETH_LINK_PARAM_NAME, iVLANInstance);
-    snprintf(acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", pEntry->Name);
-    CosaDmlXtmSetParamValues(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string,FALSE);
-
-    //Set Lowerlayers
-    snprintf(acSetParamName, DATAMODEL_PARAM_LENGTH, VLAN_ETH_LINK_PARAM_LOWERLAYERS, iVLANInstance);
-    snprintf(acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", pEntry->Path);
-    CosaDmlXtmSetParamValues(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_string,FALSE);
-    
-    //Set Enable
-    snprintf(acSetParamName, DATAMODEL_PARAM_LENGTH, VLAN_ETH_LINK_PARAM_ENABLE, iVLANInstance);
-    snprintf(acSetParamValue, DATAMODEL_PARAM_LENGTH, "%s", "true");
-    CosaDmlXtmSetParamValues(VLAN_COMPONENT_NAME, VLAN_DBUS_PATH, acSetParamName, acSetParamValue, ccsp_boolean, TRUE);
+    //Alias, Name, Lowerlayers and Enable are applied together with one commit
+    XdslBusTxnBegin(&stTxn, VLAN_COMPONENT_NAME, VLAN_DBUS_PATH);
+    XdslBusTxnAddParam(&stTxn, ccsp_string, pEntry->Alias, VLAN_ETH_LINK_PARAM_ALIAS, iVLANInstance);
+    XdslBusTxnAddParam(&stTxn, ccsp_string, pEntry->Name, VLAN_ETH_LINK_PARAM_NAME, iVLANInstance);
+    XdslBusTxnAddParam(&stTxn, ccsp_string, pEntry->Path, VLAN_ETH_LINK_PARAM_LOWERLAYERS, iVLANInstance);
+    XdslBusTxnAddParam(&stTxn, ccsp_boolean, "true", VLAN_ETH_LINK_PARAM_ENABLE, iVLANInstance);
+    if (ANSC_STATUS_SUCCESS != XdslBusTxnCommit(&stTxn))
+    {
+        CcspTraceError(("%s %d Failed to configure Device.Ethernet.Link Instance:%d\n", __FUNCTION__, __LINE__, iVLANInstance));
+        return ANSC_STATUS_FAILURE;
+    }
  
     CcspTraceInfo(("%s: Successfully created PTM VLAN link table for %s interface\n",PTM_MARKER_VLAN_CREATE,pEntry->Name));
     
@@ -462,6 +310,8 @@ ANSC_STATUS DmlPtmDeleteEthLink( char *pLowerLayer )
         CcspTraceError(("%s Failed to delete table %s\n", __FUNCTION__, acTableName));
         return ANSC_STATUS_FAILURE;
     }
+
+    XdslInstanceCacheInvalidate(XDSL_INSTANCE_TABLE_VLAN);
     
     CcspTraceInfo(("%s:Successfully deleted PTM VLAN link %s table\n",PTM_MARKER_VLAN_DELETE,acTableName));
     
@@ -592,12 +442,37 @@ ANSC_STATUS DmlGetPtmIfStatus (ANSC_HANDLE hContext, PDML_PTM pEntry )
     return returnStatus;
 }
 
+/* Monotonic milliseconds, used to age the memoized link statistics */
+static ULONG XtmGetMonotonicMs( VOID )
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (ULONG)((ULONG)ts.tv_sec * 1000 + (ULONG)(ts.tv_nsec / 1000000));
+}
+
+static BOOL XtmIsStatsFresh( BOOLEAN bValid, ULONG ulTimestamp, ULONG ulNow )
+{
+    return (bValid && (ULONG)(ulNow - ulTimestamp) < XTM_STATS_CACHE_TIMEOUT_MS);
+}
+
 ANSC_STATUS DmlGetPtmIfStatistics (ANSC_HANDLE hContext, PDML_PTM pEntry)
 {
     int returnStatus  = ANSC_STATUS_SUCCESS;
     char cLinkStats[256] = {'\0'};
+    ULONG ulNow = 0;
     if (pEntry != NULL) {
         if( pEntry->Enable) {
+            /* Every counter of the Stats object is read separately, serve
+             * them all from one HAL reply while it is still fresh */
+            ulNow = XtmGetMonotonicMs();
+            if (XtmIsStatsFresh(pEntry->StatsValid, pEntry->StatsTimestamp, ulNow)) {
+                XdslHalPerfRecordCache(XDSL_HAL_PERF_XTM_GET_LINK_STATS, TRUE);
+                return ANSC_STATUS_SUCCESS;
+            }
+            XdslHalPerfRecordCache(XDSL_HAL_PERF_XTM_GET_LINK_STATS, FALSE);
+
             /**
              * Construct Full DML path.
              * Device.PTM.Link.1.Stats.
@@ -607,6 +482,11 @@ ANSC_STATUS DmlGetPtmIfStatistics (ANSC_HANDLE hContext, PDML_PTM pEntry)
             returnStatus = xtm_hal_getLinkStats(cLinkStats, &pEntry->Statistics);
             if (returnStatus != ANSC_STATUS_SUCCESS) {
                 CcspTraceError(("%s %d Failed to get PTM stats\n",__FUNCTION__,__LINE__));
+                pEntry->StatsValid = FALSE;
+            }
+            else {
+                pEntry->StatsValid = TRUE;
+                pEntry->StatsTimestamp = ulNow;
             }
         }
     }
@@ -826,8 +706,18 @@ ANSC_STATUS DmlGetAtmIfStatistics (ANSC_HANDLE hContext, PDML_ATM pEntry)
 {
     int returnStatus  = ANSC_STATUS_SUCCESS;
     char cLinkStats[256] = {'\0'};
+    ULONG ulNow = 0;
     if (pEntry != NULL) {
         if( pEntry->Enable) {
+            /* Every counter of the Stats object is read separately, serve
+             * them all from one HAL reply while it is still fresh */
+            ulNow = XtmGetMonotonicMs();
+            if (XtmIsStatsFresh(pEntry->StatsValid, pEntry->StatsTimestamp, ulNow)) {
+                XdslHalPerfRecordCache(XDSL_HAL_PERF_ATM_GET_LINK_STATS, TRUE);
+                return ANSC_STATUS_SUCCESS;
+            }
+            XdslHalPerfRecordCache(XDSL_HAL_PERF_ATM_GET_LINK_STATS, FALSE);
+
             /**
              * Construct Full DML path.
              * Device.ATM.Link.1.Stats.
@@ -837,6 +727,11 @@ ANSC_STATUS DmlGetAtmIfStatistics (ANSC_HANDLE hContext, PDML_ATM pEntry)
             returnStatus = atm_hal_getLinkStats(cLinkStats, &pEntry->Statistics);
             if (returnStatus != ANSC_STATUS_SUCCESS) {
                 CcspTraceError(("%s %d Failed to get ATM stats\n",__FUNCTION__,__LINE__));
+                pEntry->StatsValid = FALSE;
+            }
+            else {
+                pEntry->StatsValid = TRUE;
+                pEntry->StatsTimestamp = ulNow;
             }
         }
     }
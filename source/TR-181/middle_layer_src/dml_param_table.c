@@ -0,0 +1,252 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: dml_param_table.c
+
+        For COSA Data Model Library Development
+
+    -------------------------------------------------------------------
+
+    description:
+
+        This file implements the parameter name to structure member
+        tables used by the DML getters.
+
+    -------------------------------------------------------------------
+
+**********************************************************************/
+
+#include "ansc_platform.h"
+#include "dml_param_table.h"
+
+#define DML_PARAM_TABLE_MAX_SEEDS           1024
+
+static UINT DmlParamTableHash( const char* pName, UINT uSeed )
+{
+    /* FNV-1a, the seed is folded into the offset basis */
+    UINT uHash = 2166136261U ^ uSeed;
+
+    while( *pName )
+    {
+        uHash ^= (UCHAR)*pName++;
+        uHash *= 16777619U;
+    }
+
+    return uHash ^ ( uHash >> 15 );
+}
+
+static BOOL DmlParamTableTrySeed( PDML_PARAM_TABLE pTable, UINT uSeed, UINT uMask )
+{
+    ULONG ulIndex;
+
+    memset( pTable->aSlots, DML_PARAM_SLOT_EMPTY, sizeof( pTable->aSlots ) );
+
+    for( ulIndex = 0; ulIndex < pTable->ulCount; ulIndex++ )
+    {
+        UINT uSlot = DmlParamTableHash( pTable->pEntries[ulIndex].Name, uSeed ) & uMask;
+
+        if( pTable->aSlots[uSlot] != DML_PARAM_SLOT_EMPTY )
+        {
+            return FALSE;
+        }
+
+        pTable->aSlots[uSlot] = (UCHAR)ulIndex;
+    }
+
+    return TRUE;
+}
+
+/* DmlParamTableInit() */
+ANSC_STATUS DmlParamTableInit( PDML_PARAM_TABLE pTable )
+{
+    UINT uSlots = 8;
+    UINT uSeed;
+
+    if( ( NULL == pTable ) || ( NULL == pTable->pEntries ) || ( pTable->ulCount >= DML_PARAM_SLOT_EMPTY ) )
+    {
+        CcspTraceError(("%s Invalid parameter table\n", __FUNCTION__));
+        return ANSC_STATUS_FAILURE;
+    }
+
+    /* Start at a load factor of at most one half */
+    while( uSlots < ( pTable->ulCount * 2 ) )
+    {
+        uSlots <<= 1;
+    }
+
+    for( ; uSlots <= DML_PARAM_TABLE_MAX_SLOTS; uSlots <<= 1 )
+    {
+        for( uSeed = 0; uSeed < DML_PARAM_TABLE_MAX_SEEDS; uSeed++ )
+        {
+            if( DmlParamTableTrySeed( pTable, uSeed, uSlots - 1 ) )
+            {
+                pTable->uSeed = uSeed;
+                pTable->uMask = uSlots - 1;
+                return ANSC_STATUS_SUCCESS;
+            }
+        }
+    }
+
+    /* Duplicate names never hash apart, lookups fall back to a linear scan */
+    pTable->uMask = 0;
+    CcspTraceError(("%s No collision free slot map for table starting with '%s'\n", __FUNCTION__, pTable->pEntries[0].Name));
+
+    return ANSC_STATUS_FAILURE;
+}
+
+/* DmlParamTableLookup() */
+const DML_PARAM_ENTRY* DmlParamTableLookup( const DML_PARAM_TABLE* pTable, const char* ParamName )
+{
+    const DML_PARAM_ENTRY* pEntry = NULL;
+    ULONG ulIndex;
+
+    if( 0 == pTable->uMask )
+    {
+        for( ulIndex = 0; ulIndex < pTable->ulCount; ulIndex++ )
+        {
+            if( 0 == strcmp( pTable->pEntries[ulIndex].Name, ParamName ) )
+            {
+                return &pTable->pEntries[ulIndex];
+            }
+        }
+
+        return NULL;
+    }
+
+    ulIndex = pTable->aSlots[DmlParamTableHash( ParamName, pTable->uSeed ) & pTable->uMask];
+    if( DML_PARAM_SLOT_EMPTY == ulIndex )
+    {
+        return NULL;
+    }
+
+    pEntry = &pTable->pEntries[ulIndex];
+
+    return ( 0 == strcmp( pEntry->Name, ParamName ) ) ? pEntry : NULL;
+}
+
+static ULONGLONG DmlParamTableLoadUnsigned( const void* pValue, ULONG ulSize )
+{
+    switch( ulSize )
+    {
+        case sizeof(UCHAR):     return *(const UCHAR *)pValue;
+        case sizeof(USHORT):    return *(const USHORT *)pValue;
+        case sizeof(UINT):      return *(const UINT *)pValue;
+        default:                return *(const ULONGLONG *)pValue;
+    }
+}
+
+static long long DmlParamTableLoadSigned( const void* pValue, ULONG ulSize )
+{
+    switch( ulSize )
+    {
+        case sizeof(char):      return *(const signed char *)pValue;
+        case sizeof(short):     return *(const short *)pValue;
+        case sizeof(int):       return *(const int *)pValue;
+        default:                return *(const long long *)pValue;
+    }
+}
+
+/* DmlParamTableGetBool() */
+BOOL DmlParamTableGetBool( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, BOOL* pBool )
+{
+    const DML_PARAM_ENTRY* pEntry = DmlParamTableLookup( pTable, ParamName );
+
+    if( ( NULL == pEntry ) || ( DML_PARAM_KIND_BOOL != pEntry->Kind ) )
+    {
+        return FALSE;
+    }
+
+    *pBool = DmlParamTableLoadUnsigned( (const char *)pObject + pEntry->Offset, pEntry->Size ) ? TRUE : FALSE;
+
+    return TRUE;
+}
+
+/* DmlParamTableGetUlong() */
+BOOL DmlParamTableGetUlong( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, ULONG* puLong )
+{
+    const DML_PARAM_ENTRY* pEntry = DmlParamTableLookup( pTable, ParamName );
+
+    if( NULL == pEntry )
+    {
+        return FALSE;
+    }
+
+    if( DML_PARAM_KIND_UNSIGNED == pEntry->Kind )
+    {
+        *puLong = (ULONG)DmlParamTableLoadUnsigned( (const char *)pObject + pEntry->Offset, pEntry->Size );
+        return TRUE;
+    }
+
+    if( DML_PARAM_KIND_SIGNED == pEntry->Kind )
+    {
+        *puLong = (ULONG)DmlParamTableLoadSigned( (const char *)pObject + pEntry->Offset, pEntry->Size );
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* DmlParamTableGetInt() */
+BOOL DmlParamTableGetInt( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, int* pInt )
+{
+    const DML_PARAM_ENTRY* pEntry = DmlParamTableLookup( pTable, ParamName );
+
+    if( NULL == pEntry )
+    {
+        return FALSE;
+    }
+
+    if( DML_PARAM_KIND_SIGNED == pEntry->Kind )
+    {
+        *pInt = (int)DmlParamTableLoadSigned( (const char *)pObject + pEntry->Offset, pEntry->Size );
+        return TRUE;
+    }
+
+    if( DML_PARAM_KIND_UNSIGNED == pEntry->Kind )
+    {
+        *pInt = (int)DmlParamTableLoadUnsigned( (const char *)pObject + pEntry->Offset, pEntry->Size );
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* DmlParamTableGetString() */
+ULONG DmlParamTableGetString( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, char* pValue, ULONG* pUlSize )
+{
+    const DML_PARAM_ENTRY* pEntry = DmlParamTableLookup( pTable, ParamName );
+
+    if( ( NULL == pEntry ) || ( DML_PARAM_KIND_STRING != pEntry->Kind ) )
+    {
+        return -1;
+    }
+
+    /* Same contract as the hand written getters: 1 and the required size if short of buffer */
+    if( ( pEntry->Size - 1 ) < *pUlSize )
+    {
+        AnscCopyString( pValue, (char *)pObject + pEntry->Offset );
+        return 0;
+    }
+
+    *pUlSize = pEntry->Size;
+
+    return 1;
+}
@@ -0,0 +1,103 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: dml_param_table.h
+
+        For COSA Data Model Library Development
+
+    -------------------------------------------------------------------
+
+    description:
+
+        Static parameter tables for the DML getters. Each table maps a
+        parameter name to the offset, size and kind of the structure
+        member holding its value, so a getter resolves ParamName with
+        one hash and one string compare instead of a chain of
+        AnscEqualString() calls.
+
+        The tables are declared statically next to the getters with
+        DML_PARAM() and get a collision free (perfect) hash slot map
+        once, from DmlParamTableInit(), when the plugin registers its
+        functions.
+
+    -------------------------------------------------------------------
+
+**********************************************************************/
+
+#ifndef  _DML_PARAM_TABLE_H
+#define  _DML_PARAM_TABLE_H
+
+#include <stddef.h>
+#include "cosa_apis.h"
+
+#define DML_PARAM_TABLE_MAX_SLOTS           256
+#define DML_PARAM_SLOT_EMPTY                0xFF
+
+typedef enum
+_DML_PARAM_KIND
+{
+    DML_PARAM_KIND_BOOL = 1,
+    DML_PARAM_KIND_UNSIGNED,
+    DML_PARAM_KIND_SIGNED,
+    DML_PARAM_KIND_STRING
+} DML_PARAM_KIND;
+
+typedef  struct
+_DML_PARAM_ENTRY
+{
+    const char*         Name;
+    DML_PARAM_KIND      Kind;
+    ULONG               Offset;
+    ULONG               Size;
+}
+DML_PARAM_ENTRY, *PDML_PARAM_ENTRY;
+
+typedef  struct
+_DML_PARAM_TABLE
+{
+    const DML_PARAM_ENTRY*  pEntries;
+    ULONG                   ulCount;
+    UINT                    uSeed;
+    UINT                    uMask;
+    UCHAR                   aSlots[DML_PARAM_TABLE_MAX_SLOTS];
+}
+DML_PARAM_TABLE, *PDML_PARAM_TABLE;
+
+/* Entry for parameter 'name' stored in 'member' of structure type 'object' */
+#define DML_PARAM(name, kind, object, member) \
+    { (name), (kind), offsetof(object, member), sizeof(((object *)0)->member) }
+
+#define DML_PARAM_TABLE_INIT(entries) \
+    { (entries), sizeof(entries) / sizeof((entries)[0]), 0, 0, { 0 } }
+
+ANSC_STATUS DmlParamTableInit( PDML_PARAM_TABLE pTable );
+
+const DML_PARAM_ENTRY* DmlParamTableLookup( const DML_PARAM_TABLE* pTable, const char* ParamName );
+
+BOOL DmlParamTableGetBool( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, BOOL* pBool );
+
+BOOL DmlParamTableGetUlong( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, ULONG* puLong );
+
+BOOL DmlParamTableGetInt( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, int* pInt );
+
+ULONG DmlParamTableGetString( const DML_PARAM_TABLE* pTable, const void* pObject, const char* ParamName, char* pValue, ULONG* pUlSize );
+
+#endif /* _DML_PARAM_TABLE_H */
@@ -345,6 +345,10 @@ COSA_Init
         g_SubsystemPrefix = g_GetSubsystemPrefix(g_pDslhDmlManager);
     }
 
+    /* build the hashed parameter name lookups used by the DML getters */
+    XdslDmlInitParamTables();
+    XtmDmlInitParamTables();
+
     /* register the back-end apis for the data model */
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "Line_Synchronize",  Line_Synchronize);
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "Line_IsUpdated",  Line_IsUpdated);
@@ -367,6 +371,18 @@ COSA_Init
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LineStatsLastShowtime_GetParamUlongValue",  LineStatsLastShowtime_GetParamUlongValue);
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LineStatsQuarterHour_GetParamUlongValue",  LineStatsQuarterHour_GetParamUlongValue);
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LineStatsCurrentDay_GetParamUlongValue",  LineStatsCurrentDay_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryQuarterHour_IsUpdated",  LinePMHistoryQuarterHour_IsUpdated);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryQuarterHour_Synchronize",  LinePMHistoryQuarterHour_Synchronize);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryQuarterHour_GetEntryCount",  LinePMHistoryQuarterHour_GetEntryCount);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryQuarterHour_GetEntry",  LinePMHistoryQuarterHour_GetEntry);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryQuarterHour_GetParamBoolValue",  LinePMHistoryQuarterHour_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryQuarterHour_GetParamUlongValue",  LinePMHistoryQuarterHour_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryDay_IsUpdated",  LinePMHistoryDay_IsUpdated);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryDay_Synchronize",  LinePMHistoryDay_Synchronize);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryDay_GetEntryCount",  LinePMHistoryDay_GetEntryCount);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryDay_GetEntry",  LinePMHistoryDay_GetEntry);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryDay_GetParamBoolValue",  LinePMHistoryDay_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "LinePMHistoryDay_GetParamUlongValue",  LinePMHistoryDay_GetParamUlongValue);
 
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "Channel_Synchronize",  Channel_Synchronize);
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "Channel_IsUpdated",  Channel_IsUpdated);
@@ -429,6 +445,70 @@ COSA_Init
     /* DSL X_RDK_NLNM*/
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_NLNM_GetParamIntValue",  X_RDK_NLNM_GetParamIntValue);
 
+    /* DSL X_RDK_Perf */
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Perf_GetParamBoolValue",  X_RDK_Perf_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Perf_SetParamBoolValue",  X_RDK_Perf_SetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Perf_HalCall_GetEntryCount",  X_RDK_Perf_HalCall_GetEntryCount);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Perf_HalCall_GetEntry",  X_RDK_Perf_HalCall_GetEntry);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Perf_HalCall_GetParamUlongValue",  X_RDK_Perf_HalCall_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Perf_HalCall_GetParamStringValue", X_RDK_Perf_HalCall_GetParamStringValue);
+
+    /* DSL X_RDK_BringUp */
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_GetParamBoolValue",  X_RDK_BringUp_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_SetParamBoolValue",  X_RDK_BringUp_SetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Phase_GetEntryCount",  X_RDK_BringUp_Phase_GetEntryCount);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Phase_GetEntry",  X_RDK_BringUp_Phase_GetEntry);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Phase_GetParamUlongValue",  X_RDK_BringUp_Phase_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Phase_GetParamStringValue", X_RDK_BringUp_Phase_GetParamStringValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Trace_GetEntryCount",  X_RDK_BringUp_Trace_GetEntryCount);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Trace_GetEntry",  X_RDK_BringUp_Trace_GetEntry);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Trace_GetParamUlongValue",  X_RDK_BringUp_Trace_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_BringUp_Trace_GetParamStringValue", X_RDK_BringUp_Trace_GetParamStringValue);
+
+    /* DSL X_RDK_FlapDamping */
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_GetParamBoolValue",  X_RDK_FlapDamping_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_SetParamBoolValue",  X_RDK_FlapDamping_SetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_GetParamUlongValue",  X_RDK_FlapDamping_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_SetParamUlongValue",  X_RDK_FlapDamping_SetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_Validate",  X_RDK_FlapDamping_Validate);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_Commit",  X_RDK_FlapDamping_Commit);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_FlapDamping_Rollback",  X_RDK_FlapDamping_Rollback);
+
+    /* DSL X_RDK_TrainingHint */
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_GetParamBoolValue",  X_RDK_TrainingHint_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_SetParamBoolValue",  X_RDK_TrainingHint_SetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_GetParamUlongValue",  X_RDK_TrainingHint_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_SetParamUlongValue",  X_RDK_TrainingHint_SetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_GetParamStringValue",  X_RDK_TrainingHint_GetParamStringValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_Validate",  X_RDK_TrainingHint_Validate);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_Commit",  X_RDK_TrainingHint_Commit);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TrainingHint_Rollback",  X_RDK_TrainingHint_Rollback);
+
+    /* DSL X_RDK_Shaper */
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_GetParamBoolValue",  X_RDK_Shaper_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_SetParamBoolValue",  X_RDK_Shaper_SetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_GetParamUlongValue",  X_RDK_Shaper_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_SetParamUlongValue",  X_RDK_Shaper_SetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_GetParamStringValue",  X_RDK_Shaper_GetParamStringValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_Validate",  X_RDK_Shaper_Validate);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_Commit",  X_RDK_Shaper_Commit);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_Shaper_Rollback",  X_RDK_Shaper_Rollback);
+
+    /* DSL X_RDK_TCA */
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_GetEntryCount",  X_RDK_TCA_Profile_GetEntryCount);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_GetEntry",  X_RDK_TCA_Profile_GetEntry);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_GetParamBoolValue",  X_RDK_TCA_Profile_GetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_SetParamBoolValue",  X_RDK_TCA_Profile_SetParamBoolValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_GetParamIntValue",  X_RDK_TCA_Profile_GetParamIntValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_SetParamIntValue",  X_RDK_TCA_Profile_SetParamIntValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_GetParamUlongValue",  X_RDK_TCA_Profile_GetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_SetParamUlongValue",  X_RDK_TCA_Profile_SetParamUlongValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_GetParamStringValue",  X_RDK_TCA_Profile_GetParamStringValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_SetParamStringValue",  X_RDK_TCA_Profile_SetParamStringValue);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_Validate",  X_RDK_TCA_Profile_Validate);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_Commit",  X_RDK_TCA_Profile_Commit);
+    pPlugInfo->RegisterFunction(pPlugInfo->hContext, "X_RDK_TCA_Profile_Rollback",  X_RDK_TCA_Profile_Rollback);
+
     /* register the back-end apis for the data model */
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "PTMLink_GetEntryCount", PTMLink_GetEntryCount );
     pPlugInfo->RegisterFunction(pPlugInfo->hContext, "PTMLink_GetEntry",  PTMLink_GetEntry);
@@ -69,6 +69,8 @@
 #include "xdsl_apis.h"
 #include "xdsl_dml.h"
 #include "xdsl_internal.h"
+#include "dml_param_table.h"
+#include "xdsl_psm_cache.h"
 
 char * XdslReportStatusEnable = "eRT.com.cisco.spvtg.ccsp.xdslmanager.Enabled"; 
 char * XdslReportStatusDfltReportingPeriod = "eRT.com.cisco.spvtg.ccsp.xdslmanager.Default.ReportingPeriod"; 
@@ -77,6 +79,274 @@ char * XdslReportStatusReportingPeriod = "eRT.com.cisco.spvtg.ccsp.xdslmanager.R
 extern ANSC_HANDLE                   bus_handle;
 extern char                          g_Subsystem[32];
 
+/* Parameter name tables for the getters whose parameters map 1:1 onto a
+ * backend structure member, see dml_param_table.h */
+static const DML_PARAM_ENTRY g_LineStringParamEntries[] =
+{
+    DML_PARAM( "Alias",              DML_PARAM_KIND_STRING,   DML_XDSL_LINE, Alias ),
+    DML_PARAM( "Name",               DML_PARAM_KIND_STRING,   DML_XDSL_LINE, Name ),
+    DML_PARAM( "LowerLayers",        DML_PARAM_KIND_STRING,   DML_XDSL_LINE, LowerLayers ),
+    DML_PARAM( "StandardsSupported", DML_PARAM_KIND_STRING,   DML_XDSL_LINE, StandardsSupported ),
+    DML_PARAM( "StandardUsed",       DML_PARAM_KIND_STRING,   DML_XDSL_LINE, StandardUsed ),
+    DML_PARAM( "AllowedProfiles",    DML_PARAM_KIND_STRING,   DML_XDSL_LINE, AllowedProfiles ),
+    DML_PARAM( "CurrentProfile",     DML_PARAM_KIND_STRING,   DML_XDSL_LINE, CurrentProfile ),
+    DML_PARAM( "SNRMpbus",           DML_PARAM_KIND_STRING,   DML_XDSL_LINE, SNRMpbus ),
+    DML_PARAM( "SNRMpbds",           DML_PARAM_KIND_STRING,   DML_XDSL_LINE, SNRMpbds ),
+    DML_PARAM( "FirmwareVersion",    DML_PARAM_KIND_STRING,   DML_XDSL_LINE, FirmwareVersion ),
+    DML_PARAM( "XTURVendor",         DML_PARAM_KIND_STRING,   DML_XDSL_LINE, XTURVendor ),
+    DML_PARAM( "XTUCVendor",         DML_PARAM_KIND_STRING,   DML_XDSL_LINE, XTUCVendor ),
+    DML_PARAM( "XTURCountry",        DML_PARAM_KIND_STRING,   DML_XDSL_LINE, XTURCountry ),
+    DML_PARAM( "XTUCCountry",        DML_PARAM_KIND_STRING,   DML_XDSL_LINE, XTUCCountry ),
+    DML_PARAM( "UPBOKLEPb",          DML_PARAM_KIND_STRING,   DML_XDSL_LINE, UPBOKLEPb ),
+    DML_PARAM( "UPBOKLERPb",         DML_PARAM_KIND_STRING,   DML_XDSL_LINE, UPBOKLERPb ),
+    DML_PARAM( "XTSE",               DML_PARAM_KIND_STRING,   DML_XDSL_LINE, XTSE ),
+    DML_PARAM( "XTSUsed",            DML_PARAM_KIND_STRING,   DML_XDSL_LINE, XTSUsed ),
+    DML_PARAM( "MREFPSDds",          DML_PARAM_KIND_STRING,   DML_XDSL_LINE, MREFPSDds ),
+    DML_PARAM( "MREFPSDus",          DML_PARAM_KIND_STRING,   DML_XDSL_LINE, MREFPSDus ),
+    DML_PARAM( "VirtualNoisePSDds",  DML_PARAM_KIND_STRING,   DML_XDSL_LINE, VirtualNoisePSDds ),
+    DML_PARAM( "VirtualNoisePSDus",  DML_PARAM_KIND_STRING,   DML_XDSL_LINE, VirtualNoisePSDus )
+};
+static DML_PARAM_TABLE g_LineStringParamTable = DML_PARAM_TABLE_INIT( g_LineStringParamEntries );
+
+static const DML_PARAM_ENTRY g_LineUlongParamEntries[] =
+{
+    DML_PARAM( "Status",                         DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, Status ),
+    DML_PARAM( "LastChange",                     DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, LastChange ),
+    DML_PARAM( "LinkStatus",                     DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, LinkStatus ),
+    DML_PARAM( "UpstreamMaxBitRate",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, UpstreamMaxBitRate ),
+    DML_PARAM( "DownstreamMaxBitRate",           DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, DownstreamMaxBitRate ),
+    DML_PARAM( "X_RDK_WanStatus",                DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, WanStatus ),
+    DML_PARAM( "LineEncoding",                   DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, LineEncoding ),
+    DML_PARAM( "INMIATOds",                      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, INMIATOds ),
+    DML_PARAM( "INMIATSds",                      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, INMIATSds ),
+    DML_PARAM( "INMCCds",                        DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, INMCCds ),
+    DML_PARAM( "PowerManagementState",           DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, PowerManagementState ),
+    DML_PARAM( "ACTSNRMODEds",                   DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTSNRMODEds ),
+    DML_PARAM( "ACTSNRMODEus",                   DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTSNRMODEus ),
+    DML_PARAM( "ACTUALCE",                       DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTUALCE ),
+    DML_PARAM( "XTURANSIStd",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, XTURANSIStd ),
+    DML_PARAM( "XTURANSIRev",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, XTURANSIRev ),
+    DML_PARAM( "XTUCANSIStd",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, XTUCANSIStd ),
+    DML_PARAM( "XTUCANSIRev",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, XTUCANSIRev ),
+    DML_PARAM( "SuccessFailureCause",            DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, SuccessFailureCause ),
+    DML_PARAM( "UPBOKLE",                        DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, UPBOKLE ),
+    DML_PARAM( "UPBOKLER",                       DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, UPBOKLER ),
+    DML_PARAM( "ACTRAMODEds",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTRAMODEds ),
+    DML_PARAM( "ACTRAMODEus",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTRAMODEus ),
+    DML_PARAM( "ACTINPROCds",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTINPROCds ),
+    DML_PARAM( "ACTINPROCus",                    DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, ACTINPROCus ),
+    DML_PARAM( "SNRMROCds",                      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, SNRMROCds ),
+    DML_PARAM( "SNRMROCus",                      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, SNRMROCus ),
+    DML_PARAM( "LastStateTransmittedDownstream", DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, LastStateTransmittedDownstream ),
+    DML_PARAM( "LastStateTransmittedUpstream",   DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, LastStateTransmittedUpstream ),
+    DML_PARAM( "LIMITMASK",                      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, LIMITMASK ),
+    DML_PARAM( "US0MASK",                        DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE, US0MASK )
+};
+static DML_PARAM_TABLE g_LineUlongParamTable = DML_PARAM_TABLE_INIT( g_LineUlongParamEntries );
+
+static const DML_PARAM_ENTRY g_LineIntParamEntries[] =
+{
+    DML_PARAM( "UpstreamAttenuation",   DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, UpstreamAttenuation ),
+    DML_PARAM( "UpstreamNoiseMargin",   DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, UpstreamNoiseMargin ),
+    DML_PARAM( "UpstreamPower",         DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, UpstreamPower ),
+    DML_PARAM( "TRELLISds",             DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, TRELLISds ),
+    DML_PARAM( "TRELLISus",             DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, TRELLISus ),
+    DML_PARAM( "LineNumber",            DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, LineNumber ),
+    DML_PARAM( "INMINPEQMODEds",        DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, INMINPEQMODEds ),
+    DML_PARAM( "DownstreamAttenuation", DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, DownstreamAttenuation ),
+    DML_PARAM( "DownstreamNoiseMargin", DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, DownstreamNoiseMargin ),
+    DML_PARAM( "DownstreamPower",       DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, DownstreamPower ),
+    DML_PARAM( "RXTHRSHds",             DML_PARAM_KIND_SIGNED,   DML_XDSL_LINE, RXTHRSHds )
+};
+static DML_PARAM_TABLE g_LineIntParamTable = DML_PARAM_TABLE_INIT( g_LineIntParamEntries );
+
+static const DML_PARAM_ENTRY g_LineStatsParamEntries[] =
+{
+    DML_PARAM( "BytesSent",              DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, BytesSent ),
+    DML_PARAM( "BytesReceived",          DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, BytesReceived ),
+    DML_PARAM( "PacketsSent",            DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, PacketsSent ),
+    DML_PARAM( "PacketsReceived",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, PacketsReceived ),
+    DML_PARAM( "ErrorsSent",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, ErrorsSent ),
+    DML_PARAM( "ErrorsReceived",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, ErrorsReceived ),
+    DML_PARAM( "DiscardPacketsSent",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, DiscardPacketsSent ),
+    DML_PARAM( "DiscardPacketsReceived", DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, DiscardPacketsReceived ),
+    DML_PARAM( "TotalStart",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, TotalStart ),
+    DML_PARAM( "ShowtimeStart",          DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, ShowtimeStart ),
+    DML_PARAM( "LastShowtimeStart",      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, LastShowtimeStart ),
+    DML_PARAM( "QuarterHourStart",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, QuarterHourStart ),
+    DML_PARAM( "CurrentDayStart",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, CurrentDayStart ),
+    DML_PARAM( "X_RDK_LifetimeSuccessfulRetrains", DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS, X_RDK_LifetimeSuccessfulRetrains )
+};
+static DML_PARAM_TABLE g_LineStatsParamTable = DML_PARAM_TABLE_INIT( g_LineStatsParamEntries );
+
+static const DML_PARAM_ENTRY g_LineStatsCurrentDayParamEntries[] =
+{
+    DML_PARAM( "ErroredSecs",              DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS_CURRENTDAY, ErroredSecs ),
+    DML_PARAM( "SeverelyErroredSecs",      DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS_CURRENTDAY, SeverelyErroredSecs ),
+    DML_PARAM( "X_RDK_LinkRetrain",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS_CURRENTDAY, X_RDK_LinkRetrain ),
+    DML_PARAM( "X_RDK_InitErrors",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS_CURRENTDAY, X_RDK_InitErrors ),
+    DML_PARAM( "X_RDK_InitTimeouts",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS_CURRENTDAY, X_RDK_InitTimeouts ),
+    DML_PARAM( "X_RDK_SuccessfulRetrains", DML_PARAM_KIND_UNSIGNED, DML_XDSL_LINE_STATS_CURRENTDAY, X_RDK_SuccessfulRetrains )
+};
+static DML_PARAM_TABLE g_LineStatsCurrentDayParamTable = DML_PARAM_TABLE_INIT( g_LineStatsCurrentDayParamEntries );
+
+/* Shared by the QuarterHour and Day history entries */
+static const DML_PARAM_ENTRY g_LinePMHistoryParamEntries[] =
+{
+    DML_PARAM( "IntervalEnd",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, IntervalEnd ),
+    DML_PARAM( "Elapsed",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, Elapsed ),
+    DML_PARAM( "Suspect",             DML_PARAM_KIND_BOOL,     DML_XDSL_PM_INTERVAL, Suspect ),
+    DML_PARAM( "ErroredSecs",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.ErroredSecs ),
+    DML_PARAM( "SeverelyErroredSecs", DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.SeverelyErroredSecs ),
+    DML_PARAM( "XTURCRCErrors",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.XTURCRCErrors ),
+    DML_PARAM( "XTUCCRCErrors",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.XTUCCRCErrors ),
+    DML_PARAM( "XTURFECErrors",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.XTURFECErrors ),
+    DML_PARAM( "XTUCFECErrors",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.XTUCFECErrors ),
+    DML_PARAM( "XTURHECErrors",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.XTURHECErrors ),
+    DML_PARAM( "XTUCHECErrors",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.XTUCHECErrors ),
+    DML_PARAM( "LinkRetrain",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.LinkRetrain ),
+    DML_PARAM( "InitErrors",          DML_PARAM_KIND_UNSIGNED, DML_XDSL_PM_INTERVAL, stCounters.InitErrors )
+};
+static DML_PARAM_TABLE g_LinePMHistoryParamTable = DML_PARAM_TABLE_INIT( g_LinePMHistoryParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelIntParamEntries[] =
+{
+    DML_PARAM( "INTLVBLOCK", DML_PARAM_KIND_SIGNED,   DML_XDSL_CHANNEL, INTLVBLOCK ),
+    DML_PARAM( "ACTINP",     DML_PARAM_KIND_SIGNED,   DML_XDSL_CHANNEL, ACTINP ),
+    DML_PARAM( "NFEC",       DML_PARAM_KIND_SIGNED,   DML_XDSL_CHANNEL, NFEC ),
+    DML_PARAM( "RFEC",       DML_PARAM_KIND_SIGNED,   DML_XDSL_CHANNEL, RFEC ),
+    DML_PARAM( "LSYMB",      DML_PARAM_KIND_SIGNED,   DML_XDSL_CHANNEL, LSYMB )
+};
+static DML_PARAM_TABLE g_ChannelIntParamTable = DML_PARAM_TABLE_INIT( g_ChannelIntParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelUlongParamEntries[] =
+{
+    DML_PARAM( "Status",                  DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, Status ),
+    DML_PARAM( "LastChange",              DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, LastChange ),
+    DML_PARAM( "LPATH",                   DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, LPATH ),
+    DML_PARAM( "INTLVDEPTH",              DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, INTLVDEPTH ),
+    DML_PARAM( "ActualInterleavingDelay", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, ActualInterleavingDelay ),
+    DML_PARAM( "UpstreamCurrRate",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, UpstreamCurrRate ),
+    DML_PARAM( "DownstreamCurrRate",      DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, DownstreamCurrRate ),
+    DML_PARAM( "ACTNDR",                  DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, ACTNDR ),
+    DML_PARAM( "ACTINPREIN",              DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL, ACTINPREIN )
+};
+static DML_PARAM_TABLE g_ChannelUlongParamTable = DML_PARAM_TABLE_INIT( g_ChannelUlongParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelStringParamEntries[] =
+{
+    DML_PARAM( "Alias",                      DML_PARAM_KIND_STRING,   DML_XDSL_CHANNEL, Alias ),
+    DML_PARAM( "LowerLayers",                DML_PARAM_KIND_STRING,   DML_XDSL_CHANNEL, LowerLayers ),
+    DML_PARAM( "Name",                       DML_PARAM_KIND_STRING,   DML_XDSL_CHANNEL, Name ),
+    DML_PARAM( "LinkEncapsulationSupported", DML_PARAM_KIND_STRING,   DML_XDSL_CHANNEL, LinkEncapsulationSupported ),
+    DML_PARAM( "LinkEncapsulationUsed",      DML_PARAM_KIND_STRING,   DML_XDSL_CHANNEL, LinkEncapsulationUsed )
+};
+static DML_PARAM_TABLE g_ChannelStringParamTable = DML_PARAM_TABLE_INIT( g_ChannelStringParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelStatsParamEntries[] =
+{
+    DML_PARAM( "BytesSent",              DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, BytesSent ),
+    DML_PARAM( "BytesReceived",          DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, BytesReceived ),
+    DML_PARAM( "PacketsSent",            DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, PacketsSent ),
+    DML_PARAM( "PacketsReceived",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, PacketsReceived ),
+    DML_PARAM( "ErrorsSent",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, ErrorsSent ),
+    DML_PARAM( "ErrorsReceived",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, ErrorsReceived ),
+    DML_PARAM( "DiscardPacketsSent",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, DiscardPacketsSent ),
+    DML_PARAM( "DiscardPacketsReceived", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, DiscardPacketsReceived ),
+    DML_PARAM( "TotalStart",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, TotalStart ),
+    DML_PARAM( "ShowtimeStart",          DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, ShowtimeStart ),
+    DML_PARAM( "LastShowtimeStart",      DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, LastShowtimeStart ),
+    DML_PARAM( "QuarterHourStart",       DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, QuarterHourStart ),
+    DML_PARAM( "CurrentDayStart",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS, CurrentDayStart )
+};
+static DML_PARAM_TABLE g_ChannelStatsParamTable = DML_PARAM_TABLE_INIT( g_ChannelStatsParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelStatsTimeParamEntries[] =
+{
+    DML_PARAM( "XTURFECErrors", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_TIME, XTURFECErrors ),
+    DML_PARAM( "XTUCFECErrors", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_TIME, XTUCFECErrors ),
+    DML_PARAM( "XTURHECErrors", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_TIME, XTURHECErrors ),
+    DML_PARAM( "XTUCHECErrors", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_TIME, XTUCHECErrors ),
+    DML_PARAM( "XTURCRCErrors", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_TIME, XTURCRCErrors ),
+    DML_PARAM( "XTUCCRCErrors", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_TIME, XTUCCRCErrors )
+};
+static DML_PARAM_TABLE g_ChannelStatsTimeParamTable = DML_PARAM_TABLE_INIT( g_ChannelStatsTimeParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelStatsCurrentDayParamEntries[] =
+{
+    DML_PARAM( "XTURFECErrors",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, XTURFECErrors ),
+    DML_PARAM( "XTUCFECErrors",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, XTUCFECErrors ),
+    DML_PARAM( "XTURHECErrors",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, XTURHECErrors ),
+    DML_PARAM( "XTUCHECErrors",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, XTUCHECErrors ),
+    DML_PARAM( "XTURCRCErrors",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, XTURCRCErrors ),
+    DML_PARAM( "XTUCCRCErrors",             DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, XTUCCRCErrors ),
+    DML_PARAM( "X_RDK_LinkRetrain",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, X_RDK_LinkRetrain ),
+    DML_PARAM( "X_RDK_InitErrors",          DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, X_RDK_InitErrors ),
+    DML_PARAM( "X_RDK_InitTimeouts",        DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, X_RDK_InitTimeouts ),
+    DML_PARAM( "X_RDK_SeverelyErroredSecs", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, X_RDK_SeverelyErroredSecs ),
+    DML_PARAM( "X_RDK_ErroredSecs",         DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_CURRENTDAY, X_RDK_ErroredSecs )
+};
+static DML_PARAM_TABLE g_ChannelStatsCurrentDayParamTable = DML_PARAM_TABLE_INIT( g_ChannelStatsCurrentDayParamEntries );
+
+static const DML_PARAM_ENTRY g_ChannelStatsQuarterHourParamEntries[] =
+{
+    DML_PARAM( "XTURFECErrors",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, XTURFECErrors ),
+    DML_PARAM( "XTUCFECErrors",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, XTUCFECErrors ),
+    DML_PARAM( "XTURHECErrors",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, XTURHECErrors ),
+    DML_PARAM( "XTUCHECErrors",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, XTUCHECErrors ),
+    DML_PARAM( "XTURCRCErrors",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, XTURCRCErrors ),
+    DML_PARAM( "XTUCCRCErrors",     DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, XTUCCRCErrors ),
+    DML_PARAM( "X_RDK_LinkRetrain", DML_PARAM_KIND_UNSIGNED, DML_XDSL_CHANNEL_STATS_QUARTERHOUR, X_RDK_LinkRetrain )
+};
+static DML_PARAM_TABLE g_ChannelStatsQuarterHourParamTable = DML_PARAM_TABLE_INIT( g_ChannelStatsQuarterHourParamEntries );
+
+/**********************************************************************
+
+    caller:     COSA_Init
+
+    prototype:
+
+        ANSC_STATUS
+        XdslDmlInitParamTables
+            (
+                VOID
+            );
+
+    description:
+
+        This function builds the hashed parameter name lookup of the
+        DSL Line and Channel getter tables. Must run before the getters are
+        registered.
+
+    argument:   None
+
+    return:     ANSC_STATUS_SUCCESS always, a table whose hash could not
+                be built falls back to a linear name scan.
+
+**********************************************************************/
+ANSC_STATUS
+XdslDmlInitParamTables
+    (
+        VOID
+    )
+{
+    DmlParamTableInit( &g_LineStringParamTable );
+    DmlParamTableInit( &g_LineUlongParamTable );
+    DmlParamTableInit( &g_LineIntParamTable );
+    DmlParamTableInit( &g_LineStatsParamTable );
+    DmlParamTableInit( &g_LineStatsCurrentDayParamTable );
+    DmlParamTableInit( &g_LinePMHistoryParamTable );
+    DmlParamTableInit( &g_ChannelIntParamTable );
+    DmlParamTableInit( &g_ChannelUlongParamTable );
+    DmlParamTableInit( &g_ChannelStringParamTable );
+    DmlParamTableInit( &g_ChannelStatsParamTable );
+    DmlParamTableInit( &g_ChannelStatsTimeParamTable );
+    DmlParamTableInit( &g_ChannelStatsCurrentDayParamTable );
+    DmlParamTableInit( &g_ChannelStatsQuarterHourParamTable );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
 /***********************************************************************
 
  APIs for Object:
@@ -372,338 +642,92 @@ Line_GetParamStringValue
     PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
     
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Alias", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->Alias ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->Alias );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->Alias );
-           return 1;
-       }
-    }
+    return DmlParamTableGetString( &g_LineStringParamTable, pXDSLLine, ParamName, pValue, pUlSize );
+}
 
-    if( AnscEqualString(ParamName, "Name", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->Name ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->Name );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->Name );
-           return 1;
-       }
-    }
+/**********************************************************************  
 
-    if( AnscEqualString(ParamName, "LowerLayers", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->LowerLayers ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->LowerLayers );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->LowerLayers );
-           return 1;
-       }
-    }
+    caller:     owner of this object 
 
-    if( AnscEqualString(ParamName, "StandardsSupported", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->StandardsSupported ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->StandardsSupported );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->StandardsSupported );
-           return 1;
-       }
-    }
+    prototype: 
 
-    if( AnscEqualString(ParamName, "StandardUsed", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->StandardUsed ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->StandardUsed );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->StandardUsed );
-           return 1;
-       }
-    }
+        BOOL
+        Line_SetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL                        bValue
+            );
 
-    if( AnscEqualString(ParamName, "AllowedProfiles", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->AllowedProfiles ) - 1 ) < *pUlSize )
-       {   
-           AnscCopyString( pValue, pXDSLLine->AllowedProfiles );
-           return 0;
-       }
-       else
-       {   
-           *pUlSize = sizeof( pXDSLLine->AllowedProfiles );
-           return 1;
-       }
-    }
+    description:
 
-    if( AnscEqualString(ParamName, "CurrentProfile", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->CurrentProfile ) - 1 ) < *pUlSize )
-       {   
-           AnscCopyString( pValue, pXDSLLine->CurrentProfile );
-           return 0;
-       }
-       else
-       {   
-           *pUlSize = sizeof( pXDSLLine->CurrentProfile );
-           return 1;
-       }
-    }
+        This function is called to set BOOL parameter value; 
 
-    if( AnscEqualString(ParamName, "SNRMpbus", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->SNRMpbus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->SNRMpbus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->SNRMpbus );
-           return 1;
-       }
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "SNRMpbds", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->SNRMpbds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->SNRMpbds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->SNRMpbds );
-           return 1;
-       }
-    }
+                char*                       ParamName,
+                The parameter name;
 
-    if( AnscEqualString(ParamName, "FirmwareVersion", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->FirmwareVersion ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->FirmwareVersion );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->FirmwareVersion );
-           return 1;
-       }
-    }
+                BOOL                        bValue
+                The updated BOOL value;
 
-    if( AnscEqualString(ParamName, "XTURVendor", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->XTURVendor ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->XTURVendor );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->XTURVendor );
-           return 1;
-       }
-    }
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+Line_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    )
+{
+    PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
 
-    if( AnscEqualString(ParamName, "XTUCVendor", TRUE) )
+    /* check the parameter name and set the corresponding value */
+    //Applied by Line_Commit, a value set back to the applied one is no longer pending
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->XTUCVendor ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->XTUCVendor );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->XTUCVendor );
-           return 1;
-       }
-    }
+    	if( bValue == pXDSLLine->Enable )
+    	{
+    		return TRUE;	//No need to proceed when same value comes
+    	}
+		
+    	pXDSLLine->Enable  = bValue;
+        pXDSLLine->ulPendingCfg ^= XDSL_LINE_CFG_ENABLE;
 
-    if( AnscEqualString(ParamName, "XTURCountry", TRUE) )
-    {  
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->XTURCountry ) - 1 ) < *pUlSize )
-       {   
-           AnscCopyString( pValue, pXDSLLine->XTURCountry );
-           return 0;
-       }
-       else
-       {   
-           *pUlSize = sizeof( pXDSLLine->XTURCountry );
-           return 1;
-       }
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "XTUCCountry", TRUE) )
+    if( AnscEqualString(ParamName, "EnableDataGathering", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->XTUCCountry ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->XTUCCountry );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->XTUCCountry );
-           return 1;
-       }
-    }
+    	if( bValue == pXDSLLine->EnableDataGathering )
+    	{
+    		return TRUE;	//No need to proceed when same value comes
+    	}
+		
+    	pXDSLLine->EnableDataGathering = bValue;
+        pXDSLLine->ulPendingCfg ^= XDSL_LINE_CFG_DATA_GATHERING;
 
-    if( AnscEqualString(ParamName, "UPBOKLEPb", TRUE) )
-    {
-       /* collect value */
-     if ( ( sizeof( pXDSLLine->UPBOKLEPb ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->UPBOKLEPb );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->UPBOKLEPb );
-           return 1;
-       }
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "UPBOKLERPb", TRUE) )
+    if( AnscEqualString(ParamName, "Upstream", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->UPBOKLERPb ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->UPBOKLERPb );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->UPBOKLERPb );
-           return 1;
-       }
-    }
+        if( bValue == pXDSLLine->Upstream )
+        {
+            return TRUE;    //No need to proceed when same value comes
+        }
 
-    if( AnscEqualString(ParamName, "XTSE", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->XTSE ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->XTSE );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->XTSE );
-           return 1;
-       }
+        pXDSLLine->Upstream = bValue;
+        pXDSLLine->ulPendingCfg ^= XDSL_LINE_CFG_UPSTREAM;
+
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "XTSUsed", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->XTSUsed ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->XTSUsed );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->XTSUsed );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "MREFPSDds", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->MREFPSDds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->MREFPSDds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->MREFPSDds );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "MREFPSDus", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->MREFPSDus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->MREFPSDus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->MREFPSDus );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "VirtualNoisePSDds", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->VirtualNoisePSDds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->VirtualNoisePSDds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->VirtualNoisePSDds );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "VirtualNoisePSDus", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pXDSLLine->VirtualNoisePSDus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pXDSLLine->VirtualNoisePSDus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pXDSLLine->VirtualNoisePSDus );
-           return 1;
-       }
-    }
-
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return -1;
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
 }
 
 /**********************************************************************  
@@ -713,16 +737,16 @@ Line_GetParamStringValue
     prototype: 
 
         BOOL
-        Line_SetParamBoolValue
+        Line_SetParamStringValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL                        bValue
+                char*                       pString
             );
 
     description:
 
-        This function is called to set BOOL parameter value; 
+        This function is called to set string parameter value; 
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -730,69 +754,31 @@ Line_GetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL                        bValue
-                The updated BOOL value;
+                char*                       pString
+                The updated string value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-Line_SetParamBoolValue
+Line_SetParamStringValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL                        bValue
+        char*                       pString
     )
 {
     PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
 
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "Enable", TRUE))
-    {
-    	if( bValue == pXDSLLine->Enable )
-    	{
-    		return TRUE;	//No need to proceed when same value comes
-    	}
-		
-    	pXDSLLine->Enable  = bValue;
-		
-        //Process DSL enable set
-        DmlXdslLineSetEnable( ( pXDSLLine->ulInstanceNumber - 1 ), pXDSLLine->Enable );
-
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "EnableDataGathering", TRUE))
-    {
-    	if( bValue == pXDSLLine->EnableDataGathering )
-    	{
-    		return TRUE;	//No need to proceed when same value comes
-    	}
-		
-    	pXDSLLine->EnableDataGathering = bValue;
-		
-        //Process Datagather set
-        DmlXdslLineSetDataGatheringEnable( ( pXDSLLine->ulInstanceNumber - 1 ), pXDSLLine->EnableDataGathering );
-
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "Upstream", TRUE))
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Alias", TRUE))
     {
-        if( bValue == pXDSLLine->Upstream )
-        {
-            return TRUE;    //No need to proceed when same value comes
-        }
-
-        pXDSLLine->Upstream = bValue;
-
-        //Process Upstream set
-        DmlXdslLineSetUpstream( ( pXDSLLine->ulInstanceNumber - 1 ), pXDSLLine->Upstream );
-
+        /* save update to backup */
+        AnscCopyString( pXDSLLine->Alias, pString );
         return TRUE;
     }
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
@@ -803,16 +789,16 @@ Line_SetParamBoolValue
     prototype: 
 
         BOOL
-        Line_SetParamStringValue
+        Line_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pString
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to set string parameter value; 
+        This function is called to retrieve ULONG parameter value; 
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -820,32 +806,24 @@ Line_SetParamBoolValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pString
-                The updated string value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-Line_SetParamStringValue
+Line_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pString
+        ULONG*                      puLong
     )
 {
     PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
-
+    
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Alias", TRUE))
-    {
-        /* save update to backup */
-        AnscCopyString( pXDSLLine->Alias, pString );
-        return TRUE;
-    }
-
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return DmlParamTableGetUlong( &g_LineUlongParamTable, pXDSLLine, ParamName, puLong );
 }
 
 /**********************************************************************  
@@ -855,16 +833,16 @@ Line_SetParamStringValue
     prototype: 
 
         BOOL
-        Line_GetParamUlongValue
+        Line_SetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                ULONG                       uValue
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value; 
+        This function is called to set ULONG parameter value; 
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -872,406 +850,84 @@ Line_SetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                ULONG                       uValue
+                The updated ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-Line_GetParamUlongValue
+Line_SetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        ULONG                       uValue
     )
 {
     PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
-    
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Status", TRUE) )
-    {
-    	*puLong	= pXDSLLine->Status;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "LastChange", TRUE) )
-    {
-        *puLong = pXDSLLine->LastChange;
-        return TRUE;
-    }
 
-    if( AnscEqualString(ParamName, "LinkStatus", TRUE) )
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "X_RDK_WanStatus", TRUE))
     {
-    	*puLong	= pXDSLLine->LinkStatus;
-        return TRUE;
-    }
+        DmlXdslLineSetWanStatus( pXDSLLine->ulInstanceNumber - 1, uValue );
+        pXDSLLine->WanStatus = uValue;
 
-    if( AnscEqualString(ParamName, "UpstreamMaxBitRate", TRUE) )
-    {
-    	*puLong	= pXDSLLine->UpstreamMaxBitRate;
         return TRUE;
     }
+    
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
 
-    if( AnscEqualString(ParamName, "DownstreamMaxBitRate", TRUE) )
-    {
-    	*puLong	= pXDSLLine->DownstreamMaxBitRate;
-        return TRUE;
-    }
+/**********************************************************************
 
-    if( AnscEqualString(ParamName, "X_RDK_WanStatus", TRUE) )
-    {
-        *puLong = pXDSLLine->WanStatus;
-        return TRUE;
-    }
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "LineEncoding", TRUE) )
-    {
-        *puLong = pXDSLLine->LineEncoding;
-        return TRUE;
-    }
+    prototype:
 
-    if( AnscEqualString(ParamName, "INMIATOds", TRUE) )
-    {
-        *puLong = pXDSLLine->INMIATOds;
-        return TRUE;
-    }
+        BOOL
+        Line_GetParamIntValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                int*                        pInt
+            );
 
-    if( AnscEqualString(ParamName, "INMIATSds", TRUE) )
-    {
-        *puLong = pXDSLLine->INMIATSds;
-        return TRUE;
-    }
+    description:
 
-    if( AnscEqualString(ParamName, "INMCCds", TRUE) )
-    {
-        *puLong = pXDSLLine->INMCCds;
-        return TRUE;
-    }
+        This function is called to retrieve integer parameter value;
 
-    if( AnscEqualString(ParamName, "PowerManagementState", TRUE) )
-    {
-        *puLong = pXDSLLine->PowerManagementState;
-        return TRUE;
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "ACTSNRMODEds", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTSNRMODEds;
-        return TRUE;
-    }
+                char*                       ParamName,
+                The parameter name;
 
-    if( AnscEqualString(ParamName, "ACTSNRMODEus", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTSNRMODEus;
-        return TRUE;
-    }
+                int*                        pInt
+                The buffer of returned integer value;
 
-    if( AnscEqualString(ParamName, "ACTUALCE", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTUALCE;
-        return TRUE;
-    }
+    return:     TRUE if succeeded.
 
-    if( AnscEqualString(ParamName, "XTURANSIStd", TRUE) )
-    {
-        *puLong = pXDSLLine->XTURANSIStd;
-        return TRUE;
-    }
+**********************************************************************/
+BOOL
+Line_GetParamIntValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        int*                        pInt
+    )
+{
+    PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
 
-    if( AnscEqualString(ParamName, "XTURANSIRev", TRUE) )
-    {
-        *puLong = pXDSLLine->XTURANSIRev;
-        return TRUE;
-    }
+    /* check the parameter name and return the corresponding value */
+    return DmlParamTableGetInt( &g_LineIntParamTable, pXDSLLine, ParamName, pInt );
+}
 
-    if( AnscEqualString(ParamName, "XTUCANSIStd", TRUE) )
-    {
-        *puLong = pXDSLLine->XTUCANSIStd;
-        return TRUE;
-    }
+/**********************************************************************
 
-    if( AnscEqualString(ParamName, "XTUCANSIRev", TRUE) )
-    {
-        *puLong = pXDSLLine->XTUCANSIRev;
-        return TRUE;
-    }
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "SuccessFailureCause", TRUE) )
-    {
-        *puLong = pXDSLLine->SuccessFailureCause;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UPBOKLE", TRUE) )
-    {
-        *puLong = pXDSLLine->UPBOKLE;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UPBOKLER", TRUE) )
-    {
-        *puLong = pXDSLLine->UPBOKLER;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTRAMODEds", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTRAMODEds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTRAMODEus", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTRAMODEus;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTINPROCds", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTINPROCds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTINPROCus", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTINPROCus;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "SNRMROCds", TRUE) )
-    {
-        *puLong = pXDSLLine->SNRMROCds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "SNRMROCus", TRUE) )
-    {
-        *puLong = pXDSLLine->SNRMROCus;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "LastStateTransmittedDownstream", TRUE) )
-    {
-        *puLong = pXDSLLine->LastStateTransmittedDownstream;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "LastStateTransmittedUpstream", TRUE) )
-    {
-        *puLong = pXDSLLine->LastStateTransmittedUpstream;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "LIMITMASK", TRUE) )
-    {
-        *puLong = pXDSLLine->LIMITMASK;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "US0MASK", TRUE) )
-    {
-        *puLong = pXDSLLine->US0MASK;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTSNRMODEds", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTSNRMODEds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTSNRMODEus", TRUE) )
-    {
-        *puLong = pXDSLLine->ACTSNRMODEus;
-        return TRUE;
-    }
-
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/**********************************************************************  
-
-    caller:     owner of this object 
-
-    prototype: 
-
-        BOOL
-        Line_SetParamUlongValue
-            (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG                       uValue
-            );
-
-    description:
-
-        This function is called to set ULONG parameter value; 
-
-    argument:   ANSC_HANDLE                 hInsContext,
-                The instance handle;
-
-                char*                       ParamName,
-                The parameter name;
-
-                ULONG                       uValue
-                The updated ULONG value;
-
-    return:     TRUE if succeeded.
-
-**********************************************************************/
-BOOL
-Line_SetParamUlongValue
-    (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG                       uValue
-    )
-{
-    PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
-
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "X_RDK_WanStatus", TRUE))
-    {
-        DmlXdslLineSetWanStatus( pXDSLLine->ulInstanceNumber - 1, uValue );
-        pXDSLLine->WanStatus = uValue;
-
-        return TRUE;
-    }
-    
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/**********************************************************************
-
-    caller:     owner of this object
-
-    prototype:
-
-        BOOL
-        Line_GetParamIntValue
-            (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                int*                        pInt
-            );
-
-    description:
-
-        This function is called to retrieve integer parameter value;
-
-    argument:   ANSC_HANDLE                 hInsContext,
-                The instance handle;
-
-                char*                       ParamName,
-                The parameter name;
-
-                int*                        pInt
-                The buffer of returned integer value;
-
-    return:     TRUE if succeeded.
-
-**********************************************************************/
-BOOL
-Line_GetParamIntValue
-    (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        int*                        pInt
-    )
-{
-    PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
-
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "UpstreamAttenuation", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->UpstreamAttenuation;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UpstreamNoiseMargin", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->UpstreamNoiseMargin;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UpstreamPower", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->UpstreamPower;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "TRELLISds", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->TRELLISds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "TRELLISus", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->TRELLISus;
-        return TRUE;
-    }
-    
-    if( AnscEqualString(ParamName, "LineNumber", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->LineNumber;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "INMINPEQMODEds", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->INMINPEQMODEds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DownstreamAttenuation", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->TRELLISus;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DownstreamNoiseMargin", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->DownstreamNoiseMargin;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DownstreamPower", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->DownstreamPower;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "RXTHRSHds", TRUE))
-    {
-        /* collect value */
-        *pInt = pXDSLLine->RXTHRSHds;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/**********************************************************************
-
-    caller:     owner of this object
-
-    prototype:
+    prototype:
 
         BOOL
         Line_Validate
@@ -1332,6 +988,22 @@ Line_Commit
         ANSC_HANDLE                 hInsContext
     )
 {
+    PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
+    ULONG               ulChanged = pXDSLLine->ulPendingCfg;
+
+    if( 0 == ulChanged )
+    {
+        return 0;
+    }
+
+    pXDSLLine->ulPendingCfg = 0;
+
+    //Enable and EnableDataGathering in one HAL set, then the Upstream handover
+    if( ANSC_STATUS_SUCCESS != DmlXdslLineApplyConfig( ( pXDSLLine->ulInstanceNumber - 1 ), pXDSLLine, ulChanged ) )
+    {
+        CcspTraceError(("%s Failed to apply the configuration of line %lu\n", __FUNCTION__, pXDSLLine->ulInstanceNumber));
+    }
+
     return 0;
 }
 
@@ -1360,6 +1032,26 @@ Line_Rollback
         ANSC_HANDLE                 hInsContext
     )
 {
+    PDML_XDSL_LINE      pXDSLLine = (PDML_XDSL_LINE)hInsContext;
+
+    //A pending boolean differs from the applied one, inverting it restores it
+    if( pXDSLLine->ulPendingCfg & XDSL_LINE_CFG_ENABLE )
+    {
+        pXDSLLine->Enable = !pXDSLLine->Enable;
+    }
+
+    if( pXDSLLine->ulPendingCfg & XDSL_LINE_CFG_DATA_GATHERING )
+    {
+        pXDSLLine->EnableDataGathering = !pXDSLLine->EnableDataGathering;
+    }
+
+    if( pXDSLLine->ulPendingCfg & XDSL_LINE_CFG_UPSTREAM )
+    {
+        pXDSLLine->Upstream = !pXDSLLine->Upstream;
+    }
+
+    pXDSLLine->ulPendingCfg = 0;
+
     return 0;
 }
 
@@ -1405,93 +1097,14 @@ LineStats_GetParamUlongValue
     PDML_XDSL_LINE_STATS    pXDSLLineStats  = &(pXDSLLine->stLineStats);
 
     /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "BytesSent", TRUE) )
-    {
-        *puLong = pXDSLLineStats->BytesSent;
-        return TRUE;
-    }
+    return DmlParamTableGetUlong( &g_LineStatsParamTable, pXDSLLineStats, ParamName, puLong );
+}
 
-    if( AnscEqualString(ParamName, "BytesReceived", TRUE) )
-    {
-        *puLong = pXDSLLineStats->BytesSent;
-        return TRUE;
-    }
+/***********************************************************************
 
-    if( AnscEqualString(ParamName, "PacketsSent", TRUE) )
-    {
-        *puLong = pXDSLLineStats->PacketsSent;
-        return TRUE;
-    }    
+ APIs for Object:
 
-    if( AnscEqualString(ParamName, "PacketsReceived", TRUE) )
-    {
-        *puLong = pXDSLLineStats->PacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ErrorsSent", TRUE) )
-    {
-        *puLong = pXDSLLineStats->ErrorsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ErrorsReceived", TRUE) )
-    {
-        *puLong = pXDSLLineStats->ErrorsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DiscardPacketsSent", TRUE) )
-    {
-        *puLong = pXDSLLineStats->DiscardPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DiscardPacketsReceived", TRUE) )
-    {
-        *puLong = pXDSLLineStats->DiscardPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "TotalStart", TRUE) )
-    {
-        *puLong = pXDSLLineStats->TotalStart;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ShowtimeStart", TRUE) )
-    {
-        *puLong = pXDSLLineStats->ShowtimeStart;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "LastShowtimeStart", TRUE) )
-    {
-        *puLong = pXDSLLineStats->LastShowtimeStart;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "QuarterHourStart", TRUE) )
-    {
-        *puLong = pXDSLLineStats->QuarterHourStart;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "CurrentDayStart", TRUE) )
-    {
-        *puLong = pXDSLLineStats->CurrentDayStart;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/***********************************************************************
-
- APIs for Object:
-
-    DSL.Line.{i}.Stats.Total.
+    DSL.Line.{i}.Stats.Total.
 
     *  LineStatsTotal_GetParamUlongValue
 
@@ -1743,44 +1356,7 @@ LineStatsCurrentDay_GetParamUlongValue
     PDML_XDSL_LINE_STATS_CURRENTDAY   pXDSLLineStatsCurrentDay  = &(pXDSLLineStats->stCurrentDay);
 
     /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "ErroredSecs", TRUE) )
-    {
-        *puLong = pXDSLLineStatsCurrentDay->ErroredSecs;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "SeverelyErroredSecs", TRUE) )
-    {
-        *puLong = pXDSLLineStatsCurrentDay->SeverelyErroredSecs;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "X_RDK_LinkRetrain", TRUE) )
-    {
-        *puLong = pXDSLLineStatsCurrentDay->X_RDK_LinkRetrain;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "X_RDK_InitErrors", TRUE) )
-    {
-        *puLong = pXDSLLineStatsCurrentDay->X_RDK_InitErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "X_RDK_InitTimeouts", TRUE) )
-    {
-        *puLong = pXDSLLineStatsCurrentDay->X_RDK_InitTimeouts;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "X_RDK_SuccessfulRetrains", TRUE) )
-    {
-        *puLong = pXDSLLineStatsCurrentDay->X_RDK_SuccessfulRetrains;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return DmlParamTableGetUlong( &g_LineStatsCurrentDayParamTable, pXDSLLineStatsCurrentDay, ParamName, puLong );
 }
 
 /***********************************************************************
@@ -1856,25 +1432,33 @@ LineStatsQuarterHour_GetParamUlongValue
     return FALSE;
 }
 
+/* Snapshot of the completed intervals of the line, shared by both tables and retaken when an interval was stored */
+static ULONG LinePMHistory_Sync( PDML_XDSL_LINE pXDSLLine )
+{
+    if( NULL == pXDSLLine->pstPmHistory )
+    {
+        pXDSLLine->pstPmHistory = (PDML_XDSL_X_RDK_PM_HISTORY)AnscAllocateMemory( sizeof(DML_XDSL_X_RDK_PM_HISTORY) );
+        if( NULL == pXDSLLine->pstPmHistory )
+        {
+            return ANSC_STATUS_FAILURE;
+        }
+    }
+
+    return DmlXdslGetPmHistory( ( pXDSLLine->ulInstanceNumber - 1 ), pXDSLLine->pstPmHistory );
+}
+
 /***********************************************************************
 
  APIs for Object:
 
-    DSL.Channel.{i}
+    DSL.Line.{i}.X_RDK_PMHistory.QuarterHour.{i}.
 
-    *  Channel_Synchronize
-    *  Channel_IsUpdated
-    *  Channel_GetEntryCount
-    *  Channel_GetEntry
-    *  Channel_GetParamBoolValue
-    *  Channel_GetParamUlongValue
-    *  Channel_GetParamStringValue
-    *  Channel_SetParamBoolValue
-    *  Channel_SetParamUlongValue
-    *  Channel_SetParamStringValue
-    *  Channel_Validate
-    *  Channel_Commit
-    *  Channel_Rollback
+    *  LinePMHistoryQuarterHour_IsUpdated
+    *  LinePMHistoryQuarterHour_Synchronize
+    *  LinePMHistoryQuarterHour_GetEntryCount
+    *  LinePMHistoryQuarterHour_GetEntry
+    *  LinePMHistoryQuarterHour_GetParamBoolValue
+    *  LinePMHistoryQuarterHour_GetParamUlongValue
 
 ***********************************************************************/
 /**********************************************************************
@@ -1884,7 +1468,7 @@ LineStatsQuarterHour_GetParamUlongValue
     prototype:
 
         BOOL
-        Channel_IsUpdated
+        LinePMHistoryQuarterHour_IsUpdated
             (
                 ANSC_HANDLE                 hInsContext
             );
@@ -1900,14 +1484,15 @@ LineStatsQuarterHour_GetParamUlongValue
 
 **********************************************************************/
 BOOL
-Channel_IsUpdated
+LinePMHistoryQuarterHour_IsUpdated
     (
         ANSC_HANDLE                 hInsContext
     )
 {
-    BOOL    bIsUpdated   = TRUE;
+    PDML_XDSL_LINE     pXDSLLine  = (PDML_XDSL_LINE)hInsContext;
 
-    return bIsUpdated;
+    //A quarter hour was stored since the snapshot
+    return DmlXdslIsPmHistoryStale( ( pXDSLLine->ulInstanceNumber - 1 ), XDSL_PM_INTERVAL_QUARTER_HOUR, pXDSLLine->pstPmHistory );
 }
 
 /**********************************************************************
@@ -1917,7 +1502,7 @@ Channel_IsUpdated
     prototype:
 
         ULONG
-        Channel_Synchronize
+        LinePMHistoryQuarterHour_Synchronize
             (
                 ANSC_HANDLE                 hInsContext
             );
@@ -1933,14 +1518,12 @@ Channel_IsUpdated
 
 **********************************************************************/
 ULONG
-Channel_Synchronize
+LinePMHistoryQuarterHour_Synchronize
     (
         ANSC_HANDLE                 hInsContext
     )
 {
-    ANSC_STATUS            returnStatus   = ANSC_STATUS_SUCCESS;
-
-    return returnStatus;
+    return LinePMHistory_Sync( (PDML_XDSL_LINE)hInsContext );
 }
 
 /**********************************************************************
@@ -1950,7 +1533,7 @@ Channel_Synchronize
     prototype:
 
         ULONG
-        Channel_GetEntryCount
+        LinePMHistoryQuarterHour_GetEntryCount
             (
                 ANSC_HANDLE                 hInsContext
             );
@@ -1966,14 +1549,14 @@ Channel_Synchronize
 
 **********************************************************************/
 ULONG
-Channel_GetEntryCount
+LinePMHistoryQuarterHour_GetEntryCount
     (
         ANSC_HANDLE                 hInsContext
     )
 {
-    PDATAMODEL_XDSL   pMyObject   = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_LINE     pXDSLLine  = (PDML_XDSL_LINE)hInsContext;
 
-    return pMyObject->ulTotalNoofDSLChannels;
+    return ( pXDSLLine->pstPmHistory ) ? pXDSLLine->pstPmHistory->ulTotalNoofQuarterHours : 0;
 }
 
 /**********************************************************************
@@ -1983,7 +1566,7 @@ Channel_GetEntryCount
     prototype:
 
         ANSC_HANDLE
-        Channel_GetEntry
+        LinePMHistoryQuarterHour_GetEntry
             (
                 ANSC_HANDLE                 hInsContext,
                 ULONG                       nIndex,
@@ -2007,29 +1590,20 @@ Channel_GetEntryCount
 
 **********************************************************************/
 ANSC_HANDLE
-Channel_GetEntry
+LinePMHistoryQuarterHour_GetEntry
     (
         ANSC_HANDLE                 hInsContext,
         ULONG                       nIndex,
         ULONG*                      pInsNumber
     )
-{   
-    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    
-    if ( ( pMyObject->pDSLChannel  ) && ( nIndex < pMyObject->ulTotalNoofDSLChannels ) )
-    {   
-        PDML_XDSL_CHANNEL      pDSLChannel = NULL;
-        
-        pDSLChannel = pMyObject->pDSLChannel + nIndex;
-        
-        pDSLChannel->ulInstanceNumber = nIndex + 1;
-        
-        *pInsNumber = pDSLChannel->ulInstanceNumber;
-        
-        //Sync with current information
-        DmlXdslGetChannelCfg( pDSLChannel->LineIndex, nIndex, pDSLChannel );
+{
+    PDML_XDSL_LINE     pXDSLLine  = (PDML_XDSL_LINE)hInsContext;
 
-        return pDSLChannel;
+    if ( ( pXDSLLine->pstPmHistory ) && ( nIndex < pXDSLLine->pstPmHistory->ulTotalNoofQuarterHours ) )
+    {
+        *pInsNumber = nIndex + 1;
+
+        return &pXDSLLine->pstPmHistory->stQuarterHour[nIndex];
     }
 
     return NULL; /* return the invlalid handle */
@@ -2042,7 +1616,7 @@ Channel_GetEntry
     prototype:
 
         BOOL
-        Channel_GetParamBoolValue
+        LinePMHistoryQuarterHour_GetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
@@ -2065,34 +1639,16 @@ Channel_GetEntry
     return:     TRUE if succeeded.
 
 **********************************************************************/
-
 BOOL
-Channel_GetParamBoolValue
+LinePMHistoryQuarterHour_GetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
         BOOL*                       pBool
     )
 {
-    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
-
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Enable", TRUE) )
-    {
-        *pBool = pDSLChannel->Enable;
-
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "INPREPORT", TRUE) )
-    {
-        *pBool = pDSLChannel->INPREPORT;
-
-        return TRUE;
-    }
-
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return DmlParamTableGetBool( &g_LinePMHistoryParamTable, (PDML_XDSL_PM_INTERVAL)hInsContext, ParamName, pBool );
 }
 
 /**********************************************************************
@@ -2102,16 +1658,16 @@ Channel_GetParamBoolValue
     prototype:
 
         BOOL
-        Channel_SetParamBoolValue
+        LinePMHistoryQuarterHour_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL                        bValue
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to set BOOL parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -2119,42 +1675,38 @@ Channel_GetParamBoolValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL                        bValue
-                The updated BOOL value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-Channel_SetParamBoolValue
+LinePMHistoryQuarterHour_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL                        bValue
+        ULONG*                      puLong
     )
 {
-    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
-
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "Enable", TRUE))
-    {
-        if( bValue == pDSLChannel->Enable )
-        {
-            return TRUE;    //No need to proceed when same value comes
-        }
+    /* check the parameter name and return the corresponding value */
+    return DmlParamTableGetUlong( &g_LinePMHistoryParamTable, (PDML_XDSL_PM_INTERVAL)hInsContext, ParamName, puLong );
+}
 
-        pDSLChannel->Enable = bValue;
+/***********************************************************************
 
-        //Process DSL channel enable set
-        DmlXdslChannelSetEnable( pDSLChannel->LineIndex, ( pDSLChannel->ulInstanceNumber - 1 ), pDSLChannel->Enable );
+ APIs for Object:
 
-        return TRUE;
-    }
+    DSL.Line.{i}.X_RDK_PMHistory.Day.{i}.
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
+    *  LinePMHistoryDay_IsUpdated
+    *  LinePMHistoryDay_Synchronize
+    *  LinePMHistoryDay_GetEntryCount
+    *  LinePMHistoryDay_GetEntry
+    *  LinePMHistoryDay_GetParamBoolValue
+    *  LinePMHistoryDay_GetParamUlongValue
 
+***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -2162,77 +1714,31 @@ Channel_SetParamBoolValue
     prototype:
 
         BOOL
-        Channel_GetParamIntValue
+        LinePMHistoryDay_IsUpdated
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                int*                        pInt
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
 
-        This function is called to retrieve integer parameter value;
+        This function is checking whether the table is updated or not.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
-
-                int*                        pInt
-                The buffer of returned integer value;
-
-    return:     TRUE if succeeded.
+    return:     TRUE or FALSE.
 
 **********************************************************************/
 BOOL
-Channel_GetParamIntValue
+LinePMHistoryDay_IsUpdated
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        int*                        pInt
+        ANSC_HANDLE                 hInsContext
     )
 {
-    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
-
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "INTLVBLOCK", TRUE))
-    {
-        /* collect value */
-        *pInt = pDSLChannel->INTLVBLOCK;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ACTINP", TRUE))
-    {
-        /* collect value */
-        *pInt = pDSLChannel->ACTINP;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "NFEC", TRUE))
-    {
-        /* collect value */
-        *pInt = pDSLChannel->NFEC;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "RFEC", TRUE))
-    {
-        /* collect value */
-        *pInt = pDSLChannel->RFEC;
-        return TRUE;
-    }
+    PDML_XDSL_LINE     pXDSLLine  = (PDML_XDSL_LINE)hInsContext;
 
-    if( AnscEqualString(ParamName, "LSYMB", TRUE))
-    {
-        /* collect value */
-        *pInt = pDSLChannel->LSYMB;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    //A day was stored since the snapshot
+    return DmlXdslIsPmHistoryStale( ( pXDSLLine->ulInstanceNumber - 1 ), XDSL_PM_INTERVAL_DAY, pXDSLLine->pstPmHistory );
 }
 
 /**********************************************************************
@@ -2241,97 +1747,62 @@ Channel_GetParamIntValue
 
     prototype:
 
-        BOOL
-        Channel_GetParamUlongValue
+        ULONG
+        LinePMHistoryDay_Synchronize
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG*                      puLong
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to synchronize the table.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
-
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
-
-    return:     TRUE if succeeded.
+    return:     The status of the operation.
 
 **********************************************************************/
-BOOL
-Channel_GetParamUlongValue
+ULONG
+LinePMHistoryDay_Synchronize
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG*                      puLong
+        ANSC_HANDLE                 hInsContext
     )
 {
-    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
+    return LinePMHistory_Sync( (PDML_XDSL_LINE)hInsContext );
+}
 
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Status", TRUE) )
-    {
-        *puLong = pDSLChannel->Status;
-        return TRUE;
-    }
+/**********************************************************************
 
-    if( AnscEqualString(ParamName, "LastChange", TRUE) )
-    {
-        *puLong = pDSLChannel->LastChange;
-        return TRUE;
-    }
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "LPATH", TRUE) )
-    {
-        *puLong = pDSLChannel->LPATH;
-        return TRUE;
-    }     
+    prototype:
 
-    if( AnscEqualString(ParamName, "INTLVDEPTH", TRUE) )
-    {
-        *puLong = pDSLChannel->INTLVDEPTH;
-        return TRUE;
-    }
+        ULONG
+        LinePMHistoryDay_GetEntryCount
+            (
+                ANSC_HANDLE                 hInsContext
+            );
 
-    if( AnscEqualString(ParamName, "ActualInterleavingDelay", TRUE) )
-    {
-        *puLong = pDSLChannel->ActualInterleavingDelay;
-        return TRUE;
-    }
+    description:
 
-    if( AnscEqualString(ParamName, "UpstreamCurrRate", TRUE) )
-    {
-        *puLong = pDSLChannel->UpstreamCurrRate;
-        return TRUE;
-    }
+        This function is called to retrieve the count of the table.
 
-    if( AnscEqualString(ParamName, "DownstreamCurrRate", TRUE) )
-    {
-        *puLong = pDSLChannel->DownstreamCurrRate;
-        return TRUE;
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "ACTNDR", TRUE) )
-    {
-        *puLong = pDSLChannel->ACTNDR;
-        return TRUE;
-    }
+    return:     The count of the table
 
-    if( AnscEqualString(ParamName, "ACTINPREIN", TRUE) )
-    {
-        *puLong = pDSLChannel->ACTINPREIN;
-        return TRUE;
-    }
+**********************************************************************/
+ULONG
+LinePMHistoryDay_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDML_XDSL_LINE     pXDSLLine  = (PDML_XDSL_LINE)hInsContext;
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return ( pXDSLLine->pstPmHistory ) ? pXDSLLine->pstPmHistory->ulTotalNoofDays : 0;
 }
 
 /**********************************************************************
@@ -2340,127 +1811,48 @@ Channel_GetParamUlongValue
 
     prototype:
 
-        ULONG
-        Channel_GetParamStringValue
+        ANSC_HANDLE
+        LinePMHistoryDay_GetEntry
             (
                 ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                char*                       pValue,
-                ULONG*                      pUlSize
+                ULONG                       nIndex,
+                ULONG*                      pInsNumber
             );
 
     description:
 
-        This function is called to retrieve string parameter value;
+        This function is called to retrieve the entry specified by the index.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
-
-                char*                       pValue,
-                The string value buffer;
+                ULONG                       nIndex,
+                The index of this entry;
 
-                ULONG*                      pUlSize
-                The buffer of length of string value;
-                Usually size of 1023 will be used.
-                If it's not big enough, put required size here and return 1;
+                ULONG*                      pInsNumber
+                The output instance number;
 
-    return:     0 if succeeded;
-                1 if short of buffer size; (*pUlSize = required size)
-                -1 if not supported.
+    return:     The handle to identify the entry
 
 **********************************************************************/
-ULONG
-Channel_GetParamStringValue
+ANSC_HANDLE
+LinePMHistoryDay_GetEntry
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        char*                       pValue,
-        ULONG*                      pUlSize
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
     )
 {
-    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
-
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Alias", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pDSLChannel->Alias ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pDSLChannel->Alias );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pDSLChannel->Alias );
-           return 1;
-       }
-    }
+    PDML_XDSL_LINE     pXDSLLine  = (PDML_XDSL_LINE)hInsContext;
 
-    if( AnscEqualString(ParamName, "LowerLayers", TRUE) )
+    if ( ( pXDSLLine->pstPmHistory ) && ( nIndex < pXDSLLine->pstPmHistory->ulTotalNoofDays ) )
     {
-       /* collect value */
-       if ( ( sizeof( pDSLChannel->LowerLayers ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pDSLChannel->LowerLayers );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pDSLChannel->LowerLayers );
-           return 1;
-       }
-    }
-     
-    if( AnscEqualString(ParamName, "Name", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pDSLChannel->Name ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pDSLChannel->Name );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pDSLChannel->Name );
-           return 1;
-       }
-    }
- 
-    if( AnscEqualString(ParamName, "LinkEncapsulationSupported", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pDSLChannel->LinkEncapsulationSupported ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pDSLChannel->LinkEncapsulationSupported );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pDSLChannel->LinkEncapsulationSupported );
-           return 1;
-       }
-    }
+        *pInsNumber = nIndex + 1;
 
-    if( AnscEqualString(ParamName, "LinkEncapsulationUsed", TRUE) )
-    {  
-       /* collect value */
-       if ( ( sizeof( pDSLChannel->LinkEncapsulationUsed ) - 1 ) < *pUlSize )
-       {   
-           AnscCopyString( pValue, pDSLChannel->LinkEncapsulationUsed );
-           return 0;
-       }
-       else
-       {   
-           *pUlSize = sizeof( pDSLChannel->LinkEncapsulationUsed );
-           return 1;
-       }
+        return &pXDSLLine->pstPmHistory->stDay[nIndex];
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return -1;
+    return NULL; /* return the invlalid handle */
 }
 
 /**********************************************************************
@@ -2470,16 +1862,16 @@ Channel_GetParamStringValue
     prototype:
 
         BOOL
-        Channel_SetParamStringValue
+        LinePMHistoryDay_GetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pString
+                BOOL*                       pBool
             );
 
     description:
 
-        This function is called to set string parameter value;
+        This function is called to retrieve Boolean parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -2487,32 +1879,22 @@ Channel_GetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pString
-                The updated string value;
+                BOOL*                       pBool
+                The buffer of returned boolean value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-Channel_SetParamStringValue
+LinePMHistoryDay_GetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pString
+        BOOL*                       pBool
     )
 {
-    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
-
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Alias", TRUE))
-    {
-        /* save update to backup */
-        AnscCopyString( pDSLChannel->Alias, pString );
-        return TRUE;
-    }
-    
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return DmlParamTableGetBool( &g_LinePMHistoryParamTable, (PDML_XDSL_PM_INTERVAL)hInsContext, ParamName, pBool );
 }
 
 /**********************************************************************
@@ -2522,15 +1904,16 @@ Channel_SetParamStringValue
     prototype:
 
         BOOL
-        Channel_Validate
-        (
-            ANSC_HANDLE                 hInsContext,
-            char*                       pReturnParamName,
-            ULONG*                      puLength
-        )
+        LinePMHistoryDay_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
     description:
 
-        This function is called to set ULONG parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -2538,221 +1921,207 @@ Channel_SetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG                       uValue
-                The updated ULONG value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
-
 BOOL
-Channel_Validate
+LinePMHistoryDay_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       pReturnParamName,
-        ULONG*                      puLength
+        char*                       ParamName,
+        ULONG*                      puLong
     )
 {
-    return TRUE;
+    /* check the parameter name and return the corresponding value */
+    return DmlParamTableGetUlong( &g_LinePMHistoryParamTable, (PDML_XDSL_PM_INTERVAL)hInsContext, ParamName, puLong );
 }
 
+/***********************************************************************
+
+ APIs for Object:
+
+    DSL.Channel.{i}
+
+    *  Channel_Synchronize
+    *  Channel_IsUpdated
+    *  Channel_GetEntryCount
+    *  Channel_GetEntry
+    *  Channel_GetParamBoolValue
+    *  Channel_GetParamUlongValue
+    *  Channel_GetParamStringValue
+    *  Channel_SetParamBoolValue
+    *  Channel_SetParamUlongValue
+    *  Channel_SetParamStringValue
+    *  Channel_Validate
+    *  Channel_Commit
+    *  Channel_Rollback
+
+***********************************************************************/
 /**********************************************************************
+
     caller:     owner of this object
 
     prototype:
-        ULONG
-        Channel_Commit
+
+        BOOL
+        Channel_IsUpdated
             (
                 ANSC_HANDLE                 hInsContext
             );
 
     description:
-        This function is called to finally commit all the update.
+
+        This function is checking whether the table is updated or not.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-    return:     The status of the operation.
+    return:     TRUE or FALSE.
+
 **********************************************************************/
-ULONG
-Channel_Commit
+BOOL
+Channel_IsUpdated
     (
         ANSC_HANDLE                 hInsContext
     )
 {
-    return 0;
+    PDATAMODEL_XDSL   pMyObject   = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+
+    return DmlXdslChannelIsSnapshotStale( pMyObject );
 }
 
 /**********************************************************************
+
     caller:     owner of this object
 
     prototype:
+
         ULONG
-        Channel_Rollback
+        Channel_Synchronize
             (
                 ANSC_HANDLE                 hInsContext
             );
 
     description:
-        This function is called to roll back the update whenever there's a
-        validation found.
+
+        This function is called to synchronize the table.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
     return:     The status of the operation.
+
 **********************************************************************/
 ULONG
-Channel_Rollback
+Channel_Synchronize
     (
         ANSC_HANDLE                 hInsContext
     )
 {
-    return 0;
-}
-
-/***********************************************************************
-
- APIs for Object:
+    PDATAMODEL_XDSL        pMyObject      = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    ANSC_STATUS            returnStatus   = ANSC_STATUS_SUCCESS;
 
-    DSL.Channel.{i}.Stats.
+    //Single refresher of the channel snapshot, the getters only read memory.
+    //On a HAL failure the previous snapshot keeps being served
+    DmlXdslChannelRefreshSnapshot( pMyObject );
 
-    *  ChannelStats_GetParamUlongValue
+    return returnStatus;
+}
 
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
 
     prototype:
 
-        BOOL
-        ChannelStats_GetParamUlongValue
+        ULONG
+        Channel_GetEntryCount
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG*                      puLong
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to retrieve the count of the table.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
-
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
-
-    return:     TRUE if succeeded.
+    return:     The count of the table
 
 **********************************************************************/
-BOOL
-ChannelStats_GetParamUlongValue
+ULONG
+Channel_GetEntryCount
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG*                      puLong
+        ANSC_HANDLE                 hInsContext
     )
 {
-    PDML_XDSL_CHANNEL          pDSLChannel       = (PDML_XDSL_CHANNEL)hInsContext;
-    PDML_XDSL_CHANNEL_STATS    pDSLChannelStats  = &(pDSLChannel->stChannelStats);
+    PDATAMODEL_XDSL   pMyObject   = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
 
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "BytesSent", TRUE) )
-    {
-        *puLong = pDSLChannelStats->BytesSent;
-        return TRUE;
-    }
+    return pMyObject->ulTotalNoofDSLChannels;
+}
 
-    if( AnscEqualString(ParamName, "BytesReceived", TRUE) )
-    {
-        *puLong = pDSLChannelStats->BytesSent;
-        return TRUE;
-    }
+/**********************************************************************
 
-    if( AnscEqualString(ParamName, "PacketsSent", TRUE) )
-    {
-        *puLong = pDSLChannelStats->PacketsSent;
-        return TRUE;
-    }
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "PacketsReceived", TRUE) )
-    {
-        *puLong = pDSLChannelStats->PacketsReceived;
-        return TRUE;
-    }
+    prototype:
 
-    if( AnscEqualString(ParamName, "ErrorsSent", TRUE) )
-    {
-        *puLong = pDSLChannelStats->ErrorsSent;
-        return TRUE;
-    }
+        ANSC_HANDLE
+        Channel_GetEntry
+            (
+                ANSC_HANDLE                 hInsContext,
+                ULONG                       nIndex,
+                ULONG*                      pInsNumber
+            );
 
-    if( AnscEqualString(ParamName, "ErrorsReceived", TRUE) )
-    {
-        *puLong = pDSLChannelStats->ErrorsReceived;
-        return TRUE;
-    }
+    description:
 
-    if( AnscEqualString(ParamName, "DiscardPacketsSent", TRUE) )
-    {
-        *puLong = pDSLChannelStats->DiscardPacketsSent;
-        return TRUE;
-    }
+        This function is called to retrieve the entry specified by the index.
 
-    if( AnscEqualString(ParamName, "DiscardPacketsReceived", TRUE) )
-    {
-        *puLong = pDSLChannelStats->DiscardPacketsReceived;
-        return TRUE;
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "TotalStart", TRUE) )
-    {
-        *puLong = pDSLChannelStats->TotalStart;
-        return TRUE;
-    }
+                ULONG                       nIndex,
+                The index of this entry;
 
-    if( AnscEqualString(ParamName, "ShowtimeStart", TRUE) )
-    {
-        *puLong = pDSLChannelStats->ShowtimeStart;
-        return TRUE;
-    }
+                ULONG*                      pInsNumber
+                The output instance number;
 
-    if( AnscEqualString(ParamName, "LastShowtimeStart", TRUE) )
-    {
-        *puLong = pDSLChannelStats->LastShowtimeStart;
-        return TRUE;
-    }
+    return:     The handle to identify the entry
 
-    if( AnscEqualString(ParamName, "QuarterHourStart", TRUE) )
-    {
-        *puLong = pDSLChannelStats->QuarterHourStart;
-        return TRUE;
-    }
+**********************************************************************/
+ANSC_HANDLE
+Channel_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    )
+{   
+    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    
+    if ( ( pMyObject->pDSLChannel  ) && ( nIndex < pMyObject->ulTotalNoofDSLChannels ) )
+    {   
+        PDML_XDSL_CHANNEL      pDSLChannel = NULL;
+        
+        pDSLChannel = pMyObject->pDSLChannel + nIndex;
+        
+        pDSLChannel->ulInstanceNumber = nIndex + 1;
+        
+        *pInsNumber = pDSLChannel->ulInstanceNumber;
+        
+        //Served from the channel snapshot, refreshed by Channel_Synchronize
 
-    if( AnscEqualString(ParamName, "CurrentDayStart", TRUE) )
-    {
-        *puLong = pDSLChannelStats->CurrentDayStart;
-        return TRUE;
+        return pDSLChannel;
     }
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return NULL; /* return the invlalid handle */
 }
 
-/***********************************************************************
-
- APIs for Object:
-
-    DSL.Channel.{i}.Stats.Total.
-
-    *  ChannelStatsTotal_GetParamUlongValue
-
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -2760,16 +2129,16 @@ ChannelStats_GetParamUlongValue
     prototype:
 
         BOOL
-        ChannelStatsTotal_GetParamUlongValue
+        Channel_GetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                BOOL*                       pBool
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to retrieve Boolean parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -2777,74 +2146,42 @@ ChannelStats_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                BOOL*                       pBool
+                The buffer of returned boolean value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
+
 BOOL
-ChannelStatsTotal_GetParamUlongValue
+Channel_GetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        BOOL*                       pBool
     )
 {
-    PDML_XDSL_CHANNEL               pDSLChannel            = (PDML_XDSL_CHANNEL)hInsContext;
-    PDML_XDSL_CHANNEL_STATS         pDSLChannelStats       = &(pDSLChannel->stChannelStats);
-    PDML_XDSL_CHANNEL_STATS_TIME    pDSLChannelStatsTotal  = &(pDSLChannelStats->stTotal);
-
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "XTURFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsTotal->XTURFECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsTotal->XTUCFECErrors;
-        return TRUE;
-    }
+    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
 
-    if( AnscEqualString(ParamName, "XTURHECErrors", TRUE) )
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Enable", TRUE) )
     {
-        *puLong = pDSLChannelStatsTotal->XTURHECErrors;
-        return TRUE;
-    }
+        *pBool = pDSLChannel->Enable;
 
-    if( AnscEqualString(ParamName, "XTUCHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsTotal->XTUCHECErrors;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "XTURCRCErrors", TRUE) )
+    if( AnscEqualString(ParamName, "INPREPORT", TRUE) )
     {
-        *puLong = pDSLChannelStatsTotal->XTURCRCErrors;
-        return TRUE;
-    }
+        *pBool = pDSLChannel->INPREPORT;
 
-    if( AnscEqualString(ParamName, "XTUCCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsTotal->XTUCCRCErrors;
         return TRUE;
     }
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-/***********************************************************************
-
- APIs for Object:
-
-    DSL.Channel.{i}.Stats.ShowTime.
-
-    *  ChannelStatsShowTime_GetParamUlongValue
-
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -2852,16 +2189,16 @@ ChannelStatsTotal_GetParamUlongValue
     prototype:
 
         BOOL
-        ChannelStatsShowTime_GetParamUlongValue
+        Channel_SetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                BOOL                        bValue
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to set BOOL parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -2869,58 +2206,35 @@ ChannelStatsTotal_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                BOOL                        bValue
+                The updated BOOL value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-ChannelStatsShowTime_GetParamUlongValue
+Channel_SetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        BOOL                        bValue
     )
 {
-    PDML_XDSL_CHANNEL              pDSLChannel               = (PDML_XDSL_CHANNEL)hInsContext;
-    PDML_XDSL_CHANNEL_STATS        pDSLChannelStats          = &(pDSLChannel->stChannelStats);
-    PDML_XDSL_CHANNEL_STATS_TIME   pDSLChannelStatsShowTime  = &(pDSLChannelStats->stShowTime);
+    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
 
     /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "XTURFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsShowTime->XTURFECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsShowTime->XTUCFECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTURHECErrors", TRUE) )
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-        *puLong = pDSLChannelStatsShowTime->XTURHECErrors;
-        return TRUE;
-    }
+        if( bValue == pDSLChannel->Enable )
+        {
+            return TRUE;    //No need to proceed when same value comes
+        }
 
-    if( AnscEqualString(ParamName, "XTUCHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsShowTime->XTUCHECErrors;
-        return TRUE;
-    }
+        pDSLChannel->Enable = bValue;
 
-    if( AnscEqualString(ParamName, "XTURCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsShowTime->XTURCRCErrors;
-        return TRUE;
-    }
+        //Process DSL channel enable set
+        DmlXdslChannelSetEnable( pDSLChannel->LineIndex, ( pDSLChannel->ulInstanceNumber - 1 ), pDSLChannel->Enable );
 
-    if( AnscEqualString(ParamName, "XTUCCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsShowTime->XTUCCRCErrors;
         return TRUE;
     }
 
@@ -2928,15 +2242,6 @@ ChannelStatsShowTime_GetParamUlongValue
     return FALSE;
 }
 
-/***********************************************************************
-
- APIs for Object:
-
-    DSL.Channel.{i}.Stats.LastShowTime.
-
-    *  ChannelStatsLastShowTime_GetParamUlongValue
-
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -2944,16 +2249,16 @@ ChannelStatsShowTime_GetParamUlongValue
     prototype:
 
         BOOL
-        ChannelStatsLastShowTime_GetParamUlongValue
+        Channel_GetParamIntValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                int*                        pInt
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to retrieve integer parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -2961,82 +2266,34 @@ ChannelStatsShowTime_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                int*                        pInt
+                The buffer of returned integer value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-ChannelStatsLastShowTime_GetParamUlongValue
+Channel_GetParamIntValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        int*                        pInt
     )
 {
-    PDML_XDSL_CHANNEL              pDSLChannel                   = (PDML_XDSL_CHANNEL)hInsContext;
-    PDML_XDSL_CHANNEL_STATS        pDSLChannelStats              = &(pDSLChannel->stChannelStats);
-    PDML_XDSL_CHANNEL_STATS_TIME   pDSLChannelStatsLastShowTime  = &(pDSLChannelStats->stLastShowTime);
+    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
 
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "XTURFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsLastShowTime->XTURFECErrors;
-        return TRUE;
-    }
+    /* check the parameter name and return the corresponding value */
+    return DmlParamTableGetInt( &g_ChannelIntParamTable, pDSLChannel, ParamName, pInt );
+}
 
-    if( AnscEqualString(ParamName, "XTUCFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsLastShowTime->XTUCFECErrors;
-        return TRUE;
-    }
+/**********************************************************************
 
-    if( AnscEqualString(ParamName, "XTURHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsLastShowTime->XTURHECErrors;
-        return TRUE;
-    }
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "XTUCHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsLastShowTime->XTUCHECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTURCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsLastShowTime->XTURCRCErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsLastShowTime->XTUCCRCErrors;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/***********************************************************************
-
- APIs for Object:
-
-    DSL.Channel.{i}.Stats.CurrentDay.
-
-    *  ChannelStatsCurrentDay_GetParamUlongValue
-
-***********************************************************************/
-/**********************************************************************
-
-    caller:     owner of this object
-
-    prototype:
+    prototype:
 
         BOOL
-        ChannelStatsCurrentDay_GetParamUlongValue
+        Channel_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
@@ -3060,97 +2317,72 @@ ChannelStatsLastShowTime_GetParamUlongValue
 
 **********************************************************************/
 BOOL
-ChannelStatsCurrentDay_GetParamUlongValue
+Channel_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
         ULONG*                      puLong
     )
 {
-    PDML_XDSL_CHANNEL                    pDSLChannel                   = (PDML_XDSL_CHANNEL)hInsContext;
-    PDML_XDSL_CHANNEL_STATS              pDSLChannelStats              = &(pDSLChannel->stChannelStats);
-    PDML_XDSL_CHANNEL_STATS_CURRENTDAY   pDSLChannelStatsCurrentDay    = &(pDSLChannelStats->stCurrentDay);
-
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "XTURFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->XTURFECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCFECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->XTUCFECErrors;
-        return TRUE;
-    }
+    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
 
-    if( AnscEqualString(ParamName, "XTURHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->XTURHECErrors;
-        return TRUE;
-    }
+    /* check the parameter name and return the corresponding value */
+    return DmlParamTableGetUlong( &g_ChannelUlongParamTable, pDSLChannel, ParamName, puLong );
+}
 
-    if( AnscEqualString(ParamName, "XTUCHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->XTUCHECErrors;
-        return TRUE;
-    }
+/**********************************************************************
 
-    if( AnscEqualString(ParamName, "XTURCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->XTURCRCErrors;
-        return TRUE;
-    }
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "XTUCCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->XTUCCRCErrors;
-        return TRUE;
-    }
+    prototype:
 
-    if( AnscEqualString(ParamName, "X_RDK_LinkRetrain", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->X_RDK_LinkRetrain;
-        return TRUE;
-    }
+        ULONG
+        Channel_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
 
-    if( AnscEqualString(ParamName, "X_RDK_InitErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->X_RDK_InitErrors;
-        return TRUE;
-    }
+    description:
 
-    if( AnscEqualString(ParamName, "X_RDK_InitTimeouts", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->X_RDK_InitTimeouts;
-        return TRUE;
-    }
+        This function is called to retrieve string parameter value;
 
-    if( AnscEqualString(ParamName, "X_RDK_SeverelyErroredSecs", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->X_RDK_SeverelyErroredSecs;
-        return TRUE;
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "X_RDK_ErroredSecs", TRUE) )
-    {
-        *puLong = pDSLChannelStatsCurrentDay->X_RDK_ErroredSecs;
-        return TRUE;
-    }
+                char*                       ParamName,
+                The parameter name;
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
+                char*                       pValue,
+                The string value buffer;
 
-/***********************************************************************
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
 
- APIs for Object:
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
 
-    DSL.Channel.{i}.Stats.QuarterHour.
+**********************************************************************/
+ULONG
+Channel_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
 
-    *  ChannelStatsQuarterHour_GetParamUlongValue
+    /* check the parameter name and return the corresponding value */
+    return DmlParamTableGetString( &g_ChannelStringParamTable, pDSLChannel, ParamName, pValue, pUlSize );
+}
 
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -3158,16 +2390,16 @@ ChannelStatsCurrentDay_GetParamUlongValue
     prototype:
 
         BOOL
-        ChannelStatsQuarterHour_GetParamUlongValue
+        Channel_SetParamStringValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                char*                       pString
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to set string parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3175,82 +2407,34 @@ ChannelStatsCurrentDay_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                char*                       pString
+                The updated string value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-ChannelStatsQuarterHour_GetParamUlongValue
-    (   
+Channel_SetParamStringValue
+    (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        char*                       pString
     )
 {
-    PDML_XDSL_CHANNEL                      pDSLChannel                    = (PDML_XDSL_CHANNEL)hInsContext;
-    PDML_XDSL_CHANNEL_STATS                pDSLChannelStats               = &(pDSLChannel->stChannelStats);
-    PDML_XDSL_CHANNEL_STATS_QUARTERHOUR    pDSLChannelStatsQuarterHour    = &(pDSLChannelStats->stQuarterHour);
-
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "XTURFECErrors", TRUE) )
-    {   
-        *puLong = pDSLChannelStatsQuarterHour->XTURFECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCFECErrors", TRUE) )
-    {   
-        *puLong = pDSLChannelStatsQuarterHour->XTUCFECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTURHECErrors", TRUE) )
-    {   
-        *puLong = pDSLChannelStatsQuarterHour->XTURHECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCHECErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsQuarterHour->XTUCHECErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTURCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsQuarterHour->XTURCRCErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "XTUCCRCErrors", TRUE) )
-    {
-        *puLong = pDSLChannelStatsQuarterHour->XTUCCRCErrors;
-        return TRUE;
-    }
+    PDML_XDSL_CHANNEL      pDSLChannel = (PDML_XDSL_CHANNEL)hInsContext;
 
-    if( AnscEqualString(ParamName, "X_RDK_LinkRetrain", TRUE) )
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Alias", TRUE))
     {
-        *puLong = pDSLChannelStatsQuarterHour->X_RDK_LinkRetrain;
+        /* save update to backup */
+        AnscCopyString( pDSLChannel->Alias, pString );
         return TRUE;
     }
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-/***********************************************************************
-
- APIs for Object:
-
-    Device.DSL.Diagnostics.ADSLLineTest.
-
-    *  ADSLLineTest_GetParamUlongValue
-    *  ADSLLineTest_GetParamStringValue
-    *  ADSLLineTest_SetParamStringValue
-    *  ADSLLineTest_GetParamIntValue
-
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -3258,16 +2442,15 @@ ChannelStatsQuarterHour_GetParamUlongValue
     prototype:
 
         BOOL
-        ADSLLineTest_GetParamUlongValue
-            (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG*                      puLong
-            );
-
+        Channel_Validate
+        (
+            ANSC_HANDLE                 hInsContext,
+            char*                       pReturnParamName,
+            ULONG*                      puLength
+        )
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to set ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3275,119 +2458,88 @@ ChannelStatsQuarterHour_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                ULONG                       uValue
+                The updated ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
+
 BOOL
-ADSLLineTest_GetParamUlongValue
+Channel_Validate
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG*                      puLong
+        char*                       pReturnParamName,
+        ULONG*                      puLength
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
-
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
-    {
-        *puLong = pstADSLLineTest->DiagnosticsState;
-        return TRUE;
-    }
+    return TRUE;
+}
 
-    if( AnscEqualString(ParamName, "HLINGds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->HLINGds;
-        return TRUE;
-    }
+/**********************************************************************
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "HLINGus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->HLINGus;
-        return TRUE;
-    }
+    prototype:
+        ULONG
+        Channel_Commit
+            (
+                ANSC_HANDLE                 hInsContext
+            );
 
-    if( AnscEqualString(ParamName, "HLOGGds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->HLOGGds;
-        return TRUE;
-    }
+    description:
+        This function is called to finally commit all the update.
 
-    if( AnscEqualString(ParamName, "HLOGGus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->HLOGGus;
-        return TRUE;
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "HLOGMTds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->HLOGMTds;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "HLOGMTus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->HLOGMTus;
-        return TRUE;
-    }
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+Channel_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    return 0;
+}
 
-    if( AnscEqualString(ParamName, "QLNGds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->QLNGds;
-        return TRUE;
-    }
+/**********************************************************************
+    caller:     owner of this object
 
-    if( AnscEqualString(ParamName, "QLNGus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->QLNGus;
-        return TRUE;
-    }
+    prototype:
+        ULONG
+        Channel_Rollback
+            (
+                ANSC_HANDLE                 hInsContext
+            );
 
-    if( AnscEqualString(ParamName, "QLNMTds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->QLNMTds;
-        return TRUE;
-    }
+    description:
+        This function is called to roll back the update whenever there's a
+        validation found.
 
-    if( AnscEqualString(ParamName, "QLNMTus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->QLNMTus;
-        return TRUE;
-    }
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-    if( AnscEqualString(ParamName, "SNRGds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->SNRGds;
-        return TRUE;
-    }
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+Channel_Rollback
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    return 0;
+}
 
-    if( AnscEqualString(ParamName, "SNRGus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->SNRGus;
-        return TRUE;
-    }
+/***********************************************************************
 
-    if( AnscEqualString(ParamName, "SNRMTds", TRUE) )
-    {
-        *puLong = pstADSLLineTest->SNRMTds;
-        return TRUE;
-    }
+ APIs for Object:
 
-    if( AnscEqualString(ParamName, "SNRMTus", TRUE) )
-    {
-        *puLong = pstADSLLineTest->SNRMTus;
-        return TRUE;
-    }
+    DSL.Channel.{i}.Stats.
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
+    *  ChannelStats_GetParamUlongValue
 
+***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -3395,16 +2547,16 @@ ADSLLineTest_GetParamUlongValue
     prototype:
 
         BOOL
-        ADSLLineTest_SetParamUlongValue
+        ChannelStats_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG                       uValue
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to set ULONG parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3412,36 +2564,36 @@ ADSLLineTest_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG                       uValue
-                The updated ULONG value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-ADSLLineTest_SetParamUlongValue
+ChannelStats_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG                       uValue
+        ULONG*                      puLong
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+    PDML_XDSL_CHANNEL          pDSLChannel       = (PDML_XDSL_CHANNEL)hInsContext;
+    PDML_XDSL_CHANNEL_STATS    pDSLChannelStats  = &(pDSLChannel->stChannelStats);
 
     /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
-    {
-        pstADSLLineTest->DiagnosticsState = uValue;
+    return DmlParamTableGetUlong( &g_ChannelStatsParamTable, pDSLChannelStats, ParamName, puLong );
+}
 
-        return TRUE;
-    }
+/***********************************************************************
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
+ APIs for Object:
+
+    DSL.Channel.{i}.Stats.Total.
+
+    *  ChannelStatsTotal_GetParamUlongValue
 
+***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -3449,16 +2601,16 @@ ADSLLineTest_SetParamUlongValue
     prototype:
 
         BOOL
-        ADSLLineTest_SetParamStringValue
+        ChannelStatsTotal_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pString
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to set string parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3466,54 +2618,54 @@ ADSLLineTest_SetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pString
-                The updated string value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-ADSLLineTest_SetParamStringValue
+ChannelStatsTotal_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pString
+        ULONG*                      puLong
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
-
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Interface", TRUE))
-    {
-        /* save update to backup */
-        AnscCopyString( pstADSLLineTest->Interface, pString );
-        return TRUE;
-    }
+    PDML_XDSL_CHANNEL               pDSLChannel            = (PDML_XDSL_CHANNEL)hInsContext;
+    PDML_XDSL_CHANNEL_STATS         pDSLChannelStats       = &(pDSLChannel->stChannelStats);
+    PDML_XDSL_CHANNEL_STATS_TIME    pDSLChannelStatsTotal  = &(pDSLChannelStats->stTotal);
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    /* check the parameter name and set the corresponding value */
+    return DmlParamTableGetUlong( &g_ChannelStatsTimeParamTable, pDSLChannelStatsTotal, ParamName, puLong );
 }
 
+/***********************************************************************
+
+ APIs for Object:
+
+    DSL.Channel.{i}.Stats.ShowTime.
+
+    *  ChannelStatsShowTime_GetParamUlongValue
+
+***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
 
     prototype:
 
-        ULONG
-        ADSLLineTest_GetParamStringValue
+        BOOL
+        ChannelStatsShowTime_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pValue,
-                ULONG*                      pUlSize
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to retrieve string parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3521,259 +2673,3894 @@ ADSLLineTest_SetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pValue,
-                The string value buffer;
-
-                ULONG*                      pUlSize
-                The buffer of length of string value;
-                Usually size of 1023 will be used.
-                If it's not big enough, put required size here and return 1;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
-    return:     0 if succeeded;
-                1 if short of buffer size; (*pUlSize = required size)
-                -1 if not supported.
+    return:     TRUE if succeeded.
 
 **********************************************************************/
-ULONG
-ADSLLineTest_GetParamStringValue
+BOOL
+ChannelStatsShowTime_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pValue,
-        ULONG*                      pUlSize
+        ULONG*                      puLong
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+    PDML_XDSL_CHANNEL              pDSLChannel               = (PDML_XDSL_CHANNEL)hInsContext;
+    PDML_XDSL_CHANNEL_STATS        pDSLChannelStats          = &(pDSLChannel->stChannelStats);
+    PDML_XDSL_CHANNEL_STATS_TIME   pDSLChannelStatsShowTime  = &(pDSLChannelStats->stShowTime);
 
-    if( AnscEqualString(ParamName, "Interface", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->Interface ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->Interface );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->Interface );
-           return 1;
-       }
-    }
+    /* check the parameter name and set the corresponding value */
+    return DmlParamTableGetUlong( &g_ChannelStatsTimeParamTable, pDSLChannelStatsShowTime, ParamName, puLong );
+}
 
-    if( AnscEqualString(ParamName, "HLOGpsds", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->HLOGpsds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->HLOGpsds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->HLOGpsds );
-           return 1;
-       }
-    }
+/***********************************************************************
 
-    if( AnscEqualString(ParamName, "HLOGpsus", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->HLOGpsus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->HLOGpsus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->HLOGpsus );
-           return 1;
-       }
-    }
+ APIs for Object:
 
-    if( AnscEqualString(ParamName, "LATNpbds", TRUE) )
-    {
-       /* collect value */ 
-       if ( ( sizeof( pstADSLLineTest->LATNpbds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->LATNpbds );
-           return 0;
-       }
-       else
+    DSL.Channel.{i}.Stats.LastShowTime.
+
+    *  ChannelStatsLastShowTime_GetParamUlongValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ChannelStatsLastShowTime_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ChannelStatsLastShowTime_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDML_XDSL_CHANNEL              pDSLChannel                   = (PDML_XDSL_CHANNEL)hInsContext;
+    PDML_XDSL_CHANNEL_STATS        pDSLChannelStats              = &(pDSLChannel->stChannelStats);
+    PDML_XDSL_CHANNEL_STATS_TIME   pDSLChannelStatsLastShowTime  = &(pDSLChannelStats->stLastShowTime);
+
+    /* check the parameter name and set the corresponding value */
+    return DmlParamTableGetUlong( &g_ChannelStatsTimeParamTable, pDSLChannelStatsLastShowTime, ParamName, puLong );
+}
+
+/***********************************************************************
+
+ APIs for Object:
+
+    DSL.Channel.{i}.Stats.CurrentDay.
+
+    *  ChannelStatsCurrentDay_GetParamUlongValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ChannelStatsCurrentDay_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ChannelStatsCurrentDay_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDML_XDSL_CHANNEL                    pDSLChannel                   = (PDML_XDSL_CHANNEL)hInsContext;
+    PDML_XDSL_CHANNEL_STATS              pDSLChannelStats              = &(pDSLChannel->stChannelStats);
+    PDML_XDSL_CHANNEL_STATS_CURRENTDAY   pDSLChannelStatsCurrentDay    = &(pDSLChannelStats->stCurrentDay);
+
+    /* check the parameter name and set the corresponding value */
+    return DmlParamTableGetUlong( &g_ChannelStatsCurrentDayParamTable, pDSLChannelStatsCurrentDay, ParamName, puLong );
+}
+
+/***********************************************************************
+
+ APIs for Object:
+
+    DSL.Channel.{i}.Stats.QuarterHour.
+
+    *  ChannelStatsQuarterHour_GetParamUlongValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ChannelStatsQuarterHour_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ChannelStatsQuarterHour_GetParamUlongValue
+    (   
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDML_XDSL_CHANNEL                      pDSLChannel                    = (PDML_XDSL_CHANNEL)hInsContext;
+    PDML_XDSL_CHANNEL_STATS                pDSLChannelStats               = &(pDSLChannel->stChannelStats);
+    PDML_XDSL_CHANNEL_STATS_QUARTERHOUR    pDSLChannelStatsQuarterHour    = &(pDSLChannelStats->stQuarterHour);
+
+    /* check the parameter name and set the corresponding value */
+    return DmlParamTableGetUlong( &g_ChannelStatsQuarterHourParamTable, pDSLChannelStatsQuarterHour, ParamName, puLong );
+}
+
+/***********************************************************************
+
+ APIs for Object:
+
+    Device.DSL.Diagnostics.ADSLLineTest.
+
+    *  ADSLLineTest_GetParamUlongValue
+    *  ADSLLineTest_GetParamStringValue
+    *  ADSLLineTest_SetParamStringValue
+    *  ADSLLineTest_GetParamIntValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ADSLLineTest_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ADSLLineTest_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+
+    /* check the parameter name and set the corresponding value */
+    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    {
+        *puLong = pstADSLLineTest->DiagnosticsState;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLINGds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->HLINGds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLINGus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->HLINGus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLOGGds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->HLOGGds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLOGGus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->HLOGGus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLOGMTds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->HLOGMTds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLOGMTus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->HLOGMTus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "QLNGds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->QLNGds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "QLNGus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->QLNGus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "QLNMTds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->QLNMTds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "QLNMTus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->QLNMTus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "SNRGds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->SNRGds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "SNRGus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->SNRGus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "SNRMTds", TRUE) )
+    {
+        *puLong = pstADSLLineTest->SNRMTds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "SNRMTus", TRUE) )
+    {
+        *puLong = pstADSLLineTest->SNRMTus;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ADSLLineTest_SetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
+            );
+
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ADSLLineTest_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    {
+        pstADSLLineTest->DiagnosticsState = uValue;
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ADSLLineTest_SetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pString
+            );
+
+    description:
+
+        This function is called to set string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pString
+                The updated string value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ADSLLineTest_SetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pString
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Interface", TRUE))
+    {
+        /* save update to backup */
+        AnscCopyString( pstADSLLineTest->Interface, pString );
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        ADSLLineTest_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+ADSLLineTest_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+
+    if( AnscEqualString(ParamName, "Interface", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->Interface ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->Interface );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->Interface );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "HLOGpsds", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->HLOGpsds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->HLOGpsds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->HLOGpsds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "HLOGpsus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->HLOGpsus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->HLOGpsus );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->HLOGpsus );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "LATNpbds", TRUE) )
+    {
+       /* collect value */ 
+       if ( ( sizeof( pstADSLLineTest->LATNpbds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->LATNpbds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->LATNpbds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "LATNpbus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->LATNpbus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->LATNpbus );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->LATNpbus );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "SATNds", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->SATNds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->SATNds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->SATNds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "SATNus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->SATNus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->SATNus );
+           return 0;     
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->SATNus );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "HLINpsds", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->HLINpsds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->HLINpsds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->HLINpsds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "HLINpsus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->HLINpsus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->HLINpsus );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->HLINpsus );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "QLNpsds", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->QLNpsds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->QLNpsds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->QLNpsds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "QLNpsus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->QLNpsus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->QLNpsus );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->QLNpsus );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "SNRpsds", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->SNRpsds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->SNRpsds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->SNRpsds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "SNRpsus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->SNRpsus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->SNRpsus );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->SNRpsus );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "BITSpsds", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->BITSpsds ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->BITSpsds );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->BITSpsds );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "BITSpsus", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstADSLLineTest->BITSpsus ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstADSLLineTest->BITSpsus );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstADSLLineTest->BITSpsus );
+           return 1;
+       }
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        ADSLLineTest_GetParamIntValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                int*                        pInt
+            );
+
+    description:
+
+        This function is called to retrieve integer parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                int*                        pInt
+                The buffer of returned integer value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+ADSLLineTest_GetParamIntValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        int*                        pInt
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+
+    if( AnscEqualString(ParamName, "ACTPSDds", TRUE))
+    {
+        /* collect value */
+        *pInt = pstADSLLineTest->ACTPSDds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "ACTPSDus", TRUE))
+    {
+        /* collect value */
+        *pInt = pstADSLLineTest->ACTPSDus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "ACTATPds", TRUE))
+    {
+        /* collect value */
+        *pInt = pstADSLLineTest->ACTATPds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "ACTATPus", TRUE))
+    {
+        /* collect value */
+        *pInt = pstADSLLineTest->ACTATPus;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLINSCds", TRUE))
+    {
+        /* collect value */
+        *pInt = pstADSLLineTest->HLINSCds;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "HLINSCus", TRUE))
+    {
+        /* collect value */
+        *pInt = pstADSLLineTest->HLINSCus;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/***********************************************************************
+
+ APIs for Object:
+
+    Device.DSL.Diagnostics.SELTUER.
+
+    *  SELTUER_GetParamUlongValue
+    *  SELTUER_GetParamStringValue
+    *  SELTUER_SetParamStringValue
+    *  SELTUER_GetParamBoolValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTUER_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTUER_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+
+    /* check the parameter name and set the corresponding value */
+    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    {
+        *puLong = pstSELTUERTest->DiagnosticsState;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "UERMaxMeasurementDuration", TRUE) )
+    {
+        *puLong = pstSELTUERTest->UERMaxMeasurementDuration;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "UERScaleFactor", TRUE) )
+    {
+        *puLong = pstSELTUERTest->UERScaleFactor;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "UERGroupSize", TRUE) )
+    {
+        *puLong = pstSELTUERTest->UERGroupSize;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTUER_SetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
+            );
+
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTUER_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    {
+        pstSELTUERTest->DiagnosticsState = uValue;
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        SELTUER_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+SELTUER_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+
+    if( AnscEqualString(ParamName, "Interface", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTUERTest->Interface ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTUERTest->Interface );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTUERTest->Interface );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "UER", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTUERTest->UER ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTUERTest->UER );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTUERTest->UER );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "UERVar", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTUERTest->UERVar ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTUERTest->UERVar );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTUERTest->UERVar );
+           return 1;
+       }
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTUER_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTUER_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+
+    if( AnscEqualString(ParamName, "ExtendedBandwidthOperation", TRUE) )
+    {
+        *pBool = pstSELTUERTest->ExtendedBandwidthOperation;
+
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTUER_SetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pString
+            );
+
+    description:
+
+        This function is called to set string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pString
+                The updated string value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTUER_SetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pString
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Interface", TRUE))
+    {
+        /* save update to backup */
+        AnscCopyString( pstSELTUERTest->Interface, pString );
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/***********************************************************************
+
+ APIs for Object:
+
+    Device.DSL.Diagnostics.SELTQLN.
+
+    *  SELTQLN_GetParamUlongValue
+    *  SELTQLN_SetParamUlongValue
+    *  SELTQLN_GetParamStringValue
+    *  SELTQLN_SetParamStringValue
+    *  SELTQLN_GetParamIntValue
+    *  SELTQLN_GetParamBoolValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTQLN_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTQLN_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{   
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+    
+    /* check the parameter name and set the corresponding value */
+    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    {
+        *puLong = pstSELTQLNTest->DiagnosticsState;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "QLNMaxMeasurementDuration", TRUE) )
+    {   
+        *puLong = pstSELTQLNTest->QLNMaxMeasurementDuration;
+        return TRUE;
+    }
+    
+    if( AnscEqualString(ParamName, "QLNGroupSize", TRUE) )
+    {   
+        *puLong = pstSELTQLNTest->QLNGroupSize;
+        return TRUE;
+    }
+    
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTQLN_SetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
+            );
+
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTQLN_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    {
+        pstSELTQLNTest->DiagnosticsState = uValue;
+
+        return TRUE;
+    }
+
+    if(AnscEqualString(ParamName, "QLNMaxMeasurementDuration", TRUE))
+    {
+        pstSELTQLNTest->QLNMaxMeasurementDuration = uValue;
+
+        return TRUE;
+    }
+   
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTQLN_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTQLN_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+
+    if( AnscEqualString(ParamName, "ExtendedBandwidthOperation", TRUE) )
+    {
+        *pBool = pstSELTQLNTest->ExtendedBandwidthOperation;
+
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        SELTQLN_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+SELTQLN_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+
+    if( AnscEqualString(ParamName, "Interface", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTQLNTest->Interface ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTQLNTest->Interface );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTQLNTest->Interface );
+           return 1;
+       }
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTQLN_SetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pString
+            );
+
+    description:
+
+        This function is called to set string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pString
+                The updated string value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTQLN_SetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pString
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Interface", TRUE))
+    {
+        /* save update to backup */
+        AnscCopyString( pstSELTQLNTest->Interface, pString );
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/***********************************************************************
+
+ APIs for Object:
+
+    Device.DSL.Diagnostics.SELTP.
+
+    *  SELTP_GetParamUlongValue
+    *  SELTP_SetParamUlongValue
+    *  SELTP_GetParamStringValue
+    *  SELTP_SetParamStringValue
+    *  SELTP_GetParamBoolValue
+    *  SELTP_SetParamBoolValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        SELTP_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+SELTP_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{   
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+
+    if( AnscEqualString(ParamName, "Interface", TRUE) )
+    {  
+       /* collect value */
+       if ( ( sizeof( pstSELTPTest->Interface ) - 1 ) < *pUlSize )
+       {   
+           AnscCopyString( pValue, pstSELTPTest->Interface );
+           return 0;
+       }
+       else
+       {   
+           *pUlSize = sizeof( pstSELTPTest->Interface );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "CapacitySignalPSD", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTPTest->CapacitySignalPSD ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTPTest->CapacitySignalPSD );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTPTest->CapacitySignalPSD );
+           return 1;
+       }
+    }
+   
+    if( AnscEqualString(ParamName, "CapacityNoisePSD", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTPTest->CapacityNoisePSD ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTPTest->CapacityNoisePSD );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTPTest->CapacityNoisePSD );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "LoopTermination", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTPTest->LoopTermination ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTPTest->LoopTermination );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTPTest->LoopTermination );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "LoopTopology", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTPTest->LoopTopology ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTPTest->LoopTopology );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTPTest->LoopTopology );
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "AttenuationCharacteristics", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pstSELTPTest->AttenuationCharacteristics ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pstSELTPTest->AttenuationCharacteristics );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pstSELTPTest->AttenuationCharacteristics );
+           return 1;
+       }
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTP_SetParamStringValue
+            (   
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pString
+            );
+
+    description:
+
+        This function is called to set string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pString
+                The updated string value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTP_SetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pString
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Interface", TRUE))
+    {
+        /* save update to backup */
+        AnscCopyString( pstSELTPTest->Interface, pString );
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CapacitySignalPSD", TRUE))
+    {
+        /* save update to backup */
+        AnscCopyString( pstSELTPTest->CapacitySignalPSD, pString );
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CapacityNoisePSD", TRUE))
+    {
+        /* save update to backup */
+        AnscCopyString( pstSELTPTest->CapacityNoisePSD, pString );
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTP_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTP_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{   
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+
+    if( AnscEqualString(ParamName, "CapacityEstimateEnabling", TRUE) )
+    {
+        *pBool = pstSELTPTest->CapacityEstimateEnabling;
+    
+        return TRUE;
+    }
+   
+    if( AnscEqualString(ParamName, "MissingFilter", TRUE) )
+    {
+        *pBool = pstSELTPTest->MissingFilter;
+    
+        return TRUE;
+    }
+
+    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTP_SetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL                        bValue
+            );
+
+    description:
+
+        This function is called to set BOOL parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL                        bValue
+                The updated BOOL value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTP_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+
+    /* check the parameter name and set the corresponding value */
+    if( AnscEqualString(ParamName, "CapacityEstimateEnabling", TRUE))
+    {
+        pstSELTPTest->CapacityEstimateEnabling  = bValue;
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTP_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTP_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+
+    /* check the parameter name and set the corresponding value */
+    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    {
+        *puLong = pstSELTPTest->DiagnosticsState;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CapacityTargetMargin", TRUE) )
+    {
+        *puLong = pstSELTPTest->CapacityTargetMargin;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "LoopLength", TRUE) )
+    {
+        *puLong = pstSELTPTest->LoopLength;
+        return TRUE;
+    }
+    
+    if( AnscEqualString(ParamName, "CapacityEstimate", TRUE) )
+    {   
+        *puLong = pstSELTPTest->CapacityEstimate;
+        return TRUE;
+    }
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        SELTP_SetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
+            );
+
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+SELTP_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
+    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+  
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    {
+        pstSELTPTest->DiagnosticsState = uValue;
+
+        return TRUE;
+    }
+
+    if(AnscEqualString(ParamName, "CapacityTargetMargin", TRUE))
+    {
+        pstSELTPTest->CapacityTargetMargin = uValue;
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+
+/***********************************************************************
+
+ APIs for Object:
+
+    Device.DSL.X_RDK_Report.DSL
+
+    *  X_RDK_Report_DSL_GetParamUlongValue
+    *  X_RDK_Report_DSL_SetParamUlongValue
+    *  X_RDK_Report_DSL_GetParamStringValue
+    *  X_RDK_Report_DSL_GetParamBoolValue
+    *  X_RDK_Report_DSL_SetParamBoolValue
+
+***********************************************************************/
+
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Report_DSL_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Report_DSL_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE) && (puLong != NULL))
+    {
+        *puLong = pXdslReport->ReportingPeriod;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Report_DSL_SetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
+            );
+
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Report_DSL_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    )
+{
+
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE))
+    {
+        pXdslReport->bReportingPeriodChanged = TRUE;
+        pXdslReport->ReportingPeriod = uValue;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**********************************************************************  
+
+    caller:     owner of this object 
+
+    prototype: 
+
+        ULONG
+        X_RDK_Report_DSL_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value; 
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+X_RDK_Report_DSL_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL 			 pXdslReport 	  = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "Schema", TRUE))
+    {
+        /* collect value */
+        int bufsize = XdslReportGetSchemaBufferSize();
+        if(!bufsize)
+        {
+            char result[1024] = "Schema Buffer is empty";
+            AnscCopyString(pValue, (char*)&result);
+            return FALSE;
+        }
+        else
+        {
+            if (bufsize < *pUlSize)
+            {
+                AnscCopyString(pValue, XdslReportGetSchemaBuffer());
+                return FALSE;
+            }
+            else
+            {
+                *pUlSize = bufsize + 1;
+                return TRUE;
+            }
+        }
+    }
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "SchemaID", TRUE))
+    {
+        /* collect value */
+        int bufsize = XdslReportGetSchemaIDBufferSize();
+        if(!bufsize)
+        {
+            char result[1024] = "Schema Buffer is empty";
+            AnscCopyString(pValue, (char*)&result);
+            return FALSE;
+        }
+        else
+        {
+            if (bufsize < *pUlSize)
+            {
+                AnscCopyString(pValue, XdslReportGetSchemaIDBuffer());
+                return FALSE;
+            }
+            else
+            {
+                *pUlSize = bufsize + 1;
+                return TRUE;
+            }
+        }
+    }
+    return FALSE;
+}
+
+/**********************************************************************  
+
+    caller:     owner of this object 
+
+    prototype: 
+
+        BOOL
+        X_RDK_Report_DSL_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value; 
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Report_DSL_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{
+
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    if(AnscEqualString(ParamName, "Enabled", TRUE) && (pBool != NULL))
+    {
+        *pBool = pXdslReport->Enabled;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/**********************************************************************  
+
+    caller:     owner of this object 
+
+    prototype: 
+
+        BOOL
+        X_RDK_Report_DSL_SetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL                        bValue
+            );
+
+    description:
+
+        This function is called to set BOOL parameter value; 
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL                        bValue
+                The updated BOOL value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Report_DSL_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    )
+{
+
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL 			 pXdslReport 	  = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    if(AnscEqualString(ParamName, "Enabled", TRUE))
+    {
+        pXdslReport->Enabled = bValue;
+        pXdslReport->bEnableChanged = TRUE;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Report_DSL_Validate
+        (
+            ANSC_HANDLE                 hInsContext,
+            char*                       pReturnParamName,
+            ULONG*                      puLength
+        )
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+
+BOOL
+X_RDK_Report_DSL_Validate
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       pReturnParamName,
+        ULONG*                      puLength
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    if (pXdslReport->bReportingPeriodChanged)
+    {
+            BOOL validated = XdslReportValidateReportingPeriod(pXdslReport->ReportingPeriod);    
+            if(!validated)
+            {
+                AnscCopyString(pReturnParamName, "ReportingPeriod");
+                *puLength = AnscSizeOfString("ReportingPeriod");
+                return FALSE;
+            }
+    }
+    return TRUE;
+}
+
+
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+        ULONG
+        X_RDK_Report_DSL_Commit
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+        This function is called to finally commit all the update.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+X_RDK_Report_DSL_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    ULONG psmValue = 0;
+    
+    if (pXdslReport->bEnableChanged)
+    {
+        XdslReportSetStatus(pXdslReport->Enabled);
+        pXdslReport->bEnableChanged = false;
+        psmValue = pXdslReport->Enabled;
+        SetNVRamULONGConfiguration (XdslReportStatusEnable, psmValue); 
+    }
+    
+    if (pXdslReport->bReportingPeriodChanged)
+    {
+        XdslReportSetReportingPeriod(pXdslReport->ReportingPeriod);
+        pXdslReport->bReportingPeriodChanged = false;
+        psmValue = pXdslReport->ReportingPeriod;
+        SetNVRamULONGConfiguration (XdslReportStatusReportingPeriod, psmValue); 
+    }
+    return 0;
+}
+
+
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+        ULONG
+        X_RDK_Report_DSL_Rollback
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+        This function is called to finally commit all the update.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The status of the operation.
+**********************************************************************/
+
+ULONG
+X_RDK_Report_DSL_Rollback
+(
+    ANSC_HANDLE                 hInsContext
+)
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+
+    if (pXdslReport->bEnableChanged)
+    {
+        pXdslReport->Enabled = XdslReportGetStatus();
+        pXdslReport->bEnableChanged = false;
+    }
+    
+    if (pXdslReport->bReportingPeriodChanged)
+    {
+        pXdslReport->ReportingPeriod = XdslReportGetReportingPeriod();
+        pXdslReport->bReportingPeriodChanged = false;
+    }
+
+    return 0;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Report_DSL_Default_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Report_DSL_Default_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    PDML_X_RDK_REPORT_DSL_DEFAULT    pXdslReportDflt  = (PDML_X_RDK_REPORT_DSL_DEFAULT)pXdslReport->pDSLDefaultReport;
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "OverrideTTL", TRUE) && (puLong != NULL))
+    {
+        pXdslReportDflt->OverrideTTL = XdslReportGetDefaultOverrideTTL();
+        *puLong = pXdslReportDflt->OverrideTTL;
+        return TRUE;
+    }
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE) && (puLong != NULL))
+    {
+        *puLong = pXdslReportDflt->ReportingPeriod;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+    X_RDK_Report_DSL_Default_SetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
+            );
+
+    description:
+
+        This function is called to set ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Report_DSL_Default_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    )
+{
+
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    PDML_X_RDK_REPORT_DSL_DEFAULT    pXdslReportDflt  = (PDML_X_RDK_REPORT_DSL_DEFAULT)pXdslReport->pDSLDefaultReport;
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "OverrideTTL", TRUE))
+    {
+        pXdslReportDflt->OverrideTTL = uValue;
+        XdslReportSetDefaultOverrideTTL (uValue);
+        return TRUE;
+    }
+
+    /* check the parameter name and set the corresponding value */
+    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE)) 
+    {
+        if (!XdslReportValidateReportingPeriod(uValue))
+        {
+            return FALSE;
+        }
+        ULONG psmValue = 0;
+        pXdslReportDflt->ReportingPeriod = uValue;
+        psmValue = pXdslReportDflt->ReportingPeriod;
+        XdslReportSetDefaultReportingPeriod (uValue);
+        SetNVRamULONGConfiguration (XdslReportStatusDfltReportingPeriod, psmValue); 
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+ANSC_STATUS GetNVRamULONGConfiguration(char* setting, ULONG* value)
+{
+    char strValue[32] = {0};
+    int retPsmGet = 0;
+
+    retPsmGet = XdslPsmCacheGet(setting, strValue, sizeof(strValue));
+    if (retPsmGet == CCSP_SUCCESS)
+    {
+        *value = _ansc_atoi(strValue);
+    }
+    return retPsmGet;
+}
+
+ANSC_STATUS SetNVRamULONGConfiguration (char * setting, ULONG value)
+{
+    char psmValue[32] = {};
+
+    //Unchanged values are dropped by the cache without a PSM access
+    snprintf(psmValue, sizeof(psmValue), "%d", (int)value);
+    return XdslPsmCacheSet(setting, psmValue);
+}
+
+ANSC_STATUS GetNVRamStringConfiguration(char* setting, char* value, ULONG size)
+{
+    return XdslPsmCacheGet(setting, value, size);
+}
+
+ANSC_STATUS SetNVRamStringConfiguration(char* setting, char* value)
+{
+    return XdslPsmCacheSet(setting, value);
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_NLNM.
+
+    *  X_RDK_NLNM_GetParamIntValue
+
+***********************************************************************/
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_NLNM_GetParamIntValue 
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                int*                        pInt
+            );
+
+    description:
+
+        This function is called to retrieve integer parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                int*                        pInt
+                The buffer of returned integer value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_NLNM_GetParamIntValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        int*                        pInt
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_NLNM             pXdslXRdkNlm     = (PDML_XDSL_X_RDK_NLNM)pMyObject->pDSLXRdkNlm;
+
+    if( ANSC_STATUS_FAILURE == DmlXdslGetXRDKNlm( pXdslXRdkNlm ))
+    {
+        return FALSE;
+    }
+
+    if( AnscEqualString(ParamName, "echotonoiseratio", TRUE))
+    {
+        /* collect value */
+        *pInt = pXdslXRdkNlm->echotonoiseratio;
+        return TRUE;
+    }
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_Perf.
+
+    *  X_RDK_Perf_GetParamBoolValue
+    *  X_RDK_Perf_SetParamBoolValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Perf_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Perf_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_PERF             pXdslPerf        = (PDML_XDSL_X_RDK_PERF)pMyObject->pDSLPerf;
+
+    if( AnscEqualString(ParamName, "Enable", TRUE))
+    {
+        /* collect value */
+        *pBool = pXdslPerf->Enable;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "ByteCounting", TRUE))
+    {
+        /* collect value */
+        *pBool = pXdslPerf->ByteCounting;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "Reset", TRUE))
+    {
+        /* Reset is a trigger, it always reads back as false */
+        *pBool = FALSE;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Perf_SetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL                        bValue
+            );
+
+    description:
+
+        This function is called to set BOOL parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL                        bValue
+                The updated BOOL value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Perf_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_PERF             pXdslPerf        = (PDML_XDSL_X_RDK_PERF)pMyObject->pDSLPerf;
+
+    if( AnscEqualString(ParamName, "Enable", TRUE))
+    {
+        if( ANSC_STATUS_SUCCESS != DmlXdslSetHalPerfEnable( bValue ) )
+        {
+            return FALSE;
+        }
+
+        pXdslPerf->Enable = bValue;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "ByteCounting", TRUE))
+    {
+        if( ANSC_STATUS_SUCCESS != DmlXdslSetHalPerfByteCounting( bValue ) )
+        {
+            return FALSE;
+        }
+
+        pXdslPerf->ByteCounting = bValue;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "Reset", TRUE))
+    {
+        if( TRUE == bValue )
+        {
+            DmlXdslResetHalPerf( );
+        }
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_Perf.HalCall.{i}.
+
+    *  X_RDK_Perf_HalCall_GetEntryCount
+    *  X_RDK_Perf_HalCall_GetEntry
+    *  X_RDK_Perf_HalCall_GetParamUlongValue
+    *  X_RDK_Perf_HalCall_GetParamStringValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_Perf_HalCall_GetEntryCount
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+
+        This function is called to retrieve the count of the table.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The count of the table
+
+**********************************************************************/
+ULONG
+X_RDK_Perf_HalCall_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL   pMyObject   = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+
+    return pMyObject->pDSLPerf->ulTotalNoofHalCalls;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ANSC_HANDLE
+        X_RDK_Perf_HalCall_GetEntry
+            (
+                ANSC_HANDLE                 hInsContext,
+                ULONG                       nIndex,
+                ULONG*                      pInsNumber
+            );
+
+    description:
+
+        This function is called to retrieve the entry specified by the index.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                ULONG                       nIndex,
+                The index of this entry;
+
+                ULONG*                      pInsNumber
+                The output instance number;
+
+    return:     The handle to identify the entry
+
+**********************************************************************/
+ANSC_HANDLE
+X_RDK_Perf_HalCall_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    )
+{
+    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_PERF pXdslPerf = (PDML_XDSL_X_RDK_PERF)pMyObject->pDSLPerf;
+
+    if ( ( pXdslPerf ) && ( nIndex < pXdslPerf->ulTotalNoofHalCalls ) )
+    {
+        *pInsNumber = nIndex + 1;
+
+        return &pXdslPerf->stHalCall[nIndex];
+    }
+
+    return NULL; /* return the invlalid handle */
+}
+
+/* Refresh the entry from the live counters, they move on every HAL call */
+static BOOL X_RDK_Perf_HalCall_Sync( PDML_XDSL_HAL_PERF pHalCall )
+{
+    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_PERF pXdslPerf = (PDML_XDSL_X_RDK_PERF)pMyObject->pDSLPerf;
+
+    return ( ANSC_STATUS_SUCCESS == DmlXdslGetHalPerf( (INT)(pHalCall - pXdslPerf->stHalCall), pHalCall ) ) ? TRUE : FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_Perf_HalCall_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_Perf_HalCall_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDML_XDSL_HAL_PERF      pHalCall = (PDML_XDSL_HAL_PERF)hInsContext;
+
+    if( FALSE == X_RDK_Perf_HalCall_Sync( pHalCall ) )
+    {
+        return FALSE;
+    }
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Calls", TRUE))
+    {
+        /* collect value */
+        *puLong = pHalCall->Calls;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "Errors", TRUE))
+    {
+        /* collect value */
+        *puLong = pHalCall->Errors;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "Timeouts", TRUE))
+    {
+        /* collect value */
+        *puLong = pHalCall->Timeouts;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "AverageLatency", TRUE))
+    {
+        /* collect value */
+        *puLong = ( pHalCall->Calls > 0 ) ? (ULONG)( pHalCall->TotalLatency / pHalCall->Calls ) : 0;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "MaxLatency", TRUE))
+    {
+        /* collect value */
+        *puLong = pHalCall->MaxLatency;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CacheHits", TRUE))
+    {
+        /* collect value */
+        *puLong = pHalCall->CacheHits;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CacheMisses", TRUE))
+    {
+        /* collect value */
+        *puLong = pHalCall->CacheMisses;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_Perf_HalCall_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+X_RDK_Perf_HalCall_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDML_XDSL_HAL_PERF      pHalCall = (PDML_XDSL_HAL_PERF)hInsContext;
+
+    if( FALSE == X_RDK_Perf_HalCall_Sync( pHalCall ) )
+    {
+        return -1;
+    }
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Name", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pHalCall->Name ) - 1 ) < *pUlSize )
        {
-           *pUlSize = sizeof( pstADSLLineTest->LATNpbds );
+           AnscCopyString( pValue, pHalCall->Name );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pHalCall->Name );
+           return 1;
+       }
+    }
+
+    /* 64-bit counters, a ULONG would wrap them */
+    if( AnscEqualString(ParamName, "BytesSent", TRUE) || AnscEqualString(ParamName, "BytesReceived", TRUE) )
+    {
+       char    acCount[24] = { 0 };
+
+       snprintf( acCount, sizeof(acCount), "%llu",
+                 AnscEqualString(ParamName, "BytesSent", TRUE) ? pHalCall->BytesSent : pHalCall->BytesReceived );
+
+       if ( strlen( acCount ) < *pUlSize )
+       {
+           AnscCopyString( pValue, acCount );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = strlen( acCount ) + 1;
+           return 1;
+       }
+    }
+
+    if( AnscEqualString(ParamName, "LatencyHistogram", TRUE) )
+    {
+       /* Comma separated call counts, bucket n holds calls of [2^n, 2^(n+1)) microseconds */
+       char    acHistogram[XDSL_HAL_PERF_BUCKETS * 11] = { 0 };
+       int     iLength = 0;
+       int     iLoopCount;
+
+       for( iLoopCount = 0; iLoopCount < XDSL_HAL_PERF_BUCKETS; iLoopCount++ )
+       {
+           iLength += snprintf( acHistogram + iLength, sizeof( acHistogram ) - iLength, "%s%lu",
+                                ( iLoopCount == 0 ) ? "" : ",", pHalCall->Histogram[iLoopCount] );
+       }
+
+       if ( strlen( acHistogram ) < *pUlSize )
+       {
+           AnscCopyString( pValue, acHistogram );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = strlen( acHistogram ) + 1;
            return 1;
        }
     }
 
-    if( AnscEqualString(ParamName, "LATNpbus", TRUE) )
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_BringUp.
+
+    *  X_RDK_BringUp_GetParamBoolValue
+    *  X_RDK_BringUp_SetParamBoolValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_BringUp_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_BringUp_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{
+    if( AnscEqualString(ParamName, "Reset", TRUE))
+    {
+        /* Reset is a trigger, it always reads back as false */
+        *pBool = FALSE;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_BringUp_SetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL                        bValue
+            );
+
+    description:
+
+        This function is called to set BOOL parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL                        bValue
+                The updated BOOL value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_BringUp_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    )
+{
+    if( AnscEqualString(ParamName, "Reset", TRUE))
+    {
+        if( TRUE == bValue )
+        {
+            DmlXdslResetBringUp( );
+        }
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_BringUp.Phase.{i}.
+
+    *  X_RDK_BringUp_Phase_GetEntryCount
+    *  X_RDK_BringUp_Phase_GetEntry
+    *  X_RDK_BringUp_Phase_GetParamUlongValue
+    *  X_RDK_BringUp_Phase_GetParamStringValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_BringUp_Phase_GetEntryCount
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+
+        This function is called to retrieve the count of the table.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The count of the table
+
+**********************************************************************/
+ULONG
+X_RDK_BringUp_Phase_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL   pMyObject   = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+
+    return pMyObject->pDSLBringUp->ulTotalNoofPhases;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ANSC_HANDLE
+        X_RDK_BringUp_Phase_GetEntry
+            (
+                ANSC_HANDLE                 hInsContext,
+                ULONG                       nIndex,
+                ULONG*                      pInsNumber
+            );
+
+    description:
+
+        This function is called to retrieve the entry specified by the index.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                ULONG                       nIndex,
+                The index of this entry;
+
+                ULONG*                      pInsNumber
+                The output instance number;
+
+    return:     The handle to identify the entry
+
+**********************************************************************/
+ANSC_HANDLE
+X_RDK_BringUp_Phase_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    )
+{
+    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_BRINGUP pXdslBringUp = (PDML_XDSL_X_RDK_BRINGUP)pMyObject->pDSLBringUp;
+
+    if ( ( pXdslBringUp ) && ( nIndex < pXdslBringUp->ulTotalNoofPhases ) )
+    {
+        *pInsNumber = nIndex + 1;
+
+        return &pXdslBringUp->stPhase[nIndex];
+    }
+
+    return NULL; /* return the invlalid handle */
+}
+
+/* Refresh the entry from the live counters, they move on every bring-up */
+static BOOL X_RDK_BringUp_Phase_Sync( PDML_XDSL_BRINGUP_PHASE pPhase )
+{
+    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_BRINGUP pXdslBringUp = (PDML_XDSL_X_RDK_BRINGUP)pMyObject->pDSLBringUp;
+
+    return ( ANSC_STATUS_SUCCESS == DmlXdslGetBringUpPhase( (INT)(pPhase - pXdslBringUp->stPhase), pPhase ) ) ? TRUE : FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_BringUp_Phase_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_BringUp_Phase_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDML_XDSL_BRINGUP_PHASE      pPhase = (PDML_XDSL_BRINGUP_PHASE)hInsContext;
+
+    if( FALSE == X_RDK_BringUp_Phase_Sync( pPhase ) )
+    {
+        return FALSE;
+    }
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Count", TRUE))
+    {
+        /* collect value */
+        *puLong = pPhase->Count;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "AverageTime", TRUE))
+    {
+        /* collect value */
+        *puLong = ( pPhase->Count > 0 ) ? (ULONG)( pPhase->TotalTime / pPhase->Count ) : 0;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "MaxTime", TRUE))
+    {
+        /* collect value */
+        *puLong = pPhase->MaxTime;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_BringUp_Phase_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+X_RDK_BringUp_Phase_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDML_XDSL_BRINGUP_PHASE      pPhase = (PDML_XDSL_BRINGUP_PHASE)hInsContext;
+
+    if( FALSE == X_RDK_BringUp_Phase_Sync( pPhase ) )
+    {
+        return -1;
+    }
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Name", TRUE) )
     {
        /* collect value */
-       if ( ( sizeof( pstADSLLineTest->LATNpbus ) - 1 ) < *pUlSize )
+       if ( ( sizeof( pPhase->Name ) - 1 ) < *pUlSize )
        {
-           AnscCopyString( pValue, pstADSLLineTest->LATNpbus );
+           AnscCopyString( pValue, pPhase->Name );
            return 0;
        }
        else
        {
-           *pUlSize = sizeof( pstADSLLineTest->LATNpbus );
+           *pUlSize = sizeof( pPhase->Name );
            return 1;
        }
     }
 
-    if( AnscEqualString(ParamName, "SATNds", TRUE) )
+    if( AnscEqualString(ParamName, "Histogram", TRUE) )
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->SATNds ) - 1 ) < *pUlSize )
+       /* Comma separated counts, bucket n holds phases of [2^n, 2^(n+1)) milliseconds */
+       char    acHistogram[XDSL_BRINGUP_BUCKETS * 11] = { 0 };
+
+       XdslBringUpFormatHistogram( pPhase->Histogram, acHistogram, sizeof( acHistogram ) );
+
+       if ( strlen( acHistogram ) < *pUlSize )
        {
-           AnscCopyString( pValue, pstADSLLineTest->SATNds );
+           AnscCopyString( pValue, acHistogram );
            return 0;
        }
        else
        {
-           *pUlSize = sizeof( pstADSLLineTest->SATNds );
+           *pUlSize = strlen( acHistogram ) + 1;
            return 1;
        }
     }
 
-    if( AnscEqualString(ParamName, "SATNus", TRUE) )
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_BringUp.Trace.{i}.
+
+    *  X_RDK_BringUp_Trace_GetEntryCount
+    *  X_RDK_BringUp_Trace_GetEntry
+    *  X_RDK_BringUp_Trace_GetParamUlongValue
+    *  X_RDK_BringUp_Trace_GetParamStringValue
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_BringUp_Trace_GetEntryCount
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+
+        This function is called to retrieve the count of the table.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The count of the table
+
+**********************************************************************/
+ULONG
+X_RDK_BringUp_Trace_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL   pMyObject   = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+
+    /* Take a fresh snapshot of the ring, the table is walked right after */
+    if( ANSC_STATUS_SUCCESS != DmlXdslGetBringUpTraces( pMyObject->pDSLBringUp ) )
+    {
+        return 0;
+    }
+
+    return pMyObject->pDSLBringUp->ulTotalNoofTraces;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ANSC_HANDLE
+        X_RDK_BringUp_Trace_GetEntry
+            (
+                ANSC_HANDLE                 hInsContext,
+                ULONG                       nIndex,
+                ULONG*                      pInsNumber
+            );
+
+    description:
+
+        This function is called to retrieve the entry specified by the index.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                ULONG                       nIndex,
+                The index of this entry;
+
+                ULONG*                      pInsNumber
+                The output instance number;
+
+    return:     The handle to identify the entry
+
+**********************************************************************/
+ANSC_HANDLE
+X_RDK_BringUp_Trace_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    )
+{
+    PDATAMODEL_XDSL    pMyObject  = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_BRINGUP pXdslBringUp = (PDML_XDSL_X_RDK_BRINGUP)pMyObject->pDSLBringUp;
+
+    if ( ( pXdslBringUp ) && ( nIndex < pXdslBringUp->ulTotalNoofTraces ) )
+    {
+        *pInsNumber = nIndex + 1;
+
+        return &pXdslBringUp->stTrace[nIndex];
+    }
+
+    return NULL; /* return the invlalid handle */
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_BringUp_Trace_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
+    description:
+
+        This function is called to retrieve ULONG parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_BringUp_Trace_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    )
+{
+    PDML_XDSL_BRINGUP_TRACE      pTrace = (PDML_XDSL_BRINGUP_TRACE)hInsContext;
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "StartTime", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->SATNus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->SATNus );
-           return 0;     
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->SATNus );
-           return 1;
-       }
+        /* collect value */
+        *puLong = pTrace->StartTime;
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "HLINpsds", TRUE) )
+    if( AnscEqualString(ParamName, "TrainTime", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->HLINpsds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->HLINpsds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->HLINpsds );
-           return 1;
-       }
+        /* collect value */
+        *puLong = pTrace->TrainTime;
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "HLINpsus", TRUE) )
+    if( AnscEqualString(ParamName, "XtmConfigTime", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->HLINpsus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->HLINpsus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->HLINpsus );
-           return 1;
-       }
+        /* collect value */
+        *puLong = pTrace->XtmConfigTime;
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "QLNpsds", TRUE) )
+    if( AnscEqualString(ParamName, "WanNotifyTime", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->QLNpsds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->QLNpsds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->QLNpsds );
-           return 1;
-       }
+        /* collect value */
+        *puLong = pTrace->WanNotifyTime;
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "QLNpsus", TRUE) )
+    if( AnscEqualString(ParamName, "TotalTime", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->QLNpsus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->QLNpsus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->QLNpsus );
-           return 1;
-       }
+        /* collect value */
+        *puLong = pTrace->TotalTime;
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "SNRpsds", TRUE) )
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_BringUp_Trace_GetParamStringValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
+            );
+
+    description:
+
+        This function is called to retrieve string parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
+
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
+ULONG
+X_RDK_BringUp_Trace_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
+{
+    PDML_XDSL_BRINGUP_TRACE      pTrace = (PDML_XDSL_BRINGUP_TRACE)hInsContext;
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Interface", TRUE) )
     {
        /* collect value */
-       if ( ( sizeof( pstADSLLineTest->SNRpsds ) - 1 ) < *pUlSize )
+       if ( ( sizeof( pTrace->Interface ) - 1 ) < *pUlSize )
        {
-           AnscCopyString( pValue, pstADSLLineTest->SNRpsds );
+           AnscCopyString( pValue, pTrace->Interface );
            return 0;
        }
        else
        {
-           *pUlSize = sizeof( pstADSLLineTest->SNRpsds );
+           *pUlSize = sizeof( pTrace->Interface );
            return 1;
        }
     }
 
-    if( AnscEqualString(ParamName, "SNRpsus", TRUE) )
+    if( AnscEqualString(ParamName, "Result", TRUE) )
     {
        /* collect value */
-       if ( ( sizeof( pstADSLLineTest->SNRpsus ) - 1 ) < *pUlSize )
+       if ( ( sizeof( pTrace->Result ) - 1 ) < *pUlSize )
        {
-           AnscCopyString( pValue, pstADSLLineTest->SNRpsus );
+           AnscCopyString( pValue, pTrace->Result );
            return 0;
        }
        else
        {
-           *pUlSize = sizeof( pstADSLLineTest->SNRpsus );
+           *pUlSize = sizeof( pTrace->Result );
            return 1;
        }
     }
 
-    if( AnscEqualString(ParamName, "BITSpsds", TRUE) )
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
+}
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_FlapDamping.
+
+    *  X_RDK_FlapDamping_GetParamBoolValue
+    *  X_RDK_FlapDamping_SetParamBoolValue
+    *  X_RDK_FlapDamping_GetParamUlongValue
+    *  X_RDK_FlapDamping_SetParamUlongValue
+    *  X_RDK_FlapDamping_Validate
+    *  X_RDK_FlapDamping_Commit
+    *  X_RDK_FlapDamping_Rollback
+
+***********************************************************************/
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_FlapDamping_GetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL*                       pBool
+            );
+
+    description:
+
+        This function is called to retrieve Boolean parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL*                       pBool
+                The buffer of returned boolean value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_FlapDamping_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
+
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->BITSpsds ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->BITSpsds );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->BITSpsds );
-           return 1;
-       }
+        /* collect value */
+        *pBool = pFlapDamping->Enable;
+        return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "BITSpsus", TRUE) )
+    if( AnscEqualString(ParamName, "Reset", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstADSLLineTest->BITSpsus ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstADSLLineTest->BITSpsus );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstADSLLineTest->BITSpsus );
-           return 1;
-       }
+        /* Reset is a trigger, it always reads back as false */
+        *pBool = FALSE;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
+
+/**********************************************************************
+
+    caller:     owner of this object
+
+    prototype:
+
+        BOOL
+        X_RDK_FlapDamping_SetParamBoolValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                BOOL                        bValue
+            );
+
+    description:
+
+        This function is called to set BOOL parameter value;
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       ParamName,
+                The parameter name;
+
+                BOOL                        bValue
+                The updated BOOL value;
+
+    return:     TRUE if succeeded.
+
+**********************************************************************/
+BOOL
+X_RDK_FlapDamping_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
+
+    if( AnscEqualString(ParamName, "Enable", TRUE))
+    {
+        pFlapDamping->Enable = bValue;
+        pFlapDamping->bConfigChanged = TRUE;
+        return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return -1;
+    if( AnscEqualString(ParamName, "Reset", TRUE))
+    {
+        if( TRUE == bValue )
+        {
+            DmlXdslResetFlapDampingStats( );
+        }
+
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
 }
 
 /**********************************************************************
@@ -3783,16 +6570,16 @@ ADSLLineTest_GetParamStringValue
     prototype:
 
         BOOL
-        ADSLLineTest_GetParamIntValue
+        X_RDK_FlapDamping_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                int*                        pInt
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to retrieve integer parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3800,82 +6587,97 @@ ADSLLineTest_GetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                int*                        pInt
-                The buffer of returned integer value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-ADSLLineTest_GetParamIntValue
+X_RDK_FlapDamping_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        int*                        pInt
+        ULONG*                      puLong
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_ADSL_LINE_TEST    pstADSLLineTest  = (PDML_XDSL_DIAG_ADSL_LINE_TEST)&(pDSLDiag->stDiagADSLLineTest);
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
 
-    if( AnscEqualString(ParamName, "ACTPSDds", TRUE))
+    /* Counters and penalty move with every link status change */
+    if( ANSC_STATUS_SUCCESS != DmlXdslGetFlapDampingStats( pFlapDamping ) )
+    {
+        return FALSE;
+    }
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "HalfLife", TRUE))
     {
         /* collect value */
-        *pInt = pstADSLLineTest->ACTPSDds;
+        *puLong = pFlapDamping->HalfLife;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "ACTPSDus", TRUE))
+    if( AnscEqualString(ParamName, "SuppressThreshold", TRUE))
     {
         /* collect value */
-        *pInt = pstADSLLineTest->ACTPSDus;
+        *puLong = pFlapDamping->SuppressThreshold;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "ACTATPds", TRUE))
+    if( AnscEqualString(ParamName, "ReuseThreshold", TRUE))
     {
         /* collect value */
-        *pInt = pstADSLLineTest->ACTATPds;
+        *puLong = pFlapDamping->ReuseThreshold;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "ACTATPus", TRUE))
+    if( AnscEqualString(ParamName, "MaxSuppressTime", TRUE))
     {
         /* collect value */
-        *pInt = pstADSLLineTest->ACTATPus;
+        *puLong = pFlapDamping->MaxSuppressTime;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "HLINSCds", TRUE))
+    if( AnscEqualString(ParamName, "Flaps", TRUE))
     {
         /* collect value */
-        *pInt = pstADSLLineTest->HLINSCds;
+        *puLong = pFlapDamping->Flaps;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "HLINSCus", TRUE))
+    if( AnscEqualString(ParamName, "SuppressedEvents", TRUE))
     {
         /* collect value */
-        *pInt = pstADSLLineTest->HLINSCus;
+        *puLong = pFlapDamping->SuppressedEvents;
         return TRUE;
     }
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/***********************************************************************
+    if( AnscEqualString(ParamName, "Suppressions", TRUE))
+    {
+        /* collect value */
+        *puLong = pFlapDamping->Suppressions;
+        return TRUE;
+    }
 
- APIs for Object:
+    if( AnscEqualString(ParamName, "Penalty", TRUE))
+    {
+        /* collect value */
+        *puLong = pFlapDamping->Penalty;
+        return TRUE;
+    }
 
-    Device.DSL.Diagnostics.SELTUER.
+    if( AnscEqualString(ParamName, "SuppressedLines", TRUE))
+    {
+        /* collect value */
+        *puLong = pFlapDamping->SuppressedLines;
+        return TRUE;
+    }
 
-    *  SELTUER_GetParamUlongValue
-    *  SELTUER_GetParamStringValue
-    *  SELTUER_SetParamStringValue
-    *  SELTUER_GetParamBoolValue
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
 
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -3883,16 +6685,16 @@ ADSLLineTest_GetParamIntValue
     prototype:
 
         BOOL
-        SELTUER_GetParamUlongValue
+        X_RDK_FlapDamping_SetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                ULONG                       uValue
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to set ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -3900,46 +6702,49 @@ ADSLLineTest_GetParamIntValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                ULONG                       uValue
+                The updated ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-SELTUER_GetParamUlongValue
+X_RDK_FlapDamping_SetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        ULONG                       uValue
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
 
     /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    if( AnscEqualString(ParamName, "HalfLife", TRUE))
     {
-        *puLong = pstSELTUERTest->DiagnosticsState;
+        pFlapDamping->HalfLife = uValue;
+        pFlapDamping->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "UERMaxMeasurementDuration", TRUE) )
+    if( AnscEqualString(ParamName, "SuppressThreshold", TRUE))
     {
-        *puLong = pstSELTUERTest->UERMaxMeasurementDuration;
+        pFlapDamping->SuppressThreshold = uValue;
+        pFlapDamping->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "UERScaleFactor", TRUE) )
+    if( AnscEqualString(ParamName, "ReuseThreshold", TRUE))
     {
-        *puLong = pstSELTUERTest->UERScaleFactor;
+        pFlapDamping->ReuseThreshold = uValue;
+        pFlapDamping->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "UERGroupSize", TRUE) )
+    if( AnscEqualString(ParamName, "MaxSuppressTime", TRUE))
     {
-        *puLong = pstSELTUERTest->UERGroupSize;
+        pFlapDamping->MaxSuppressTime = uValue;
+        pFlapDamping->bConfigChanged = TRUE;
         return TRUE;
     }
 
@@ -3954,153 +6759,159 @@ SELTUER_GetParamUlongValue
     prototype:
 
         BOOL
-        SELTUER_SetParamUlongValue
-            (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG                       uValue
-            );
-
+        X_RDK_FlapDamping_Validate
+        (
+            ANSC_HANDLE                 hInsContext,
+            char*                       pReturnParamName,
+            ULONG*                      puLength
+        )
     description:
 
-        This function is called to set ULONG parameter value;
+        This function is called to validate the update.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
+                char*                       pReturnParamName,
+                The buffer (128 bytes) of parameter name if there's a validation.
 
-                ULONG                       uValue
-                The updated ULONG value;
+                ULONG*                      puLength
+                The output length of the param name.
 
-    return:     TRUE if succeeded.
+    return:     TRUE if there's no validation.
 
 **********************************************************************/
 BOOL
-SELTUER_SetParamUlongValue
+X_RDK_FlapDamping_Validate
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG                       uValue
+        char*                       pReturnParamName,
+        ULONG*                      puLength
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    if( FALSE == pFlapDamping->bConfigChanged )
     {
-        pstSELTUERTest->DiagnosticsState = uValue;
-
         return TRUE;
     }
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    if( 0 == pFlapDamping->HalfLife )
+    {
+        AnscCopyString(pReturnParamName, "HalfLife");
+        *puLength = AnscSizeOfString("HalfLife");
+        return FALSE;
+    }
+
+    if( ( 0 == pFlapDamping->ReuseThreshold ) || ( pFlapDamping->ReuseThreshold >= pFlapDamping->SuppressThreshold ) )
+    {
+        AnscCopyString(pReturnParamName, "ReuseThreshold");
+        *puLength = AnscSizeOfString("ReuseThreshold");
+        return FALSE;
+    }
+
+    if( pFlapDamping->MaxSuppressTime < pFlapDamping->HalfLife )
+    {
+        AnscCopyString(pReturnParamName, "MaxSuppressTime");
+        *puLength = AnscSizeOfString("MaxSuppressTime");
+        return FALSE;
+    }
+
+    return TRUE;
 }
 
 /**********************************************************************
-
     caller:     owner of this object
 
     prototype:
-
         ULONG
-        SELTUER_GetParamStringValue
+        X_RDK_FlapDamping_Commit
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                char*                       pValue,
-                ULONG*                      pUlSize
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
-
-        This function is called to retrieve string parameter value;
+        This function is called to finally commit all the update.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+X_RDK_FlapDamping_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
 
-                char*                       pValue,
-                The string value buffer;
+    if( TRUE == pFlapDamping->bConfigChanged )
+    {
+        if( ANSC_STATUS_SUCCESS != DmlXdslSetFlapDampingConfig( pFlapDamping ) )
+        {
+            DmlXdslGetFlapDampingConfig( pFlapDamping );
+            return -1;
+        }
 
-                ULONG*                      pUlSize
-                The buffer of length of string value;
-                Usually size of 1023 will be used.
-                If it's not big enough, put required size here and return 1;
+        pFlapDamping->bConfigChanged = FALSE;
+    }
 
-    return:     0 if succeeded;
-                1 if short of buffer size; (*pUlSize = required size)
-                -1 if not supported.
+    return 0;
+}
+
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+        ULONG
+        X_RDK_FlapDamping_Rollback
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+        This function is called to roll back the update whenever there's a
+        validation found.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
+    return:     The status of the operation.
 **********************************************************************/
 ULONG
-SELTUER_GetParamStringValue
+X_RDK_FlapDamping_Rollback
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        char*                       pValue,
-        ULONG*                      pUlSize
+        ANSC_HANDLE                 hInsContext
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+    PDML_XDSL_X_RDK_FLAP_DAMPING     pFlapDamping     = (PDML_XDSL_X_RDK_FLAP_DAMPING)pMyObject->pDSLFlapDamping;
 
-    if( AnscEqualString(ParamName, "Interface", TRUE) )
+    if( TRUE == pFlapDamping->bConfigChanged )
     {
-       /* collect value */
-       if ( ( sizeof( pstSELTUERTest->Interface ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTUERTest->Interface );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTUERTest->Interface );
-           return 1;
-       }
+        DmlXdslGetFlapDampingConfig( pFlapDamping );
     }
 
-    if( AnscEqualString(ParamName, "UER", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstSELTUERTest->UER ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTUERTest->UER );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTUERTest->UER );
-           return 1;
-       }
-    }
+    return 0;
+}
 
-    if( AnscEqualString(ParamName, "UERVar", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstSELTUERTest->UERVar ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTUERTest->UERVar );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTUERTest->UERVar );
-           return 1;
-       }
-    }
+/***********************************************************************
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return -1;
-}
+    Device.DSL.X_RDK_TrainingHint.
+
+    *  X_RDK_TrainingHint_GetParamBoolValue
+    *  X_RDK_TrainingHint_SetParamBoolValue
+    *  X_RDK_TrainingHint_GetParamUlongValue
+    *  X_RDK_TrainingHint_SetParamUlongValue
+    *  X_RDK_TrainingHint_GetParamStringValue
+    *  X_RDK_TrainingHint_Validate
+    *  X_RDK_TrainingHint_Commit
+    *  X_RDK_TrainingHint_Rollback
 
+***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -4108,7 +6919,7 @@ SELTUER_GetParamStringValue
     prototype:
 
         BOOL
-        SELTUER_GetParamBoolValue
+        X_RDK_TrainingHint_GetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
@@ -4132,7 +6943,7 @@ SELTUER_GetParamStringValue
 
 **********************************************************************/
 BOOL
-SELTUER_GetParamBoolValue
+X_RDK_TrainingHint_GetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
@@ -4140,17 +6951,35 @@ SELTUER_GetParamBoolValue
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
+
+    if( AnscEqualString(ParamName, "Enable", TRUE))
+    {
+        /* collect value */
+        *pBool = pTrainingHint->Enable;
+        return TRUE;
+    }
 
-    if( AnscEqualString(ParamName, "ExtendedBandwidthOperation", TRUE) )
+    if( AnscEqualString(ParamName, "Active", TRUE))
     {
-        *pBool = pstSELTUERTest->ExtendedBandwidthOperation;
+        if( ANSC_STATUS_SUCCESS != DmlXdslGetTrainingHintStatus( pTrainingHint ) )
+        {
+            return FALSE;
+        }
 
+        /* collect value */
+        *pBool = pTrainingHint->Active;
         return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    if( AnscEqualString(ParamName, "Forget", TRUE))
+    {
+        /* Forget is a trigger, it always reads back as false */
+        *pBool = FALSE;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
@@ -4161,16 +6990,16 @@ SELTUER_GetParamBoolValue
     prototype:
 
         BOOL
-        SELTUER_SetParamStringValue
+        X_RDK_TrainingHint_SetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pString
+                BOOL                        bValue
             );
 
     description:
 
-        This function is called to set string parameter value;
+        This function is called to set BOOL parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4178,50 +7007,44 @@ SELTUER_GetParamBoolValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pString
-                The updated string value;
+                BOOL                        bValue
+                The updated BOOL value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-SELTUER_SetParamStringValue
+X_RDK_TrainingHint_SetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pString
+        BOOL                        bValue
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTUER           pstSELTUERTest   = (PDML_XDSL_DIAG_SELTUER)&(pDSLDiag->stDiagSELTUER);
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
 
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Interface", TRUE))
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-        /* save update to backup */
-        AnscCopyString( pstSELTUERTest->Interface, pString );
+        pTrainingHint->Enable = bValue;
+        pTrainingHint->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
-}
-
-/***********************************************************************
-
- APIs for Object:
+    if( AnscEqualString(ParamName, "Forget", TRUE))
+    {
+        if( TRUE == bValue )
+        {
+            DmlXdslForgetTrainingHint( );
+        }
 
-    Device.DSL.Diagnostics.SELTQLN.
+        return TRUE;
+    }
 
-    *  SELTQLN_GetParamUlongValue
-    *  SELTQLN_SetParamUlongValue
-    *  SELTQLN_GetParamStringValue
-    *  SELTQLN_SetParamStringValue
-    *  SELTQLN_GetParamIntValue
-    *  SELTQLN_GetParamBoolValue
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
 
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -4229,7 +7052,7 @@ SELTUER_SetParamStringValue
     prototype:
 
         BOOL
-        SELTQLN_GetParamUlongValue
+        X_RDK_TrainingHint_GetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
@@ -4253,36 +7076,51 @@ SELTUER_SetParamStringValue
 
 **********************************************************************/
 BOOL
-SELTQLN_GetParamUlongValue
+X_RDK_TrainingHint_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
         ULONG*                      puLong
     )
-{   
+{
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
-    
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
+
+    /* Last good configuration is relearnt on every training */
+    if( ANSC_STATUS_SUCCESS != DmlXdslGetTrainingHintStatus( pTrainingHint ) )
     {
-        *puLong = pstSELTQLNTest->DiagnosticsState;
+        return FALSE;
+    }
+
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "FallbackTimeout", TRUE))
+    {
+        /* collect value */
+        *puLong = pTrainingHint->FallbackTimeout;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "QLNMaxMeasurementDuration", TRUE) )
-    {   
-        *puLong = pstSELTQLNTest->QLNMaxMeasurementDuration;
+    if( AnscEqualString(ParamName, "UpstreamRate", TRUE))
+    {
+        /* collect value */
+        *puLong = pTrainingHint->UpstreamRate;
         return TRUE;
     }
-    
-    if( AnscEqualString(ParamName, "QLNGroupSize", TRUE) )
-    {   
-        *puLong = pstSELTQLNTest->QLNGroupSize;
+
+    if( AnscEqualString(ParamName, "DownstreamRate", TRUE))
+    {
+        /* collect value */
+        *puLong = pTrainingHint->DownstreamRate;
         return TRUE;
     }
-    
+
+    if( AnscEqualString(ParamName, "Fallbacks", TRUE))
+    {
+        /* collect value */
+        *puLong = pTrainingHint->Fallbacks;
+        return TRUE;
+    }
+
     /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
@@ -4294,7 +7132,7 @@ SELTQLN_GetParamUlongValue
     prototype:
 
         BOOL
-        SELTQLN_SetParamUlongValue
+        X_RDK_TrainingHint_SetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
@@ -4318,7 +7156,7 @@ SELTQLN_GetParamUlongValue
 
 **********************************************************************/
 BOOL
-SELTQLN_SetParamUlongValue
+X_RDK_TrainingHint_SetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
@@ -4326,24 +7164,16 @@ SELTQLN_SetParamUlongValue
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
 
     /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    if( AnscEqualString(ParamName, "FallbackTimeout", TRUE))
     {
-        pstSELTQLNTest->DiagnosticsState = uValue;
-
+        pTrainingHint->FallbackTimeout = uValue;
+        pTrainingHint->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    if(AnscEqualString(ParamName, "QLNMaxMeasurementDuration", TRUE))
-    {
-        pstSELTQLNTest->QLNMaxMeasurementDuration = uValue;
-
-        return TRUE;
-    }
-   
     /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
@@ -4354,17 +7184,18 @@ SELTQLN_SetParamUlongValue
 
     prototype:
 
-        BOOL
-        SELTQLN_GetParamBoolValue
+        ULONG
+        X_RDK_TrainingHint_GetParamStringValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL*                       pBool
+                char*                       pValue,
+                ULONG*                      pUlSize
             );
 
     description:
 
-        This function is called to retrieve Boolean parameter value;
+        This function is called to retrieve string parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4372,33 +7203,69 @@ SELTQLN_SetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL*                       pBool
-                The buffer of returned boolean value;
+                char*                       pValue,
+                The string value buffer;
 
-    return:     TRUE if succeeded.
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
 
 **********************************************************************/
-BOOL
-SELTQLN_GetParamBoolValue
+ULONG
+X_RDK_TrainingHint_GetParamStringValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL*                       pBool
+        char*                       pValue,
+        ULONG*                      pUlSize
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
 
-    if( AnscEqualString(ParamName, "ExtendedBandwidthOperation", TRUE) )
+    if( ANSC_STATUS_SUCCESS != DmlXdslGetTrainingHintStatus( pTrainingHint ) )
     {
-        *pBool = pstSELTQLNTest->ExtendedBandwidthOperation;
+        return -1;
+    }
 
-        return TRUE;
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "StandardUsed", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pTrainingHint->StandardUsed ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pTrainingHint->StandardUsed );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pTrainingHint->StandardUsed );
+           return 1;
+       }
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    if( AnscEqualString(ParamName, "CurrentProfile", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pTrainingHint->CurrentProfile ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pTrainingHint->CurrentProfile );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pTrainingHint->CurrentProfile );
+           return 1;
+       }
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return -1;
 }
 
 /**********************************************************************
@@ -4407,70 +7274,146 @@ SELTQLN_GetParamBoolValue
 
     prototype:
 
+        BOOL
+        X_RDK_TrainingHint_Validate
+        (
+            ANSC_HANDLE                 hInsContext,
+            char*                       pReturnParamName,
+            ULONG*                      puLength
+        )
+    description:
+
+        This function is called to validate the update.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+                char*                       pReturnParamName,
+                The buffer (128 bytes) of parameter name if there's a validation.
+
+                ULONG*                      puLength
+                The output length of the param name.
+
+    return:     TRUE if there's no validation.
+
+**********************************************************************/
+BOOL
+X_RDK_TrainingHint_Validate
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       pReturnParamName,
+        ULONG*                      puLength
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
+
+    if( FALSE == pTrainingHint->bConfigChanged )
+    {
+        return TRUE;
+    }
+
+    if( 0 == pTrainingHint->FallbackTimeout )
+    {
+        AnscCopyString(pReturnParamName, "FallbackTimeout");
+        *puLength = AnscSizeOfString("FallbackTimeout");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
         ULONG
-        SELTQLN_GetParamStringValue
+        X_RDK_TrainingHint_Commit
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                char*                       pValue,
-                ULONG*                      pUlSize
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
-
-        This function is called to retrieve string parameter value;
+        This function is called to finally commit all the update.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+X_RDK_TrainingHint_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
 
-                char*                       pValue,
-                The string value buffer;
+    if( TRUE == pTrainingHint->bConfigChanged )
+    {
+        if( ANSC_STATUS_SUCCESS != DmlXdslSetTrainingHintConfig( pTrainingHint ) )
+        {
+            DmlXdslGetTrainingHintConfig( pTrainingHint );
+            return -1;
+        }
 
-                ULONG*                      pUlSize
-                The buffer of length of string value;
-                Usually size of 1023 will be used.
-                If it's not big enough, put required size here and return 1;
+        pTrainingHint->bConfigChanged = FALSE;
+    }
 
-    return:     0 if succeeded;
-                1 if short of buffer size; (*pUlSize = required size)
-                -1 if not supported.
+    return 0;
+}
+
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+        ULONG
+        X_RDK_TrainingHint_Rollback
+            (
+                ANSC_HANDLE                 hInsContext
+            );
 
+    description:
+        This function is called to roll back the update whenever there's a
+        validation found.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The status of the operation.
 **********************************************************************/
 ULONG
-SELTQLN_GetParamStringValue
+X_RDK_TrainingHint_Rollback
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        char*                       pValue,
-        ULONG*                      pUlSize
+        ANSC_HANDLE                 hInsContext
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+    PDML_XDSL_X_RDK_TRAINING_HINT    pTrainingHint    = (PDML_XDSL_X_RDK_TRAINING_HINT)pMyObject->pDSLTrainingHint;
 
-    if( AnscEqualString(ParamName, "Interface", TRUE) )
+    if( TRUE == pTrainingHint->bConfigChanged )
     {
-       /* collect value */
-       if ( ( sizeof( pstSELTQLNTest->Interface ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTQLNTest->Interface );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTQLNTest->Interface );
-           return 1;
-       }
+        DmlXdslGetTrainingHintConfig( pTrainingHint );
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return -1;
+    return 0;
 }
 
+/***********************************************************************
+
+    Device.DSL.X_RDK_Shaper.
+
+    *  X_RDK_Shaper_GetParamBoolValue
+    *  X_RDK_Shaper_SetParamBoolValue
+    *  X_RDK_Shaper_GetParamUlongValue
+    *  X_RDK_Shaper_SetParamUlongValue
+    *  X_RDK_Shaper_GetParamStringValue
+    *  X_RDK_Shaper_Validate
+    *  X_RDK_Shaper_Commit
+    *  X_RDK_Shaper_Rollback
+
+***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
@@ -4478,16 +7421,16 @@ SELTQLN_GetParamStringValue
     prototype:
 
         BOOL
-        SELTQLN_SetParamStringValue
+        X_RDK_Shaper_GetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pString
+                BOOL*                       pBool
             );
 
     description:
 
-        This function is called to set string parameter value;
+        This function is called to retrieve Boolean parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4495,68 +7438,51 @@ SELTQLN_GetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pString
-                The updated string value;
+                BOOL*                       pBool
+                The buffer of returned boolean value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-SELTQLN_SetParamStringValue
+X_RDK_Shaper_GetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pString
+        BOOL*                       pBool
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTQLN           pstSELTQLNTest   = (PDML_XDSL_DIAG_SELTQLN)&(pDSLDiag->stDiagSELTQLN);
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
 
-    /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Interface", TRUE))
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-        /* save update to backup */
-        AnscCopyString( pstSELTQLNTest->Interface, pString );
+        /* collect value */
+        *pBool = pShaper->Enable;
         return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-/***********************************************************************
-
- APIs for Object:
-
-    Device.DSL.Diagnostics.SELTP.
-
-    *  SELTP_GetParamUlongValue
-    *  SELTP_SetParamUlongValue
-    *  SELTP_GetParamStringValue
-    *  SELTP_SetParamStringValue
-    *  SELTP_GetParamBoolValue
-    *  SELTP_SetParamBoolValue
-
-***********************************************************************/
 /**********************************************************************
 
     caller:     owner of this object
 
     prototype:
 
-        ULONG
-        SELTP_GetParamStringValue
+        BOOL
+        X_RDK_Shaper_SetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pValue,
-                ULONG*                      pUlSize
+                BOOL                        bValue
             );
 
     description:
 
-        This function is called to retrieve string parameter value;
+        This function is called to set BOOL parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4564,124 +7490,32 @@ SELTQLN_SetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pValue,
-                The string value buffer;
-
-                ULONG*                      pUlSize
-                The buffer of length of string value;
-                Usually size of 1023 will be used.
-                If it's not big enough, put required size here and return 1;
+                BOOL                        bValue
+                The updated BOOL value;
 
-    return:     0 if succeeded;
-                1 if short of buffer size; (*pUlSize = required size)
-                -1 if not supported.
+    return:     TRUE if succeeded.
 
 **********************************************************************/
-ULONG
-SELTP_GetParamStringValue
+BOOL
+X_RDK_Shaper_SetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pValue,
-        ULONG*                      pUlSize
+        BOOL                        bValue
     )
-{   
+{
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
-
-    if( AnscEqualString(ParamName, "Interface", TRUE) )
-    {  
-       /* collect value */
-       if ( ( sizeof( pstSELTPTest->Interface ) - 1 ) < *pUlSize )
-       {   
-           AnscCopyString( pValue, pstSELTPTest->Interface );
-           return 0;
-       }
-       else
-       {   
-           *pUlSize = sizeof( pstSELTPTest->Interface );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "CapacitySignalPSD", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstSELTPTest->CapacitySignalPSD ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTPTest->CapacitySignalPSD );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTPTest->CapacitySignalPSD );
-           return 1;
-       }
-    }
-   
-    if( AnscEqualString(ParamName, "CapacityNoisePSD", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstSELTPTest->CapacityNoisePSD ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTPTest->CapacityNoisePSD );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTPTest->CapacityNoisePSD );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "LoopTermination", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstSELTPTest->LoopTermination ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTPTest->LoopTermination );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTPTest->LoopTermination );
-           return 1;
-       }
-    }
-
-    if( AnscEqualString(ParamName, "LoopTopology", TRUE) )
-    {
-       /* collect value */
-       if ( ( sizeof( pstSELTPTest->LoopTopology ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTPTest->LoopTopology );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTPTest->LoopTopology );
-           return 1;
-       }
-    }
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
 
-    if( AnscEqualString(ParamName, "AttenuationCharacteristics", TRUE) )
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-       /* collect value */
-       if ( ( sizeof( pstSELTPTest->AttenuationCharacteristics ) - 1 ) < *pUlSize )
-       {
-           AnscCopyString( pValue, pstSELTPTest->AttenuationCharacteristics );
-           return 0;
-       }
-       else
-       {
-           *pUlSize = sizeof( pstSELTPTest->AttenuationCharacteristics );
-           return 1;
-       }
+        pShaper->Enable = bValue;
+        pShaper->bConfigChanged = TRUE;
+        return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return -1;
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
 }
 
 /**********************************************************************
@@ -4691,16 +7525,16 @@ SELTP_GetParamStringValue
     prototype:
 
         BOOL
-        SELTP_SetParamStringValue
-            (   
+        X_RDK_Shaper_GetParamUlongValue
+            (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pString
+                ULONG*                      puLong
             );
 
     description:
 
-        This function is called to set string parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4708,47 +7542,115 @@ SELTP_GetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pString
-                The updated string value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-SELTP_SetParamStringValue
+X_RDK_Shaper_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pString
+        ULONG*                      puLong
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
+
+    /* Recommendation follows the sync rate while the line is in showtime */
+    if( ANSC_STATUS_SUCCESS != DmlXdslGetShaperRates( pShaper ) )
+    {
+        return FALSE;
+    }
 
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "Interface", TRUE))
+    if( AnscEqualString(ParamName, "Percent", TRUE))
     {
-        /* save update to backup */
-        AnscCopyString( pstSELTPTest->Interface, pString );
+        /* collect value */
+        *puLong = pShaper->Percent;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "PacketSize", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->PacketSize;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "ATMOverhead", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->ATMOverhead;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "PTMOverhead", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->PTMOverhead;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CheckInterval", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->CheckInterval;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "EgressShaper", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->EgressShaper;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "IngressShaper", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->IngressShaper;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "UpstreamSyncRate", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->UpstreamSyncRate;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "DownstreamSyncRate", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->DownstreamSyncRate;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "EgressRate", TRUE))
+    {
+        /* collect value */
+        *puLong = pShaper->EgressRate;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "CapacitySignalPSD", TRUE))
+    if( AnscEqualString(ParamName, "IngressRate", TRUE))
     {
-        /* save update to backup */
-        AnscCopyString( pstSELTPTest->CapacitySignalPSD, pString );
+        /* collect value */
+        *puLong = pShaper->IngressRate;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "CapacityNoisePSD", TRUE))
+    if( AnscEqualString(ParamName, "Updates", TRUE))
     {
-        /* save update to backup */
-        AnscCopyString( pstSELTPTest->CapacityNoisePSD, pString );
+        /* collect value */
+        *puLong = pShaper->Updates;
         return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
@@ -4759,16 +7661,16 @@ SELTP_SetParamStringValue
     prototype:
 
         BOOL
-        SELTP_GetParamBoolValue
+        X_RDK_Shaper_SetParamUlongValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL*                       pBool
+                ULONG                       uValue
             );
 
     description:
 
-        This function is called to retrieve Boolean parameter value;
+        This function is called to set ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4776,39 +7678,74 @@ SELTP_SetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL*                       pBool
-                The buffer of returned boolean value;
+                ULONG                       uValue
+                The updated ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-SELTP_GetParamBoolValue
+X_RDK_Shaper_SetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL*                       pBool
+        ULONG                       uValue
     )
-{   
+{
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
 
-    if( AnscEqualString(ParamName, "CapacityEstimateEnabling", TRUE) )
+    /* check the parameter name and set the corresponding value */
+    if( AnscEqualString(ParamName, "Percent", TRUE))
     {
-        *pBool = pstSELTPTest->CapacityEstimateEnabling;
-    
+        pShaper->Percent = uValue;
+        pShaper->bConfigChanged = TRUE;
         return TRUE;
     }
-   
-    if( AnscEqualString(ParamName, "MissingFilter", TRUE) )
+
+    if( AnscEqualString(ParamName, "PacketSize", TRUE))
     {
-        *pBool = pstSELTPTest->MissingFilter;
-    
+        pShaper->PacketSize = uValue;
+        pShaper->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    /* AnscTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    if( AnscEqualString(ParamName, "ATMOverhead", TRUE))
+    {
+        pShaper->ATMOverhead = uValue;
+        pShaper->bConfigChanged = TRUE;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "PTMOverhead", TRUE))
+    {
+        pShaper->PTMOverhead = uValue;
+        pShaper->bConfigChanged = TRUE;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "CheckInterval", TRUE))
+    {
+        pShaper->CheckInterval = uValue;
+        pShaper->bConfigChanged = TRUE;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "EgressShaper", TRUE))
+    {
+        pShaper->EgressShaper = uValue;
+        pShaper->bConfigChanged = TRUE;
+        return TRUE;
+    }
+
+    if( AnscEqualString(ParamName, "IngressShaper", TRUE))
+    {
+        pShaper->IngressShaper = uValue;
+        pShaper->bConfigChanged = TRUE;
+        return TRUE;
+    }
+
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
@@ -4818,17 +7755,18 @@ SELTP_GetParamBoolValue
 
     prototype:
 
-        BOOL
-        SELTP_SetParamBoolValue
+        ULONG
+        X_RDK_Shaper_GetParamStringValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL                        bValue
+                char*                       pValue,
+                ULONG*                      pUlSize
             );
 
     description:
 
-        This function is called to set BOOL parameter value;
+        This function is called to retrieve string parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -4836,34 +7774,54 @@ SELTP_GetParamBoolValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL                        bValue
-                The updated BOOL value;
+                char*                       pValue,
+                The string value buffer;
 
-    return:     TRUE if succeeded.
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
 
 **********************************************************************/
-BOOL
-SELTP_SetParamBoolValue
+ULONG
+X_RDK_Shaper_GetParamStringValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL                        bValue
+        char*                       pValue,
+        ULONG*                      pUlSize
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
 
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "CapacityEstimateEnabling", TRUE))
+    if( ANSC_STATUS_SUCCESS != DmlXdslGetShaperRates( pShaper ) )
     {
-        pstSELTPTest->CapacityEstimateEnabling  = bValue;
+        return -1;
+    }
 
-        return TRUE;
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Encapsulation", TRUE) )
+    {
+       /* collect value */
+       if ( ( sizeof( pShaper->Encapsulation ) - 1 ) < *pUlSize )
+       {
+           AnscCopyString( pValue, pShaper->Encapsulation );
+           return 0;
+       }
+       else
+       {
+           *pUlSize = sizeof( pShaper->Encapsulation );
+           return 1;
+       }
     }
 
     /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return -1;
 }
 
 /**********************************************************************
@@ -4873,145 +7831,208 @@ SELTP_SetParamBoolValue
     prototype:
 
         BOOL
-        SELTP_GetParamUlongValue
-            (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG*                      puLong
-            );
-
+        X_RDK_Shaper_Validate
+        (
+            ANSC_HANDLE                 hInsContext,
+            char*                       pReturnParamName,
+            ULONG*                      puLength
+        )
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to validate the update.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
+                char*                       pReturnParamName,
+                The buffer (128 bytes) of parameter name if there's a validation.
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                ULONG*                      puLength
+                The output length of the param name.
 
-    return:     TRUE if succeeded.
+    return:     TRUE if there's no validation.
 
 **********************************************************************/
 BOOL
-SELTP_GetParamUlongValue
+X_RDK_Shaper_Validate
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG*                      puLong
+        char*                       pReturnParamName,
+        ULONG*                      puLength
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
 
-    /* check the parameter name and set the corresponding value */
-    if( AnscEqualString(ParamName, "DiagnosticsState", TRUE) )
+    if( FALSE == pShaper->bConfigChanged )
     {
-        *puLong = pstSELTPTest->DiagnosticsState;
         return TRUE;
     }
 
-    if( AnscEqualString(ParamName, "CapacityTargetMargin", TRUE) )
+    if( ( 0 == pShaper->Percent ) || ( 100 < pShaper->Percent ) )
     {
-        *puLong = pstSELTPTest->CapacityTargetMargin;
-        return TRUE;
+        AnscCopyString(pReturnParamName, "Percent");
+        *puLength = AnscSizeOfString("Percent");
+        return FALSE;
     }
 
-    if( AnscEqualString(ParamName, "LoopLength", TRUE) )
+    if( ( 64 > pShaper->PacketSize ) || ( 9216 < pShaper->PacketSize ) )
     {
-        *puLong = pstSELTPTest->LoopLength;
-        return TRUE;
+        AnscCopyString(pReturnParamName, "PacketSize");
+        *puLength = AnscSizeOfString("PacketSize");
+        return FALSE;
     }
-    
-    if( AnscEqualString(ParamName, "CapacityEstimate", TRUE) )
-    {   
-        *puLong = pstSELTPTest->CapacityEstimate;
-        return TRUE;
+
+    if( 256 < pShaper->ATMOverhead )
+    {
+        AnscCopyString(pReturnParamName, "ATMOverhead");
+        *puLength = AnscSizeOfString("ATMOverhead");
+        return FALSE;
     }
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+
+    if( 256 < pShaper->PTMOverhead )
+    {
+        AnscCopyString(pReturnParamName, "PTMOverhead");
+        *puLength = AnscSizeOfString("PTMOverhead");
+        return FALSE;
+    }
+
+    if( 0 == pShaper->CheckInterval )
+    {
+        AnscCopyString(pReturnParamName, "CheckInterval");
+        *puLength = AnscSizeOfString("CheckInterval");
+        return FALSE;
+    }
+
+    return TRUE;
 }
 
 /**********************************************************************
-
     caller:     owner of this object
 
     prototype:
-
-        BOOL
-        SELTP_SetParamUlongValue
+        ULONG
+        X_RDK_Shaper_Commit
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG                       uValue
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
-
-        This function is called to set ULONG parameter value;
+        This function is called to finally commit all the update.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
-
-                ULONG                       uValue
-                The updated ULONG value;
-
-    return:     TRUE if succeeded.
-
+    return:     The status of the operation.
 **********************************************************************/
-BOOL
-SELTP_SetParamUlongValue
+ULONG
+X_RDK_Shaper_Commit
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG                       uValue
+        ANSC_HANDLE                 hInsContext
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_DIAGNOSTICS_FULL       pDSLDiag         = (PDML_XDSL_DIAGNOSTICS_FULL)pMyObject->pDSLDiag;
-    PDML_XDSL_DIAG_SELTP             pstSELTPTest     = (PDML_XDSL_DIAG_SELTP)&(pDSLDiag->stDiagSELTP);
-  
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "DiagnosticsState", TRUE))
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
+
+    if( TRUE == pShaper->bConfigChanged )
     {
-        pstSELTPTest->DiagnosticsState = uValue;
+        if( ANSC_STATUS_SUCCESS != DmlXdslSetShaperConfig( pShaper ) )
+        {
+            DmlXdslGetShaperConfig( pShaper );
+            return -1;
+        }
 
-        return TRUE;
+        pShaper->bConfigChanged = FALSE;
     }
 
-    if(AnscEqualString(ParamName, "CapacityTargetMargin", TRUE))
-    {
-        pstSELTPTest->CapacityTargetMargin = uValue;
+    return 0;
+}
 
-        return TRUE;
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+        ULONG
+        X_RDK_Shaper_Rollback
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+        This function is called to roll back the update whenever there's a
+        validation found.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+X_RDK_Shaper_Rollback
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_SHAPER           pShaper          = (PDML_XDSL_X_RDK_SHAPER)pMyObject->pDSLShaper;
+
+    if( TRUE == pShaper->bConfigChanged )
+    {
+        DmlXdslGetShaperConfig( pShaper );
     }
 
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return 0;
 }
 
-
 /***********************************************************************
 
- APIs for Object:
+    Device.DSL.X_RDK_TCA.Profile.{i}.
+
+    *  X_RDK_TCA_Profile_GetEntryCount
+    *  X_RDK_TCA_Profile_GetEntry
+    *  X_RDK_TCA_Profile_GetParamBoolValue
+    *  X_RDK_TCA_Profile_SetParamBoolValue
+    *  X_RDK_TCA_Profile_GetParamIntValue
+    *  X_RDK_TCA_Profile_SetParamIntValue
+    *  X_RDK_TCA_Profile_GetParamUlongValue
+    *  X_RDK_TCA_Profile_SetParamUlongValue
+    *  X_RDK_TCA_Profile_GetParamStringValue
+    *  X_RDK_TCA_Profile_SetParamStringValue
+    *  X_RDK_TCA_Profile_Validate
+    *  X_RDK_TCA_Profile_Commit
+    *  X_RDK_TCA_Profile_Rollback
 
-    Device.DSL.X_RDK_Report.DSL
+***********************************************************************/
+/**********************************************************************
 
-    *  X_RDK_Report_DSL_GetParamUlongValue
-    *  X_RDK_Report_DSL_SetParamUlongValue
-    *  X_RDK_Report_DSL_GetParamStringValue
-    *  X_RDK_Report_DSL_GetParamBoolValue
-    *  X_RDK_Report_DSL_SetParamBoolValue
+    caller:     owner of this object
+
+    prototype:
+
+        ULONG
+        X_RDK_TCA_Profile_GetEntryCount
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+
+        This function is called to retrieve the count of the table.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
 
-***********************************************************************/
+    return:     The count of the table
 
+**********************************************************************/
+ULONG
+X_RDK_TCA_Profile_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    )
+{
+    return XDSL_TCA_MAX_PROFILES;
+}
 
 /**********************************************************************
 
@@ -5019,51 +8040,59 @@ SELTP_SetParamUlongValue
 
     prototype:
 
-        BOOL
-        X_RDK_Report_DSL_GetParamUlongValue
+        ANSC_HANDLE
+        X_RDK_TCA_Profile_GetEntry
             (
                 ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG*                      puLong
+                ULONG                       nIndex,
+                ULONG*                      pInsNumber
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to retrieve the entry specified by the index.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
+                ULONG                       nIndex,
+                The index of this entry;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                ULONG*                      pInsNumber
+                The output instance number;
 
-    return:     TRUE if succeeded.
+    return:     The handle to identify the entry
 
 **********************************************************************/
-BOOL
-X_RDK_Report_DSL_GetParamUlongValue
+ANSC_HANDLE
+X_RDK_TCA_Profile_GetEntry
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG*                      puLong
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
     )
 {
     PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    PDML_XDSL_X_RDK_TCA              pTca             = (PDML_XDSL_X_RDK_TCA)pMyObject->pDSLTca;
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE) && (puLong != NULL))
+    if ( ( pTca ) && ( nIndex < XDSL_TCA_MAX_PROFILES ) )
     {
-        *puLong = pXdslReport->ReportingPeriod;
-        return TRUE;
+        *pInsNumber = nIndex + 1;
+
+        return &pTca->stProfile[nIndex];
     }
 
-    return FALSE;
+    return NULL; /* return the invlalid handle */
 }
 
+/* Index of the profile entry, the entries are an array in X_RDK_TCA */
+static INT X_RDK_TCA_Profile_Index( PDML_XDSL_TCA_PROFILE pProfile )
+{
+    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
+    PDML_XDSL_X_RDK_TCA              pTca             = (PDML_XDSL_X_RDK_TCA)pMyObject->pDSLTca;
+
+    return (INT)( pProfile - pTca->stProfile );
+}
 
 /**********************************************************************
 
@@ -5072,16 +8101,16 @@ X_RDK_Report_DSL_GetParamUlongValue
     prototype:
 
         BOOL
-        X_RDK_Report_DSL_SetParamUlongValue
+        X_RDK_TCA_Profile_GetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG                       uValue
+                BOOL*                       pBool
             );
 
     description:
 
-        This function is called to set ULONG parameter value;
+        This function is called to retrieve Boolean parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -5089,53 +8118,58 @@ X_RDK_Report_DSL_GetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG                       uValue
-                The updated ULONG value;
+                BOOL*                       pBool
+                The buffer of returned boolean value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-X_RDK_Report_DSL_SetParamUlongValue
+X_RDK_TCA_Profile_GetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG                       uValue
+        BOOL*                       pBool
     )
 {
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Enable", TRUE))
+    {
+        /* collect value */
+        *pBool = pProfile->Enable;
+        return TRUE;
+    }
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE))
+    if( AnscEqualString(ParamName, "Raised", TRUE))
     {
-        pXdslReport->bReportingPeriodChanged = TRUE;
-        pXdslReport->ReportingPeriod = uValue;
+        /* collect value */
+        *pBool = XdslTcaIsRaised( X_RDK_TCA_Profile_Index( pProfile ) );
         return TRUE;
     }
 
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-/**********************************************************************  
+/**********************************************************************
 
-    caller:     owner of this object 
+    caller:     owner of this object
 
-    prototype: 
+    prototype:
 
-        ULONG
-        X_RDK_Report_DSL_GetParamStringValue
+        BOOL
+        X_RDK_TCA_Profile_SetParamBoolValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                char*                       pValue,
-                ULONG*                      pUlSize
+                BOOL                        bValue
             );
 
     description:
 
-        This function is called to retrieve string parameter value; 
+        This function is called to set BOOL parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -5143,102 +8177,50 @@ X_RDK_Report_DSL_SetParamUlongValue
                 char*                       ParamName,
                 The parameter name;
 
-                char*                       pValue,
-                The string value buffer;
-
-                ULONG*                      pUlSize
-                The buffer of length of string value;
-                Usually size of 1023 will be used.
-                If it's not big enough, put required size here and return 1;
+                BOOL                        bValue
+                The updated BOOL value;
 
-    return:     0 if succeeded;
-                1 if short of buffer size; (*pUlSize = required size)
-                -1 if not supported.
+    return:     TRUE if succeeded.
 
 **********************************************************************/
-ULONG
-X_RDK_Report_DSL_GetParamStringValue
+BOOL
+X_RDK_TCA_Profile_SetParamBoolValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        char*                       pValue,
-        ULONG*                      pUlSize
+        BOOL                        bValue
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL 			 pXdslReport 	  = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "Schema", TRUE))
+    if( AnscEqualString(ParamName, "Enable", TRUE))
     {
-        /* collect value */
-        int bufsize = XdslReportGetSchemaBufferSize();
-        if(!bufsize)
-        {
-            char result[1024] = "Schema Buffer is empty";
-            AnscCopyString(pValue, (char*)&result);
-            return FALSE;
-        }
-        else
-        {
-            if (bufsize < *pUlSize)
-            {
-                AnscCopyString(pValue, XdslReportGetSchemaBuffer());
-                return FALSE;
-            }
-            else
-            {
-                *pUlSize = bufsize + 1;
-                return TRUE;
-            }
-        }
+        pProfile->Enable = bValue;
+        pProfile->bConfigChanged = TRUE;
+        return TRUE;
     }
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "SchemaID", TRUE))
-    {
-        /* collect value */
-        int bufsize = XdslReportGetSchemaIDBufferSize();
-        if(!bufsize)
-        {
-            char result[1024] = "Schema Buffer is empty";
-            AnscCopyString(pValue, (char*)&result);
-            return FALSE;
-        }
-        else
-        {
-            if (bufsize < *pUlSize)
-            {
-                AnscCopyString(pValue, XdslReportGetSchemaIDBuffer());
-                return FALSE;
-            }
-            else
-            {
-                *pUlSize = bufsize + 1;
-                return TRUE;
-            }
-        }
-    }
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-/**********************************************************************  
+/**********************************************************************
 
-    caller:     owner of this object 
+    caller:     owner of this object
 
-    prototype: 
+    prototype:
 
         BOOL
-        X_RDK_Report_DSL_GetParamBoolValue
+        X_RDK_TCA_Profile_GetParamIntValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL*                       pBool
+                int*                        pInt
             );
 
     description:
 
-        This function is called to retrieve Boolean parameter value; 
+        This function is called to retrieve integer parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -5246,50 +8228,51 @@ X_RDK_Report_DSL_GetParamStringValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL*                       pBool
-                The buffer of returned boolean value;
+                int*                        pInt
+                The buffer of returned integer value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-X_RDK_Report_DSL_GetParamBoolValue
+X_RDK_TCA_Profile_GetParamIntValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL*                       pBool
+        int*                        pInt
     )
 {
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
-
-    if(AnscEqualString(ParamName, "Enabled", TRUE) && (pBool != NULL))
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Threshold", TRUE))
     {
-        *pBool = pXdslReport->Enabled;
+        /* collect value */
+        *pInt = pProfile->Threshold;
         return TRUE;
     }
 
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-/**********************************************************************  
+/**********************************************************************
 
-    caller:     owner of this object 
+    caller:     owner of this object
 
-    prototype: 
+    prototype:
 
         BOOL
-        X_RDK_Report_DSL_SetParamBoolValue
+        X_RDK_TCA_Profile_SetParamIntValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                BOOL                        bValue
+                int                         iValue
             );
 
     description:
 
-        This function is called to set BOOL parameter value; 
+        This function is called to set integer parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -5297,35 +8280,33 @@ X_RDK_Report_DSL_GetParamBoolValue
                 char*                       ParamName,
                 The parameter name;
 
-                BOOL                        bValue
-                The updated BOOL value;
+                int                         iValue
+                The updated integer value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-X_RDK_Report_DSL_SetParamBoolValue
+X_RDK_TCA_Profile_SetParamIntValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        BOOL                        bValue
+        int                         iValue
     )
 {
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL 			 pXdslReport 	  = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
-
-    if(AnscEqualString(ParamName, "Enabled", TRUE))
+    if( AnscEqualString(ParamName, "Threshold", TRUE))
     {
-        pXdslReport->Enabled = bValue;
-        pXdslReport->bEnableChanged = TRUE;
+        pProfile->Threshold = iValue;
+        pProfile->bConfigChanged = TRUE;
         return TRUE;
     }
 
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-
 /**********************************************************************
 
     caller:     owner of this object
@@ -5333,15 +8314,16 @@ X_RDK_Report_DSL_SetParamBoolValue
     prototype:
 
         BOOL
-        X_RDK_Report_DSL_Validate
-        (
-            ANSC_HANDLE                 hInsContext,
-            char*                       pReturnParamName,
-            ULONG*                      puLength
-        )
+        X_RDK_TCA_Profile_GetParamUlongValue
+            (
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG*                      puLong
+            );
+
     description:
 
-        This function is called to set ULONG parameter value;
+        This function is called to retrieve ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -5349,126 +8331,159 @@ X_RDK_Report_DSL_SetParamBoolValue
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG                       uValue
-                The updated ULONG value;
+                ULONG*                      puLong
+                The buffer of returned ULONG value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
-
 BOOL
-X_RDK_Report_DSL_Validate
+X_RDK_TCA_Profile_GetParamUlongValue
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       pReturnParamName,
-        ULONG*                      puLength
+        char*                       ParamName,
+        ULONG*                      puLong
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    if (pXdslReport->bReportingPeriodChanged)
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Hysteresis", TRUE))
     {
-            BOOL validated = XdslReportValidateReportingPeriod(pXdslReport->ReportingPeriod);    
-            if(!validated)
-            {
-                AnscCopyString(pReturnParamName, "ReportingPeriod");
-                *puLength = AnscSizeOfString("ReportingPeriod");
-                return FALSE;
-            }
+        /* collect value */
+        *puLong = pProfile->Hysteresis;
+        return TRUE;
     }
-    return TRUE;
-}
 
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
 
 /**********************************************************************
+
     caller:     owner of this object
 
     prototype:
-        ULONG
-        X_RDK_Report_DSL_Commit
+
+        BOOL
+        X_RDK_TCA_Profile_SetParamUlongValue
             (
-                ANSC_HANDLE                 hInsContext
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                ULONG                       uValue
             );
 
     description:
-        This function is called to finally commit all the update.
+
+        This function is called to set ULONG parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-    return:     The status of the operation.
+                char*                       ParamName,
+                The parameter name;
+
+                ULONG                       uValue
+                The updated ULONG value;
+
+    return:     TRUE if succeeded.
+
 **********************************************************************/
-ULONG
-X_RDK_Report_DSL_Commit
+BOOL
+X_RDK_TCA_Profile_SetParamUlongValue
     (
-        ANSC_HANDLE                 hInsContext
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
-    ULONG psmValue = 0;
-    
-    if (pXdslReport->bEnableChanged)
-    {
-        XdslReportSetStatus(pXdslReport->Enabled);
-        pXdslReport->bEnableChanged = false;
-        psmValue = pXdslReport->Enabled;
-        SetNVRamULONGConfiguration (XdslReportStatusEnable, psmValue); 
-    }
-    
-    if (pXdslReport->bReportingPeriodChanged)
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
+
+    if( AnscEqualString(ParamName, "Hysteresis", TRUE))
     {
-        XdslReportSetReportingPeriod(pXdslReport->ReportingPeriod);
-        pXdslReport->bReportingPeriodChanged = false;
-        psmValue = pXdslReport->ReportingPeriod;
-        SetNVRamULONGConfiguration (XdslReportStatusReportingPeriod, psmValue); 
+        pProfile->Hysteresis = uValue;
+        pProfile->bConfigChanged = TRUE;
+        return TRUE;
     }
-    return 0;
-}
 
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+    return FALSE;
+}
 
 /**********************************************************************
+
     caller:     owner of this object
 
     prototype:
+
         ULONG
-        X_RDK_Report_DSL_Rollback
+        X_RDK_TCA_Profile_GetParamStringValue
             (
-                ANSC_HANDLE                 hInsContext
+                ANSC_HANDLE                 hInsContext,
+                char*                       ParamName,
+                char*                       pValue,
+                ULONG*                      pUlSize
             );
 
     description:
-        This function is called to finally commit all the update.
+
+        This function is called to retrieve string parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-    return:     The status of the operation.
-**********************************************************************/
+                char*                       ParamName,
+                The parameter name;
+
+                char*                       pValue,
+                The string value buffer;
 
+                ULONG*                      pUlSize
+                The buffer of length of string value;
+                Usually size of 1023 will be used.
+                If it's not big enough, put required size here and return 1;
+
+    return:     0 if succeeded;
+                1 if short of buffer size; (*pUlSize = required size)
+                -1 if not supported.
+
+**********************************************************************/
 ULONG
-X_RDK_Report_DSL_Rollback
-(
-    ANSC_HANDLE                 hInsContext
-)
+X_RDK_TCA_Profile_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
+    char*                            pString          = NULL;
 
-    if (pXdslReport->bEnableChanged)
+    /* check the parameter name and return the corresponding value */
+    if( AnscEqualString(ParamName, "Counter", TRUE) )
     {
-        pXdslReport->Enabled = XdslReportGetStatus();
-        pXdslReport->bEnableChanged = false;
+        pString = pProfile->Counter;
     }
-    
-    if (pXdslReport->bReportingPeriodChanged)
+    else if( AnscEqualString(ParamName, "Interval", TRUE) )
     {
-        pXdslReport->ReportingPeriod = XdslReportGetReportingPeriod();
-        pXdslReport->bReportingPeriodChanged = false;
+        pString = pProfile->Interval;
+    }
+    else
+    {
+        /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
+        return -1;
     }
 
-    return 0;
+    /* collect value */
+    if ( AnscSizeOfString( pString ) < *pUlSize )
+    {
+        AnscCopyString( pValue, pString );
+        return 0;
+    }
+
+    *pUlSize = AnscSizeOfString( pString ) + 1;
+    return 1;
 }
 
 /**********************************************************************
@@ -5478,16 +8493,16 @@ X_RDK_Report_DSL_Rollback
     prototype:
 
         BOOL
-        X_RDK_Report_DSL_Default_GetParamUlongValue
+        X_RDK_TCA_Profile_SetParamStringValue
             (
                 ANSC_HANDLE                 hInsContext,
                 char*                       ParamName,
-                ULONG*                      puLong
+                char*                       pString
             );
 
     description:
 
-        This function is called to retrieve ULONG parameter value;
+        This function is called to set string parameter value;
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
@@ -5495,44 +8510,40 @@ X_RDK_Report_DSL_Rollback
                 char*                       ParamName,
                 The parameter name;
 
-                ULONG*                      puLong
-                The buffer of returned ULONG value;
+                char*                       pString
+                The updated string value;
 
     return:     TRUE if succeeded.
 
 **********************************************************************/
 BOOL
-X_RDK_Report_DSL_Default_GetParamUlongValue
+X_RDK_TCA_Profile_SetParamStringValue
     (
         ANSC_HANDLE                 hInsContext,
         char*                       ParamName,
-        ULONG*                      puLong
+        char*                       pString
     )
 {
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
-    PDML_X_RDK_REPORT_DSL_DEFAULT    pXdslReportDflt  = (PDML_X_RDK_REPORT_DSL_DEFAULT)pXdslReport->pDSLDefaultReport;
-
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "OverrideTTL", TRUE) && (puLong != NULL))
+    if( AnscEqualString(ParamName, "Counter", TRUE) )
     {
-        pXdslReportDflt->OverrideTTL = XdslReportGetDefaultOverrideTTL();
-        *puLong = pXdslReportDflt->OverrideTTL;
+        snprintf( pProfile->Counter, sizeof(pProfile->Counter), "%s", pString );
+        pProfile->bConfigChanged = TRUE;
         return TRUE;
     }
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE) && (puLong != NULL))
+    if( AnscEqualString(ParamName, "Interval", TRUE) )
     {
-        *puLong = pXdslReportDflt->ReportingPeriod;
+        snprintf( pProfile->Interval, sizeof(pProfile->Interval), "%s", pString );
+        pProfile->bConfigChanged = TRUE;
         return TRUE;
     }
 
+    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
     return FALSE;
 }
 
-
 /**********************************************************************
 
     caller:     owner of this object
@@ -5540,157 +8551,132 @@ X_RDK_Report_DSL_Default_GetParamUlongValue
     prototype:
 
         BOOL
-    X_RDK_Report_DSL_Default_SetParamUlongValue
-            (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                ULONG                       uValue
-            );
-
+        X_RDK_TCA_Profile_Validate
+        (
+            ANSC_HANDLE                 hInsContext,
+            char*                       pReturnParamName,
+            ULONG*                      puLength
+        )
     description:
 
-        This function is called to set ULONG parameter value;
+        This function is called to validate the update.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
+                char*                       pReturnParamName,
+                The buffer (128 bytes) of parameter name if there's a validation.
 
-                ULONG                       uValue
-                The updated ULONG value;
+                ULONG*                      puLength
+                The output length of the param name.
 
-    return:     TRUE if succeeded.
+    return:     TRUE if there's no validation.
 
 **********************************************************************/
 BOOL
-X_RDK_Report_DSL_Default_SetParamUlongValue
+X_RDK_TCA_Profile_Validate
     (
         ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        ULONG                       uValue
+        char*                       pReturnParamName,
+        ULONG*                      puLength
     )
 {
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_X_RDK_REPORT_DSL            pXdslReport      = (PDML_X_RDK_REPORT_DSL)pMyObject->pDSLReport; 
-    PDML_X_RDK_REPORT_DSL_DEFAULT    pXdslReportDflt  = (PDML_X_RDK_REPORT_DSL_DEFAULT)pXdslReport->pDSLDefaultReport;
-
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "OverrideTTL", TRUE))
+    if( FALSE == pProfile->bConfigChanged )
     {
-        pXdslReportDflt->OverrideTTL = uValue;
-        XdslReportSetDefaultOverrideTTL (uValue);
         return TRUE;
     }
 
-    /* check the parameter name and set the corresponding value */
-    if(AnscEqualString(ParamName, "ReportingPeriod", TRUE)) 
+    if( 0 > XdslTcaCounterFromName( pProfile->Counter ) )
     {
-        if (!XdslReportValidateReportingPeriod(uValue))
-        {
-            return FALSE;
-        }
-        ULONG psmValue = 0;
-        pXdslReportDflt->ReportingPeriod = uValue;
-        psmValue = pXdslReportDflt->ReportingPeriod;
-        XdslReportSetDefaultReportingPeriod (uValue);
-        SetNVRamULONGConfiguration (XdslReportStatusDfltReportingPeriod, psmValue); 
-        return TRUE;
+        AnscCopyString(pReturnParamName, "Counter");
+        *puLength = AnscSizeOfString("Counter");
+        return FALSE;
     }
 
-    return FALSE;
-}
-
-ANSC_STATUS GetNVRamULONGConfiguration(char* setting, ULONG* value)
-{
-    char *strValue = NULL;
-    int retPsmGet = 0;
-    
-    retPsmGet = PSM_Get_Record_Value2(bus_handle,g_Subsystem, setting, NULL, &strValue);
-    if (retPsmGet == CCSP_SUCCESS) 
+    if( 0 > XdslTcaIntervalFromName( pProfile->Interval ) )
     {
-        *value = _ansc_atoi(strValue);
-        ((CCSP_MESSAGE_BUS_INFO *)bus_handle)->freefunc(strValue);
+        AnscCopyString(pReturnParamName, "Interval");
+        *puLength = AnscSizeOfString("Interval");
+        return FALSE;
     }
-    return retPsmGet;
+
+    return TRUE;
 }
 
-ANSC_STATUS SetNVRamULONGConfiguration (char * setting, ULONG value)
+/**********************************************************************
+    caller:     owner of this object
+
+    prototype:
+        ULONG
+        X_RDK_TCA_Profile_Commit
+            (
+                ANSC_HANDLE                 hInsContext
+            );
+
+    description:
+        This function is called to finally commit all the update.
+
+    argument:   ANSC_HANDLE                 hInsContext,
+                The instance handle;
+
+    return:     The status of the operation.
+**********************************************************************/
+ULONG
+X_RDK_TCA_Profile_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    )
 {
-    int retPsmSet = 0;
-    char psmValue[32] = {};
-    ULONG psm_value = 0;
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
+    INT                              iIndex           = X_RDK_TCA_Profile_Index( pProfile );
 
-    retPsmSet = GetNVRamULONGConfiguration(setting,&psm_value);
-    if ((retPsmSet == CCSP_SUCCESS) && (psm_value == value))
+    if( TRUE == pProfile->bConfigChanged )
     {
-        return retPsmSet;
+        if( ANSC_STATUS_SUCCESS != DmlXdslSetTcaProfile( iIndex, pProfile ) )
+        {
+            DmlXdslGetTcaProfile( iIndex, pProfile );
+            return -1;
+        }
+
+        pProfile->bConfigChanged = FALSE;
     }
 
-    sprintf(psmValue,"%d",value);
-    retPsmSet = PSM_Set_Record_Value2(bus_handle,g_Subsystem, setting, ccsp_string, psmValue);
-    return retPsmSet;
+    return 0;
 }
 
-/***********************************************************************
-
-    Device.DSL.X_RDK_NLNM.
-
-    *  X_RDK_NLNM_GetParamIntValue
-
-***********************************************************************/
 /**********************************************************************
     caller:     owner of this object
 
     prototype:
-
-        BOOL
-        X_RDK_NLNM_GetParamIntValue 
+        ULONG
+        X_RDK_TCA_Profile_Rollback
             (
-                ANSC_HANDLE                 hInsContext,
-                char*                       ParamName,
-                int*                        pInt
+                ANSC_HANDLE                 hInsContext
             );
 
     description:
-
-        This function is called to retrieve integer parameter value;
+        This function is called to roll back the update whenever there's a
+        validation found.
 
     argument:   ANSC_HANDLE                 hInsContext,
                 The instance handle;
 
-                char*                       ParamName,
-                The parameter name;
-
-                int*                        pInt
-                The buffer of returned integer value;
-
-    return:     TRUE if succeeded.
-
+    return:     The status of the operation.
 **********************************************************************/
-BOOL
-X_RDK_NLNM_GetParamIntValue
+ULONG
+X_RDK_TCA_Profile_Rollback
     (
-        ANSC_HANDLE                 hInsContext,
-        char*                       ParamName,
-        int*                        pInt
+        ANSC_HANDLE                 hInsContext
     )
 {
-    PDATAMODEL_XDSL                  pMyObject        = (PDATAMODEL_XDSL)g_pBEManager->hDSL;
-    PDML_XDSL_X_RDK_NLNM             pXdslXRdkNlm     = (PDML_XDSL_X_RDK_NLNM)pMyObject->pDSLXRdkNlm;
+    PDML_XDSL_TCA_PROFILE            pProfile         = (PDML_XDSL_TCA_PROFILE)hInsContext;
 
-    if( ANSC_STATUS_FAILURE == DmlXdslGetXRDKNlm( pXdslXRdkNlm ))
+    if( TRUE == pProfile->bConfigChanged )
     {
-        return FALSE;
+        DmlXdslGetTcaProfile( X_RDK_TCA_Profile_Index( pProfile ), pProfile );
     }
 
-    if( AnscEqualString(ParamName, "echotonoiseratio", TRUE))
-    {
-        /* collect value */
-        *pInt = pXdslXRdkNlm->echotonoiseratio;
-        return TRUE;
-    }
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return 0;
 }
@@ -236,6 +236,118 @@ LineStatsQuarterHour_GetParamUlongValue
         char*                       ParamName,
         ULONG*                      puLong
     );
+
+/***********************************************************************
+
+ APIs for Object:
+
+    DSL.Line.{i}.X_RDK_PMHistory.QuarterHour.{i}.
+
+    *  LinePMHistoryQuarterHour_IsUpdated
+    *  LinePMHistoryQuarterHour_Synchronize
+    *  LinePMHistoryQuarterHour_GetEntryCount
+    *  LinePMHistoryQuarterHour_GetEntry
+    *  LinePMHistoryQuarterHour_GetParamBoolValue
+    *  LinePMHistoryQuarterHour_GetParamUlongValue
+
+***********************************************************************/
+BOOL
+LinePMHistoryQuarterHour_IsUpdated
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+LinePMHistoryQuarterHour_Synchronize
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+LinePMHistoryQuarterHour_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ANSC_HANDLE
+LinePMHistoryQuarterHour_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    );
+
+BOOL
+LinePMHistoryQuarterHour_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+LinePMHistoryQuarterHour_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+/***********************************************************************
+
+ APIs for Object:
+
+    DSL.Line.{i}.X_RDK_PMHistory.Day.{i}.
+
+    *  LinePMHistoryDay_IsUpdated
+    *  LinePMHistoryDay_Synchronize
+    *  LinePMHistoryDay_GetEntryCount
+    *  LinePMHistoryDay_GetEntry
+    *  LinePMHistoryDay_GetParamBoolValue
+    *  LinePMHistoryDay_GetParamUlongValue
+
+***********************************************************************/
+BOOL
+LinePMHistoryDay_IsUpdated
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+LinePMHistoryDay_Synchronize
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+LinePMHistoryDay_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ANSC_HANDLE
+LinePMHistoryDay_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    );
+
+BOOL
+LinePMHistoryDay_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+LinePMHistoryDay_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
 /***********************************************************************
 
  APIs for Object:
@@ -735,6 +847,8 @@ X_RDK_Report_DSL_Default_SetParamUlongValue
 
 ANSC_STATUS GetNVRamULONGConfiguration(char* setting, ULONG* value);
 ANSC_STATUS SetNVRamULONGConfiguration (char * setting, ULONG value);
+ANSC_STATUS GetNVRamStringConfiguration(char* setting, char* value, ULONG size);
+ANSC_STATUS SetNVRamStringConfiguration(char* setting, char* value);
 
 /***********************************************************************
  APIs for Object:
@@ -751,5 +865,522 @@ X_RDK_NLNM_GetParamIntValue
         char*                       ParamName,
         int*                        pInt
     );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_Perf.
+
+    *  X_RDK_Perf_GetParamBoolValue
+    *  X_RDK_Perf_SetParamBoolValue
+
+***********************************************************************/
+
+BOOL
+X_RDK_Perf_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+X_RDK_Perf_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_Perf.HalCall.{i}.
+
+    *  X_RDK_Perf_HalCall_GetEntryCount
+    *  X_RDK_Perf_HalCall_GetEntry
+    *  X_RDK_Perf_HalCall_GetParamUlongValue
+    *  X_RDK_Perf_HalCall_GetParamStringValue
+
+***********************************************************************/
+
+ULONG
+X_RDK_Perf_HalCall_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ANSC_HANDLE
+X_RDK_Perf_HalCall_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    );
+
+BOOL
+X_RDK_Perf_HalCall_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+ULONG
+X_RDK_Perf_HalCall_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_BringUp.
+
+    *  X_RDK_BringUp_GetParamBoolValue
+    *  X_RDK_BringUp_SetParamBoolValue
+
+***********************************************************************/
+
+BOOL
+X_RDK_BringUp_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+X_RDK_BringUp_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_BringUp.Phase.{i}.
+
+    *  X_RDK_BringUp_Phase_GetEntryCount
+    *  X_RDK_BringUp_Phase_GetEntry
+    *  X_RDK_BringUp_Phase_GetParamUlongValue
+    *  X_RDK_BringUp_Phase_GetParamStringValue
+
+***********************************************************************/
+
+ULONG
+X_RDK_BringUp_Phase_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ANSC_HANDLE
+X_RDK_BringUp_Phase_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    );
+
+BOOL
+X_RDK_BringUp_Phase_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+ULONG
+X_RDK_BringUp_Phase_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_BringUp.Trace.{i}.
+
+    *  X_RDK_BringUp_Trace_GetEntryCount
+    *  X_RDK_BringUp_Trace_GetEntry
+    *  X_RDK_BringUp_Trace_GetParamUlongValue
+    *  X_RDK_BringUp_Trace_GetParamStringValue
+
+***********************************************************************/
+
+ULONG
+X_RDK_BringUp_Trace_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ANSC_HANDLE
+X_RDK_BringUp_Trace_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    );
+
+BOOL
+X_RDK_BringUp_Trace_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+ULONG
+X_RDK_BringUp_Trace_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_FlapDamping.
+
+    *  X_RDK_FlapDamping_GetParamBoolValue
+    *  X_RDK_FlapDamping_SetParamBoolValue
+    *  X_RDK_FlapDamping_GetParamUlongValue
+    *  X_RDK_FlapDamping_SetParamUlongValue
+    *  X_RDK_FlapDamping_Validate
+    *  X_RDK_FlapDamping_Commit
+    *  X_RDK_FlapDamping_Rollback
+
+***********************************************************************/
+
+BOOL
+X_RDK_FlapDamping_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+X_RDK_FlapDamping_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    );
+
+BOOL
+X_RDK_FlapDamping_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+BOOL
+X_RDK_FlapDamping_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    );
+
+BOOL
+X_RDK_FlapDamping_Validate
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       pReturnParamName,
+        ULONG*                      puLength
+    );
+
+ULONG
+X_RDK_FlapDamping_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+X_RDK_FlapDamping_Rollback
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_TrainingHint.
+
+    *  X_RDK_TrainingHint_GetParamBoolValue
+    *  X_RDK_TrainingHint_SetParamBoolValue
+    *  X_RDK_TrainingHint_GetParamUlongValue
+    *  X_RDK_TrainingHint_SetParamUlongValue
+    *  X_RDK_TrainingHint_GetParamStringValue
+    *  X_RDK_TrainingHint_Validate
+    *  X_RDK_TrainingHint_Commit
+    *  X_RDK_TrainingHint_Rollback
+
+***********************************************************************/
+
+BOOL
+X_RDK_TrainingHint_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+X_RDK_TrainingHint_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    );
+
+BOOL
+X_RDK_TrainingHint_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+BOOL
+X_RDK_TrainingHint_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    );
+
+ULONG
+X_RDK_TrainingHint_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    );
+
+BOOL
+X_RDK_TrainingHint_Validate
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       pReturnParamName,
+        ULONG*                      puLength
+    );
+
+ULONG
+X_RDK_TrainingHint_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+X_RDK_TrainingHint_Rollback
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+/***********************************************************************
+ APIs for Object:
+    Device.DSL.X_RDK_Shaper.
+
+    *  X_RDK_Shaper_GetParamBoolValue
+    *  X_RDK_Shaper_SetParamBoolValue
+    *  X_RDK_Shaper_GetParamUlongValue
+    *  X_RDK_Shaper_SetParamUlongValue
+    *  X_RDK_Shaper_GetParamStringValue
+    *  X_RDK_Shaper_Validate
+    *  X_RDK_Shaper_Commit
+    *  X_RDK_Shaper_Rollback
+
+***********************************************************************/
+
+BOOL
+X_RDK_Shaper_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+X_RDK_Shaper_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    );
+
+BOOL
+X_RDK_Shaper_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+BOOL
+X_RDK_Shaper_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    );
+
+ULONG
+X_RDK_Shaper_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    );
+
+BOOL
+X_RDK_Shaper_Validate
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       pReturnParamName,
+        ULONG*                      puLength
+    );
+
+ULONG
+X_RDK_Shaper_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+X_RDK_Shaper_Rollback
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+/***********************************************************************
+
+    Device.DSL.X_RDK_TCA.Profile.{i}.
+
+    *  X_RDK_TCA_Profile_GetEntryCount
+    *  X_RDK_TCA_Profile_GetEntry
+    *  X_RDK_TCA_Profile_GetParamBoolValue
+    *  X_RDK_TCA_Profile_SetParamBoolValue
+    *  X_RDK_TCA_Profile_GetParamIntValue
+    *  X_RDK_TCA_Profile_SetParamIntValue
+    *  X_RDK_TCA_Profile_GetParamUlongValue
+    *  X_RDK_TCA_Profile_SetParamUlongValue
+    *  X_RDK_TCA_Profile_GetParamStringValue
+    *  X_RDK_TCA_Profile_SetParamStringValue
+    *  X_RDK_TCA_Profile_Validate
+    *  X_RDK_TCA_Profile_Commit
+    *  X_RDK_TCA_Profile_Rollback
+
+***********************************************************************/
+ULONG
+X_RDK_TCA_Profile_GetEntryCount
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ANSC_HANDLE
+X_RDK_TCA_Profile_GetEntry
+    (
+        ANSC_HANDLE                 hInsContext,
+        ULONG                       nIndex,
+        ULONG*                      pInsNumber
+    );
+
+BOOL
+X_RDK_TCA_Profile_GetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL*                       pBool
+    );
+
+BOOL
+X_RDK_TCA_Profile_SetParamBoolValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        BOOL                        bValue
+    );
+
+BOOL
+X_RDK_TCA_Profile_GetParamIntValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        int*                        pInt
+    );
+
+BOOL
+X_RDK_TCA_Profile_SetParamIntValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        int                         iValue
+    );
+
+BOOL
+X_RDK_TCA_Profile_GetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG*                      puLong
+    );
+
+BOOL
+X_RDK_TCA_Profile_SetParamUlongValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        ULONG                       uValue
+    );
+
+ULONG
+X_RDK_TCA_Profile_GetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pValue,
+        ULONG*                      pUlSize
+    );
+
+BOOL
+X_RDK_TCA_Profile_SetParamStringValue
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       ParamName,
+        char*                       pString
+    );
+
+BOOL
+X_RDK_TCA_Profile_Validate
+    (
+        ANSC_HANDLE                 hInsContext,
+        char*                       pReturnParamName,
+        ULONG*                      puLength
+    );
+
+ULONG
+X_RDK_TCA_Profile_Commit
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+
+ULONG
+X_RDK_TCA_Profile_Rollback
+    (
+        ANSC_HANDLE                 hInsContext
+    );
+ANSC_STATUS
+XdslDmlInitParamTables
+    (
+        VOID
+    );
+
 #endif /* _COSA_XDSL_DML_H */
 
@@ -34,9 +34,16 @@
     PDML_XDSL_LINE                  pXDSLLine;                                                   \
     UINT                                ulTotalNoofDSLChannels;                                       \
     PDML_XDSL_CHANNEL               pDSLChannel;                                                   \
+    PDML_XDSL_CHANNEL_SNAPSHOT      pDSLChannelSnapshot;                                           \
     PDML_XDSL_DIAGNOSTICS_FULL      pDSLDiag;                                                   \
     PDML_X_RDK_REPORT_DSL           pDSLReport;                                                   \
-    PDML_XDSL_X_RDK_NLNM            pDSLXRdkNlm;
+    PDML_XDSL_X_RDK_NLNM            pDSLXRdkNlm;                                                   \
+    PDML_XDSL_X_RDK_PERF            pDSLPerf;                                                   \
+    PDML_XDSL_X_RDK_BRINGUP         pDSLBringUp;                                                   \
+    PDML_XDSL_X_RDK_FLAP_DAMPING    pDSLFlapDamping;                                                   \
+    PDML_XDSL_X_RDK_TRAINING_HINT   pDSLTrainingHint;                                                   \
+    PDML_XDSL_X_RDK_SHAPER          pDSLShaper;                                                   \
+    PDML_XDSL_X_RDK_TCA             pDSLTca;
 
 typedef  struct
 _DATAMODEL_DSL                                               
@@ -37,7 +37,9 @@
 #include "xtm_apis.h"
 #include "plugin_main_apis.h"
 #include "xtm_internal.h"
+#include "dml_param_table.h"
 #include "ccsp_psm_helper.h"
+#include "xdsl_psm_cache.h"
 
 #if     CFG_USE_CCSP_SYSLOG
     #include <ccsp_syslog.h>
@@ -58,9 +60,91 @@
 extern char                g_Subsystem[32];
 extern ANSC_HANDLE         bus_handle;
 
+/* Parameter name tables for the getters whose parameters map 1:1 onto a
+ * backend structure member, see dml_param_table.h */
+static const DML_PARAM_ENTRY g_PtmLinkStatsParamEntries[] =
+{
+    DML_PARAM( "BytesSent",                   DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.BytesSent ),
+    DML_PARAM( "BytesReceived",               DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.BytesReceived ),
+    DML_PARAM( "PacketsSent",                 DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.PacketsSent ),
+    DML_PARAM( "PacketsReceived",             DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.PacketsReceived ),
+    DML_PARAM( "ErrorsSent",                  DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.ErrorsSent ),
+    DML_PARAM( "ErrorsReceived",              DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.ErrorsReceived ),
+    DML_PARAM( "UnicastPacketsSent",          DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.UnicastPacketsSent ),
+    DML_PARAM( "UnicastPacketsReceived",      DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.UnicastPacketsReceived ),
+    DML_PARAM( "DiscardPacketsSent",          DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.DiscardPacketsSent ),
+    DML_PARAM( "DiscardPacketsReceived",      DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.DiscardPacketsReceived ),
+    DML_PARAM( "MulticastPacketsSent",        DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.MulticastPacketsSent ),
+    DML_PARAM( "MulticastPacketsReceived",    DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.MulticastPacketsReceived ),
+    DML_PARAM( "BroadcastPacketsSent",        DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.BroadcastPacketsSent ),
+    DML_PARAM( "BroadcastPacketsReceived",    DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.BroadcastPacketsReceived ),
+    DML_PARAM( "UnknownProtoPacketsReceived", DML_PARAM_KIND_UNSIGNED, DML_PTM, Statistics.UnknownProtoPacketsReceived )
+};
+static DML_PARAM_TABLE g_PtmLinkStatsParamTable = DML_PARAM_TABLE_INIT( g_PtmLinkStatsParamEntries );
+
+static const DML_PARAM_ENTRY g_AtmLinkStatsParamEntries[] =
+{
+    DML_PARAM( "BytesSent",                   DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.BytesSent ),
+    DML_PARAM( "BytesReceived",               DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.BytesReceived ),
+    DML_PARAM( "PacketsSent",                 DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.PacketsSent ),
+    DML_PARAM( "PacketsReceived",             DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.PacketsReceived ),
+    DML_PARAM( "ErrorsSent",                  DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.ErrorsSent ),
+    DML_PARAM( "ErrorsReceived",              DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.ErrorsReceived ),
+    DML_PARAM( "UnicastPacketsSent",          DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.UnicastPacketsSent ),
+    DML_PARAM( "UnicastPacketsReceived",      DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.UnicastPacketsReceived ),
+    DML_PARAM( "DiscardPacketsSent",          DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.DiscardPacketsSent ),
+    DML_PARAM( "DiscardPacketsReceived",      DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.DiscardPacketsReceived ),
+    DML_PARAM( "MulticastPacketsSent",        DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.MulticastPacketsSent ),
+    DML_PARAM( "MulticastPacketsReceived",    DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.MulticastPacketsReceived ),
+    DML_PARAM( "BroadcastPacketsSent",        DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.BroadcastPacketsSent ),
+    DML_PARAM( "BroadcastPacketsReceived",    DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.BroadcastPacketsReceived ),
+    DML_PARAM( "UnknownProtoPacketsReceived", DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.UnknownProtoPacketsReceived ),
+    DML_PARAM( "TransmittedBlocks",           DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.TransmittedBlocks ),
+    DML_PARAM( "ReceivedBlocks",              DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.ReceivedBlocks ),
+    DML_PARAM( "CRCErrors",                   DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.CRCErrors ),
+    DML_PARAM( "HECErrors",                   DML_PARAM_KIND_UNSIGNED, DML_ATM, Statistics.HECErrors )
+};
+static DML_PARAM_TABLE g_AtmLinkStatsParamTable = DML_PARAM_TABLE_INIT( g_AtmLinkStatsParamEntries );
+
+/**********************************************************************
+
+    caller:     COSA_Init
+
+    prototype:
+
+        ANSC_STATUS
+        XtmDmlInitParamTables
+            (
+                VOID
+            );
+
+    description:
+
+        This function builds the hashed parameter name lookup of the
+        PTM and ATM link statistics getter tables. Must run before the getters are
+        registered.
+
+    argument:   None
+
+    return:     ANSC_STATUS_SUCCESS always, a table whose hash could not
+                be built falls back to a linear name scan.
+
+**********************************************************************/
+ANSC_STATUS
+XtmDmlInitParamTables
+    (
+        VOID
+    )
+{
+    DmlParamTableInit( &g_PtmLinkStatsParamTable );
+    DmlParamTableInit( &g_AtmLinkStatsParamTable );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
 #define _PSM_WRITE_PARAM(_PARAM_NAME) { \
     _ansc_sprintf(param_name, _PARAM_NAME); \
-    retPsmSet = PSM_Set_Record_Value2(bus_handle,g_Subsystem, param_name, ccsp_string, param_value); \
+    retPsmSet = XdslPsmCacheSet(param_name, param_value); \
     if (retPsmSet != CCSP_SUCCESS) { \
         AnscTraceFlow(("%s Error %d writing %s %s\n", __FUNCTION__, retPsmSet, param_name, param_value));\
     } \
@@ -600,6 +684,8 @@ BOOL PTMLink_SetParamBoolValue ( ANSC_HANDLE hInsContext, char* ParamName, BOOL
     {
         /* save update to backup */
         p_Ptm->Enable  = bValue;
+        /* the link is re-created, do not serve the old counters */
+        p_Ptm->StatsValid = FALSE;
         return TRUE;
     }
 
@@ -800,98 +886,7 @@ BOOL PTMLinkStats_GetParamUlongValue ( ANSC_HANDLE hInsContext, char* ParamName,
     DmlGetPtmIfStatistics( NULL, p_Ptm );
 
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "BytesSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.BytesSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "BytesReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.BytesReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "PacketsSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.PacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "PacketsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.PacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ErrorsSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.ErrorsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ErrorsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.ErrorsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UnicastPacketsSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.UnicastPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UnicastPacketsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.UnicastPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DiscardPacketsSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.DiscardPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DiscardPacketsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.DiscardPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "MulticastPacketsSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.MulticastPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "MulticastPacketsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.MulticastPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "BroadcastPacketsSent", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.BroadcastPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "BroadcastPacketsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.BroadcastPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UnknownProtoPacketsReceived", TRUE) )
-    {
-        *puLong = p_Ptm->Statistics.UnknownProtoPacketsReceived;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return DmlParamTableGetUlong( &g_PtmLinkStatsParamTable, p_Ptm, ParamName, puLong );
 }
 
 /**********************************************************************
@@ -1165,7 +1160,7 @@ ANSC_HANDLE ATMLink_AddEntry ( ANSC_HANDLE hInsContext, ULONG* pInsNumber )
     INT                             ret_val           = ANSC_STATUS_SUCCESS;
     INT                             retPsmGet         = CCSP_SUCCESS;
     CHAR                            param_name[256]   = {0};
-    CHAR                            *param_value      = NULL;
+    CHAR                            param_value[256]  = {0};
 
     p_Atm = (PDML_ATM)AnscAllocateMemory(sizeof(DML_ATM));
 
@@ -1197,8 +1192,8 @@ ANSC_HANDLE ATMLink_AddEntry ( ANSC_HANDLE hInsContext, ULONG* pInsNumber )
 
     /* Get ADSL Linktype */
     _ansc_sprintf(param_name, PSM_ADSL_LINKTYPE);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         if (strcmp(param_value, "EoA") == 0)
         {
@@ -1224,8 +1219,8 @@ ANSC_HANDLE ATMLink_AddEntry ( ANSC_HANDLE hInsContext, ULONG* pInsNumber )
 
     /* Get ADSL Encapsulation */
     _ansc_sprintf(param_name, PSM_ADSL_ENCAPSULATION);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         if (strcmp(param_value, "LLC") == 0)
         {
@@ -1240,24 +1235,24 @@ ANSC_HANDLE ATMLink_AddEntry ( ANSC_HANDLE hInsContext, ULONG* pInsNumber )
     /* Get ADSL Autoconfig */
     memset(param_name, 0, sizeof(param_name));
     _ansc_sprintf(param_name, PSM_ADSL_AUTOCONFIG);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         p_Atm->AutoConfig = atoi(param_value);
     }
 
     /* Get ADSL PVC */
     _ansc_sprintf(param_name, PSM_ADSL_PVC);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         strcpy(p_Atm->DestinationAddress, param_value);
     }
 
     /* Get ADSL AAL */
     _ansc_sprintf(param_name, PSM_ADSL_AAL);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         if (strcmp(param_value, "AAL1") == 0)
         {
@@ -1283,24 +1278,24 @@ ANSC_HANDLE ATMLink_AddEntry ( ANSC_HANDLE hInsContext, ULONG* pInsNumber )
 
     /* Get ADSL FCSPreserved */
     _ansc_sprintf(param_name, PSM_ADSL_FCSPRESERVED);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         p_Atm->FCSPreserved = atoi(param_value);
     }
 
     /* Get ADSL VCSearchList */
     _ansc_sprintf(param_name, PSM_ADSL_VCSEARCHLIST);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         strcpy(p_Atm->VCSearchList, param_value);
     }
 
     /* Get ADSL QOS Class */
     _ansc_sprintf(param_name, PSM_ADSL_QOS_CLASS);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         if (strcmp(param_value, "UBR") == 0)
         {
@@ -1334,33 +1329,28 @@ ANSC_HANDLE ATMLink_AddEntry ( ANSC_HANDLE hInsContext, ULONG* pInsNumber )
 
     /* Get ADSL QOS Peak cell rate */
     _ansc_sprintf(param_name, PSM_ADSL_QOS_PEAKCELLRATE);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         p_Atm->Qos.PeakCellRate = atoi(param_value);
     }
 
     /* Get ADSL QOS Max. burst rate */
     _ansc_sprintf(param_name, PSM_ADSL_QOS_MAXBURSTSIZE);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         p_Atm->Qos.MaximumBurstSize = atoi(param_value);
     }
 
     /* Get ADSL QOS cell rate */
     _ansc_sprintf(param_name, PSM_ADSL_QOS_CELLRATE);
-    retPsmGet = PSM_Get_Record_Value2(bus_handle, g_Subsystem, param_name, NULL, &param_value);
-    if (retPsmGet == CCSP_SUCCESS && param_value != NULL)
+    retPsmGet = XdslPsmCacheGet(param_name, param_value, sizeof(param_value));
+    if (retPsmGet == CCSP_SUCCESS)
     {
         p_Atm->Qos.SustainableCellRate = atoi(param_value);
     }
 
-    if(param_value != NULL)
-    {
-        ((CCSP_MESSAGE_BUS_INFO *)bus_handle)->freefunc(param_value);
-    }
-
     SListPushEntryByInsNum(&pATM->Q_AtmList, (PCONTEXT_LINK_OBJECT)pAtmCxtLink);
    
     return (ANSC_HANDLE)pAtmCxtLink;
@@ -1688,6 +1678,8 @@ BOOL ATMLink_SetParamBoolValue ( ANSC_HANDLE hInsContext, char* ParamName, BOOL
     {
         /* save update to backup */
         p_Atm->Enable  = bValue;
+        /* the link is re-created, do not serve the old counters */
+        p_Atm->StatsValid = FALSE;
         return TRUE;
     }
     if( AnscEqualString(ParamName, "FCSPreserved", TRUE))
@@ -1932,122 +1924,7 @@ BOOL ATMLinkStats_GetParamUlongValue  ( ANSC_HANDLE hInsContext, char* ParamName
     DmlGetAtmIfStatistics( NULL, p_Atm );
 
     /* check the parameter name and return the corresponding value */
-    if( AnscEqualString(ParamName, "BytesSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.BytesSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "BytesReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.BytesReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "PacketsSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.PacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "PacketsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.PacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ErrorsSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.ErrorsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ErrorsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.ErrorsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UnicastPacketsSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.UnicastPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UnicastPacketsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.UnicastPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DiscardPacketsSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.DiscardPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "DiscardPacketsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.DiscardPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "MulticastPacketsSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.MulticastPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "MulticastPacketsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.MulticastPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "BroadcastPacketsSent", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.BroadcastPacketsSent;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "BroadcastPacketsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.BroadcastPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "UnknownProtoPacketsReceived", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.UnknownProtoPacketsReceived;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "TransmittedBlocks", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.TransmittedBlocks;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "ReceivedBlocks", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.ReceivedBlocks;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "CRCErrors", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.CRCErrors;
-        return TRUE;
-    }
-
-    if( AnscEqualString(ParamName, "HECErrors", TRUE) )
-    {
-        *puLong = p_Atm->Statistics.HECErrors;
-        return TRUE;
-    }
-
-    /* CcspTraceWarning(("Unsupported parameter '%s'\n", ParamName)); */
-    return FALSE;
+    return DmlParamTableGetUlong( &g_AtmLinkStatsParamTable, p_Atm, ParamName, puLong );
 }
 
 /**********************************************************************
@@ -2133,6 +2010,9 @@ ULONG ATMLink_Commit ( ANSC_HANDLE hInsContext )
         }
     }
 
+    //Write the PSM records changed by the set calls in one go
+    XdslPsmCacheFlush();
+
     return returnStatus;
 }
 
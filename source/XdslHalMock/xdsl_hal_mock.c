@@ -0,0 +1,874 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_hal_mock.c
+
+        Stand-in xDSL JSON HAL server for running the manager without
+        vendor hardware.
+
+    ---------------------------------------------------------------
+
+    description:
+
+        The parameter table is built from xdsl_hal_schema.json: every
+        leaf definition of the schema is instantiated for instance 1
+        with a type default value, then overlaid with the values of the
+        selected line profile. getParameters, setParameters and
+        subscribeEvent are answered from that table, and a per-profile
+        script drives Device.DSL.Line.1.LinkStatus (training, up, down)
+        and publishes the matching link events.
+
+        Latency and error injection are configurable on the command
+        line so that the DML, state machine, report and XTM paths can
+        be load tested on a plain Linux host.
+
+    ---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <regex.h>
+#include <pthread.h>
+#include <time.h>
+#include <json-c/json.h>
+#include "json_hal_common.h"
+#include "json_hal_server.h"
+
+#define MOCK_DEFAULT_CONF_PATH      "/etc/rdk/conf/xdsl_manager_conf.json"
+#define MOCK_DEFAULT_PROFILE_PATH   "/etc/rdk/conf/xdsl_hal_mock_profiles.json"
+#define MOCK_DEFAULT_PROFILE        "vdsl_17a"
+
+#define MOCK_LINE_LINKSTATUS        "Device.DSL.Line.1.LinkStatus"
+#define MOCK_LINE_STATUS            "Device.DSL.Line.1.Status"
+#define MOCK_LINE_ENABLE            "Device.DSL.Line.1.Enable"
+#define MOCK_LINE_LASTCHANGE        "Device.DSL.Line.1.LastChange"
+#define MOCK_LINE_SHOWTIME_START    "Device.DSL.Line.1.Stats.ShowtimeStart"
+
+#define MOCK_MAX_PARAMS             1024
+#define MOCK_MAX_SCRIPT_STEPS       32
+#define MOCK_MAX_NOISE_PARAMS       32
+#define MOCK_PARAM_NAME_LEN         256
+#define MOCK_PARAM_VALUE_LEN        1024
+
+#define MOCK_LOG(fmt, ...)  fprintf(stdout, "[xdsl_hal_mock] " fmt, ##__VA_ARGS__)
+#define MOCK_ERR(fmt, ...)  fprintf(stderr, "[xdsl_hal_mock] " fmt, ##__VA_ARGS__)
+
+typedef struct _MOCK_PARAM
+{
+    char        name[MOCK_PARAM_NAME_LEN];
+    eParamType  type;
+    char        value[MOCK_PARAM_VALUE_LEN];
+} MOCK_PARAM;
+
+typedef struct _MOCK_SCHEMA_RULE
+{
+    regex_t     regex;
+    eParamType  type;
+} MOCK_SCHEMA_RULE;
+
+typedef struct _MOCK_SCRIPT_STEP
+{
+    char        state[16];      //training, up, down
+    int         hold;           //seconds, 0 = stay in this state
+} MOCK_SCRIPT_STEP;
+
+typedef struct _MOCK_NOISE
+{
+    char        name[MOCK_PARAM_NAME_LEN];
+    long        step;           //per-second increment (counters) or amplitude (levels)
+    int         isCounter;
+    long        base;
+} MOCK_NOISE;
+
+typedef struct _MOCK_CONFIG
+{
+    char        confPath[256];
+    char        profilePath[256];
+    char        profileName[64];
+    char        schemaPath[256];
+    int         latencyMs;
+    int         jitterMs;
+    int         errorPercent;
+} MOCK_CONFIG;
+
+static MOCK_CONFIG          gMockCfg;
+static MOCK_PARAM           gParams[MOCK_MAX_PARAMS];
+static int                  gParamCount = 0;
+static MOCK_SCHEMA_RULE     gRules[MOCK_MAX_PARAMS];
+static int                  gRuleCount = 0;
+static MOCK_SCRIPT_STEP     gScript[MOCK_MAX_SCRIPT_STEPS];
+static int                  gScriptSteps = 0;
+static int                  gScriptRepeat = 0;
+static MOCK_NOISE           gNoise[MOCK_MAX_NOISE_PARAMS];
+static int                  gNoiseCount = 0;
+static int                  gRestartScript = 0;     //guarded by gParamMutex
+static volatile sig_atomic_t gRunning = 1;
+static pthread_mutex_t      gParamMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* mock_type_from_string() */
+static eParamType mock_type_from_string(const char *type)
+{
+    if (strcmp(type, "boolean") == 0)      return PARAM_BOOLEAN;
+    if (strcmp(type, "int") == 0)          return PARAM_INTEGER;
+    if (strcmp(type, "unsignedInt") == 0)  return PARAM_UNSIGNED_INTEGER;
+    if (strcmp(type, "unsignedLong") == 0) return PARAM_UNSIGNED_LONG;
+    if (strcmp(type, "hexBinary") == 0)    return PARAM_HEXBINARY;
+
+    return PARAM_STRING;
+}
+
+/* mock_default_value() */
+static const char *mock_default_value(eParamType type)
+{
+    switch (type)
+    {
+        case PARAM_BOOLEAN:
+            return "false";
+        case PARAM_INTEGER:
+        case PARAM_UNSIGNED_INTEGER:
+        case PARAM_UNSIGNED_LONG:
+            return "0";
+        default:
+            return "";
+    }
+}
+
+/* mock_find_param() */
+static MOCK_PARAM *mock_find_param(const char *name)
+{
+    for (int i = 0; i < gParamCount; i++)
+    {
+        if (strcmp(gParams[i].name, name) == 0)
+        {
+            return &gParams[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* mock_store_param() */
+static MOCK_PARAM *mock_store_param(const char *name, eParamType type, const char *value)
+{
+    MOCK_PARAM *pParam = mock_find_param(name);
+
+    if (pParam == NULL)
+    {
+        if (gParamCount >= MOCK_MAX_PARAMS)
+        {
+            MOCK_ERR("parameter table full, dropping %s\n", name);
+            return NULL;
+        }
+        pParam = &gParams[gParamCount++];
+        snprintf(pParam->name, sizeof(pParam->name), "%s", name);
+        pParam->type = type;
+    }
+
+    snprintf(pParam->value, sizeof(pParam->value), "%s", value);
+    return pParam;
+}
+
+/* mock_schema_type_of() */
+static int mock_schema_type_of(const char *name, eParamType *type)
+{
+    for (int i = 0; i < gRuleCount; i++)
+    {
+        if (regexec(&gRules[i].regex, name, 0, NULL, 0) == 0)
+        {
+            *type = gRules[i].type;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Turns a schema pattern such as ^Device\.DSL\.Line\.\d+\.Enable$ into a
+ * POSIX extended regex, and into the concrete instance-1 name when the
+ * pattern has no other wildcard than the instance number.
+ */
+static int mock_translate_pattern(const char *pattern, char *regex, int regexLen, char *instance, int instanceLen)
+{
+    int r = 0, n = 0, concrete = 1;
+
+    for (const char *p = pattern; *p != '\0' && r < regexLen - 8 && n < instanceLen - 2; p++)
+    {
+        if (strncmp(p, "\\d+", 3) == 0)
+        {
+            r += snprintf(regex + r, regexLen - r, "[0-9]+");
+            instance[n++] = '1';
+            p += 2;
+        }
+        else if (p[0] == '\\' && p[1] != '\0')
+        {
+            regex[r++] = p[0];
+            regex[r++] = p[1];
+            instance[n++] = p[1];
+            p++;
+        }
+        else if (*p == '^' || *p == '$')
+        {
+            regex[r++] = *p;
+        }
+        else
+        {
+            if (strchr("()[]|*+?{}", *p) != NULL)
+            {
+                concrete = 0;
+            }
+            regex[r++] = *p;
+            instance[n++] = *p;
+        }
+    }
+    regex[r] = '\0';
+    instance[n] = '\0';
+
+    return concrete;
+}
+
+/**
+ * Seeds one default parameter per branch of a (A|B) group, e.g.
+ * ^Device\.DSL\.(Line|Channel)\.\d+\.Stats\.ShowtimeStart$
+ */
+static void mock_seed_alternatives(const char *pattern, eParamType type)
+{
+    const char *open = strchr(pattern, '(');
+    const char *close = open ? strchr(open, ')') : NULL;
+    const char *branch = open ? open + 1 : NULL;
+
+    if (open == NULL || close == NULL)
+    {
+        return;
+    }
+
+    while (branch != NULL && branch < close)
+    {
+        const char *end = memchr(branch, '|', close - branch);
+        char expanded[512] = {0};
+        char regex[512] = {0};
+        char instance[MOCK_PARAM_NAME_LEN] = {0};
+
+        if (end == NULL)
+        {
+            end = close;
+        }
+
+        snprintf(expanded, sizeof(expanded), "%.*s%.*s%s",
+                 (int)(open - pattern), pattern, (int)(end - branch), branch, close + 1);
+
+        if (mock_translate_pattern(expanded, regex, sizeof(regex), instance, sizeof(instance)))
+        {
+            mock_store_param(instance, type, mock_default_value(type));
+        }
+        else
+        {
+            mock_seed_alternatives(expanded, type);
+        }
+
+        branch = (end < close) ? end + 1 : NULL;
+    }
+}
+
+/* mock_load_schema() */
+static int mock_load_schema(const char *path)
+{
+    json_object *jschema = json_object_from_file(path);
+    json_object *jdefs = NULL;
+
+    if (jschema == NULL)
+    {
+        MOCK_ERR("unable to parse schema %s\n", path);
+        return -1;
+    }
+
+    if (!json_object_object_get_ex(jschema, "definitions", &jdefs))
+    {
+        MOCK_ERR("schema %s has no definitions\n", path);
+        json_object_put(jschema);
+        return -1;
+    }
+
+    json_object_object_foreach(jdefs, key, jdef)
+    {
+        json_object *jprops = NULL, *jname = NULL, *jtype = NULL, *jpattern = NULL, *jconst = NULL;
+        char regex[512] = {0};
+        char instance[MOCK_PARAM_NAME_LEN] = {0};
+        eParamType type = PARAM_STRING;
+
+        (void)key;
+        if (!json_object_object_get_ex(jdef, "properties", &jprops) ||
+            !json_object_object_get_ex(jprops, "name", &jname) ||
+            !json_object_object_get_ex(jname, "pattern", &jpattern))
+        {
+            continue;
+        }
+
+        //Object names (no type) are only used for subtree queries
+        if (!json_object_object_get_ex(jprops, "type", &jtype) ||
+            !json_object_object_get_ex(jtype, "const", &jconst))
+        {
+            continue;
+        }
+
+        if (gRuleCount >= MOCK_MAX_PARAMS)
+        {
+            break;
+        }
+
+        type = mock_type_from_string(json_object_get_string(jconst));
+        int concrete = mock_translate_pattern(json_object_get_string(jpattern), regex, sizeof(regex), instance, sizeof(instance));
+        if (regcomp(&gRules[gRuleCount].regex, regex, REG_EXTENDED | REG_NOSUB) != 0)
+        {
+            MOCK_ERR("skipping unsupported schema pattern %s\n", json_object_get_string(jpattern));
+            continue;
+        }
+        gRules[gRuleCount++].type = type;
+
+        if (concrete)
+        {
+            mock_store_param(instance, type, mock_default_value(type));
+        }
+        else
+        {
+            mock_seed_alternatives(json_object_get_string(jpattern), type);
+        }
+    }
+
+    json_object_put(jschema);
+    MOCK_LOG("schema %s: %d rules, %d default parameters\n", path, gRuleCount, gParamCount);
+    return 0;
+}
+
+/* mock_load_profile() */
+static int mock_load_profile(const char *path, const char *profile)
+{
+    json_object *jfile = json_object_from_file(path);
+    json_object *jprofiles = NULL, *jprofile = NULL, *jobj = NULL;
+
+    if (jfile == NULL ||
+        !json_object_object_get_ex(jfile, "profiles", &jprofiles) ||
+        !json_object_object_get_ex(jprofiles, profile, &jprofile))
+    {
+        MOCK_ERR("profile %s not found in %s\n", profile, path);
+        if (jfile)
+        {
+            json_object_put(jfile);
+        }
+        return -1;
+    }
+
+    if (json_object_object_get_ex(jprofile, "params", &jobj))
+    {
+        json_object_object_foreach(jobj, name, jval)
+        {
+            eParamType type = PARAM_STRING;
+
+            if (mock_schema_type_of(name, &type) != 0)
+            {
+                MOCK_ERR("profile parameter %s is not in the schema, serving it as string\n", name);
+            }
+            mock_store_param(name, type, json_object_get_string(jval));
+        }
+    }
+
+    if (json_object_object_get_ex(jprofile, "script", &jobj))
+    {
+        for (size_t i = 0; i < json_object_array_length(jobj) && gScriptSteps < MOCK_MAX_SCRIPT_STEPS; i++)
+        {
+            json_object *jstep = json_object_array_get_idx(jobj, i);
+            json_object *jstate = NULL, *jhold = NULL;
+
+            if (json_object_object_get_ex(jstep, "state", &jstate))
+            {
+                snprintf(gScript[gScriptSteps].state, sizeof(gScript[gScriptSteps].state), "%s", json_object_get_string(jstate));
+                gScript[gScriptSteps].hold = json_object_object_get_ex(jstep, "hold", &jhold) ? json_object_get_int(jhold) : 0;
+                gScriptSteps++;
+            }
+        }
+    }
+
+    if (json_object_object_get_ex(jprofile, "repeat", &jobj))
+    {
+        gScriptRepeat = json_object_get_boolean(jobj);
+    }
+
+    if (json_object_object_get_ex(jprofile, "counters", &jobj))
+    {
+        json_object_object_foreach(jobj, name, jval)
+        {
+            if (gNoiseCount < MOCK_MAX_NOISE_PARAMS)
+            {
+                snprintf(gNoise[gNoiseCount].name, sizeof(gNoise[gNoiseCount].name), "%s", name);
+                gNoise[gNoiseCount].step = json_object_get_int64(jval);
+                gNoise[gNoiseCount].isCounter = 1;
+                gNoiseCount++;
+            }
+        }
+    }
+
+    if (json_object_object_get_ex(jprofile, "jitter", &jobj))
+    {
+        json_object_object_foreach(jobj, name, jval)
+        {
+            MOCK_PARAM *pParam = mock_find_param(name);
+
+            if (gNoiseCount < MOCK_MAX_NOISE_PARAMS)
+            {
+                snprintf(gNoise[gNoiseCount].name, sizeof(gNoise[gNoiseCount].name), "%s", name);
+                gNoise[gNoiseCount].step = json_object_get_int64(jval);
+                gNoise[gNoiseCount].isCounter = 0;
+                gNoise[gNoiseCount].base = pParam ? atol(pParam->value) : 0;
+                gNoiseCount++;
+            }
+        }
+    }
+
+    if (json_object_object_get_ex(jprofile, "latency_ms", &jobj) && gMockCfg.latencyMs == 0)
+    {
+        gMockCfg.latencyMs = json_object_get_int(jobj);
+    }
+
+    json_object_put(jfile);
+    MOCK_LOG("profile %s: %d script steps%s, %d noise sources\n", profile, gScriptSteps, gScriptRepeat ? " (repeating)" : "", gNoiseCount);
+    return 0;
+}
+
+/* mock_inject_latency() */
+static int mock_inject_latency(void)
+{
+    long delayMs = gMockCfg.latencyMs;
+
+    if (gMockCfg.jitterMs > 0)
+    {
+        delayMs += rand() % (gMockCfg.jitterMs + 1);
+    }
+
+    if (delayMs > 0)
+    {
+        usleep(delayMs * 1000);
+    }
+
+    //Non zero means this request must fail
+    return (gMockCfg.errorPercent > 0) && ((rand() % 100) < gMockCfg.errorPercent);
+}
+
+/* mock_add_reply_param() */
+static void mock_add_reply_param(json_object *jreply, const MOCK_PARAM *pParam)
+{
+    hal_param_t resp;
+
+    memset(&resp, 0, sizeof(resp));
+    snprintf(resp.name, sizeof(resp.name), "%s", pParam->name);
+    snprintf(resp.value, sizeof(resp.value), "%s", pParam->value);
+    resp.type = pParam->type;
+    json_hal_add_param(jreply, GET_RESPONSE_MESSAGE, &resp);
+}
+
+/* mock_getParameters() */
+static int mock_getParameters(const json_object *jmsg, int param_count, json_object *jreply)
+{
+    hal_param_t req;
+
+    if (mock_inject_latency())
+    {
+        json_hal_add_result_status(jreply, RESULT_FAILURE);
+        return RETURN_OK;
+    }
+
+    pthread_mutex_lock(&gParamMutex);
+    for (int i = 0; i < param_count; i++)
+    {
+        memset(&req, 0, sizeof(req));
+        if (json_hal_get_param((json_object *)jmsg, i, GET_REQUEST_MESSAGE, &req) != RETURN_OK)
+        {
+            continue;
+        }
+
+        size_t len = strlen(req.name);
+        if (len > 0 && req.name[len - 1] == '.')
+        {
+            //Partial path, return the whole subtree
+            for (int j = 0; j < gParamCount; j++)
+            {
+                if (strncmp(gParams[j].name, req.name, len) == 0)
+                {
+                    mock_add_reply_param(jreply, &gParams[j]);
+                }
+            }
+        }
+        else
+        {
+            MOCK_PARAM *pParam = mock_find_param(req.name);
+            if (pParam != NULL)
+            {
+                mock_add_reply_param(jreply, pParam);
+            }
+            else
+            {
+                MOCK_ERR("getParameters: unknown parameter %s\n", req.name);
+            }
+        }
+    }
+    pthread_mutex_unlock(&gParamMutex);
+
+    return RETURN_OK;
+}
+
+/* mock_setParameters() */
+static int mock_setParameters(const json_object *jmsg, int param_count, json_object *jreply)
+{
+    hal_param_t req;
+    eResultStatus status = RESULT_SUCCESS;
+
+    if (mock_inject_latency())
+    {
+        json_hal_add_result_status(jreply, RESULT_FAILURE);
+        return RETURN_OK;
+    }
+
+    pthread_mutex_lock(&gParamMutex);
+    for (int i = 0; i < param_count; i++)
+    {
+        eParamType type = PARAM_STRING;
+
+        memset(&req, 0, sizeof(req));
+        if (json_hal_get_param((json_object *)jmsg, i, SET_REQUEST_MESSAGE, &req) != RETURN_OK)
+        {
+            status = RESULT_FAILURE;
+            continue;
+        }
+
+        if (mock_schema_type_of(req.name, &type) != 0)
+        {
+            MOCK_ERR("setParameters: %s is not a schema parameter\n", req.name);
+            status = RESULT_FAILURE;
+            continue;
+        }
+
+        mock_store_param(req.name, type, req.value);
+
+        //Re-enabling the line retrains it
+        if ((strcmp(req.name, MOCK_LINE_ENABLE) == 0) && (strcmp(req.value, "true") == 0))
+        {
+            gRestartScript = 1;
+        }
+    }
+    pthread_mutex_unlock(&gParamMutex);
+
+    json_hal_add_result_status(jreply, status);
+    return RETURN_OK;
+}
+
+/* mock_subscribeEvent() */
+static int mock_subscribeEvent(const json_object *jmsg, int param_count, json_object *jreply)
+{
+    hal_param_t req;
+
+    for (int i = 0; i < param_count; i++)
+    {
+        memset(&req, 0, sizeof(req));
+        if (json_hal_get_param((json_object *)jmsg, i, GET_REQUEST_MESSAGE, &req) == RETURN_OK)
+        {
+            MOCK_LOG("subscription for %s\n", req.name);
+        }
+    }
+
+    json_hal_add_result_status(jreply, RESULT_SUCCESS);
+    return RETURN_OK;
+}
+
+/* mock_set_link_state() */
+static void mock_set_link_state(const char *state)
+{
+    const char *linkStatus = "NoSignal";
+    const char *status = "Down";
+
+    if (strcmp(state, "up") == 0)
+    {
+        linkStatus = "Up";
+        status = "Up";
+    }
+    else if (strcmp(state, "training") == 0)
+    {
+        linkStatus = "Initializing";
+    }
+
+    pthread_mutex_lock(&gParamMutex);
+    mock_store_param(MOCK_LINE_LINKSTATUS, PARAM_STRING, linkStatus);
+    mock_store_param(MOCK_LINE_STATUS, PARAM_STRING, status);
+    mock_store_param(MOCK_LINE_LASTCHANGE, PARAM_UNSIGNED_INTEGER, "0");
+    if (strcmp(state, "up") == 0)
+    {
+        mock_store_param(MOCK_LINE_SHOWTIME_START, PARAM_UNSIGNED_INTEGER, "0");
+    }
+    pthread_mutex_unlock(&gParamMutex);
+
+    MOCK_LOG("link %s\n", state);
+    json_hal_server_publish_event(MOCK_LINE_LINKSTATUS, state);
+}
+
+/* mock_apply_noise() */
+static void mock_apply_noise(int elapsed)
+{
+    char value[32];
+
+    pthread_mutex_lock(&gParamMutex);
+    for (int i = 0; i < gNoiseCount; i++)
+    {
+        MOCK_PARAM *pParam = mock_find_param(gNoise[i].name);
+        long newValue;
+
+        if (pParam == NULL || gNoise[i].step <= 0)
+        {
+            continue;
+        }
+
+        if (gNoise[i].isCounter)
+        {
+            newValue = atol(pParam->value) + (rand() % (gNoise[i].step + 1));
+        }
+        else
+        {
+            newValue = gNoise[i].base + (rand() % (2 * gNoise[i].step + 1)) - gNoise[i].step;
+        }
+        snprintf(value, sizeof(value), "%ld", newValue);
+        snprintf(pParam->value, sizeof(pParam->value), "%s", value);
+    }
+
+    //Keep the elapsed time counters moving
+    MOCK_PARAM *pLastChange = mock_find_param(MOCK_LINE_LASTCHANGE);
+    if (pLastChange != NULL)
+    {
+        snprintf(pLastChange->value, sizeof(pLastChange->value), "%d", elapsed);
+    }
+    MOCK_PARAM *pShowtime = mock_find_param(MOCK_LINE_SHOWTIME_START);
+    MOCK_PARAM *pLinkStatus = mock_find_param(MOCK_LINE_LINKSTATUS);
+    if (pShowtime != NULL && pLinkStatus != NULL && strcmp(pLinkStatus->value, "Up") == 0)
+    {
+        snprintf(pShowtime->value, sizeof(pShowtime->value), "%d", elapsed);
+    }
+    pthread_mutex_unlock(&gParamMutex);
+}
+
+/* mock_take_restart() */
+static int mock_take_restart(void)
+{
+    int restart;
+
+    pthread_mutex_lock(&gParamMutex);
+    restart = gRestartScript;
+    gRestartScript = 0;
+    pthread_mutex_unlock(&gParamMutex);
+
+    return restart;
+}
+
+/* mock_line_script_thread() */
+static void *mock_line_script_thread(void *arg)
+{
+    int step = 0;
+    int remaining = 0;
+    int elapsed = 0;
+
+    (void)arg;
+    pthread_detach(pthread_self());
+
+    if (gScriptSteps == 0)
+    {
+        //No script means a line that trains once and stays up
+        snprintf(gScript[0].state, sizeof(gScript[0].state), "%s", "training");
+        gScript[0].hold = 3;
+        snprintf(gScript[1].state, sizeof(gScript[1].state), "%s", "up");
+        gScript[1].hold = 0;
+        gScriptSteps = 2;
+    }
+
+    mock_set_link_state(gScript[0].state);
+    remaining = gScript[0].hold;
+
+    while (gRunning)
+    {
+        sleep(1);
+        elapsed++;
+
+        if (mock_take_restart())
+        {
+            step = 0;
+            elapsed = 0;
+            mock_set_link_state(gScript[step].state);
+            remaining = gScript[step].hold;
+            continue;
+        }
+
+        mock_apply_noise(elapsed);
+
+        if (remaining > 0 && --remaining == 0)
+        {
+            step++;
+            if (step >= gScriptSteps)
+            {
+                if (!gScriptRepeat)
+                {
+                    step = gScriptSteps - 1;
+                    continue;
+                }
+                step = 0;
+            }
+            elapsed = 0;
+            mock_set_link_state(gScript[step].state);
+            remaining = gScript[step].hold;
+        }
+    }
+
+    return NULL;
+}
+
+/* mock_read_schema_path() */
+static int mock_read_schema_path(const char *confPath, char *schemaPath, int len)
+{
+    json_object *jconf = json_object_from_file(confPath);
+    json_object *jpath = NULL;
+
+    if (jconf == NULL)
+    {
+        return -1;
+    }
+
+    if (json_object_object_get_ex(jconf, "hal_schema_path", &jpath))
+    {
+        snprintf(schemaPath, len, "%s", json_object_get_string(jpath));
+    }
+    json_object_put(jconf);
+
+    return (schemaPath[0] != '\0') ? 0 : -1;
+}
+
+/* mock_signal_handler() */
+static void mock_signal_handler(int sig)
+{
+    (void)sig;
+    gRunning = 0;
+}
+
+/* mock_usage() */
+static void mock_usage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -c <file>     JSON HAL server configuration (default %s)\n"
+            "  -s <file>     HAL schema, overrides hal_schema_path of the configuration\n"
+            "  -f <file>     line profile file (default %s)\n"
+            "  -p <profile>  line profile to emulate (default %s)\n"
+            "  -l <ms>       latency added to every request\n"
+            "  -j <ms>       random extra latency, 0..ms\n"
+            "  -e <percent>  share of requests answered with a failure\n",
+            prog, MOCK_DEFAULT_CONF_PATH, MOCK_DEFAULT_PROFILE_PATH, MOCK_DEFAULT_PROFILE);
+}
+
+int main(int argc, char *argv[])
+{
+    pthread_t scriptThread;
+    int opt;
+
+    memset(&gMockCfg, 0, sizeof(gMockCfg));
+    snprintf(gMockCfg.confPath, sizeof(gMockCfg.confPath), "%s", MOCK_DEFAULT_CONF_PATH);
+    snprintf(gMockCfg.profilePath, sizeof(gMockCfg.profilePath), "%s", MOCK_DEFAULT_PROFILE_PATH);
+    snprintf(gMockCfg.profileName, sizeof(gMockCfg.profileName), "%s", MOCK_DEFAULT_PROFILE);
+
+    while ((opt = getopt(argc, argv, "c:s:f:p:l:j:e:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': snprintf(gMockCfg.confPath, sizeof(gMockCfg.confPath), "%s", optarg); break;
+            case 's': snprintf(gMockCfg.schemaPath, sizeof(gMockCfg.schemaPath), "%s", optarg); break;
+            case 'f': snprintf(gMockCfg.profilePath, sizeof(gMockCfg.profilePath), "%s", optarg); break;
+            case 'p': snprintf(gMockCfg.profileName, sizeof(gMockCfg.profileName), "%s", optarg); break;
+            case 'l': gMockCfg.latencyMs = atoi(optarg); break;
+            case 'j': gMockCfg.jitterMs = atoi(optarg); break;
+            case 'e': gMockCfg.errorPercent = atoi(optarg); break;
+            default:
+                mock_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    srand((unsigned int)time(NULL));
+
+    if (gMockCfg.schemaPath[0] == '\0' &&
+        mock_read_schema_path(gMockCfg.confPath, gMockCfg.schemaPath, sizeof(gMockCfg.schemaPath)) != 0)
+    {
+        MOCK_ERR("no hal_schema_path in %s\n", gMockCfg.confPath);
+        return 1;
+    }
+
+    if (mock_load_schema(gMockCfg.schemaPath) != 0 ||
+        mock_load_profile(gMockCfg.profilePath, gMockCfg.profileName) != 0)
+    {
+        return 1;
+    }
+
+    signal(SIGINT, mock_signal_handler);
+    signal(SIGTERM, mock_signal_handler);
+
+    if (json_hal_server_init(gMockCfg.confPath) != RETURN_OK)
+    {
+        MOCK_ERR("json_hal_server_init failed\n");
+        return 1;
+    }
+
+    json_hal_server_register_action_callback("getParameters", mock_getParameters);
+    json_hal_server_register_action_callback("setParameters", mock_setParameters);
+    json_hal_server_register_action_callback("subscribeEvent", mock_subscribeEvent);
+
+    if (json_hal_server_run() != RETURN_OK)
+    {
+        MOCK_ERR("json_hal_server_run failed\n");
+        return 1;
+    }
+
+    if (pthread_create(&scriptThread, NULL, mock_line_script_thread, NULL) != 0)
+    {
+        MOCK_ERR("unable to start the line script thread\n");
+        json_hal_server_terminate();
+        return 1;
+    }
+
+    MOCK_LOG("serving profile %s, latency %d+%dms, error rate %d%%\n",
+             gMockCfg.profileName, gMockCfg.latencyMs, gMockCfg.jitterMs, gMockCfg.errorPercent);
+
+    while (gRunning)
+    {
+        pause();
+    }
+
+    json_hal_server_terminate();
+    for (int i = 0; i < gRuleCount; i++)
+    {
+        regfree(&gRules[i].regex);
+    }
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_pm_store_test.c
+    For CCSP Component:  dsl performance monitoring store tests
+
+---------------------------------------------------------------
+
+    Description:
+
+    Fills the rings past their size and restores them from the file, as
+    after a restart, both with the ring position committed and with the
+    commit still pending on the timer. The store file is named by
+    XDSL_PM_STORE_FILE at build time, the reactor is replaced by a timer
+    that never fires unless the test asks for it.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "xdsl_pm_store.h"
+#include "xdsl_reactor.h"
+
+static int giFailures = 0;
+
+/* FALSE runs every commit straight away, as before the event loop is up */
+static BOOL gbTimerAvailable = FALSE;
+
+#define XDSL_TEST_EXPECT(cond)                                                  \
+    do                                                                          \
+    {                                                                           \
+        if( !(cond) )                                                           \
+        {                                                                       \
+            fprintf( stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #cond ); \
+            giFailures++;                                                       \
+        }                                                                       \
+    } while( 0 )
+
+INT XdslReactorAddTimer( XDSL_REACTOR_TIMER_HANDLER pHandler, PVOID pContext )
+{
+    (void)pHandler;
+    (void)pContext;
+
+    return gbTimerAvailable ? 0 : -1;
+}
+
+ANSC_STATUS XdslReactorSetTimer( INT iTimerId, ULONG ulFirstMs, ULONG ulIntervalMs )
+{
+    (void)iTimerId;
+    (void)ulFirstMs;
+    (void)ulIntervalMs;
+
+    return gbTimerAvailable ? ANSC_STATUS_SUCCESS : ANSC_STATUS_FAILURE;
+}
+
+ANSC_STATUS XdslReactorSubmit( XDSL_REACTOR_WORK_HANDLER pHandler, PVOID pContext )
+{
+    pHandler( pContext );
+
+    return ANSC_STATUS_SUCCESS;
+}
+
+static VOID XdslPmStoreTestAppend( INT LineIndex, XDSL_PM_INTERVAL interval, ULONG ulFirst, ULONG ulCount )
+{
+    DML_XDSL_PM_INTERVAL stInterval;
+    ULONG                i;
+
+    for( i = ulFirst; i < ulFirst + ulCount; i++ )
+    {
+        memset( &stInterval, 0, sizeof(stInterval) );
+        stInterval.IntervalEnd                    = i * XDSL_PM_HISTORY_QUARTER_HOUR_SECS;
+        stInterval.Elapsed                        = XDSL_PM_HISTORY_QUARTER_HOUR_SECS;
+        stInterval.stCounters.ErroredSecs         = (UINT)i;
+        XdslPmStoreAppend( LineIndex, interval, &stInterval );
+    }
+}
+
+/* The ring holds the ulSize newest of ulTotal intervals numbered from 1, newest first */
+static VOID XdslPmStoreTestExpectRing( INT LineIndex, XDSL_PM_INTERVAL interval, ULONG ulSize, ULONG ulTotal )
+{
+    static DML_XDSL_PM_INTERVAL astIntervals[XDSL_PM_HISTORY_QUARTER_HOURS + 1];
+    ULONG ulExpected = ( ulTotal < ulSize ) ? ulTotal : ulSize;
+    ULONG ulCount;
+    ULONG i;
+
+    XDSL_TEST_EXPECT( XdslPmStoreGetDepth( LineIndex, interval ) == ulTotal );
+
+    ulCount = XdslPmStoreExport( LineIndex, interval, astIntervals, XDSL_PM_HISTORY_QUARTER_HOURS + 1 );
+    XDSL_TEST_EXPECT( ulCount == ulExpected );
+
+    for( i = 0; i < ulCount; i++ )
+    {
+        if( astIntervals[i].stCounters.ErroredSecs != ulTotal - i )
+        {
+            fprintf( stderr, "line %d interval %d bin %lu holds %u, expected %lu\n",
+                     LineIndex, interval, i, astIntervals[i].stCounters.ErroredSecs, ulTotal - i );
+            giFailures++;
+            break;
+        }
+    }
+}
+
+static VOID XdslPmStoreTestWrapAround( VOID )
+{
+    INT iValue = 0;
+
+    //Nothing left from an earlier run
+    unlink( XDSL_PM_STORE_FILE );
+    gbTimerAvailable = FALSE;
+
+    XDSL_TEST_EXPECT( XdslPmStoreInit() == ANSC_STATUS_SUCCESS );
+    XdslPmStoreTestExpectRing( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOURS, 0 );
+    XDSL_TEST_EXPECT( !XdslPmStoreGetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, &iValue ) );
+
+    //Wraps the quarter hours of line 0 twice and the days of line 1 once
+    XdslPmStoreTestAppend( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, 1, 2 * XDSL_PM_HISTORY_QUARTER_HOURS + 5 );
+    XdslPmStoreTestAppend( 1, XDSL_PM_INTERVAL_DAY, 1, XDSL_PM_HISTORY_DAYS + 3 );
+    XdslPmStoreSetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, 7 );
+
+    XdslPmStoreTestExpectRing( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOURS, 2 * XDSL_PM_HISTORY_QUARTER_HOURS + 5 );
+    XdslPmStoreTestExpectRing( 0, XDSL_PM_INTERVAL_DAY, XDSL_PM_HISTORY_DAYS, 0 );
+    XdslPmStoreTestExpectRing( 1, XDSL_PM_INTERVAL_DAY, XDSL_PM_HISTORY_DAYS, XDSL_PM_HISTORY_DAYS + 3 );
+
+    //Restart
+    XDSL_TEST_EXPECT( XdslPmStoreInit() == ANSC_STATUS_SUCCESS );
+    XdslPmStoreTestExpectRing( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOURS, 2 * XDSL_PM_HISTORY_QUARTER_HOURS + 5 );
+    XdslPmStoreTestExpectRing( 1, XDSL_PM_INTERVAL_DAY, XDSL_PM_HISTORY_DAYS, XDSL_PM_HISTORY_DAYS + 3 );
+    XDSL_TEST_EXPECT( XdslPmStoreGetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, &iValue ) && iValue == 7 );
+}
+
+static VOID XdslPmStoreTestUncommitted( VOID )
+{
+    ULONG ulTotal = 2 * XDSL_PM_HISTORY_QUARTER_HOURS + 5;
+    INT   iValue  = 0;
+
+    //Commits now wait for a timer that is never fired
+    gbTimerAvailable = TRUE;
+
+    //Less than a ring past the commit is rolled forward on restart
+    XdslPmStoreTestAppend( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, ulTotal + 1, XDSL_PM_HISTORY_QUARTER_HOURS - 1 );
+    ulTotal += XDSL_PM_HISTORY_QUARTER_HOURS - 1;
+    XdslPmStoreSetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, 8 );
+
+    XDSL_TEST_EXPECT( XdslPmStoreInit() == ANSC_STATUS_SUCCESS );
+    XdslPmStoreTestExpectRing( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOURS, ulTotal );
+
+    //The counter change was not committed yet, the last commit wins
+    XDSL_TEST_EXPECT( XdslPmStoreGetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, &iValue ) && iValue == 7 );
+
+    //A commit makes both survive the next restart
+    XdslPmStoreSetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, 9 );
+    XDSL_TEST_EXPECT( XdslPmStoreFlush() == ANSC_STATUS_SUCCESS );
+    XDSL_TEST_EXPECT( XdslPmStoreInit() == ANSC_STATUS_SUCCESS );
+    XdslPmStoreTestExpectRing( 0, XDSL_PM_INTERVAL_QUARTER_HOUR, XDSL_PM_HISTORY_QUARTER_HOURS, ulTotal );
+    XDSL_TEST_EXPECT( XdslPmStoreGetCounter( 0, XDSL_PM_STORE_COUNTER_DAY_RETRAINS, &iValue ) && iValue == 9 );
+}
+
+int main( int argc, char *argv[] )
+{
+    (void)argc;
+    (void)argv;
+
+    XdslPmStoreTestWrapAround();
+    XdslPmStoreTestUncommitted();
+
+    unlink( XDSL_PM_STORE_FILE );
+
+    if( giFailures != 0 )
+    {
+        fprintf( stderr, "%d check(s) failed\n", giFailures );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * If not stated otherwise in this file or this component's Licenses.txt file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2019 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+*/
+
+/**********************************************************************
+
+    module: xdsl_shaper_test.c
+    For CCSP Component:  dsl WAN shaper rate recommendation tests
+
+---------------------------------------------------------------
+
+    Description:
+
+    Checks the ATM and PTM payload rates against values worked out by
+    hand and when a recommendation is republished.
+
+---------------------------------------------------------------
+
+**********************************************************************/
+
+#include <stdio.h>
+#include "xdsl_shaper.h"
+
+static int giFailures = 0;
+
+#define XDSL_TEST_EXPECT(cond)                                                  \
+    do                                                                          \
+    {                                                                           \
+        if( !(cond) )                                                           \
+        {                                                                       \
+            fprintf( stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #cond ); \
+            giFailures++;                                                       \
+        }                                                                       \
+    } while( 0 )
+
+static XDSL_SHAPER_CONFIG XdslShaperTestConfig( VOID )
+{
+    XDSL_SHAPER_CONFIG stConfig =
+    {
+        XDSL_SHAPER_DEFAULT_ENABLE,
+        XDSL_SHAPER_DEFAULT_PERCENT,
+        XDSL_SHAPER_DEFAULT_PACKET_SIZE,
+        XDSL_SHAPER_DEFAULT_ATM_OVERHEAD,
+        XDSL_SHAPER_DEFAULT_PTM_OVERHEAD,
+        XDSL_SHAPER_DEFAULT_CHECK_INTERVAL,
+        0,
+        0
+    };
+
+    return stConfig;
+}
+
+static VOID XdslShaperTestAtmRate( VOID )
+{
+    XDSL_SHAPER_CONFIG stConfig = XdslShaperTestConfig();
+
+    //1500 + 32 + 8 bytes take 33 cells, 1749 bytes on the line
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 8000, XDSL_SHAPER_ENCAP_ATM, &stConfig ) == 6518 );
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 24000, XDSL_SHAPER_ENCAP_ATM, &stConfig ) == 19554 );
+
+    //88 + 8 bytes fill two cells exactly, one byte more pads a third
+    stConfig.Percent     = 100;
+    stConfig.AtmOverhead = 0;
+    stConfig.PacketSize  = 88;
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 1000, XDSL_SHAPER_ENCAP_ATM, &stConfig ) == 830 );
+    stConfig.PacketSize  = 89;
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 1000, XDSL_SHAPER_ENCAP_ATM, &stConfig ) == 559 );
+}
+
+static VOID XdslShaperTestPtmRate( VOID )
+{
+    XDSL_SHAPER_CONFIG stConfig = XdslShaperTestConfig();
+
+    //1530 bytes per packet, 65 line bytes per 64 payload bytes
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 40000, XDSL_SHAPER_ENCAP_PTM, &stConfig ) == 36681 );
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 100000, XDSL_SHAPER_ENCAP_PTM, &stConfig ) == 91704 );
+
+    //No overflow at the largest sync rate a ULONG kbps value can hold on 32 bits
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 4294967, XDSL_SHAPER_ENCAP_PTM, &stConfig ) == 3938672 );
+}
+
+static VOID XdslShaperTestInvalid( VOID )
+{
+    XDSL_SHAPER_CONFIG stConfig = XdslShaperTestConfig();
+
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 8000, XDSL_SHAPER_ENCAP_NONE, &stConfig ) == 0 );
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 8000, XDSL_SHAPER_ENCAP_ATM, NULL ) == 0 );
+    XDSL_TEST_EXPECT( XdslShaperComputeRate( 0, XDSL_SHAPER_ENCAP_PTM, &stConfig ) == 0 );
+
+    stConfig.Percent = 101;
+    XDSL_TEST_EXPECT( !XdslShaperIsConfigValid( &stConfig ) );
+    XDSL_TEST_EXPECT( XdslShaperSetConfig( &stConfig ) == ANSC_STATUS_FAILURE );
+
+    stConfig = XdslShaperTestConfig();
+    stConfig.PacketSize = 63;
+    XDSL_TEST_EXPECT( !XdslShaperIsConfigValid( &stConfig ) );
+}
+
+static VOID XdslShaperTestUpdate( VOID )
+{
+    XDSL_SHAPER_CONFIG stConfig = XdslShaperTestConfig();
+    XDSL_SHAPER_RATES  stRates;
+
+    XDSL_TEST_EXPECT( XdslShaperInit( &stConfig ) == ANSC_STATUS_SUCCESS );
+
+    //First update is always published
+    XDSL_TEST_EXPECT( XdslShaperUpdate( XDSL_SHAPER_ENCAP_PTM, 40000, 100000, &stRates ) );
+    XDSL_TEST_EXPECT( stRates.EgressRate == 36681 && stRates.IngressRate == 91704 && stRates.Updates == 1 );
+
+    //A 1% SRA step is not, a 2.5% one is
+    XDSL_TEST_EXPECT( !XdslShaperUpdate( XDSL_SHAPER_ENCAP_PTM, 40400, 100000, &stRates ) );
+    XDSL_TEST_EXPECT( stRates.EgressRate == 36681 && stRates.Updates == 1 );
+    XDSL_TEST_EXPECT( XdslShaperUpdate( XDSL_SHAPER_ENCAP_PTM, 41000, 100000, &stRates ) );
+    XDSL_TEST_EXPECT( stRates.EgressRate == 37598 && stRates.Updates == 2 );
+
+    //Same rates after leaving showtime or on another transport are published again
+    XdslShaperReset();
+    XDSL_TEST_EXPECT( XdslShaperUpdate( XDSL_SHAPER_ENCAP_PTM, 41000, 100000, &stRates ) );
+    XDSL_TEST_EXPECT( XdslShaperUpdate( XDSL_SHAPER_ENCAP_ATM, 41000, 100000, &stRates ) );
+    XDSL_TEST_EXPECT( stRates.Encapsulation == XDSL_SHAPER_ENCAP_ATM && stRates.Updates == 4 );
+
+    //Nothing is published while disabled
+    stConfig.Enable = FALSE;
+    XDSL_TEST_EXPECT( XdslShaperSetConfig( &stConfig ) == ANSC_STATUS_SUCCESS );
+    XDSL_TEST_EXPECT( !XdslShaperUpdate( XDSL_SHAPER_ENCAP_PTM, 80000, 200000, &stRates ) );
+    XDSL_TEST_EXPECT( stRates.Updates == 4 );
+}
+
+int main( int argc, char *argv[] )
+{
+    (void)argc;
+    (void)argv;
+
+    XdslShaperTestAtmRate();
+    XdslShaperTestPtmRate();
+    XdslShaperTestInvalid();
+    XdslShaperTestUpdate();
+
+    if( giFailures != 0 )
+    {
+        fprintf( stderr, "%d check(s) failed\n", giFailures );
+        return 1;
+    }
+
+    return 0;
+}